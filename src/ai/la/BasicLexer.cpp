@@ -17,14 +17,13 @@
 
 using namespace Solarix;
 
-BasicLexer::BasicLexer( Solarix::Dictionary * _dict, const TextRecognitionParameters & _params, TrTrace * _trace )
- : dict(_dict), params(_params), trace(_trace), wf_end(NULL)
+BasicLexer::BasicLexer( Solarix::Dictionary * _dict, const TextRecognitionParameters & _params, TrTrace * _trace, lem::MemArena * _arena )
+ : dict(_dict), params(_params), trace(_trace), arena(_arena), wf_end(NULL)
 {
  LEM_CHECKIT_Z( !params.language_ids.empty() );
 
  begin_token=NULL;
 
- use_recognition_cache=false;
  path_count=1;
 
  return;
@@ -36,8 +35,10 @@ BasicLexer::~BasicLexer()
  for( lem::Container::size_type i=0; i<wordforms.size(); ++i )
   delete wordforms[i];
 
- for( lem::Container::size_type i=0; i<positions.size(); ++i )
-  delete positions[i];
+ //       .
+ if( arena==NULL )
+  for( lem::Container::size_type i=0; i<positions.size(); ++i )
+   delete positions[i];
 
  return;
 }
@@ -48,7 +49,6 @@ BasicLexer::~BasicLexer()
 void BasicLexer::ResetParams( const TextRecognitionParameters & _params )
 {
  params = _params;
- recognitions.clear(); //        ,    .
  edges.clear();
  end_tokens.clear();
 
@@ -67,13 +67,13 @@ const LexerTextPos * BasicLexer::GetBeginToken()
    Word_Form *wf_margin = new Word_Form( Solarix::Lexem(L"") );
    wordforms.push_back(wf_margin);
 
-   LexerTextPos_BeyondLeft * margin = new LexerTextPos_BeyondLeft(wf_margin);
+   LexerTextPos_BeyondLeft * margin = new(arena) LexerTextPos_BeyondLeft(wf_margin);
    positions.push_back(margin);
 
    Word_Form *wf = new Predef_Word_Form( dict->GetSynGram().I_BEGIN, dict->GetSynGram() );
    wordforms.push_back(wf);
 
-   LexerTextPos_Begin * t = new LexerTextPos_Begin( margin, wf );
+   LexerTextPos_Begin * t = new(arena) LexerTextPos_Begin( margin, wf );
    positions.push_back(t);
 
    margin->SetNextChained( t );
@@ -99,7 +99,7 @@ const LexerTextPos * BasicLexer::GetEndToken( const LexerTextPos * last_token )
    wordforms.push_back(wf_end);
   }
 
- LexerTextPos_End * t = new LexerTextPos_End( last_token, wf_end );
+ LexerTextPos_End * t = new(arena) LexerTextPos_End( last_token, wf_end );
  positions.push_back(t);
 
  edges.insert( std::make_pair( last_token, t ) );
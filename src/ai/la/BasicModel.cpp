@@ -256,7 +256,7 @@ void BasicModel::PullFeatures1(
 
   if( EMIT_FORMTAGS_FOR_CONTEXT && offset!=0 )
    {
-    for( int k = 0; k < f.allform_tags.size(); ++k )
+    for( lem::Container::size_type k = 0; k < f.allform_tags.size(); ++k )
     {
      b.push_back( lem::format_str("formtag[%d]=%d", offset, f.allform_tags[k] ).c_str() );
     }
@@ -264,7 +264,7 @@ void BasicModel::PullFeatures1(
 
   if( EMIT_SEMANTIC_TAGS )
   {
-   for( int k = 0; k < f.semantic_tags.size(); ++k )
+   for( lem::Container::size_type k = 0; k < f.semantic_tags.size(); ++k )
    {
     b.push_back( lem::format_str("sem[%d]=%s", offset, lem::to_utf8( f.semantic_tags[k] ).c_str() ).c_str() );
    }
@@ -311,6 +311,93 @@ void BasicModel::PullFeatures3( lem::MCollect<lem::CString> & b, const lem::PtrC
 }
 
 
+namespace {
+inline void PushFeatureId( lem::MCollect<int> & b, int id )
+{
+ if( id!=UNKNOWN )
+  b.push_back(id);
+}
+}
+
+
+//  PullFeatures1   ,   .
+void BasicModel::PullFeatureIds1(
+                                 lem::MCollect<int> & b,
+                                 const ModelFeatureIndex & index,
+                                 const lem::PtrCollect<ModelTokenFeatures> & token_features,
+                                 int ifocus,
+                                 int offset,
+                                 bool rich_set,
+                                 bool emit_Aa_feature
+                                ) const
+{
+ const int n_token = CastSizeToInt(token_features.size());
+ int iword = ifocus + offset;
+
+ if( iword >= 0 && iword < n_token )
+ {
+  const ModelTokenFeatures & f = * token_features[iword];
+
+  if( codebook->GetMaxSuffixLen() > 0 )
+   PushFeatureId( b, index.Find( ModelFeatureIndex::Suffix, offset, f.suffix_id ) );
+
+  if( emit_Aa_feature && f.Aa==true && !f.IsBegin && !f.IsEnd )
+   PushFeatureId( b, index.Find( ModelFeatureIndex::Aa, offset ) );
+
+  if( rich_set && EMIT_POS_TAGS )
+  {
+   const std::string * pos[ModelFeatureIndex::POS_COUNT] = {
+    &f.POS_N, &f.POS_A, &f.POS_V, &f.POS_IMV, &f.POS_I, &f.POS_Y, &f.POS_VY, &f.POS_PRN,
+    &f.POS_PRN2, &f.POS_C, &f.POS_D, &f.POS_P, &f.POS_PX, &f.POS_PP, &f.POS_MU };
+
+   for( int ipos=0; ipos<ModelFeatureIndex::POS_COUNT; ++ipos )
+    PushFeatureId( b, index.Find( ModelFeatureIndex::Pos, offset, ipos, ModelFeatureIndex::GetPosValue(*pos[ipos]) ) );
+  }
+
+  if( EMIT_FORMTAGS_FOR_CONTEXT && offset!=0 )
+   {
+    for( lem::Container::size_type k = 0; k < f.allform_tags.size(); ++k )
+     PushFeatureId( b, index.Find( ModelFeatureIndex::ContextFormTag, offset, f.allform_tags[k] ) );
+   }
+
+  if( EMIT_SEMANTIC_TAGS )
+  {
+   for( lem::Container::size_type k = 0; k < f.semantic_tags.size(); ++k )
+    PushFeatureId( b, index.FindSemantic( offset, f.semantic_tags[k] ) );
+  }
+ }
+
+ return;
+}
+
+
+void BasicModel::PullFeatureIds2( lem::MCollect<int> & b, const ModelFeatureIndex & index, const lem::PtrCollect<ModelTokenFeatures> & token_features, int ifocus, int offset1, int offset2 ) const
+{
+ const int n_token = CastSizeToInt(token_features.size());
+ int iword1 = ifocus + offset1;
+ int iword2 = ifocus + offset2;
+
+ if( iword1 >= 0 && iword1 < n_token && iword2 >= 0 && iword2 < n_token )
+  PushFeatureId( b, index.Find( ModelFeatureIndex::SuffixPair, ModelFeatureIndex::PackOffsets(offset1,offset2), token_features[iword1]->suffix_id, token_features[iword2]->suffix_id ) );
+
+ return;
+}
+
+
+void BasicModel::PullFeatureIds3( lem::MCollect<int> & b, const ModelFeatureIndex & index, const lem::PtrCollect<ModelTokenFeatures> & token_features, int ifocus, int offset1, int offset2, int offset3 ) const
+{
+ const int n_token = CastSizeToInt(token_features.size());
+ int iword1 = ifocus + offset1;
+ int iword2 = ifocus + offset2;
+ int iword3 = ifocus + offset3;
+
+ if( iword1 >= 0 && iword1 < n_token && iword2 >= 0 && iword2 < n_token && iword3 >= 0 && iword3 < n_token )
+  PushFeatureId( b, index.Find( ModelFeatureIndex::SuffixTriple, ModelFeatureIndex::PackOffsets(offset1,offset2,offset3), token_features[iword1]->suffix_id, token_features[iword2]->suffix_id, token_features[iword3]->suffix_id ) );
+
+ return;
+}
+
+
 void BasicModel::SetParamsAfterLoad()
 {
  EMIT_POS_TAGS = codebook->FindModelParam( L"EMIT_POS_TAGS", L"false" ).eqi( L"true" );
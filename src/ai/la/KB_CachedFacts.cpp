@@ -1,5 +1,8 @@
 #if defined SOL_CAA
 
+#include <algorithm>
+#include <lem/solarix/lexem.h>
+#include <lem/solarix/word_form.h>
 #include <lem/solarix/KnowledgeBase.h>
 
 using namespace Solarix;
@@ -11,9 +14,94 @@ KB_CachedFacts::KB_CachedFacts( int _id ) : id(_id)
     
 KB_CheckingResult KB_CachedFacts::Match( Solarix::Dictionary * dict, const KB_Facts & group, const lem::MCollect<const Solarix::Word_Form*> & args ) const
 {
- for( lem::Container::size_type i=0; i<facts.size(); ++i )
+ if( arg_index.empty() || args.size()!=arg_index.size() )
   {
-   KB_CheckingResult res = facts[i]->Match( dict, group, args );
+   for( lem::Container::size_type i=0; i<facts.size(); ++i )
+    {
+     KB_CheckingResult res = facts[i]->Match( dict, group, args );
+     if( res.IsMatched() )
+      return res;
+    }
+
+   return KB_NotMatchedResult();
+  }
+
+ //       .
+ int best_pos=UNKNOWN, best_n=0;
+ const lem::MCollect<int> *best_entry=NULL, *best_word=NULL;
+
+ for( lem::Container::size_type i=0; i<arg_index.size(); ++i )
+  {
+   const ArgIndex &ai = *arg_index[i];
+   const Word_Form &val = *args[i];
+
+   const lem::MCollect<int> *by_entry=NULL, *by_word=NULL;
+   int n = ai.n_regex_facts + CastSizeToInt(ai.rest.size());
+
+   std::map< int, lem::MCollect<int> >::const_iterator it1 = ai.by_entry.find( val.GetEntryKey() );
+   if( it1!=ai.by_entry.end() )
+    {
+     by_entry = &it1->second;
+     n += CastSizeToInt(by_entry->size());
+    }
+
+   if( !ai.by_word.empty() )
+    {
+     std::map< lem::UCString, lem::MCollect<int> >::const_iterator it2 = ai.by_word.find( * val.GetNormalized() );
+     if( it2!=ai.by_word.end() )
+      {
+       by_word = &it2->second;
+       n += CastSizeToInt(by_word->size());
+      }
+    }
+
+   if( best_pos==UNKNOWN || n<best_n )
+    {
+     best_pos = CastSizeToInt(i);
+     best_n = n;
+     best_entry = by_entry;
+     best_word = by_word;
+
+     if( n==0 )
+      return KB_NotMatchedResult();
+    }
+  }
+
+ const ArgIndex &ai = *arg_index[best_pos];
+
+ lem::MCollect<int> candidates;
+ candidates.reserve(best_n);
+
+ if( best_entry!=NULL )
+  for( lem::Container::size_type k=0; k<best_entry->size(); ++k )
+   candidates.push_back( (*best_entry)[k] );
+
+ if( best_word!=NULL )
+  for( lem::Container::size_type k=0; k<best_word->size(); ++k )
+   candidates.push_back( (*best_word)[k] );
+
+ if( !ai.regex.empty() )
+  {
+   const lem::UCString & word = * args[best_pos]->GetName();
+   for( lem::Container::size_type k=0; k<ai.regex.size(); ++k )
+    {
+     const RegexBucket &b = *ai.regex[k];
+     if( boost::regex_match( word.c_str(), b.arg->rx ) )
+      for( lem::Container::size_type j=0; j<b.ifacts.size(); ++j )
+       candidates.push_back( b.ifacts[j] );
+    }
+  }
+
+ for( lem::Container::size_type k=0; k<ai.rest.size(); ++k )
+  candidates.push_back( ai.rest[k] );
+
+ //     ,    , 
+ //     .
+ std::sort( candidates.begin(), candidates.end() );
+
+ for( lem::Container::size_type k=0; k<candidates.size(); ++k )
+  {
+   KB_CheckingResult res = facts[ candidates[k] ]->Match( dict, group, args );
    if( res.IsMatched() )
     return res;
   }
@@ -26,6 +114,69 @@ void KB_CachedFacts::AddFact( KB_Fact * x )
 {
  LEM_CHECKIT_Z(x!=NULL);
  facts.push_back(x);
+ arg_index.clear();
+ return;
+}
+
+
+void KB_CachedFacts::BuildIndex(void)
+{
+ arg_index.clear();
+
+ if( facts.empty() )
+  return;
+
+ //        -  .
+ const int n_arg = facts.front()->CountArgs();
+ for( lem::Container::size_type i=1; i<facts.size(); ++i )
+  if( facts[i]->CountArgs()!=n_arg )
+   return;
+
+ for( int iarg=0; iarg<n_arg; ++iarg )
+  {
+   ArgIndex *ai = new ArgIndex();
+   arg_index.push_back(ai);
+
+   for( lem::Container::size_type i=0; i<facts.size(); ++i )
+    {
+     const int ifact = CastSizeToInt(i);
+     const KB_Argument &arg = facts[i]->GetArg(iarg);
+
+     //         .
+     if( !arg.is_positive )
+      ai->rest.push_back(ifact);
+     else if( arg.id_metaentry==UNKNOWN && !lem::is_quantor(arg.id_entry) )
+      ai->by_entry[ arg.id_entry ].push_back(ifact);
+     else if( arg.is_regex )
+      {
+       std::wstring key( arg.case_sensitive ? L"1" : L"0" );
+       key += arg.regex_str.c_str();
+
+       std::map< std::wstring, int >::const_iterator it = ai->regex_key.find(key);
+       int ibucket;
+       if( it==ai->regex_key.end() )
+        {
+         RegexBucket *b = new RegexBucket();
+         b->arg = &arg;
+         ibucket = CastSizeToInt(ai->regex.size());
+         ai->regex.push_back(b);
+         ai->regex_key.insert( std::make_pair(key,ibucket) );
+        }
+       else
+        {
+         ibucket = it->second;
+        }
+
+       ai->regex[ibucket]->ifacts.push_back(ifact);
+       ai->n_regex_facts++;
+      }
+     else if( !arg.word.empty() )
+      ai->by_word[ arg.word ].push_back(ifact);
+     else
+      ai->rest.push_back(ifact);
+    }
+  }
+
  return;
 }
 
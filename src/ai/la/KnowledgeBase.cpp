@@ -202,6 +202,7 @@ const KB_CachedFacts& KnowledgeBase::LoadAndCacheFacts( int id )
        x->AddFact(fact);
       }
 
+     x->BuildIndex();
      cached_facts.push_back(x);
      id2cached_facts.insert( std::make_pair(id,x) );
      return *x;
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <lem/solarix/LA_RecognitionRule.h>
 #include <lem/solarix/LS_ResultSet.h>
 #include <lem/solarix/LexiconStorage.h>
@@ -8,7 +9,7 @@ using namespace Solarix;
 
 
 LA_RecognitionRules::LA_RecognitionRules( int _id_language, LexiconStorage *_storage )
- : id_language(_id_language), storage(_storage)
+ : id_language(_id_language), storage(_storage), rx_icase(true), rx_case(false), use_rx_set(true)
 {
  LEM_CHECKIT_Z( storage!=NULL );
 }
@@ -55,7 +56,18 @@ void LA_RecognitionRules::Add( LA_RecognitionRule * rule )
   }
  else if( rule->IsRegex() )
   {
+   const int irx = CastSizeToInt(rx_rules.size());
    rx_rules.push_back(rule);
+
+   LA_RegexSet &rx = rule->IsCaseSensitive() ? rx_case : rx_icase;
+   if( !rx.Add( rule->GetCondition().c_str(), irx ) )
+    rx_fallback.push_back(irx);
+  }
+ else if( rule->IsWordMatcher() )
+  {
+   //          .
+   if( rule->GetCondition().length()<lem::UCString::max_len )
+    word_rules.insert( std::make_pair( lem::UCString(rule->GetCondition().c_str()), rule ) );
   }
  else
   {
@@ -69,34 +81,22 @@ void LA_RecognitionRules::Add( LA_RecognitionRule * rule )
 void LA_RecognitionRules::AddResult(
                                     const Solarix::Word_Coord &wc,
                                     lem::Real1 val,
-                                    Solarix::LA_ProjectInfo *inf,
+                                    const Solarix::CP_Array &coords,
                                     lem::MCollect<Solarix::Word_Coord> &found_list,
                                     lem::MCollect<Solarix::ProjScore> &val_list,
                                     lem::PtrCollect<Solarix::LA_ProjectInfo> &inf_list
                                    ) const
 {
- //       .
+ //   .       .
  for( lem::Container::size_type i=0; i<found_list.size(); ++i )
   {
-   if( found_list[i]==wc )
-    {
-     bool inf_matched=true;
-
-     if( inf==NULL && inf_list[i]!=NULL )
-      inf_matched=false;
-     else if( inf!=NULL && inf_list[i]==NULL )
-      inf_matched=false;
-     else if( inf->coords!=inf_list[i]->coords )
-      inf_matched=false;
-       
-     if( inf_matched )
-      {
-       delete inf;
-       return;
-      }
-    }
+   if( found_list[i]==wc && inf_list[i]!=NULL && inf_list[i]->coords==coords )
+    return;
   }
 
+ LA_ProjectInfo *inf = new LA_ProjectInfo();
+ inf->coords = coords;
+
  found_list.push_back(wc);
  val_list.push_back(val);
  inf_list.push_back(inf);
@@ -105,6 +105,29 @@ void LA_RecognitionRules::AddResult(
 }
 
 
+void LA_RecognitionRules::AddRuleResult(
+                                        const LA_RecognitionRule *r,
+                                        const lem::UCString & word,
+                                        lem::Real1 word_rel,
+                                        lem::MCollect<Solarix::Word_Coord> &found_list,
+                                        lem::MCollect<Solarix::ProjScore> &val_list,
+                                        lem::PtrCollect<Solarix::LA_ProjectInfo> &inf_list,
+                                        LA_RecognitionTrace *trace
+                                       ) const
+{
+ AddResult( Word_Coord( r->GetEntryKey(), 0 ), word_rel*r->GetRel(), r->GetCoords(), found_list, val_list, inf_list );
+
+ #if defined SOL_DEBUGGING
+ if( trace!=NULL )
+  {
+   trace->Matched( word, r );
+  }
+ #endif
+
+ return;
+}
+
+
 
 bool LA_RecognitionRules::Apply(
                                 const lem::UCString & normalized_word,
@@ -120,26 +143,12 @@ bool LA_RecognitionRules::Apply(
 
  typedef RULES::const_iterator IT;
 
- // ,   ,     ,      .
- lem::Ptr<Solarix::LS_ResultSet> rs_words( storage->ListRecognitionRulesForWord( id_language, normalized_word ) );
- while( rs_words->Fetch() )
+ // ,   ,  ,     .
+ std::pair<WORD_RULES::const_iterator,WORD_RULES::const_iterator> pw = word_rules.equal_range(normalized_word);
+ for( WORD_RULES::const_iterator it=pw.first; it!=pw.second; ++it )
   {
-   const int id_rule = rs_words->GetInt(0);
-   lem::Ptr<LA_RecognitionRule> rule( storage->GetRecognitionRule(id_rule) );
-
    matched = true;
-
-   LA_ProjectInfo *info = new LA_ProjectInfo();
-   info->coords = rule->GetCoords();
-
-   AddResult( Word_Coord( rule->GetEntryKey(), 0 ), word_rel*rule->GetRel(), info, found_list, val_list, inf_list );
-
-   #if defined SOL_DEBUGGING
-   if( trace!=NULL )
-    {
-     trace->Matched( normalized_word, &*rule );
-    }
-   #endif
+   AddRuleResult( it->second, normalized_word, word_rel, found_list, val_list, inf_list, trace );
   }
 
  if( !matched )
@@ -151,18 +160,7 @@ bool LA_RecognitionRules::Apply(
      if( r->Match(normalized_word,original_word) )
       {
        matched = true;
- 
-       LA_ProjectInfo *info = new LA_ProjectInfo();
-       info->coords = r->GetCoords();
- 
-       AddResult( Word_Coord( r->GetEntryKey(), 0 ), word_rel*r->GetRel(), info, found_list, val_list, inf_list );
- 
-       #if defined SOL_DEBUGGING
-       if( trace!=NULL )
-        {
-         trace->Matched( normalized_word, r );
-        }
-       #endif
+       AddRuleResult( r, normalized_word, word_rel, found_list, val_list, inf_list, trace );
       }
     }
  
@@ -173,39 +171,40 @@ bool LA_RecognitionRules::Apply(
      if( r->Match(normalized_word,original_word) )
       {
        matched = true;
- 
-       LA_ProjectInfo *info = new LA_ProjectInfo();
-       info->coords = r->GetCoords();
- 
-       AddResult( Word_Coord( r->GetEntryKey(), 0 ), word_rel*r->GetRel(), info, found_list, val_list, inf_list );
- 
-       #if defined SOL_DEBUGGING
-       if( trace!=NULL )
-        {
-         trace->Matched( normalized_word, r );
-        }
-       #endif
+       AddRuleResult( r, normalized_word, word_rel, found_list, val_list, inf_list, trace );
       }
     }
-   
-   for( lem::Container::size_type i=0; i<rx_rules.size(); ++i )
+
+   if( use_rx_set )
     {
-     const LA_RecognitionRule *r = rx_rules[i];
-     if( r->Match(normalized_word,original_word) )
+     //       ,  
+     //    ,    .
+     lem::MCollect<int> rx_hits;
+     rx_icase.Match( normalized_word.c_str(), rx_hits );
+     rx_case.Match( original_word.c_str(), rx_hits );
+
+     for( lem::Container::size_type i=0; i<rx_fallback.size(); ++i )
+      if( rx_rules[ rx_fallback[i] ]->Match(normalized_word,original_word) )
+       rx_hits.push_back( rx_fallback[i] );
+
+     std::sort( rx_hits.begin(), rx_hits.end() );
+
+     for( lem::Container::size_type i=0; i<rx_hits.size(); ++i )
       {
        matched = true;
- 
-       LA_ProjectInfo *info = new LA_ProjectInfo();
-       info->coords = r->GetCoords();
- 
-       AddResult( Word_Coord( r->GetEntryKey(), 0 ), word_rel*r->GetRel(), info, found_list, val_list, inf_list );
- 
-       #if defined SOL_DEBUGGING
-       if( trace!=NULL )
+       AddRuleResult( rx_rules[ rx_hits[i] ], normalized_word, word_rel, found_list, val_list, inf_list, trace );
+      }
+    }
+   else
+    {
+     for( lem::Container::size_type i=0; i<rx_rules.size(); ++i )
+      {
+       const LA_RecognitionRule *r = rx_rules[i];
+       if( r->Match(normalized_word,original_word) )
         {
-         trace->Matched( normalized_word, r );
+         matched = true;
+         AddRuleResult( r, normalized_word, word_rel, found_list, val_list, inf_list, trace );
         }
-       #endif
       }
     }
   }
@@ -237,10 +236,7 @@ bool LA_RecognitionRules::ApplyForSyllabs(
     {
      matched = true;
 
-     LA_ProjectInfo *info = new LA_ProjectInfo();
-     info->coords = r->GetCoords();
-
-     AddResult( Word_Coord( r->GetEntryKey(), 0 ), word_rel*r->GetRel(), info, found_list, val_list, inf_list );
+     AddResult( Word_Coord( r->GetEntryKey(), 0 ), word_rel*r->GetRel(), r->GetCoords(), found_list, val_list, inf_list );
 
      #if defined SOL_DEBUGGING
      if( trace!=NULL )
@@ -259,10 +255,7 @@ bool LA_RecognitionRules::ApplyForSyllabs(
     {
      matched = true;
 
-     LA_ProjectInfo *info = new LA_ProjectInfo();
-     info->coords = r->GetCoords();
-
-     AddResult( Word_Coord( r->GetEntryKey(), 0 ), word_rel*r->GetRel(), info, found_list, val_list, inf_list );
+     AddResult( Word_Coord( r->GetEntryKey(), 0 ), word_rel*r->GetRel(), r->GetCoords(), found_list, val_list, inf_list );
 
      #if defined SOL_DEBUGGING
      if( trace!=NULL )
@@ -17,6 +17,7 @@ LA_Recognizer::LA_Recognizer( Solarix::Dictionary *Dict )
 {
  dict = Dict;
  storage = NULL;
+ use_rx_set = true;
  return;
 }
 
@@ -40,6 +41,21 @@ LA_Recognizer::~LA_Recognizer(void)
 }
 
 
+void LA_Recognizer::SetRegexAutomaton( bool f )
+{
+ #if defined LEM_THREADS
+ lem::Process::RWU_ReaderGuard rlock(cs);
+ lem::Process::RWU_WriterGuard wlock(rlock);
+ #endif
+
+ use_rx_set = f;
+ for( lem::Container::size_type i=0; i<rules.size(); ++i )
+  rules[i]->use_rx_set = f;
+
+ return;
+}
+
+
 void LA_Recognizer::DeleteRules(void)
 {
  for( lem::Container::size_type i=0; i<rules.size(); ++i )
@@ -58,8 +74,11 @@ void LA_Recognizer::DeleteRules(void)
 void LA_Recognizer::LoadRulesFromStorage( int id_language )
 {
  LA_RecognitionRules *lang_rules = new LA_RecognitionRules( id_language, storage );
+ lang_rules->use_rx_set = use_rx_set;
  
- lem::Ptr<LS_ResultSet> rs1 = storage->ListRecognitionRules(id_language,false);
+ //   ,    ,  
+ //       .
+ lem::Ptr<LS_ResultSet> rs1 = storage->ListRecognitionRules(id_language,true);
  while( rs1->Fetch() )
   {
    const int id = rs1->GetInt(0);
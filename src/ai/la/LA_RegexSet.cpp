@@ -0,0 +1,576 @@
+#include <vector>
+#include <boost/regex.hpp>
+#include <lem/unicode.h>
+#include <lem/conversions.h>
+#include <lem/ptr_container.h>
+#include <lem/solarix/LA_RegexSet.h>
+
+using namespace Solarix;
+
+
+namespace
+{
+ enum { F_DIGIT=1, F_WORD=2, F_SPACE=4, F_NOTDIGIT=8, F_NOTWORD=16, F_NOTSPACE=32 };
+
+ //   {m,n},      .
+ const int MAX_REPEAT=32;
+
+ //      .
+ struct RegexUnsupported {};
+
+ //  \d \w \s         ,
+ //    boost::wregex  ,   -: 
+ //   \w         
+ //    ,    .
+ class RegexTraits
+ {
+  private:
+   typedef boost::regex_traits<wchar_t> traits_type;
+
+   traits_type traits;
+   traits_type::char_class_type class_d, class_w, class_s;
+
+   traits_type::char_class_type LookUp( const wchar_t *name ) const
+   {
+    return traits.lookup_classname( name, name+wcslen(name) );
+   }
+
+  public:
+   RegexTraits(void)
+   {
+    class_d = LookUp(L"d");
+    class_w = LookUp(L"w");
+    class_s = LookUp(L"s");
+   }
+
+   bool IsDigit( wchar_t c ) const { return traits.isctype( c, class_d ); }
+   bool IsWordChar( wchar_t c ) const { return traits.isctype( c, class_w ); }
+   bool IsSpace( wchar_t c ) const { return traits.isctype( c, class_s ); }
+   wchar_t Fold( wchar_t c ) const { return traits.translate_nocase(c); }
+ };
+
+ const RegexTraits& Traits(void)
+ {
+  static RegexTraits traits;
+  return traits;
+ }
+
+ int EscapeFlag( wchar_t c )
+ {
+  switch( c )
+  {
+   case L'd': return F_DIGIT;
+   case L'w': return F_WORD;
+   case L's': return F_SPACE;
+   case L'D': return F_NOTDIGIT;
+   case L'W': return F_NOTWORD;
+   case L'S': return F_NOTSPACE;
+  }
+
+  return 0;
+ }
+
+ //     \d\w\s:     
+ // ,     '\'    .
+ wchar_t EscapeLiteral( wchar_t c )
+ {
+  switch( c )
+  {
+   case L'n': return L'\n';
+   case L't': return L'\t';
+   case L'r': return L'\r';
+  }
+
+  if( c==0 || lem::is_ualpha(c) || lem::is_udigit(c) )
+   throw RegexUnsupported();
+
+  return c;
+ }
+}
+
+
+// c -  , fc -      (  
+//       ,   boost).
+bool LA_RegexSet::CharClass::Contains( wchar_t c, wchar_t fc ) const
+{
+ bool res=false;
+
+ for( lem::Container::size_type i=0; i<ranges.size() && !res; ++i )
+  if( fc>=ranges[i].first && fc<=ranges[i].second )
+   res = true;
+
+ if( !res && flags!=0 )
+  {
+   const RegexTraits &traits = Traits();
+   if(
+      ( (flags&F_DIGIT) && traits.IsDigit(c) ) ||
+      ( (flags&F_WORD) && traits.IsWordChar(c) ) ||
+      ( (flags&F_SPACE) && traits.IsSpace(c) ) ||
+      ( (flags&F_NOTDIGIT) && !traits.IsDigit(c) ) ||
+      ( (flags&F_NOTWORD) && !traits.IsWordChar(c) ) ||
+      ( (flags&F_NOTSPACE) && !traits.IsSpace(c) )
+     )
+    res = true;
+  }
+
+ return res!=negated;
+}
+
+
+//    .      Add.
+struct LA_RegexSet::Node
+{
+ enum { NChar, NAny, NClass, NCat, NAlt, NRepeat, NEmpty };
+
+ int kind;
+ wchar_t c;
+ int iclass;
+ const Node *a, *b;
+ int rmin, rmax; // rmax=-1   
+
+ Node( int _kind ) : kind(_kind), c(0), iclass(-1), a(NULL), b(NULL), rmin(0), rmax(0) {}
+};
+
+
+//    .     
+// LA_RegexSet::classes,   Add     .
+class LA_RegexSet::Parser
+{
+ private:
+  LA_RegexSet &owner;
+  const wchar_t *begin, *p;
+  lem::PtrCollect<Node> nodes;
+
+  Node* New( int kind )
+  {
+   Node *n = new Node(kind);
+   nodes.push_back(n);
+   return n;
+  }
+
+  Node* NewPair( int kind, const Node *a, const Node *b )
+  {
+   Node *n = New(kind);
+   n->a = a;
+   n->b = b;
+   return n;
+  }
+
+  Node* NewClass( const CharClass &cls )
+  {
+   Node *n = New(Node::NClass);
+   n->iclass = CastSizeToInt(owner.classes.size());
+   owner.classes.push_back(cls);
+   return n;
+  }
+
+  int ReadInt()
+  {
+   if( *p<L'0' || *p>L'9' )
+    throw RegexUnsupported();
+
+   int x=0;
+   while( *p>=L'0' && *p<=L'9' )
+    {
+     x = x*10 + (*p-L'0');
+     if( x>MAX_REPEAT )
+      throw RegexUnsupported();
+     p++;
+    }
+
+   return x;
+  }
+
+  wchar_t Fold( wchar_t c ) const { return owner.icase ? Traits().Fold(c) : c; }
+
+  const Node* ParseClass()
+  {
+   // p     '['
+   CharClass cls;
+   if( *p==L'^' )
+    {
+     cls.negated = true;
+     p++;
+    }
+
+   bool first=true;
+   while( *p!=L']' || first )
+    {
+     first=false;
+
+     if( *p==0 || (*p==L'[' && (p[1]==L':' || p[1]==L'=' || p[1]==L'.')) )
+      throw RegexUnsupported();
+
+     wchar_t c1;
+     if( *p==L'\\' )
+      {
+       p++;
+       const int f = EscapeFlag(*p);
+       if( f!=0 )
+        {
+         cls.flags |= f;
+         p++;
+         continue;
+        }
+
+       c1 = EscapeLiteral(*p++);
+      }
+     else
+      {
+       c1 = *p++;
+      }
+
+     wchar_t c2 = c1;
+     if( *p==L'-' && p[1]!=L']' && p[1]!=0 )
+      {
+       p++;
+       if( *p==L'\\' )
+        {
+         p++;
+         c2 = EscapeLiteral(*p++);
+        }
+       else
+        c2 = *p++;
+
+       if( c2<c1 )
+        throw RegexUnsupported();
+      }
+
+     c1 = Fold(c1);
+     c2 = Fold(c2);
+     if( c2<c1 )
+      throw RegexUnsupported();
+
+     cls.ranges.push_back( std::make_pair(c1,c2) );
+    }
+
+   p++; // ']'
+   return NewClass(cls);
+  }
+
+  const Node* ParseAtom()
+  {
+   switch( *p )
+   {
+    case L'(':
+     {
+      p++;
+      if( *p==L'?' )
+       {
+        if( p[1]!=L':' )
+         throw RegexUnsupported();
+        p += 2;
+       }
+
+      const Node *n = ParseAlt();
+      if( *p!=L')' )
+       throw RegexUnsupported();
+      p++;
+      return n;
+     }
+
+    case L'.':
+     p++;
+     return New(Node::NAny);
+
+    case L'[':
+     p++;
+     return ParseClass();
+
+    case L'\\':
+     {
+      p++;
+      const int f = EscapeFlag(*p);
+      if( f!=0 )
+       {
+        p++;
+        CharClass cls;
+        cls.flags = f;
+        return NewClass(cls);
+       }
+
+      Node *n = New(Node::NChar);
+      n->c = Fold( EscapeLiteral(*p++) );
+      return n;
+     }
+
+    case L'^':
+     // regex_match    ,       .
+     if( p!=begin )
+      throw RegexUnsupported();
+     p++;
+     return New(Node::NEmpty);
+
+    case L'$':
+     if( p[1]!=0 )
+      throw RegexUnsupported();
+     p++;
+     return New(Node::NEmpty);
+
+    case L'*': case L'+': case L'?': case L'{': case 0:
+     throw RegexUnsupported();
+   }
+
+   Node *n = New(Node::NChar);
+   n->c = Fold(*p++);
+   return n;
+  }
+
+  const Node* ParseRepeat()
+  {
+   const Node *atom = ParseAtom();
+
+   int rmin=0, rmax=0;
+   switch( *p )
+   {
+    case L'*': rmin=0; rmax=-1; p++; break;
+    case L'+': rmin=1; rmax=-1; p++; break;
+    case L'?': rmin=0; rmax=1; p++; break;
+
+    case L'{':
+     p++;
+     rmin = rmax = ReadInt();
+     if( *p==L',' )
+      {
+       p++;
+       rmax = *p==L'}' ? -1 : ReadInt();
+      }
+     if( *p!=L'}' || (rmax!=-1 && rmax<rmin) )
+      throw RegexUnsupported();
+     p++;
+     break;
+
+    default:
+     return atom;
+   }
+
+   //        ,  - .
+   if( *p==L'?' )
+    p++;
+
+   if( *p==L'*' || *p==L'+' || *p==L'?' || *p==L'{' )
+    throw RegexUnsupported();
+
+   Node *n = New(Node::NRepeat);
+   n->a = atom;
+   n->rmin = rmin;
+   n->rmax = rmax;
+   return n;
+  }
+
+  const Node* ParseCat()
+  {
+   const Node *n = NULL;
+   while( *p!=0 && *p!=L'|' && *p!=L')' )
+    {
+     const Node *atom = ParseRepeat();
+     n = n==NULL ? atom : NewPair( Node::NCat, n, atom );
+    }
+
+   return n==NULL ? New(Node::NEmpty) : n;
+  }
+
+ public:
+  Parser( LA_RegexSet &_owner, const wchar_t *pattern ) : owner(_owner), begin(pattern), p(pattern) {}
+
+  const Node* ParseAlt()
+  {
+   const Node *n = ParseCat();
+   while( *p==L'|' )
+    {
+     p++;
+     n = NewPair( Node::NAlt, n, ParseCat() );
+    }
+
+   return n;
+  }
+
+  const Node* Parse()
+  {
+   const Node *n = ParseAlt();
+   if( *p!=0 )
+    throw RegexUnsupported(); //  ')'
+
+   return n;
+  }
+};
+
+
+
+LA_RegexSet::LA_RegexSet( bool _icase ) : icase(_icase)
+{
+}
+
+
+int LA_RegexSet::NewState( int type, wchar_t c, int out, int out1 )
+{
+ State s;
+ s.type = type;
+ s.c = c;
+ s.out = out;
+ s.out1 = out1;
+ states.push_back(s);
+ return CastSizeToInt(states.size())-1;
+}
+
+
+//    :    ,   
+//   next,    .
+int LA_RegexSet::Compile( const Node *node, int next )
+{
+ switch( node->kind )
+ {
+  case Node::NChar:  return NewState( StChar, node->c, next, -1 );
+  case Node::NAny:   return NewState( StAny, 0, next, -1 );
+  case Node::NClass: return NewState( StClass, 0, next, node->iclass );
+  case Node::NEmpty: return next;
+  case Node::NCat:   return Compile( node->a, Compile( node->b, next ) );
+
+  case Node::NAlt:
+   {
+    const int e1 = Compile( node->a, next );
+    const int e2 = Compile( node->b, next );
+    return NewState( StSplit, 0, e1, e2 );
+   }
+
+  case Node::NRepeat:
+   {
+    int cur = next;
+
+    if( node->rmax==-1 )
+     {
+      //  x*
+      const int s = NewState( StSplit, 0, -1, next );
+      const int e = Compile( node->a, s );
+      states[s].out = e;
+      cur = s;
+     }
+    else
+     {
+      // (x(x(x)?)?)?   
+      for( int k=node->rmin; k<node->rmax; ++k )
+       {
+        const int e = Compile( node->a, cur );
+        cur = NewState( StSplit, 0, e, next );
+       }
+     }
+
+    for( int k=0; k<node->rmin; ++k )
+     cur = Compile( node->a, cur );
+
+    return cur;
+   }
+ }
+
+ LEM_STOPIT;
+ return next;
+}
+
+
+bool LA_RegexSet::Add( const wchar_t *pattern, int id )
+{
+ const lem::Container::size_type n_state0 = states.size();
+ const lem::Container::size_type n_class0 = classes.size();
+
+ try
+  {
+   Parser parser( *this, pattern );
+   const Node *root = parser.Parse();
+
+   const int m = NewState( StMatch, 0, -1, id );
+   starts.push_back( Compile( root, m ) );
+   return true;
+  }
+ catch( const RegexUnsupported& )
+  {
+   states.resize(n_state0);
+   classes.resize(n_class0);
+   return false;
+  }
+}
+
+
+void LA_RegexSet::AddState( int s, int gen, int *list, int &n, int *mark ) const
+{
+ if( mark[s]==gen )
+  return;
+
+ mark[s] = gen;
+
+ const State &st = states[s];
+ if( st.type==StSplit )
+  {
+   AddState( st.out, gen, list, n, mark );
+   AddState( st.out1, gen, list, n, mark );
+  }
+ else
+  {
+   list[n++] = s;
+  }
+
+ return;
+}
+
+
+bool LA_RegexSet::Step( int s, wchar_t c, wchar_t fc ) const
+{
+ const State &st = states[s];
+ switch( st.type )
+ {
+  case StChar:  return st.c==fc;
+  case StAny:   return c!=L'\n';
+  case StClass: return classes[st.out1].Contains(c,fc);
+ }
+
+ return false;
+}
+
+
+void LA_RegexSet::Match( const wchar_t *word, lem::MCollect<int> &matched ) const
+{
+ if( starts.empty() )
+  return;
+
+ const int n_state = CastSizeToInt(states.size());
+
+ //         .
+ enum { STACK_STATES=512 };
+ int stack_buf[STACK_STATES*3];
+ std::vector<int> heap_buf;
+ int *buf = stack_buf;
+ if( n_state>STACK_STATES )
+  {
+   heap_buf.resize( n_state*3 );
+   buf = &heap_buf[0];
+  }
+
+ int *clist = buf, *nlist = buf+n_state, *mark = buf+2*n_state;
+ for( int i=0; i<n_state; ++i )
+  mark[i] = -1;
+
+ int gen=0, nc=0;
+ for( lem::Container::size_type i=0; i<starts.size(); ++i )
+  AddState( starts[i], gen, clist, nc, mark );
+
+ for( const wchar_t *q=word; *q!=0 && nc>0; ++q )
+  {
+   gen++;
+   const wchar_t fc = icase ? Traits().Fold(*q) : *q;
+   int nn=0;
+   for( int i=0; i<nc; ++i )
+    {
+     const int s = clist[i];
+     if( Step(s,*q,fc) )
+      AddState( states[s].out, gen, nlist, nn, mark );
+    }
+
+   std::swap( clist, nlist );
+   nc = nn;
+  }
+
+ for( int i=0; i<nc; ++i )
+  if( states[clist[i]].type==StMatch )
+   matched.push_back( states[clist[i]].out1 );
+
+ return;
+}
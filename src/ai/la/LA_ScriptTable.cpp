@@ -0,0 +1,168 @@
+#include <map>
+#include <lem/unicode.h>
+#include <lem/smart_pointers.h>
+#include <lem/solarix/dictionary.h>
+#include <lem/solarix/sg_autom.h>
+#include <lem/solarix/gg_autom.h>
+#include <lem/solarix/Symbols.h>
+#include <lem/solarix/Symbol.h>
+#include <lem/solarix/SymbolEnumerator.h>
+#include <lem/solarix/Languages.h>
+#include <lem/solarix/LanguageEnumerator.h>
+#include <lem/solarix/SG_Language.h>
+#include <lem/solarix/LA_ScriptTable.h>
+
+using namespace Solarix;
+
+
+LA_ScriptTable::LA_ScriptTable( Dictionary &dict )
+ : fixed_language(UNKNOWN)
+{
+ SynGram &sg = dict.GetSynGram();
+ GraphGram &gg = dict.GetGraphGram();
+
+ //       ,   .
+ dict.GetLanguages( lang_id );
+
+ if( lang_id.size()==1 )
+  fixed_language = lang_id.front();
+ else if( lang_id.empty() )
+  {
+   lem::Ptr<LanguageEnumerator> lenum( sg.languages().Enumerate() );
+   while( lenum->Fetch() )
+    lang_id.push_back( lenum->GetId() );
+  }
+
+ //        .
+ std::multimap<int/*id_alphabet*/,lem::uint32_t/*code*/> alphabet_codes;
+
+ lem::Ptr<SymbolEnumerator> senum( gg.entries().Enumerate() );
+ while( senum->Fetch() )
+  {
+   const GG_Entry &e = senum->GetItem();
+   const int id_alphabet = e.GetAlphabet();
+   if( id_alphabet==UNKNOWN )
+    continue;
+
+   if( e.forms().empty() )
+    alphabet_codes.insert( std::make_pair( id_alphabet, e.GetName() ) );
+   else
+    for( lem::Container::size_type k=0; k<e.forms().size(); ++k )
+     alphabet_codes.insert( std::make_pair( id_alphabet, e.forms()[k].GetName() ) );
+  }
+
+ senum.Delete();
+
+ //    - ,    .
+ std::multimap<int/*id_alphabet*/,int/*ilang*/> alphabet_langs;
+
+ lem::Ptr<LanguageEnumerator> lenum( sg.languages().Enumerate() );
+ while( lenum->Fetch() )
+  {
+   const int ilang = lang_id.find( lenum->GetId() );
+   if( ilang==UNKNOWN )
+    continue;
+
+   const SG_Language &lang = lenum->GetItem();
+
+   for( std::multimap<int,lem::uint32_t>::const_iterator it=alphabet_codes.begin(); it!=alphabet_codes.end(); it=alphabet_codes.upper_bound(it->first) )
+    if( lang.IsMainAlphabet(it->first) )
+     alphabet_langs.insert( std::make_pair( it->first, ilang ) );
+  }
+
+ lenum.Delete();
+
+ //    .
+ typedef std::map< lem::uint32_t, std::map<int/*ilang*/,int/*points*/> > CODE_POINTS;
+ CODE_POINTS code_points;
+
+ typedef std::multimap<int,int>::const_iterator LIT;
+ for( std::multimap<int,lem::uint32_t>::const_iterator it=alphabet_codes.begin(); it!=alphabet_codes.end(); ++it )
+  {
+   std::pair<LIT,LIT> r = alphabet_langs.equal_range(it->first);
+   for( LIT jt=r.first; jt!=r.second; ++jt )
+    code_points[it->second][jt->second] += 2;
+  }
+
+ // :      ,  0 - .
+ std::map< std::vector< std::pair<int,int> >, int > set_ids;
+ set_begin.push_back(0);
+ set_begin.push_back(0);
+
+ if( !code_points.empty() )
+  pages.resize( (code_points.rbegin()->first>>PAGE_BITS)+1, -1 );
+
+ for( CODE_POINTS::const_iterator it=code_points.begin(); it!=code_points.end(); ++it )
+  {
+   std::vector< std::pair<int,int> > lp( it->second.begin(), it->second.end() );
+
+   int id_set;
+   std::map< std::vector< std::pair<int,int> >, int >::const_iterator s = set_ids.find(lp);
+   if( s==set_ids.end() )
+    {
+     id_set = CastSizeToInt(set_begin.size())-1;
+     for( size_t k=0; k<lp.size(); ++k )
+      {
+       LangPoints x;
+       x.ilang = lp[k].first;
+       x.points = lp[k].second;
+       points.push_back(x);
+      }
+
+     set_begin.push_back( CastSizeToInt(points.size()) );
+     set_ids.insert( std::make_pair( lp, id_set ) );
+    }
+   else
+    {
+     id_set = s->second;
+    }
+
+   const lem::uint32_t ipage = it->first>>PAGE_BITS;
+   if( pages[ipage]==-1 )
+    {
+     pages[ipage] = CastSizeToInt(cells.size()/PAGE_SIZE);
+     cells.resize( cells.size()+PAGE_SIZE, 0 );
+    }
+
+   cells[ pages[ipage]*PAGE_SIZE + (it->first & (PAGE_SIZE-1)) ] = id_set;
+  }
+
+ return;
+}
+
+
+void LA_ScriptTable::Find( lem::uint32_t code, const LangPoints* &begin, const LangPoints* &end ) const
+{
+ begin = end = NULL;
+
+ const lem::uint32_t ipage = code>>PAGE_BITS;
+ if( ipage>=pages.size() || pages[ipage]==-1 )
+  return;
+
+ const int id_set = cells[ pages[ipage]*PAGE_SIZE + (code & (PAGE_SIZE-1)) ];
+ if( id_set!=0 )
+  {
+   begin = &points[0] + set_begin[id_set];
+   end = &points[0] + set_begin[id_set+1];
+  }
+
+ return;
+}
+
+
+void LA_ScriptTable::Score( const wchar_t *str, int len, int *lang_scores ) const
+{
+ for( int i=0; i<len; ++i )
+  {
+   const wchar_t c = str[i];
+   if( !lem::is_uspace(c) && !lem::is_udigit(c) && !lem::is_upunct(c) )
+    {
+     const LangPoints *p, *p_end;
+     Find( lem::uint32_t(c), p, p_end );
+     for( ; p!=p_end; ++p )
+      lang_scores[p->ilang] += p->points;
+    }
+  }
+
+ return;
+}
@@ -0,0 +1,119 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <lem/unicode.h>
+#include <lem/solarix/MorphologyModels.h>
+
+using namespace Solarix;
+
+
+ModelFeatureIndex::ModelFeatureIndex() : n_unparsed(0)
+{
+}
+
+
+void ModelFeatureIndex::Clear()
+{
+ key2id.clear();
+ sem2id.clear();
+ n_unparsed=0;
+ return;
+}
+
+
+int ModelFeatureIndex::GetPosIndex( const char * name )
+{
+ static const char * names[POS_COUNT] = { "N", "A", "V", "IMV", "I", "Y", "VY", "PRN", "PRN2", "C", "D", "P", "PX", "PP", "MU" };
+
+ for( int i=0; i<POS_COUNT; ++i )
+  if( strcmp( names[i], name )==0 )
+   return i;
+
+ return UNKNOWN;
+}
+
+
+//   ,     BasicModel::PullFeatures*.
+//      ,      .
+void ModelFeatureIndex::Add( const char * attr, int id )
+{
+ int n=-1, o1=0, o2=0, o3=0, v1=0, v2=0, v3=0;
+
+ char * end=NULL;
+ const long tag = strtol( attr, &end, 10 );
+ if( end!=attr && *end==0 )
+  {
+   key2id.insert( std::make_pair( Key( FormTag, 0, int(tag), 0, 0 ), id ) );
+   return;
+  }
+
+ if( sscanf( attr, "sfx[%d]=%d%n", &o1, &v1, &n )==2 && n>0 && attr[n]==0 )
+  {
+   key2id.insert( std::make_pair( Key( Suffix, o1, v1, 0, 0 ), id ) );
+   return;
+  }
+
+ n=-1;
+ if( sscanf( attr, "sfx[%d,%d]=%d,%d%n", &o1, &o2, &v1, &v2, &n )==4 && n>0 && attr[n]==0 )
+  {
+   key2id.insert( std::make_pair( Key( SuffixPair, PackOffsets(o1,o2), v1, v2, 0 ), id ) );
+   return;
+  }
+
+ n=-1;
+ if( sscanf( attr, "sfx[%d,%d,%d]=%d,%d,%d%n", &o1, &o2, &o3, &v1, &v2, &v3, &n )==6 && n>0 && attr[n]==0 )
+  {
+   key2id.insert( std::make_pair( Key( SuffixTriple, PackOffsets(o1,o2,o3), v1, v2, v3 ), id ) );
+   return;
+  }
+
+ n=-1;
+ if( sscanf( attr, "Aa[%d]=%n", &o1, &n )==1 && n>0 && strcmp( attr+n, "True" )==0 )
+  {
+   key2id.insert( std::make_pair( Key( Aa, o1, 0, 0, 0 ), id ) );
+   return;
+  }
+
+ n=-1;
+ char pos_name[8];
+ if( sscanf( attr, "pos[%d,%7[A-Z0-9]]=%d%n", &o1, pos_name, &v1, &n )==3 && n>0 && attr[n]==0 )
+  {
+   const int ipos = GetPosIndex(pos_name);
+   if( ipos!=UNKNOWN )
+    {
+     key2id.insert( std::make_pair( Key( Pos, o1, ipos, v1, 0 ), id ) );
+     return;
+    }
+  }
+
+ n=-1;
+ if( sscanf( attr, "formtag[%d]=%d%n", &o1, &v1, &n )==2 && n>0 && attr[n]==0 )
+  {
+   key2id.insert( std::make_pair( Key( ContextFormTag, o1, v1, 0, 0 ), id ) );
+   return;
+  }
+
+ n=-1;
+ if( sscanf( attr, "sem[%d]=%n", &o1, &n )==1 && n>0 )
+  {
+   sem2id.insert( std::make_pair( std::make_pair( o1, lem::UFString( lem::from_utf8(attr+n).c_str() ) ), id ) );
+   return;
+  }
+
+ n_unparsed++;
+ return;
+}
+
+
+int ModelFeatureIndex::Find( int family, int offsets, int v1, int v2, int v3 ) const
+{
+ std::map<Key,int>::const_iterator it = key2id.find( Key( family, offsets, v1, v2, v3 ) );
+ return it==key2id.end() ? UNKNOWN : it->second;
+}
+
+
+int ModelFeatureIndex::FindSemantic( int offset, const wchar_t * tag ) const
+{
+ std::map< std::pair<int,lem::UFString>, int >::const_iterator it = sem2id.find( std::make_pair( offset, lem::UFString(tag) ) );
+ return it==sem2id.end() ? UNKNOWN : it->second;
+}
@@ -16,7 +16,6 @@ SequenceLabelerModel::SequenceLabelerModel() : BasicModel()
  model = NULL;
  attrs = NULL;
  labels = NULL;
- tagger = NULL;
  #endif
 
  CONTEXT_SIZE = -1;
@@ -29,6 +28,103 @@ SequenceLabelerModel::SequenceLabelerModel() : BasicModel()
 
 SequenceLabelerModel::~SequenceLabelerModel()
 {
+ #if defined SOL_CRF_MODEL
+ if( labels!=NULL )
+  labels->release(labels);
+
+ if( attrs!=NULL )
+  attrs->release(attrs);
+
+ for( lem::Container::size_type i=0; i<all_taggers.size(); ++i )
+  {
+   all_taggers[i].tagger->release( all_taggers[i].tagger );
+   all_taggers[i].model->release( all_taggers[i].model );
+  }
+ #endif
+}
+
+
+#if defined SOL_CRF_MODEL
+//         -   
+//        .
+bool SequenceLabelerModel::CreateTagger( TaggerSlot & slot )
+{
+ slot.model = NULL;
+ slot.tagger = NULL;
+
+ lem::Path model_path( folder );
+ model_path.ConcateLeaf( L"sequence_labeler.model" );
+
+ if( crfsuite_create_instance_from_file( model_path.GetAscii().c_str(), (void**)&slot.model )!=0 )
+  {
+   slot.model = NULL;
+   return false;
+  }
+
+ if( slot.model->get_tagger( slot.model, &slot.tagger )!=0 )
+  {
+   slot.model->release(slot.model);
+   slot.model = NULL;
+   slot.tagger = NULL;
+   return false;
+  }
+
+ return true;
+}
+
+
+SequenceLabelerModel::TaggerSlot SequenceLabelerModel::AcquireTagger()
+{
+ TaggerSlot slot;
+
+ {
+  #if defined LEM_THREADS
+  lem::Process::CritSecLocker guard(&cs_taggers);
+  #endif
+
+  if( !free_taggers.empty() )
+   {
+    slot = free_taggers.back();
+    free_taggers.pop_back();
+    return slot;
+   }
+ }
+
+ //    -      .
+ if( CreateTagger(slot) )
+  {
+   #if defined LEM_THREADS
+   lem::Process::CritSecLocker guard(&cs_taggers);
+   #endif
+   all_taggers.push_back(slot);
+  }
+
+ return slot;
+}
+
+
+void SequenceLabelerModel::ReleaseTagger( const TaggerSlot & slot )
+{
+ #if defined LEM_THREADS
+ lem::Process::CritSecLocker guard(&cs_taggers);
+ #endif
+
+ free_taggers.push_back(slot);
+ return;
+}
+#endif
+
+
+int SequenceLabelerModel::CountTaggers()
+{
+ #if defined SOL_CRF_MODEL
+ #if defined LEM_THREADS
+ lem::Process::CritSecLocker guard(&cs_taggers);
+ #endif
+ return CastSizeToInt(all_taggers.size());
+ #else
+ return 0;
+ #endif
 }
 
 
@@ -80,13 +176,30 @@ bool SequenceLabelerModel::Load()
         LEM_STOPIT;
        }
    
-       /* Obtain the tagger interface. */
-       if( ret = model->get_tagger(model, &tagger) )
-       {
-        LEM_STOPIT;
-       }
-   
-       // ...
+       /* Obtain the tagger interface. */
+       TaggerSlot slot;
+       slot.model = model;
+       slot.tagger = NULL;
+       if( (ret = model->get_tagger(model, &slot.tagger))!=0 )
+       {
+        LEM_STOPIT;
+       }
+
+       all_taggers.push_back(slot);
+       free_taggers.push_back(slot);
+
+       //      ,      .
+       feature_index.Clear();
+       const int n_attr = attrs->num(attrs);
+       for( int aid=0; aid<n_attr; ++aid )
+        {
+         const char * attr_str = NULL;
+         if( attrs->to_string( attrs, aid, &attr_str )==0 && attr_str!=NULL )
+          {
+           feature_index.Add( attr_str, aid );
+           attrs->free( attrs, attr_str );
+          }
+        }
        
       }
 
@@ -172,97 +285,96 @@ void SequenceLabelerModel::Apply( BasicLexer & lexer, Dictionary & dict, const E
    //dbg_tags.Open(lem::Path("crf.txt"));
    #endif
 
-   lem::MCollect<lem::CString> str_features;
+   lem::MCollect<int> attr_ids;
    for( int iword=0; iword<CastSizeToInt(nodes2.size()); ++iword )
     {
-     str_features.clear();
+     attr_ids.clear();
 
      if( EMIT_FORM_TAGS )
      {
       for( int k = 0; k < token_features[iword]->allform_tags.size(); ++k )
       {
-       str_features.push_back( lem::format_str( "%d", token_features[iword]->allform_tags[k] ).c_str() );
+       const int aid = feature_index.Find( ModelFeatureIndex::FormTag, 0, token_features[iword]->allform_tags[k] );
+       if( aid!=UNKNOWN )
+        attr_ids.push_back(aid);
       }
      }
 
      // -----------------------------
      //    
      // -----------------------------
-     PullFeatures1( str_features, token_features, iword, 0, true, EMIT_AA_FEATURE );
+     PullFeatureIds1( attr_ids, feature_index, token_features, iword, 0, true, EMIT_AA_FEATURE );
 
      const bool rich_context = EMIT_POS_FOR_CONTEXT || EMIT_MORPH_FOR_CONTEXT || EMIT_FORMTAGS_FOR_CONTEXT;
 
      //   
      if( CONTEXT_SIZE>3 )
-      PullFeatures1( str_features, token_features, iword, -4, rich_context, EMIT_AA_FOR_CONTEXT );
+      PullFeatureIds1( attr_ids, feature_index, token_features, iword, -4, rich_context, EMIT_AA_FOR_CONTEXT );
 
      if( CONTEXT_SIZE>2 )
-      PullFeatures1( str_features, token_features, iword, -3, rich_context, EMIT_AA_FOR_CONTEXT );
+      PullFeatureIds1( attr_ids, feature_index, token_features, iword, -3, rich_context, EMIT_AA_FOR_CONTEXT );
 
      if( CONTEXT_SIZE>1 )
-      PullFeatures1( str_features, token_features, iword, -2, rich_context, EMIT_AA_FOR_CONTEXT );
+      PullFeatureIds1( attr_ids, feature_index, token_features, iword, -2, rich_context, EMIT_AA_FOR_CONTEXT );
 
      if( CONTEXT_SIZE>0 )
       {
-       PullFeatures1( str_features, token_features, iword, -1, rich_context, EMIT_AA_FOR_CONTEXT );
-       PullFeatures1( str_features, token_features, iword, 1, rich_context, EMIT_AA_FOR_CONTEXT );
+       PullFeatureIds1( attr_ids, feature_index, token_features, iword, -1, rich_context, EMIT_AA_FOR_CONTEXT );
+       PullFeatureIds1( attr_ids, feature_index, token_features, iword, 1, rich_context, EMIT_AA_FOR_CONTEXT );
       }
 
      if( CONTEXT_SIZE>1 )
-      PullFeatures1( str_features, token_features, iword, 2, rich_context, EMIT_AA_FOR_CONTEXT );
+      PullFeatureIds1( attr_ids, feature_index, token_features, iword, 2, rich_context, EMIT_AA_FOR_CONTEXT );
 
      if( CONTEXT_SIZE>2 )
-      PullFeatures1( str_features, token_features, iword, 3, rich_context, EMIT_AA_FOR_CONTEXT );
+      PullFeatureIds1( attr_ids, feature_index, token_features, iword, 3, rich_context, EMIT_AA_FOR_CONTEXT );
 
      if( CONTEXT_SIZE>3 )
-      PullFeatures1( str_features, token_features, iword, 4, rich_context, EMIT_AA_FOR_CONTEXT );
+      PullFeatureIds1( attr_ids, feature_index, token_features, iword, 4, rich_context, EMIT_AA_FOR_CONTEXT );
 
      if( EMIT_PAIRWISE_FEATURE )
       {
-       PullFeatures2( str_features, token_features, iword, -3, -2 );
-       PullFeatures2( str_features, token_features, iword, -2, -1 );
-       PullFeatures2( str_features, token_features, iword, -1, 0 );
-       PullFeatures2( str_features, token_features, iword, 0, 1 );
-       PullFeatures2( str_features, token_features, iword, 1, 2 );
-       PullFeatures2( str_features, token_features, iword, 3, 4 );
+       PullFeatureIds2( attr_ids, feature_index, token_features, iword, -3, -2 );
+       PullFeatureIds2( attr_ids, feature_index, token_features, iword, -2, -1 );
+       PullFeatureIds2( attr_ids, feature_index, token_features, iword, -1, 0 );
+       PullFeatureIds2( attr_ids, feature_index, token_features, iword, 0, 1 );
+       PullFeatureIds2( attr_ids, feature_index, token_features, iword, 1, 2 );
+       PullFeatureIds2( attr_ids, feature_index, token_features, iword, 3, 4 );
       }
 
      if( EMIT_TRIPLE_FEATURE )
       {
-       PullFeatures3( str_features, token_features, iword, -3, -2, -1 );
-       PullFeatures3( str_features, token_features, iword, -2, -1, 0 );
-       PullFeatures3( str_features, token_features, iword, -1, 0, 1 );
-       PullFeatures3( str_features, token_features, iword, 0, 1, 2 );
-       PullFeatures3( str_features, token_features, iword, 1, 2, 3 );
+       PullFeatureIds3( attr_ids, feature_index, token_features, iword, -3, -2, -1 );
+       PullFeatureIds3( attr_ids, feature_index, token_features, iword, -2, -1, 0 );
+       PullFeatureIds3( attr_ids, feature_index, token_features, iword, -1, 0, 1 );
+       PullFeatureIds3( attr_ids, feature_index, token_features, iword, 0, 1, 2 );
+       PullFeatureIds3( attr_ids, feature_index, token_features, iword, 1, 2, 3 );
       }
    
 
 /*
      #if LEM_DEBUGGING==1
      lem::mout->printf( "CRF token #%d tags==>", iword );
-     for( int q=0; q<str_features.size(); ++q )
+     for( int q=0; q<attr_ids.size(); ++q )
      {
-      lem::mout->printf( " %s", str_features[q].c_str() );
+      lem::mout->printf( " %d", attr_ids[q] );
      }
      lem::mout->eol();
      #endif
 */
 
-     //  str_features        
+     //  attr_ids        
    
      /* Initialize an item. */
      crfsuite_item_t item;
      crfsuite_item_init(&item);
    
-     for( int k=0; k<CastSizeToInt(str_features.size()); ++k )
+     for( int k=0; k<CastSizeToInt(attr_ids.size()); ++k )
       {
-       crfsuite_attribute_t cont;
+       crfsuite_attribute_t cont;
    
-       /* Fields after the first field present attributes. */
-       const char * token_attr = str_features[k].c_str();
-       int aid = attrs->to_id( attrs, /*token->attr*/token_attr );
-       /* Ignore attributes 'unknown' to the model. */
-       if( 0 <= aid )
+       /* ,  ,      feature_index. */
+       const int aid = attr_ids[k];
         {
          /* Associate the attribute with the current item. */
          //if (token->value && *token->value)
@@ -291,14 +403,23 @@ void SequenceLabelerModel::Apply( BasicLexer & lexer, Dictionary & dict, const E
    floatval_t score = 0;
    int *output = (int*)calloc(sizeof(int), inst.num_items);
 
+   //         .
+   TaggerSlot slot = AcquireTagger();
+   if( slot.tagger==NULL )
+    {
+     LEM_STOPIT;
+    }
+
    /* Set the instance to the tagger. */
-   if ((ret = tagger->set(tagger, &inst)))
-   {
-    LEM_STOPIT;
-   }
+   ret = slot.tagger->set(slot.tagger, &inst);
 
    /* Obtain the viterbi label sequence. */
-   if ((ret = tagger->viterbi(tagger, output, &score)))
+   if( ret==0 )
+    ret = slot.tagger->viterbi(slot.tagger, output, &score);
+
+   ReleaseTagger(slot);
+
+   if( ret!=0 )
    {
     LEM_STOPIT;
    }
@@ -306,10 +427,10 @@ void SequenceLabelerModel::Apply( BasicLexer & lexer, Dictionary & dict, const E
   // output   ID   .
   lem::MCollect<int> tag_ids;
 
-  for (i = 0;i < inst.num_items;++i)
+  for( int k=0; k<inst.num_items; ++k )
    {
     const char *label = NULL;
-    labels->to_string(labels, output[i], &label);
+    labels->to_string(labels, output[k], &label);
     //fprintf(fpo, "%s", label);
     int id=UNKNOWN;
     if( lem::is_int(label) )
@@ -293,6 +293,41 @@ bool SynPatternPoint::EqualHead( const SynPatternPoint &x ) const
 }
 
 
+//     Match_WordformStrict:   
+//  ,          
+// (  eqi,     ),    .
+int SynPatternPoint::GetDispatchKey( int & key, lem::UCString & lower_lexeme ) const
+{
+ key = UNKNOWN;
+ lower_lexeme.clear();
+
+ // ,     -   .
+ if( !function_name.empty() || id_tree!=UNKNOWN || check_fun.NotNull() )
+  return DispatchAny;
+
+ if( !lexeme.empty() )
+  {
+   lower_lexeme = lexeme;
+   lower_lexeme.to_lower();
+   return DispatchLexeme;
+  }
+
+ if( ekey!=UNKNOWN && ekey!=ANY_STATE )
+  {
+   key = ekey;
+   return DispatchEntry;
+  }
+
+ if( iclass!=UNKNOWN && iclass!=ANY_STATE )
+  {
+   key = iclass;
+   return DispatchClass;
+  }
+
+ return DispatchAny;
+}
+
+
 
 #if defined SOL_LOADTXT && defined SOL_COMPILER
 void SynPatternPoint::RegisterRootNodeExport( SynPatternCompilation & compilation_context ) const
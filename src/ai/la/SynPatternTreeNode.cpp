@@ -2,6 +2,8 @@
 
 #include <lem/solarix/pm_autom.h>
 #include <lem/solarix/la_autom.h>
+#include <lem/solarix/sg_autom.h>
+#include <lem/solarix/WordEntry.h>
 #include <lem/solarix/variator.h>
 #include <lem/solarix/LA_SynPatternTrees.h>
 #include <lem/solarix/BackTrace.h>
@@ -12,18 +14,19 @@
 #include <lem/solarix/LexerTextPos.h>
 #include <lem/solarix/ElapsedTimeConstraint.h>
 #include <lem/solarix/SynPatternTreeNodeMatchingResults.h>
+#include <lem/solarix/SynPatternBestResults.h>
 
 
 using namespace lem;
 using namespace Solarix;
 
 
-SynPatternTreeNode::SynPatternTreeNode(void) : bottomup(false)
+SynPatternTreeNode::SynPatternTreeNode(void) : bottomup(false), dispatch_ready(false)
 {
 }
 
 #if defined SOL_LOADTXT && defined SOL_COMPILER
-SynPatternTreeNode::SynPatternTreeNode( const lem::MCollect<SynPatternPoint*> & points ) : bottomup(false)
+SynPatternTreeNode::SynPatternTreeNode( const lem::MCollect<SynPatternPoint*> & points ) : bottomup(false), dispatch_ready(false)
 {
  point.push_back( new SynPatternPoint( * points.front() ) );
  leaf.push_back( new SynPatternTreeNode( points, 0 ) );
@@ -33,7 +36,7 @@ SynPatternTreeNode::SynPatternTreeNode( const lem::MCollect<SynPatternPoint*> &
 
 
 #if defined SOL_LOADTXT && defined SOL_COMPILER
-SynPatternTreeNode::SynPatternTreeNode( const lem::MCollect<SynPattern*> & patterns ) : bottomup(false)
+SynPatternTreeNode::SynPatternTreeNode( const lem::MCollect<SynPattern*> & patterns ) : bottomup(false), dispatch_ready(false)
 {
  //        
  for( lem::Container::size_type i=0; i<patterns.size(); ++i )
@@ -105,7 +108,7 @@ SynPatternTreeNode::SynPatternTreeNode( const lem::MCollect<SynPattern*> & patte
 
 
 #if defined SOL_LOADTXT && defined SOL_COMPILER
-SynPatternTreeNode::SynPatternTreeNode( const lem::MCollect<SynPatternPoint*> & points, int ipoint ) : bottomup(false)
+SynPatternTreeNode::SynPatternTreeNode( const lem::MCollect<SynPatternPoint*> & points, int ipoint ) : bottomup(false), dispatch_ready(false)
 {
  if( ipoint+1 < CastSizeToInt(points.size()) )
   {
@@ -120,7 +123,7 @@ SynPatternTreeNode::SynPatternTreeNode( const lem::MCollect<SynPatternPoint*> &
 
 
 #if defined SOL_LOADTXT && defined SOL_COMPILER
-SynPatternTreeNode::SynPatternTreeNode( const SynPattern & pattern, int ipoint ) : bottomup(false)
+SynPatternTreeNode::SynPatternTreeNode( const SynPattern & pattern, int ipoint ) : bottomup(false), dispatch_ready(false)
 {
  //   ipoint+1     
  if( ipoint+1 < CastSizeToInt(pattern.GetPointChain().size()) )
@@ -197,6 +200,117 @@ void SynPatternTreeNode::Link( const TrFunctions &funs )
  for( lem::Container::size_type j=0; j<leaf.size(); ++j )
   leaf[j]->Link(funs);
 
+ BuildDispatchIndex();
+
+ return;
+}
+#endif
+
+
+//          .
+static const int MIN_DISPATCH_POINTS=4;
+
+void SynPatternTreeNode::BuildDispatchIndex(void)
+{
+ dispatch_ready = false;
+ dispatch_any.clear();
+ dispatch_entry.clear();
+ dispatch_class.clear();
+ dispatch_lexeme.clear();
+
+ if( CastSizeToInt(point.size())<MIN_DISPATCH_POINTS )
+  return;
+
+ //        ,   point.
+ for( lem::Container::size_type i=0; i<point.size(); ++i )
+  {
+   int key=UNKNOWN;
+   lem::UCString lexeme;
+
+   switch( point[i]->GetDispatchKey( key, lexeme ) )
+   {
+    case SynPatternPoint::DispatchLexeme: dispatch_lexeme[lexeme].push_back( CastSizeToInt(i) ); break;
+    case SynPatternPoint::DispatchEntry:  dispatch_entry[key].push_back( CastSizeToInt(i) );      break;
+    case SynPatternPoint::DispatchClass:  dispatch_class[key].push_back( CastSizeToInt(i) );      break;
+    default:                              dispatch_any.push_back( CastSizeToInt(i) );             break;
+   }
+  }
+
+ dispatch_ready = true;
+ return;
+}
+
+
+#if defined SOL_CAA && !defined SOL_NO_AA
+static void AppendCandidates( lem::MCollect<int> & dst, const lem::MCollect<int> & src )
+{
+ std::copy( src.begin(), src.end(), std::back_inserter(dst) );
+ return;
+}
+
+
+//  ,     current_token. 
+//   ,       ,
+//     ,     .
+void SynPatternTreeNode::GetDispatchCandidates(
+                                               SynGram &sg,
+                                               const LexerTextPos * current_token,
+                                               lem::MCollect<int> & candidates
+                                              ) const
+{
+ candidates = dispatch_any;
+
+ //       .
+ if( !current_token->IsBeyondRight() )
+  {
+   const Word_Form & wf = * current_token->GetWordform();
+   bool unknown_class=false;
+
+   const int nalt = wf.VersionCount();
+   for( int ialt=0; ialt<nalt; ++ialt )
+    {
+     const Word_Form * alt = wf.GetVersion(ialt);
+
+     if( !dispatch_lexeme.empty() )
+      {
+       lem::UCString word( * alt->GetName() );
+       word.to_lower();
+       DISPATCH_STR::const_iterator it = dispatch_lexeme.find(word);
+       if( it!=dispatch_lexeme.end() )
+        AppendCandidates( candidates, it->second );
+      }
+
+     const int alt_ekey = alt->GetEntryKey();
+
+     if( !dispatch_entry.empty() )
+      {
+       DISPATCH_INT::const_iterator it = dispatch_entry.find(alt_ekey);
+       if( it!=dispatch_entry.end() )
+        AppendCandidates( candidates, it->second );
+      }
+
+     if( !dispatch_class.empty() )
+      {
+       if( alt_ekey==UNKNOWN )
+        unknown_class = true;
+       else
+        {
+         DISPATCH_INT::const_iterator it = dispatch_class.find( sg.GetEntry(alt_ekey).GetClass() );
+         if( it!=dispatch_class.end() )
+          AppendCandidates( candidates, it->second );
+        }
+      }
+    }
+
+   //         -    .
+   if( unknown_class )
+    for( DISPATCH_INT::const_iterator it=dispatch_class.begin(); it!=dispatch_class.end(); ++it )
+     AppendCandidates( candidates, it->second );
+  }
+
+ std::sort( candidates.begin(), candidates.end() );
+ candidates.resize( std::unique( candidates.begin(), candidates.end() ) - candidates.begin() );
+
  return;
 }
 #endif
@@ -282,45 +396,6 @@ static void Append( SYNPATTERN_DEBUG_TRACE & dst, const SYNPATTERN_DEBUG_TRACE &
 
 
 
-struct BestResults : lem::NonCopyable
-{
- lem::PtrCollect<EXPORTED_COORDS> best_exported_coords;
- lem::PtrCollect<MATCHING_ALTS> best_matching_alts;
- lem::PtrCollect<EXPORTED_NODES> best_exported_nodes;
- lem::PtrCollect<LINKAGE_GROUPS> best_linkage_groups;
- lem::PtrCollect<LINKAGE_EDGES> best_linkage_edges;
- lem::PtrCollect<BackTrace> best_backtrace;
- lem::MCollect<int> matching_len;
- lem::MCollect<NGramScore> ngram_freqs;
- lem::MCollect<const LexerTextPos*> start_token;
- lem::MCollect<const LexerTextPos*> final_token;
-
- #if defined SOL_DEBUGGING
- lem::PtrCollect<SYNPATTERN_DEBUG_TRACE> best_debug_trace;
- #endif
-
- void Clear(void)
- {
-  best_exported_coords.clear();
-  best_matching_alts.clear();
-  best_backtrace.clear();
-  matching_len.clear();
-  best_exported_nodes.clear();
-  best_linkage_groups.clear();
-  best_linkage_edges.clear();
-  ngram_freqs.clear();
-  start_token.clear();
-  final_token.clear();
-
-  #if defined SOL_DEBUGGING
-  best_debug_trace.clear();
-  #endif
-
-  return;
- }
-};
-
-
 namespace {
 /*
 static bool result_sorter( const SynPatternResult * x, const SynPatternResult * y )
@@ -742,8 +817,26 @@ bool SynPatternTreeNode::Match(
 
  BestResults *best_results=NULL;
 
- for( lem::Container::size_type i=0; i<point.size(); ++i )
+ //      .   ,   
+ //   ,       Equal.
+ lem::MCollect<int> candidates;
+ const bool use_dispatch = dispatch_ready && trace_log==NULL && !lexer.GetParams().CanSkipInnerTokens();
+ if( use_dispatch )
   {
+   GetDispatchCandidates( sg, current_token, candidates );
+   experience.CountPointChecks( CastSizeToInt(candidates.size()), CastSizeToInt(point.size()-candidates.size()) );
+  }
+ else
+  {
+   experience.CountPointChecks( CastSizeToInt(point.size()), 0 );
+  }
+
+ const lem::Container::size_type n_check = use_dispatch ? candidates.size() : point.size();
+
+ for( lem::Container::size_type icheck=0; icheck<n_check; ++icheck )
+  {
+   const lem::Container::size_type i = use_dispatch ? candidates[icheck] : icheck;
+
    //      wf
 
    lem::PtrCollect<SynPatternResult> subresults;
@@ -797,24 +890,24 @@ bool SynPatternTreeNode::Match(
          const int len2 = xres.res.Length();
 
          if( best_results==NULL )
-          best_results = new BestResults();
+          best_results = BestResults::Create( lexer.GetArena() );
 
          //   .
 
          #if defined SOL_DEBUGGING
-         SYNPATTERN_DEBUG_TRACE * debug_trace = new SYNPATTERN_DEBUG_TRACE;
+         SYNPATTERN_DEBUG_TRACE * debug_trace = best_results->New<SYNPATTERN_DEBUG_TRACE>();
          Append( *debug_trace, xres.debug_trace );
          best_results->best_debug_trace.push_back( debug_trace );
          #endif
 
-         MATCHING_ALTS *matching_alts = new MATCHING_ALTS();
+         MATCHING_ALTS *matching_alts = best_results->New<MATCHING_ALTS>();
          Append( *matching_alts, xres.matched_alts );
          best_results->best_matching_alts.push_back(matching_alts);
 
          EXPORTED_COORDS *exported_coords=NULL;
          if( !xres.exported_coords.empty() )
           {
-           exported_coords = new EXPORTED_COORDS();
+           exported_coords = best_results->New<EXPORTED_COORDS>();
            Append( *exported_coords, xres.exported_coords );
           }
          best_results->best_exported_coords.push_back(exported_coords);
@@ -822,22 +915,22 @@ bool SynPatternTreeNode::Match(
          EXPORTED_NODES *exported_nodes = NULL;
          if( !xres.exported_nodes.empty() )
           {
-           exported_nodes = new EXPORTED_NODES( xres.exported_nodes );
+           exported_nodes = best_results->Copy<EXPORTED_NODES>( xres.exported_nodes );
           }
          best_results->best_exported_nodes.push_back(exported_nodes);
 
          LINKAGE_GROUPS * linkage_groups = NULL;
          if( !xres.linkage_groups.empty() )
-          linkage_groups = new LINKAGE_GROUPS(xres.linkage_groups);
+          linkage_groups = best_results->Copy<LINKAGE_GROUPS>( xres.linkage_groups );
          best_results->best_linkage_groups.push_back( linkage_groups );
 
          LINKAGE_EDGES * linkage_edges = NULL;
          if( !xres.linkage_edges.empty() )
-          linkage_edges = new LINKAGE_EDGES(xres.linkage_edges);
+          linkage_edges = best_results->Copy<LINKAGE_EDGES>( xres.linkage_edges );
          best_results->best_linkage_edges.push_back( linkage_edges );
 
 
-         BackTrace *backtrace = new BackTrace();
+         BackTrace *backtrace = best_results->New<BackTrace>();
          xres.trace.CollectAll( backtrace );
          best_results->best_backtrace.push_back( backtrace );
 
@@ -900,7 +993,7 @@ bool SynPatternTreeNode::Match(
              if( len2>=max_len || !greedy )
               {
                if( best_results==NULL )
-                best_results = new BestResults();
+                best_results = BestResults::Create( lexer.GetArena() );
         
                if( (len2>max_len || (len2==max_len && ngram_freq_sum>max_ngram_freq)) && greedy )
                 {
@@ -911,13 +1004,13 @@ bool SynPatternTreeNode::Match(
                //   .
         
                #if defined SOL_DEBUGGING
-               SYNPATTERN_DEBUG_TRACE * debug_trace = new SYNPATTERN_DEBUG_TRACE(xres.debug_trace);
+               SYNPATTERN_DEBUG_TRACE * debug_trace = best_results->Copy<SYNPATTERN_DEBUG_TRACE>( xres.debug_trace );
                Append( *debug_trace, yres.debug_trace );
                best_results->best_debug_trace.push_back( debug_trace );
                #endif
 
 
-               MATCHING_ALTS *matching_alts = new MATCHING_ALTS();
+               MATCHING_ALTS *matching_alts = best_results->New<MATCHING_ALTS>();
                Append( *matching_alts, xres.matched_alts );
                Append( *matching_alts, yres.matched_alts ); 
                best_results->best_matching_alts.push_back(matching_alts);
@@ -926,7 +1019,7 @@ bool SynPatternTreeNode::Match(
                EXPORTED_COORDS *exported_coords = NULL;
                if( !xres.exported_coords.empty() || !yres.exported_coords.empty() )
                 {
-                 exported_coords = new EXPORTED_COORDS();
+                 exported_coords = best_results->New<EXPORTED_COORDS>();
                  Append( *exported_coords, xres.exported_coords );
                  Append( *exported_coords, yres.exported_coords );
                 }
@@ -936,7 +1029,7 @@ bool SynPatternTreeNode::Match(
                EXPORTED_NODES *exported_nodes = NULL;
                if( !xres.exported_nodes.empty() || !yres.exported_nodes.empty() )
                 {
-                 exported_nodes = new EXPORTED_NODES( xres.exported_nodes );
+                 exported_nodes = best_results->Copy<EXPORTED_NODES>( xres.exported_nodes );
                  Append( *exported_nodes, yres.exported_nodes );
                 }
                best_results->best_exported_nodes.push_back( exported_nodes );
@@ -945,7 +1038,7 @@ bool SynPatternTreeNode::Match(
                LINKAGE_GROUPS * linkage_groups = NULL;
                if( !xres.linkage_groups.empty() || !yres.linkage_groups.empty() )
                 {
-                 linkage_groups = new LINKAGE_GROUPS( xres.linkage_groups );
+                 linkage_groups = best_results->Copy<LINKAGE_GROUPS>( xres.linkage_groups );
                  Append( *linkage_groups, yres.linkage_groups );
                 }
                best_results->best_linkage_groups.push_back( linkage_groups );
@@ -953,13 +1046,13 @@ bool SynPatternTreeNode::Match(
                LINKAGE_EDGES * linkage_edges = NULL;
                if( !xres.linkage_edges.empty() || !yres.linkage_edges.empty() )
                 {
-                 linkage_edges = new LINKAGE_EDGES( xres.linkage_edges );
+                 linkage_edges = best_results->Copy<LINKAGE_EDGES>( xres.linkage_edges );
                  Append( *linkage_edges, yres.linkage_edges );
                 }
                best_results->best_linkage_edges.push_back( linkage_edges );
         
         
-               BackTrace *backtrace = new BackTrace();
+               BackTrace *backtrace = best_results->New<BackTrace>();
                yres.trace.CollectAll( backtrace );
                best_results->best_backtrace.push_back( backtrace );
         
@@ -1000,7 +1093,7 @@ bool SynPatternTreeNode::Match(
            if( (len2 >= max_len) || !greedy )
             {
              if( best_results==NULL )
-              best_results = new BestResults();
+              best_results = BestResults::Create( lexer.GetArena() );
       
              if( (len2>max_len || (len2==max_len && xres.res.GetNGramFreq()>max_ngram_freq) ) && greedy )
               {
@@ -1011,35 +1104,35 @@ bool SynPatternTreeNode::Match(
              //   .
       
              #if defined SOL_DEBUGGING
-             SYNPATTERN_DEBUG_TRACE * debug_trace = new SYNPATTERN_DEBUG_TRACE(xres.debug_trace);
+             SYNPATTERN_DEBUG_TRACE * debug_trace = best_results->Copy<SYNPATTERN_DEBUG_TRACE>( xres.debug_trace );
              best_results->best_debug_trace.push_back( debug_trace );
              #endif
       
-             MATCHING_ALTS *matching_alts = new MATCHING_ALTS();
+             MATCHING_ALTS *matching_alts = best_results->New<MATCHING_ALTS>();
              Append( *matching_alts, xres.matched_alts );
              best_results->best_matching_alts.push_back(matching_alts);
       
              EXPORTED_COORDS *exported_coords = NULL;
              if( !xres.exported_coords.empty() )
-              exported_coords = new EXPORTED_COORDS(xres.exported_coords);
+              exported_coords = best_results->Copy<EXPORTED_COORDS>( xres.exported_coords );
              best_results->best_exported_coords.push_back(exported_coords);
       
              EXPORTED_NODES *exported_nodes = NULL;
              if( !xres.exported_nodes.empty() )
-              exported_nodes = new EXPORTED_NODES(xres.exported_nodes);
+              exported_nodes = best_results->Copy<EXPORTED_NODES>( xres.exported_nodes );
              best_results->best_exported_nodes.push_back(exported_nodes);
       
              LINKAGE_GROUPS * linkage_groups = NULL;
              if( !xres.linkage_groups.empty() )
-              linkage_groups = new LINKAGE_GROUPS( xres.linkage_groups );
+              linkage_groups = best_results->Copy<LINKAGE_GROUPS>( xres.linkage_groups );
              best_results->best_linkage_groups.push_back( linkage_groups );
       
              LINKAGE_EDGES * linkage_edges = NULL;
              if( !xres.linkage_edges.empty() )
-              linkage_edges = new LINKAGE_EDGES( xres.linkage_edges );
+              linkage_edges = best_results->Copy<LINKAGE_EDGES>( xres.linkage_edges );
              best_results->best_linkage_edges.push_back( linkage_edges );
       
-             BackTrace *backtrace = new BackTrace();
+             BackTrace *backtrace = best_results->New<BackTrace>();
              xres.trace.CollectAll( backtrace );
              best_results->best_backtrace.push_back( backtrace );
       
@@ -1073,7 +1166,7 @@ bool SynPatternTreeNode::Match(
 
  if( point_matches )
   {
-   for( lem::Container::size_type i=0; i<best_results->best_matching_alts.size(); ++i )
+   for( int i=0; i<best_results->best_matching_alts.size(); ++i )
     {
      const MATCHING_ALTS &a = *best_results->best_matching_alts[i];
      const EXPORTED_COORDS *c = best_results->best_exported_coords[i];
@@ -1102,8 +1195,7 @@ bool SynPatternTreeNode::Match(
    Limit( lexer, results, sg );
   }
 
- if( best_results!=NULL )
-  delete best_results;
+ BestResults::Destroy(best_results);
 
  return point_matches;
 }
@@ -1265,9 +1357,16 @@ SynPatternTreeNodeMatchingResults* SynPatternTreeNode::IncompleteAnalysis(
   }
  
  //    ,      (???)
- for( int i=CastSizeToInt(result->results.size())-1; i>=0; --i )
-  if( !result->results[i]->res.GetFinalToken()->IsEnd() )
-   result->results.Remove(i);
+ //              ,
+ //     -    .
+ bool complete_found=false;
+ for( lem::Container::size_type i=0; i<result->results.size() && !complete_found; ++i )
+  complete_found = result->results[i]->res.GetFinalToken()->IsEnd();
+
+ if( complete_found || !constraints.Exceeded() )
+  for( int i=CastSizeToInt(result->results.size())-1; i>=0; --i )
+   if( !result->results[i]->res.GetFinalToken()->IsEnd() )
+    result->results.Remove(i);
  
  /*
  #if LEM_DEBUGGING==1
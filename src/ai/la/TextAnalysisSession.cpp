@@ -12,6 +12,7 @@
 #include <lem/solarix/PreparedLexer.h>
 #include <lem/solarix/MorphologyModels.h>
 #include <lem/solarix/aa_autom.h>
+#include <lem/solarix/TextAnalysisProfile.h>
 #include <lem/solarix/TextAnalysisSession.h>
 
 #if LEM_DEBUGGING==1
@@ -23,7 +24,7 @@ using namespace Solarix;
 
 
 TextAnalysisSession::TextAnalysisSession( Solarix::Dictionary * _dict, TrTrace * _trace )
- : dict(_dict), trace(_trace), lexer(NULL), pack(NULL)
+ : dict(_dict), trace(_trace), lexer(NULL), pack(NULL), n_point_checked(0), n_point_skipped(0), profile(NULL)
 {
  FindFacts = false;
  rules = & dict->GetLexAuto().GetSynPatternTrees();
@@ -39,9 +40,39 @@ TextAnalysisSession::~TextAnalysisSession()
 
 
 
+void TextAnalysisSession::BeginStage()
+{
+ if( profile!=NULL )
+  profile->Begin();
+
+ return;
+}
+
+
+void TextAnalysisSession::EndStage( int stage )
+{
+ if( profile!=NULL )
+  profile->End( stage );
+
+ return;
+}
+
+
 void TextAnalysisSession::Analyze( bool ApplyPatterns, bool DoSyntaxLinks, const ElapsedTimeConstraint &constraints )
 {
  lem_rub_off(pack);
+ n_point_checked = n_point_skipped = 0;
+
+ if( profile!=NULL )
+  {
+   //         .
+   //     ,     
+   //       -    .
+   BeginStage();
+   lem::MCollect<const LexerTextPos*> leafs;
+   lexer->FetchEnds( lexer->GetBeginToken(), leafs, lexer->GetParams().GetMaxRightLeaves() );
+   EndStage( TextAnalysisProfile::Tokenize );
+  }
 
  //         lexer.
 
@@ -58,7 +89,9 @@ void TextAnalysisSession::Analyze( bool ApplyPatterns, bool DoSyntaxLinks, const
    if( dict->GetLexAuto().GetModel().GetSequenceLabeler().IsAvailable() )
     {
      SequenceLabelerModel & model = dict->GetLexAuto().GetModel().GetSequenceLabeler();
+     BeginStage();
      model.Apply( *lexer, *dict, constraints, false );
+     EndStage( TextAnalysisProfile::Model );
 
      #if defined SOL_DEBUGGING
      if( trace!=NULL )
@@ -99,10 +132,15 @@ void TextAnalysisSession::Analyze( bool ApplyPatterns, bool DoSyntaxLinks, const
     {
      int algorithm = scheduled_algorithms[step];
 
+     //         .
+     const int parse_stage = step==0 ? TextAnalysisProfile::Parse : TextAnalysisProfile::Fallback;
+
      if( algorithm==UseTopDown )
       {
        //     - .
+       BeginStage();
        results = TopDownParsing( ApplyPatterns, DoSyntaxLinks, experience, constraints );
+       EndStage( parse_stage );
 
        if( results.NotNull() && !results->empty() )
         {
@@ -112,7 +150,9 @@ void TextAnalysisSession::Analyze( bool ApplyPatterns, bool DoSyntaxLinks, const
 
          UseDefaultScheme=false;
          results->ApplyTokenScores();
+         BeginStage();
          pack = results->BuildGrafs( *dict, *lexer, DoSyntaxLinks, false, constraints, trace );
+         EndStage( TextAnalysisProfile::Build );
 
          #if LEM_DEBUGGING==1
          //pack->Print( *lem::mout, dict->GetSynGram(), true );
@@ -133,6 +173,7 @@ void TextAnalysisSession::Analyze( bool ApplyPatterns, bool DoSyntaxLinks, const
 
        experience.ClearPatternMatchings();
 
+       BeginStage();
        results = TopDownParsing( ApplyPatterns, DoSyntaxLinks, experience, constraints );
 
        if( (results.IsNull() || results->empty()) && !constraints.Exceeded() )
@@ -155,6 +196,8 @@ void TextAnalysisSession::Analyze( bool ApplyPatterns, bool DoSyntaxLinks, const
           }
         }
 
+       EndStage( parse_stage );
+
        if( results.NotNull() && !results->empty() )
         {
          #if LEM_DEBUGGING==1
@@ -164,7 +207,9 @@ void TextAnalysisSession::Analyze( bool ApplyPatterns, bool DoSyntaxLinks, const
          UseDefaultScheme=false;
        
          results->ApplyTokenScores();
+         BeginStage();
          pack = results->BuildGrafs( *dict, *lexer, DoSyntaxLinks, false, constraints, trace );
+         EndStage( TextAnalysisProfile::Build );
          break;
         }
       }
@@ -172,6 +217,9 @@ void TextAnalysisSession::Analyze( bool ApplyPatterns, bool DoSyntaxLinks, const
      if( constraints.Exceeded() )
       break; //   ,   .
     }
+
+   n_point_checked = experience.CountCheckedPoints();
+   n_point_skipped = experience.CountSkippedPoints();
   }
 
  if( UseDefaultScheme )
@@ -179,7 +227,9 @@ void TextAnalysisSession::Analyze( bool ApplyPatterns, bool DoSyntaxLinks, const
    //      ,         
    //   .
    SynPatternTreeNodeMatchingResults empty;
+   BeginStage();
    pack = empty.BuildGrafs( *dict, *lexer, false, params.CompleteAnalysisOnly, constraints, trace );
+   EndStage( TextAnalysisProfile::Build );
   }
 
  #if defined SOL_DEBUGGING
@@ -0,0 +1,228 @@
+// -----------------------------------------------------------------------------
+// File WORDRECOGNITIONCACHE.CPP
+//
+// (c) by Koziev Elijah     all rights reserved
+//
+// SOLARIX Intellectronix Project http://www.solarix.ru
+//                                http://sourceforge.net/projects/solarix
+//
+// Content:
+//        .
+// -----------------------------------------------------------------------------
+//
+// CD->16.10.2026
+// LC->16.10.2026
+// --------------
+
+#include <lem/solarix/word_form.h>
+#include <lem/solarix/WordRecognitionCache.h>
+
+using namespace Solarix;
+
+
+WordRecognitionCache::WordRecognitionCache( int _max_size )
+ : max_size(_max_size), generation(0)
+{
+}
+
+
+WordRecognitionCache::~WordRecognitionCache(void)
+{
+ Clear();
+ return;
+}
+
+
+WordRecognitionCache::Shard& WordRecognitionCache::GetShard( const Key &key )
+{
+ const unsigned int h = unsigned(key.word.GetHash16()) ^ unsigned(key.case_flags*31) ^ unsigned(key.id_language*131);
+ return shards[ h % N_SHARD ];
+}
+
+
+Word_Form* WordRecognitionCache::Find( const Key &key )
+{
+ if( max_size<=0 )
+  return NULL;
+
+ Shard &shard = GetShard(key);
+
+ #if defined LEM_THREADS
+ lem::Process::CritSecLocker guard(&shard.cs);
+ #endif
+
+ ITEMS::const_iterator it = shard.items.find(key);
+ if( it==shard.items.end() )
+  {
+   shard.misses++;
+   return NULL;
+  }
+
+ shard.hits++;
+
+ //    ,        .
+ return new Word_Form( *it->second, true );
+}
+
+
+void WordRecognitionCache::Store( const Key &key, const Word_Form &wordform, int _generation )
+{
+ const int limit = max_size;
+ if( limit<=0 )
+  return;
+
+ Word_Form *copy = new Word_Form( wordform, true );
+
+ Shard &shard = GetShard(key);
+
+ #if defined LEM_THREADS
+ lem::Process::CritSecLocker guard(&shard.cs);
+ #endif
+
+ // Invalidate        , 
+ //         .
+ if( _generation!=GetGeneration() )
+  {
+   delete copy;
+   return;
+  }
+
+ std::pair<ITEMS::iterator,bool> res = shard.items.insert( std::make_pair(key,copy) );
+ if( !res.second )
+  {
+   //      .
+   delete copy;
+   return;
+  }
+
+ shard.order.push_back(res.first);
+ Evict( shard, limit>N_SHARD ? limit/N_SHARD : 1 );
+
+ return;
+}
+
+
+void WordRecognitionCache::Evict( Shard &shard, int shard_limit )
+{
+ while( int(shard.items.size())>shard_limit )
+  {
+   ITEMS::iterator it = shard.order.front();
+   shard.order.pop_front();
+   delete it->second;
+   shard.items.erase(it);
+  }
+
+ return;
+}
+
+
+void WordRecognitionCache::Clear(void)
+{
+ for( int i=0; i<N_SHARD; ++i )
+  {
+   Shard &shard = shards[i];
+
+   #if defined LEM_THREADS
+   lem::Process::CritSecLocker guard(&shard.cs);
+   #endif
+
+   for( ITEMS::iterator it=shard.items.begin(); it!=shard.items.end(); ++it )
+    delete it->second;
+
+   shard.items.clear();
+   shard.order.clear();
+   shard.hits = shard.misses = 0;
+  }
+
+ return;
+}
+
+
+int WordRecognitionCache::GetGeneration(void)
+{
+ #if defined LEM_THREADS
+ lem::Process::CritSecLocker guard(&cs_generation);
+ #endif
+
+ return generation;
+}
+
+
+void WordRecognitionCache::Invalidate(void)
+{
+ #if defined LEM_THREADS
+ {
+  lem::Process::CritSecLocker guard(&cs_generation);
+  generation++;
+ }
+ #else
+ generation++;
+ #endif
+
+ Clear();
+ return;
+}
+
+
+void WordRecognitionCache::SetMaxSize( int n )
+{
+ max_size = n;
+
+ for( int i=0; i<N_SHARD; ++i )
+  {
+   Shard &shard = shards[i];
+
+   #if defined LEM_THREADS
+   lem::Process::CritSecLocker guard(&shard.cs);
+   #endif
+
+   Evict( shard, n<=0 ? 0 : n>N_SHARD ? n/N_SHARD : 1 );
+  }
+
+ return;
+}
+
+
+int WordRecognitionCache::Count(void)
+{
+ int n=0;
+ for( int i=0; i<N_SHARD; ++i )
+  {
+   #if defined LEM_THREADS
+   lem::Process::CritSecLocker guard(&shards[i].cs);
+   #endif
+   n += CastSizeToInt(shards[i].items.size());
+  }
+
+ return n;
+}
+
+
+int WordRecognitionCache::CountHits(void)
+{
+ int n=0;
+ for( int i=0; i<N_SHARD; ++i )
+  {
+   #if defined LEM_THREADS
+   lem::Process::CritSecLocker guard(&shards[i].cs);
+   #endif
+   n += shards[i].hits;
+  }
+
+ return n;
+}
+
+
+int WordRecognitionCache::CountMisses(void)
+{
+ int n=0;
+ for( int i=0; i<N_SHARD; ++i )
+  {
+   #if defined LEM_THREADS
+   lem::Process::CritSecLocker guard(&shards[i].cs);
+   #endif
+   n += shards[i].misses;
+  }
+
+ return n;
+}
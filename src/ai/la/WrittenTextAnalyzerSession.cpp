@@ -14,6 +14,26 @@ WrittenTextAnalysisSession::WrittenTextAnalysisSession( Solarix::Dictionary * _d
 }
 
 
+WrittenTextAnalysisSession::~WrittenTextAnalysisSession()
+{
+ //     ,     .
+ lem_rub_off(lexer);
+ return;
+}
+
+
+void WrittenTextAnalysisSession::NewLexer( const lem::UFString & str )
+{
+ lem_rub_off(lexer);
+
+ //       .
+ arena.Reset();
+
+ lexer = new WrittenTextLexer( str, params, dict, trace, &arena );
+ return;
+}
+
+
 void WrittenTextAnalysisSession::ApplyFilters( const lem::UFString & str )
 {
  ElapsedTimeConstraint constraints( params.timeout.max_elapsed_millisecs );
@@ -95,8 +115,7 @@ void WrittenTextAnalysisSession::AnalyzeIt( const lem::UFString & str, bool Appl
    #endif
   }
 
- delete lexer;
- lexer = new WrittenTextLexer( str, params, dict, trace );
+ NewLexer(str);
 
  Analyze(ApplyPatterns,DoSyntacticLinks,constraints);
 
@@ -125,8 +144,7 @@ void WrittenTextAnalysisSession::Tokenize( const lem::UFString & str )
    #endif
   }
 
- delete lexer;
- lexer = new WrittenTextLexer( str, params, dict, trace );
+ NewLexer(str);
 
  Analyze(false,false,constraints);
 
@@ -11,6 +11,7 @@
 #include <lem/solarix/MorphFiltersInfo.h>
 #include <lem/solarix/TF_ClassFilter.h>
 #include <lem/solarix/MorphologyModels.h>
+#include <lem/solarix/WordRecognitionCache.h>
 
 #if defined SOL_DEBUGGING
 #include <lem/solarix/LA_PreprocessorTrace.h>
@@ -25,8 +26,9 @@ WrittenTextLexer::WrittenTextLexer(
                                    const lem::UFString & _text,
                                    const TextRecognitionParameters & _params,
                                    Solarix::Dictionary * _dict,
-                                   TrTrace * _trace
-                                  ) : BasicLexer(_dict,_params,_trace), text(_text)
+                                   TrTrace * _trace,
+                                   lem::MemArena * _arena
+                                  ) : BasicLexer(_dict,_params,_trace,_arena), text(_text)
 {
  rules = dict->GetTokenizationRules( params.language_ids );
 
@@ -139,7 +141,7 @@ void WrittenTextLexer::CallExternalTokenizer()
    //   .
    wordforms.push_back(wordform);
 
-   LexerTextPos * new_token = new LexerTextPos( prev_token, wordform, 0, -1, word.length(), CastSizeToInt(i) );
+   LexerTextPos * new_token = new(arena) LexerTextPos( prev_token, wordform, 0, -1, word.length(), CastSizeToInt(i) );
    positions.push_back(new_token);
    edges.insert( std::make_pair(prev_token,new_token) );
 
@@ -164,27 +166,6 @@ const Word_Form * WrittenTextLexer::Recognize( const lem::UCString & word, int W
 
  if( params.RecognizeWordforms )
   {
-   if( use_recognition_cache && TokenizationFlags==NULL )
-    {
-     std::map<lem::UCString,const Word_Form*>::iterator it = recognitions.find(word);
-     if( it!=recognitions.end() )
-      {
-       //   ,     .
-       //    ,          ,
-       //    .
-       Word_Form * copy = new Word_Form( *it->second, true );
-       copy->SetOriginPos(WordIndex);
- 
-       const int nver = copy->VersionCount()-1;
-       for( int i=0; i<nver; ++i )
-        copy->GetAlts()[i]->SetOriginPos(WordIndex);
- 
-       wordforms.push_back(copy);
-       return copy;
-      }
-    }
- 
- 
    //           .
  
    int case_flags=UNKNOWN;
@@ -244,7 +225,39 @@ const Word_Form * WrittenTextLexer::Recognize( const lem::UCString & word, int W
       case_flags = casing_coder->Lower;
     }
  
-   //   EachLexemCapitalized,    .
+   //   EachLexemCapitalized,    .
+
+   //       , ,  
+   //    ,        .
+   //     ,     .
+   WordRecognitionCache & shared_cache = dict->GetRecognitionCache();
+   const bool use_shared_cache = TokenizationFlags==NULL && trace==NULL && shared_cache.IsEnabled();
+
+   WordRecognitionCache::Key cache_key;
+   int cache_generation=0;
+   if( use_shared_cache )
+    {
+     cache_generation = shared_cache.GetGeneration();
+
+     cache_key.word = word;
+     cache_key.id_language = params.GetLanguageID();
+     cache_key.case_flags = case_flags;
+     cache_key.word_parts = WordParts;
+     cache_key.flags = (params.AllowPrimaryFuzzyWordRecog ? 1 : 0) | (params.AllowDynform ? 2 : 0);
+
+     Word_Form * cached = shared_cache.Find(cache_key);
+     if( cached!=NULL )
+      {
+       cached->SetOriginPos(WordIndex);
+
+       const int nver = cached->VersionCount()-1;
+       for( int i=0; i<nver; ++i )
+        cached->GetAlts()[i]->SetOriginPos(WordIndex);
+
+       wordforms.push_back(cached);
+       return cached;
+      }
+    }
  
    TokenizationTags * tags=NULL;
    if( case_flags!=UNKNOWN )
@@ -257,15 +270,15 @@ const Word_Form * WrittenTextLexer::Recognize( const lem::UCString & word, int W
    Word_Form * new_recognition = dict->GetLexAuto().ProjectWord( word, WordIndex, WordParts, tags, params, trace==NULL ? NULL : trace->RecognizerTrace() );
  
    lem_rub_off(tags);
+
+   if( use_shared_cache )
+    shared_cache.Store( cache_key, *new_recognition, cache_generation );
  
    if( TokenizationFlags!=NULL )
     new_recognition->SetTokenizerFlag(TokenizationFlags);
    
    //   .
    wordforms.push_back(new_recognition);
- 
-   //   .
-   // recognitions.insert( std::make_pair( word, new_recognition ) );
 
    return new_recognition;
   }
@@ -322,7 +335,7 @@ void WrittenTextLexer::TryToSplitToken(
        // 
        lem::UCString prefix_str = lem::left( *token->GetWordform()->GetName(), prefix_len );
        const Word_Form * prefix_wordform = Recognize( prefix_str, token->GetWordIndex(), 1, NULL );
-       LexerTextPos * prefix_token = new LexerTextPos( previous_token, prefix_wordform, score, token->GetStartPosition(), prefix_str.length(), token->GetWordIndex() );
+       LexerTextPos * prefix_token = new(arena) LexerTextPos( previous_token, prefix_wordform, score, token->GetStartPosition(), prefix_str.length(), token->GetWordIndex() );
        prefix_token->Reconstructed();
 
        positions.push_back( prefix_token );
@@ -332,7 +345,7 @@ void WrittenTextLexer::TryToSplitToken(
        // 
        lem::UCString suffix_str( token->GetWordform()->GetName()->c_str() + prefix_len );
        const Word_Form * suffix_wordform = Recognize( suffix_str, token->GetWordIndex()+1, 1, NULL );
-       LexerTextPos * suffix_token = new LexerTextPos( prefix_token, suffix_wordform, -1, token->GetStartPosition()+prefix_len, suffix_str.length(), token->GetWordIndex()+1 );
+       LexerTextPos * suffix_token = new(arena) LexerTextPos( prefix_token, suffix_wordform, -1, token->GetStartPosition()+prefix_len, suffix_str.length(), token->GetWordIndex()+1 );
        suffix_token->Reconstructed();
 
        positions.push_back( suffix_token );
@@ -488,7 +501,7 @@ void WrittenTextLexer::ExtractUnfiltered(
      //      ,   .
      //    -.
 
-     LexerTextPos_Terminator * new_token = new LexerTextPos_Terminator();
+     LexerTextPos_Terminator * new_token = new(arena) LexerTextPos_Terminator();
      tokens.push_back(new_token);
      positions.push_back( new_token );
      edges.insert( std::make_pair( PreviousToken, new_token ) );
@@ -581,7 +594,7 @@ void WrittenTextLexer::ExtractUnfiltered(
              //   
              const Word_Form * new_wordform = Recognize( ml, WordIndex, xlen+1, NULL );
 
-             LexerTextPos * new_token = new LexerTextPos(
+             LexerTextPos * new_token = new(arena) LexerTextPos(
                                                          PreviousToken,
                                                          new_wordform,
                                                          Score,
@@ -612,7 +625,7 @@ void WrittenTextLexer::ExtractUnfiltered(
        else
         {
          //   .
-         LexerTextPos * new_token = new LexerTextPos(
+         LexerTextPos * new_token = new(arena) LexerTextPos(
                                                      PreviousToken,
                                                      new_wordform,
                                                      Score,
@@ -673,7 +686,7 @@ bool WrittenTextLexer::Fetch(
    Word_Form *wf = new Word_Form( Solarix::Lexem(L"") );
    wordforms.push_back(wf);
 
-   LexerTextPos_BeyondRight * t = new LexerTextPos_BeyondRight( current, wf );
+   LexerTextPos_BeyondRight * t = new(arena) LexerTextPos_BeyondRight( current, wf );
    positions.push_back(t);
 
    next.push_back(t);
@@ -65,6 +65,7 @@
 #include <lem/solarix/WordAssociation.h>
 #include <lem/solarix/TreeScorers.h>
 #include <lem/solarix/MorphologyModels.h>
+#include <lem/solarix/LA_ScriptTable.h>
 #include <lem/solarix/la_autom.h>
 
 
@@ -81,6 +82,8 @@ LexicalAutomat::LexicalAutomat(void) : PM_Automat(SOL_LA_INDEX)
 
  #if defined SOL_CAA
  casing_coder = NULL;
+ script_table = NULL;
+ use_script_table = true;
  #endif
 
  unknown_entry_key = UNKNOWN;
@@ -133,6 +136,7 @@ LexicalAutomat::~LexicalAutomat(void)
 
  #if defined SOL_CAA
  lem_rub_off(casing_coder);
+ delete script_table;
  #endif
 
  lem_rub_off(word_proj);
@@ -1085,6 +1089,38 @@ Real1 LexicalAutomat::GetMinProjectionRel(void)
 }
 
 
+#if defined SOL_CAA
+const LA_ScriptTable& LexicalAutomat::GetScriptTable(void) const
+{
+ #if defined LEM_THREADS
+ lem::Process::RWU_ReaderGuard rlock(cs_script_table);
+ #endif
+ if( script_table==NULL )
+  {
+   #if defined LEM_THREADS
+   lem::Process::RWU_WriterGuard wlock(rlock);
+   #endif
+   if( script_table==NULL )
+    script_table = new LA_ScriptTable( GetDict() );
+  }
+
+ return *script_table;
+}
+#endif
+
+
+#if defined SOL_LOADBIN && defined SOL_CAA
+void LexicalAutomat::DictionaryLoaded(void)
+{
+ PM_Automat::DictionaryLoaded();
+
+ //    GuessLanguage  ,     .
+ GetScriptTable();
+ return;
+}
+#endif
+
+
 
 
 
@@ -57,6 +57,7 @@
 #include <lem/solarix/LA_WordEntrySet.h>
 #include <lem/solarix/TextRecognitionParameters.h>
 #include <lem/solarix/la_autom.h>
+#include <lem/solarix/LA_ScriptTable.h>
 
 
 using namespace lem;
@@ -1361,11 +1362,26 @@ int rtm = CompareThem( a, b, 1 );
  //        
  //  ,       A_len
  //     NMISSMAX .
- lem::Ptr<WordEntryEnumerator> wenum( s_gram.GetEntries().ListEntries() ); 
- while( wenum->Fetch() )
+ //
+ //       ,    ,
+ //   A     nmissmax   : CompareThem
+ //       ,   
+ //  ,        .
+ //     ListEntries(),    .
+ lem::MCollect<Word_Coord> fuzzy_forms;
+ const bool indexed = s_gram.GetEntries().FindFuzzyForms( *A, nmissmax, fuzzy_forms );
+ lem::Container::size_type icand=0, icand_begin=0;
+
+ lem::Ptr<WordEntryEnumerator> wenum( indexed ? NULL : s_gram.GetEntries().ListEntries() ); 
+ while( indexed ? icand<fuzzy_forms.size() : wenum->Fetch() )
   {
-   const int ientry = wenum->GetId();
-   const SG_Entry &e = wenum->GetItem();
+   const int ientry = indexed ? fuzzy_forms[icand].GetEntry() : wenum->GetId();
+   const SG_Entry &e = indexed ? s_gram.GetEntries().GetEntry(ientry) : wenum->GetItem();
+
+   //       [icand_begin,icand)
+   icand_begin = icand;
+   while( indexed && icand<fuzzy_forms.size() && fuzzy_forms[icand].GetEntry()==ientry )
+    icand++;
 
    //  :   A      
    //       nmissmax.
@@ -1391,6 +1407,16 @@ int rtm = CompareThem( a, b, 1 );
 
    for( int iform=0; iform<nform; iform++ )
     {
+     if( indexed )
+      {
+       bool is_candidate=false;
+       for( lem::Container::size_type k=icand_begin; k<icand && !is_candidate; ++k )
+        is_candidate = fuzzy_forms[k].GetForm()==iform;
+
+       if( !is_candidate )
+        continue;
+      }
+
      const Lexem &B = e.forms()[iform].name();
      const int B_len = B.length();
 
@@ -2666,58 +2692,61 @@ int LexicalAutomat::GuessLanguage( const lem::UFString &str ) const
  const SynGram &sg = GetDict().GetSynGram();
  const GraphGram &gg = GetDict().GetGraphGram();
 
- lem::MCollect<int> lang_scores;
- lem::MCollect<int> lang_id;
+ //         (. LA_ScriptTable),
+ //        .
+ const LA_ScriptTable &script_tab = GetScriptTable();
+ const lem::MCollect<int> &lang_id = script_tab.GetLanguages();
+
+ //      ,    .
+ if( script_tab.GetFixedLanguage()!=UNKNOWN )
+  return script_tab.GetFixedLanguage();
 
- //   ,      , ,
- //      .
- GetDict().GetLanguages( lang_id );
+ const int nlang = CastSizeToInt(lang_id.size());
 
- if( lang_id.size()==1 )
-  return lang_id.front();
- else if( lang_id.empty() )
+ int local_scores[32];
+ lem::MCollect<int> heap_scores;
+ int *lang_scores = local_scores;
+ if( nlang>32 )
   {
-   //  -    .
-   lem::Ptr<LanguageEnumerator> lenum( sg.languages().Enumerate() );
-   while( lenum->Fetch() )
-    {
-     const int id_lang = lenum->GetId();
-     lang_id.push_back(id_lang);
-    }
-   lenum.Delete();
+   heap_scores.resize(nlang);
+   lang_scores = &heap_scores[0];
   }
 
- lang_scores.resize( lang_id.size() );
- lang_scores.fill(0);
+ std::fill( lang_scores, lang_scores+nlang, 0 );
 
- const int nlang = CastSizeToInt(lang_id.size());
-
- MCollect<Word_Coord> projs;
- for( int i=0; i<str.length(); ++i )
+ if( use_script_table )
+  {
+   script_tab.Score( str.c_str(), str.length(), lang_scores );
+  }
+ else
   {
-   const wchar_t c = str[i];
-   if( !lem::is_uspace(c) && !lem::is_udigit(c) && !lem::is_upunct(c) )
+   MCollect<Word_Coord> projs;
+   for( int i=0; i<str.length(); ++i )
     {
-     projs.clear();
-     gg.FindSymbol( c, projs );
-
-     for( lem::Container::size_type j=0; j<projs.size(); ++j )
+     const wchar_t c = str[i];
+     if( !lem::is_uspace(c) && !lem::is_udigit(c) && !lem::is_upunct(c) )
       {
-       const int isymbol = projs[j].GetEntry();
-       const GG_Entry &symbol = gg.entries()[isymbol];
-       const int id_alphabet = symbol.GetAlphabet();
-       if( id_alphabet!=UNKNOWN )
+       projs.clear();
+       gg.FindSymbol( c, projs );
+
+       for( lem::Container::size_type j=0; j<projs.size(); ++j )
         {
-         lem::Ptr<LanguageEnumerator> lenum( sg.languages().Enumerate() );
-         while( lenum->Fetch() )
+         const int isymbol = projs[j].GetEntry();
+         const GG_Entry &symbol = gg.entries()[isymbol];
+         const int id_alphabet = symbol.GetAlphabet();
+         if( id_alphabet!=UNKNOWN )
           {
-           const int id_lang = lenum->GetId();
-           const SG_Language &lang = lenum->GetItem(); 
-           if( lang.IsMainAlphabet(id_alphabet) ) //    ,          .
+           lem::Ptr<LanguageEnumerator> lenum( sg.languages().Enumerate() );
+           while( lenum->Fetch() )
             {
-             const int ilang = lang_id.find(id_lang);
-             if( ilang!=UNKNOWN )
-              lang_scores[ilang]+=2;
+             const int id_lang = lenum->GetId();
+             const SG_Language &lang = lenum->GetItem(); 
+             if( lang.IsMainAlphabet(id_alphabet) ) //    ,          .
+              {
+               const int ilang = lang_id.find(id_lang);
+               if( ilang!=UNKNOWN )
+                lang_scores[ilang]+=2;
+              }
             }
           }
         }
@@ -2766,7 +2795,7 @@ int LexicalAutomat::GuessLanguage( const lem::UFString &str ) const
        lem::Collect<UFString> words;
        lem::parse( str, words, L" \r\n\t,.:;'\"?!()*&-+=[{]}|<>", false );
 
-       lang_scores.Nullify();
+       std::fill( lang_scores, lang_scores+nlang, 0 );
 
        for( lem::Container::size_type i=0; i<words.size(); ++i )
         {
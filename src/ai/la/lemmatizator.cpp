@@ -1,3 +1,4 @@
+#include <cstring>
 #include <lem/ucstring_functions.h>
 #include <lem/stl.h>
 #include <lem/solarix/Lemmatizator.h>
@@ -7,6 +8,72 @@
 using namespace lem;
 using namespace Solarix;
 
+
+//    ,      .
+static void NormalizeForm( lem::UCString &res )
+{
+ res.to_upper();
+
+ bool rehash=false;
+ for( int i=0; i<res.length(); ++i )
+  if( res[i]==0x0401 )
+   {
+    res.set( i, 0x0415 );
+    rehash=true;
+   }
+
+ if( rehash )
+  res.calc_hash();
+
+ return;
+}
+
+
+//  ,  lem::Save_Packed,     -
+//  lem::Load_Packed    .
+static const lem::uint8_t* LoadPackedMapped( const lem::uint8_t *p, lem::UCString &s )
+{
+ const lem::uint8_t f = *p++;
+ const int l = 0x3fu & f;
+
+ switch( 0xc0u & f )
+ {
+  case 0x40: // ASCII_CHARS
+  {
+   for( int i=0; i<l; ++i )
+    s.ptr()[i] = p[i];
+
+   p += l;
+   break;
+  }
+
+  case 0x80: // UNICODE_PACKED
+  {
+   lem::int16_t base;
+   std::memcpy( &base, p, sizeof(base) );
+   p += sizeof(base);
+
+   s.ptr()[0] = static_cast<wchar_t>(base);
+   for( int i=1; i<l; ++i )
+    s.ptr()[i] = static_cast<wchar_t>( base + static_cast<lem::int16_t>( static_cast<lem::int8_t>(*p++) ) );
+
+   break;
+  }
+
+  default: // NOTPACKED
+  {
+   std::memcpy( s.ptr(), p, l*sizeof(wchar_t) );
+   p += l*sizeof(wchar_t);
+   break;
+  }
+ }
+
+ s.ptr()[l]=0;
+ s.calc_hash();
+ return p;
+}
+
+
 Lemmatizator::Lemmatizator(void)
 {
  norm_ref=0;
@@ -55,6 +122,10 @@ void Lemmatizator::Load( const lem::Path &DbPath, int Flags )
  bin = new lem::BinaryReader(DbPath);
  #endif
 
+ mapped.Close();
+ if( (Flags&LEME_FASTER)==LEME_FASTER )
+  mapped.Open(DbPath);
+
  lem::Stream::pos_type table_pos=0;
  bin->read( &table_pos, sizeof(table_pos) );
 
@@ -103,13 +174,27 @@ void Lemmatizator::Load( const lem::Path &DbPath, int Flags )
     fast_search1=true;
   }
 
- if( fast_search1 )
+ if( fast_search1 || (mapped.IsOpen() && char_size==1) )
   {
    for( int i=0; i<nchars; ++i )
     {
      const wchar_t c = i2wchar[i];
      wchar2i.insert( std::make_pair(c,i) );
     }
+  }
+
+ if( mapped.IsOpen() )
+  {
+   //   ,       .
+   bin->seekp( model_pos );
+   model_loaded = true;
+   model_available = bin->read_bool();
+   if( model_available )
+    LoadModel();
+  }
+
+ if( fast_search1 )
+  {
 
    for( int g=0; g<L_NHASHGROUP; ++g )
     {
@@ -196,21 +281,24 @@ void Lemmatizator::Load( const lem::Path &DbPath, int Flags )
 void Lemmatizator::Lemmatize( const lem::UCString &word, lem::MCollect<lem::UCString> &lemmas )
 {
  lem::UCString res(word);
- res.to_upper();
-
- bool rehash=false;
- for( int i=0; i<res.length(); ++i )
-  if( res[i]==0x0401 )
-   {
-    res.set( i, 0x0415 );
-    rehash=true;
-   }
-
- if( rehash )
-  res.calc_hash();
+ NormalizeForm(res);
 
  // ,    .
  const int igroup = (unsigned)res.GetHash16() & (L_NHASHGROUP-1);
+
+ if( mapped.IsOpen() )
+  {
+   if( FindMapped( res, igroup, &lemmas, NULL )==UNKNOWN )
+    {
+     lemmas.clear();
+     lem::UCString lemma;
+     LemmatizeBySuffix( res, lemma );
+     lemmas.push_back(lemma);
+    }
+
+   return;
+  }
+
  const lem::Stream::pos_type pos = group_pos[igroup];
 
  #if defined LEM_THREADS
@@ -298,26 +386,151 @@ void Lemmatizator::Lemmatize( const lem::UCString &word, lem::MCollect<lem::UCSt
 
  lemmas.clear();
 
+ lem::UCString lemma;
+ LemmatizeBySuffix( res, lemma );
+ lemmas.push_back(lemma);
+ return;
+}
+
+
+void Lemmatizator::LemmatizeBySuffix( const lem::UCString &res, lem::UCString &lemma ) const
+{
  //    ,   .
  for( lem::Container::size_type i=0; i<suffices.size(); ++i )
   {
    if( res.eq_endi( suffices[i].first ) )
     {
      //   !
-     UCString lemma = lem::left( res, res.length()-suffices[i].first.length() );
+     lemma = lem::left( res, res.length()-suffices[i].first.length() );
      lemma += suffices[i].second;
-     lemmas.push_back(lemma);
      return;
     }
   }
 
-
  //   ,      .
- lemmas.push_back(res);
+ lemma = res;
  return;
 }
 
 
+// *****************************************************************************
+//        .   ,
+//    ,     .
+//        UNKNOWN.
+// *****************************************************************************
+int Lemmatizator::FindMapped( const lem::UCString &res, int igroup, lem::MCollect<lem::UCString> *lemmas, lem::UCString *first_lemma ) const
+{
+ const lem::uint8_t *p = mapped.At<lem::uint8_t>( group_pos[igroup] );
+
+ int n=0;
+ std::memcpy( &n, p, sizeof(n) );
+ p += sizeof(n);
+
+ const lem::uint8_t *found=NULL;
+
+ if( char_size==1 )
+  {
+   //     ,   .
+   lem::uint8_t a8[ lem::UCString::max_len+1 ];
+   const int len = res.length();
+   for( int i=0; i<len; ++i )
+    {
+     std::map<wchar_t,int>::const_iterator it = wchar2i.find(res[i]);
+     if( it==wchar2i.end() )
+      return UNKNOWN; //     
+
+     a8[i] = static_cast<lem::uint8_t>(it->second);
+    }
+
+   for( int i=0; i<n && found==NULL; ++i )
+    {
+     const lem::uint8_t len8 = *p++;
+     const bool eq = len8==len && std::memcmp( p, a8, len )==0;
+     p += len8;
+
+     if( eq )
+      found = p;
+     else
+      p += 1 + 3*(*p);
+    }
+  }
+ else if( char_size==sizeof(wchar_t) )
+  {
+   lem::UCString form;
+   for( int i=0; i<n && found==NULL; ++i )
+    {
+     p = LoadPackedMapped( p, form );
+
+     if( form==res )
+      found = p;
+     else
+      p += 1 + 3*(*p);
+    }
+  }
+ else
+  {
+   LEM_STOPIT;
+  }
+
+ if( found==NULL )
+  return UNKNOWN;
+
+ const lem::uint8_t n8 = *found++;
+ for( lem::uint8_t i8=0; i8<n8; ++i8, found+=3 )
+  {
+   const int x32 = (0x00ff0000&(found[0]<<16)) |
+                   (0x0000ff00&(found[1]<<8))  |
+                   (0x000000ff&found[2]);
+
+   if( lemmas!=NULL )
+    lemmas->push_back( GetMappedLemma(x32) );
+
+   if( first_lemma!=NULL && i8==0 )
+    *first_lemma = GetMappedLemma(x32);
+  }
+
+ return n8;
+}
+
+
+lem::UCString Lemmatizator::GetMappedLemma( int idx ) const
+{
+ LEM_CHECKIT_Z( idx>=0 && idx<n_lemma );
+
+ UCString s;
+
+ if( char_size==sizeof(wchar_t) )
+  {
+   //  -  UCString,      . 
+   //  :          wchar_t.
+   const lem::uint8_t *rec = mapped.At<lem::uint8_t>( norm_ref + sizeof(lem::UCString)*idx );
+   std::memcpy( s.ptr(), rec, lem::UCString::max_len*sizeof(wchar_t) );
+   s.ptr()[lem::UCString::max_len]=0;
+   s.calc_hash();
+  }
+ else if( char_size==1 )
+  {
+   const lem::uint8_t *str8 = mapped.At<lem::uint8_t>( norm_ref + (lem::UCString::max_len)*idx );
+
+   int i=0;
+   while( i<lem::CString::max_len && str8[i]!=0 )
+    {
+     s.ptr()[i] = i2wchar[str8[i]];
+     ++i;
+    }
+
+   s.ptr()[i]=0;
+   s.calc_hash();
+  }
+ else
+  {
+   LEM_STOPIT;
+  }
+
+ return s;
+}
+
+
 void Lemmatizator::DecodeWord1( const lem::CString & a, lem::UCString & u ) const
 {
  for( int i=0; i<a.length(); ++i )
@@ -384,6 +597,19 @@ int Lemmatizator::Lemmatize( const lem::UCString &word, lem::UCString &lemma )
      return 1;
     }
   }
+ else if( mapped.IsOpen() )
+  {
+   lem::UCString res(word);
+   NormalizeForm(res);
+
+   const int igroup = (unsigned)res.GetHash16() & (L_NHASHGROUP-1);
+   const int n = FindMapped( res, igroup, NULL, &lemma );
+   if( n!=UNKNOWN )
+    return n;
+
+   LemmatizeBySuffix( res, lemma );
+   return 1;
+  }
  else
   {
    lem::MCollect<UCString> lemmas;
@@ -738,6 +964,13 @@ void Lemmatizator::BuildIndex()
 
 void Lemmatizator::Lemmatize( const lem::MCollect<lem::UCString> & words, lem::MCollect<lem::UCString> &lemmas )
 {
+ if( mapped.IsOpen() )
+  {
+   //     Load(),      .
+   LemmatizeWords( words, lemmas );
+   return;
+  }
+
  #if defined LEM_THREADS
  lem::Process::CritSecLocker lock(&cs);
  #endif
@@ -753,7 +986,13 @@ void Lemmatizator::Lemmatize( const lem::MCollect<lem::UCString> & words, lem::M
     }
   }
 
+ LemmatizeWords( words, lemmas );
+ return;
+}
 
+
+void Lemmatizator::LemmatizeWords( const lem::MCollect<lem::UCString> & words, lem::MCollect<lem::UCString> &lemmas )
+{
  if( model_available )
   {
    LemmatizeViaModel( words, lemmas );
@@ -230,6 +230,19 @@ void CovalentNGramsCollector::Prepare(
 }
 
 
+//      ,  
+//   .
+void CovalentNGramsCollector::CountSentence( const lem::MCollect<UCString> &sent )
+{
+ #if defined LEM_THREADS
+ lem::Process::CritSecLocker lock(&cs_words);
+ #endif
+
+ ProcessSentence(sent);
+ return;
+}
+
+
 void CovalentNGramsCollector::ProcessSentence( const lem::MCollect<UCString> &sent )
 {
  //      .
@@ -850,6 +863,7 @@ void CovalentNGramsCollector::Merge( const lem::Path &dbfolder, bool echo )
 
 void CovalentNGramsCollector::EndAll( bool echo )
 {
+ FlushShardedCounters(echo);
  PurgeDocCache(echo);
  
  if( print_ngrams && print_file.NotNull() )
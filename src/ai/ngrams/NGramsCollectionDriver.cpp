@@ -0,0 +1,141 @@
+#if !defined(SOL_NO_NGRAMS)
+
+// CD->16.10.2026
+// LC->16.10.2026
+
+#if defined LEM_THREADS
+#include <boost/bind.hpp>
+#include <boost/thread/thread.hpp>
+#endif
+
+#include <lem/conversions.h>
+#include <lem/solarix/NGramsCollectors.h>
+#include <lem/solarix/NGramsCollectionDriver.h>
+
+using namespace lem;
+using namespace Solarix;
+
+
+NGramsCollectionDriver::NGramsCollectionDriver( int _n_thread, int _batch_size )
+ : n_thread(_n_thread), batch_size(_batch_size)
+{
+ LEM_CHECKIT_Z( batch_size>0 );
+
+ #if defined LEM_THREADS
+ if( n_thread<1 )
+  n_thread = 1;
+ #else
+ n_thread = 1;
+ #endif
+
+ return;
+}
+
+
+void NGramsCollectionDriver::Add( RawNGramsCollector *collector )
+{
+ LEM_CHECKIT_Z( collector!=NULL );
+ collectors.push_back(collector);
+ return;
+}
+
+
+void NGramsCollectionDriver::Process( const lem::UCString &word )
+{
+ if( n_thread==1 )
+  {
+   for( lem::Container::size_type i=0; i<collectors.size(); ++i )
+    collectors[i]->Process(word);
+
+   return;
+  }
+
+ if( collectors.empty() )
+  return;
+
+ //      .
+ sentence.push_back(word);
+ if( collectors.front()->IsSentenceEnd( word, CastSizeToInt(sentence.size()) ) )
+  {
+   batch.push_back(sentence);
+   sentence.clear();
+
+   if( CastSizeToInt(batch.size())>=batch_size )
+    CountBatch();
+  }
+
+ return;
+}
+
+
+void NGramsCollectionDriver::Flush(void)
+{
+ if( !sentence.empty() )
+  {
+   batch.push_back(sentence);
+   sentence.clear();
+  }
+
+ CountBatch();
+ return;
+}
+
+
+void NGramsCollectionDriver::CountBatch(void)
+{
+ if( batch.empty() )
+  return;
+
+ #if defined LEM_THREADS
+ boost::thread_group threads;
+ for( int i=0; i<n_thread; ++i )
+  threads.create_thread( boost::bind( &NGramsCollectionDriver::CountPart, this, i ) );
+
+ threads.join_all();
+ #else
+ CountPart(0);
+ #endif
+
+ batch.clear();
+
+ if( !error.empty() )
+  {
+   const std::wstring msg(error);
+   error.clear();
+   throw lem::E_BaseException(msg);
+  }
+
+ return;
+}
+
+
+//  ithread   n_thread-  .
+void NGramsCollectionDriver::CountPart( int ithread )
+{
+ try
+  {
+   for( std::size_t i=ithread; i<batch.size(); i+=n_thread )
+    for( lem::Container::size_type k=0; k<collectors.size(); ++k )
+     collectors[k]->CountSentence( batch[i] );
+  }
+ catch( const lem::E_BaseException &e )
+  {
+   #if defined LEM_THREADS
+   lem::Process::CritSecLocker lock(&cs_error);
+   #endif
+   if( error.empty() )
+    error = e.what();
+  }
+ catch( ... )
+  {
+   #if defined LEM_THREADS
+   lem::Process::CritSecLocker lock(&cs_error);
+   #endif
+   if( error.empty() )
+    error = L"Error in N-gram collection thread";
+  }
+
+ return;
+}
+
+#endif
@@ -1,17 +1,21 @@
 #if !defined(SOL_NO_NGRAMS)
 
 // CD->09.11.2008
-// LC->28.12.2010
+// LC->16.10.2026
 
 #include <lem/solarix/NGramsCollectors.h>
+#include <lem/solarix/NGramsCollectionDriver.h>
 
 using namespace std;
 using namespace lem;
 using namespace Solarix;
 
+//    ,  SetThreads   .
+static const int DEFAULT_SHARD_CAPACITY=262144;
+
 
 NGramsCollectors::NGramsCollectors( lem::Ptr<Solarix::Dictionary> _dict, lem::Ptr<LemmatizatorStorage> _lemm )
- : dict( _dict), lemm( _lemm )
+ : dict( _dict), lemm( _lemm ), n_thread(1), n_shard(0), shard_capacity(0)
 {
  db = dict->GetNgrams()->GetStorage();
  return;
@@ -143,6 +147,9 @@ void NGramsCollectors::BuildKnowledgeBase(
    ngrams.clear();
    Prepare( DestinationFolder, language, ngrams_flags, false, true, lemmatize, false, true, "", cleanup_ngrams );
 
+   NGramsCollectionDriver driver( n_thread );
+   AddTo(driver);
+
    std::vector<lem::Path> files;
 
    if( DocumentsFolder.IsFolder() )
@@ -215,10 +222,11 @@ void NGramsCollectors::BuildKnowledgeBase(
              if( bl.word==L'\'' || bl.word==L'"'  || bl.word.front()=='_' )
               continue;
 
-             Process(bl.word);
+             driver.Process(bl.word);
             }        
           }
 
+         driver.Flush();
          EndDocument(echo);
         }
       }
@@ -373,6 +381,9 @@ void NGramsCollectors::Prepare(
    ngrams[i]->upload_to_db = upload_to_db;
    ngrams[i]->clean_database = clean_database;
    ngrams[i]->Prepare( dict, outdir, language );
+
+   if( n_shard>0 )
+    ngrams[i]->SetShardedCounters( n_shard, shard_capacity );
   }
 
  return;
@@ -402,6 +413,16 @@ void NGramsCollectors::Process( const UCString &l )
 }
 
 
+//  ,     .
+void NGramsCollectors::CountSentence( const lem::MCollect<UCString> &sent )
+{
+ for( lem::Container::size_type i=0; i<ngrams.size(); ++i )
+  ngrams[i]->CountSentence(sent);
+
+ return;
+}
+
+
 void NGramsCollectors::BeginDocument( bool echo )
 {
  for( lem::Container::size_type i=0; i<ngrams.size(); ++i )
@@ -487,6 +508,57 @@ void NGramsCollectors::SetNGramsCacheCapacity( int n )
 }
 
 
+void NGramsCollectors::SetShardedCounters( int _n_shard, int capacity )
+{
+ LEM_CHECKIT_Z( _n_shard>=0 );
+ LEM_CHECKIT_Z( _n_shard==0 || capacity>0 );
+
+ n_shard = _n_shard;
+ shard_capacity = capacity;
+
+ for( lem::Container::size_type k=0; k<ngrams.size(); k++ ) 
+  {
+   ngrams[k]->SetShardedCounters(n_shard,capacity);
+  }
+
+ return;
+}
+
+
+void NGramsCollectors::SetThreads( int n )
+{
+ LEM_CHECKIT_Z( n>=1 );
+ n_thread = n;
+
+ if( n>1 && n_shard==0 )
+  SetShardedCounters( n, DEFAULT_SHARD_CAPACITY );
+
+ return;
+}
+
+
+int NGramsCollectors::CountShards(void) const
+{
+ if( ngrams.empty() )
+  return 0;
+
+ int n=ngrams.front()->CountShards();
+ for( lem::Container::size_type k=1; k<ngrams.size(); k++ ) 
+  n = std::min( n, ngrams[k]->CountShards() );
+
+ return n;
+}
+
+
+void NGramsCollectors::AddTo( NGramsCollectionDriver &driver )
+{
+ for( lem::Container::size_type k=0; k<ngrams.size(); k++ ) 
+  driver.Add( ngrams[k] );
+
+ return;
+}
+
+
 void NGramsCollectors::SetDBCache( int cache_size )
 {
  db->SetDBCache(cache_size);
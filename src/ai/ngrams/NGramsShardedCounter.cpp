@@ -0,0 +1,348 @@
+#if !defined(SOL_NO_NGRAMS)
+
+// CD->16.10.2026
+// LC->16.10.2026
+
+#include <algorithm>
+#include <lem/conversions.h>
+#include <lem/console_streams.h>
+#include <lem/solarix/NGramsShardedCounter.h>
+
+using namespace lem;
+using namespace Solarix;
+
+
+namespace
+{
+ const int READ_BLOCK = 65536; //      
+
+ struct RecordLess
+ {
+  int order;
+
+  RecordLess( int _order ) : order(_order) {}
+
+  bool operator()( const NGramsShardedCounter::Record &a, const NGramsShardedCounter::Record &b ) const
+  {
+   for( int i=0; i<order; ++i )
+    if( a.ie[i]!=b.ie[i] )
+     return a.ie[i]<b.ie[i];
+
+   return false;
+  }
+ };
+}
+
+
+NGramsShardedCounter::NGramsShardedCounter(
+                                           int _order,
+                                           int n_shard,
+                                           int capacity,
+                                           const lem::Path &_outdir,
+                                           const lem::FString &_name
+                                          )
+ : order(_order), outdir(_outdir), name(_name), n_spilled(0)
+{
+ LEM_CHECKIT_Z( order>0 && order<=MAX_ORDER );
+ LEM_CHECKIT_Z( n_shard>0 );
+
+ max_records = std::max( 1024, capacity/n_shard );
+
+ shards.reserve(n_shard);
+ for( int i=0; i<n_shard; ++i )
+  {
+   shards.push_back( new Shard );
+   shards.back()->buffer.reserve( max_records );
+  }
+
+ return;
+}
+
+
+NGramsShardedCounter::~NGramsShardedCounter(void)
+{
+ ClearMerge();
+
+ for( std::size_t i=0; i<shards.size(); ++i )
+  delete shards[i];
+
+ for( std::size_t i=0; i<runs.size(); ++i )
+  runs[i].DoRemove();
+
+ return;
+}
+
+
+lem::uint32_t NGramsShardedCounter::Hash( const int *ie ) const
+{
+ lem::uint32_t h=2166136261U;
+ for( int i=0; i<order; ++i )
+  h = (h ^ lem::uint32_t(ie[i])) * 16777619U;
+
+ h ^= h>>15;
+ h *= 0x2c1b3c6dU;
+ h ^= h>>12;
+ return h;
+}
+
+
+bool NGramsShardedCounter::Less( const Record &a, const Record &b ) const
+{
+ return RecordLess(order)(a,b);
+}
+
+
+bool NGramsShardedCounter::Equal( const Record &a, const Record &b ) const
+{
+ for( int i=0; i<order; ++i )
+  if( a.ie[i]!=b.ie[i] )
+   return false;
+
+ return true;
+}
+
+
+void NGramsShardedCounter::Add( const int *ie, int freq )
+{
+ Record r;
+ for( int i=0; i<MAX_ORDER; ++i )
+  r.ie[i] = i<order ? ie[i] : 0;
+
+ r.freq = freq;
+
+ Shard &shard = *shards[ Hash(ie) % lem::uint32_t(shards.size()) ];
+
+ #if defined LEM_THREADS
+ lem::Process::CritSecLocker lock(&shard.cs);
+ #endif
+
+ shard.buffer.push_back(r);
+ if( CastSizeToInt(shard.buffer.size())>=max_records )
+  {
+   Compact( shard.buffer );
+
+   //         ,
+   //      -  .
+   if( CastSizeToInt(shard.buffer.size())>max_records/2 )
+    Spill( shard.buffer );
+  }
+
+ return;
+}
+
+
+//      N-   .
+void NGramsShardedCounter::Compact( std::vector<Record> &buffer ) const
+{
+ if( buffer.empty() )
+  return;
+
+ std::sort( buffer.begin(), buffer.end(), RecordLess(order) );
+
+ std::size_t dst=0;
+ for( std::size_t src=1; src<buffer.size(); ++src )
+  {
+   if( Equal( buffer[dst], buffer[src] ) )
+    buffer[dst].freq += buffer[src].freq;
+   else
+    buffer[++dst] = buffer[src];
+  }
+
+ buffer.resize(dst+1);
+ return;
+}
+
+
+//      . :  N-,
+//  ,    order+1  (id   ).
+void NGramsShardedCounter::Spill( std::vector<Record> &buffer )
+{
+ lem::Path p(outdir);
+
+ {
+  #if defined LEM_THREADS
+  lem::Process::CritSecLocker lock(&cs_runs);
+  #endif
+
+  p.ConcateLeaf( lem::Path( lem::format_str( "%s.run%d.tmp", name.c_str(), CastSizeToInt(runs.size()) ) ) );
+  runs.push_back(p);
+  n_spilled += buffer.size();
+ }
+
+ lem::BinaryWriter wr(p);
+
+ const lem::int32_t n_order = order;
+ const lem::int64_t n = buffer.size();
+ wr.write( &n_order, sizeof(n_order) );
+ wr.write( &n, sizeof(n) );
+
+ std::vector<lem::int32_t> block;
+ block.reserve( READ_BLOCK*(order+1) );
+ for( std::size_t i=0; i<buffer.size(); ++i )
+  {
+   block.insert( block.end(), buffer[i].ie, buffer[i].ie+order );
+   block.push_back( buffer[i].freq );
+
+   if( block.size()>=block.capacity() || i+1==buffer.size() )
+    {
+     wr.write( &block[0], block.size()*sizeof(lem::int32_t) );
+     block.clear();
+    }
+  }
+
+ buffer.clear();
+ return;
+}
+
+
+bool NGramsShardedCounter::Refill( MergeSource &src )
+{
+ src.buf.clear();
+ src.pos=0;
+
+ if( src.file.IsNull() || src.n_left==0 )
+  return false;
+
+ const int n = int( std::min( lem::int64_t(READ_BLOCK), src.n_left ) );
+ std::vector<lem::int32_t> block( n*(order+1) );
+ src.file->read( &block[0], block.size()*sizeof(lem::int32_t) );
+ src.n_left -= n;
+
+ src.buf.resize(n);
+ const lem::int32_t *p = &block[0];
+ for( int i=0; i<n; ++i )
+  {
+   Record &r = src.buf[i];
+   for( int k=0; k<MAX_ORDER; ++k )
+    r.ie[k] = k<order ? *p++ : 0;
+
+   r.freq = *p++;
+  }
+
+ return true;
+}
+
+
+const NGramsShardedCounter::Record& NGramsShardedCounter::Current( int isrc ) const
+{
+ const MergeSource &src = *sources[isrc];
+ return src.buf[src.pos];
+}
+
+
+void NGramsShardedCounter::SiftDown( int i )
+{
+ const int n = CastSizeToInt(heap.size());
+ while(true)
+  {
+   int least=i;
+   const int l=2*i+1, r=2*i+2;
+
+   if( l<n && Less( Current(heap[l]), Current(heap[least]) ) )
+    least=l;
+
+   if( r<n && Less( Current(heap[r]), Current(heap[least]) ) )
+    least=r;
+
+   if( least==i )
+    break;
+
+   std::swap( heap[i], heap[least] );
+   i=least;
+  }
+
+ return;
+}
+
+
+void NGramsShardedCounter::ClearMerge(void)
+{
+ for( std::size_t i=0; i<sources.size(); ++i )
+  delete sources[i];
+
+ sources.clear();
+ heap.clear();
+ return;
+}
+
+
+void NGramsShardedCounter::BeginMerge( bool echo )
+{
+ ClearMerge();
+
+ lem::int64_t n_mem=0;
+ for( std::size_t i=0; i<shards.size(); ++i )
+  {
+   Shard &shard = *shards[i];
+   Compact( shard.buffer );
+   if( shard.buffer.empty() )
+    continue;
+
+   n_mem += shard.buffer.size();
+
+   MergeSource *src = new MergeSource;
+   src->buf.swap( shard.buffer );
+   sources.push_back(src);
+  }
+
+ for( std::size_t i=0; i<runs.size(); ++i )
+  {
+   MergeSource *src = new MergeSource;
+   src->file = new lem::BinaryReader( runs[i] );
+
+   lem::int32_t n_order=0;
+   src->file->read( &n_order, sizeof(n_order) );
+   src->file->read( &src->n_left, sizeof(src->n_left) );
+   LEM_CHECKIT_Z( n_order==order );
+
+   if( Refill(*src) )
+    sources.push_back(src);
+   else
+    delete src;
+  }
+
+ if( echo )
+  {
+   lem::mout->printf( "%s: %d run(s) on disk with %qd record(s), %qd record(s) in memory\n",
+    name.c_str(), CastSizeToInt(runs.size()), n_spilled, n_mem );
+  }
+
+ for( int i=0; i<CastSizeToInt(sources.size()); ++i )
+  heap.push_back(i);
+
+ for( int i=CastSizeToInt(heap.size())/2-1; i>=0; --i )
+  SiftDown(i);
+
+ return;
+}
+
+
+//  N-    id .     N-
+//     ,   .
+bool NGramsShardedCounter::Fetch( Record &r )
+{
+ if( heap.empty() )
+  return false;
+
+ r = Current(heap.front());
+ r.freq = 0;
+
+ while( !heap.empty() && Equal( r, Current(heap.front()) ) )
+  {
+   MergeSource &src = *sources[heap.front()];
+   r.freq += src.buf[src.pos].freq;
+
+   if( ++src.pos==src.buf.size() && !Refill(src) )
+    {
+     heap.front() = heap.back();
+     heap.pop_back();
+    }
+
+   if( !heap.empty() )
+    SiftDown(0);
+  }
+
+ return true;
+}
+
+#endif
@@ -0,0 +1,562 @@
+#if !defined(SOL_NO_NGRAMS)
+
+// CD->16.10.2026
+// LC->16.10.2026
+
+#include <algorithm>
+#include <math.h>
+#include <string.h>
+#include <lem/runtime_checks.h>
+#include <lem/streams.h>
+#include <lem/solarix/NGramsSuccinctStore.h>
+
+using namespace lem;
+using namespace Solarix;
+
+
+namespace
+{
+ const lem::uint32_t MAGIC = 0x4e475346U; // 'NGSF'
+ const lem::uint32_t VERSION = 1;
+ const lem::uint64_t SAMPLE = 256; //       
+ const lem::uint64_t ONE = 1;
+
+ inline int PopCount( lem::uint64_t x )
+ {
+  x = x - ((x>>1) & 0x5555555555555555ULL);
+  x = (x & 0x3333333333333333ULL) + ((x>>2) & 0x3333333333333333ULL);
+  x = (x + (x>>4)) & 0x0f0f0f0f0f0f0f0fULL;
+  return int( (x*0x0101010101010101ULL)>>56 );
+ }
+
+ //  r- ( )    .
+ inline int SelectInWord( lem::uint64_t x, int r )
+ {
+  for( int k=0; k<r; ++k )
+   x &= x-1;
+
+  int pos=0;
+  while( (x & ONE)==0 )
+   {
+    x >>= 1;
+    pos++;
+   }
+
+  return pos;
+ }
+
+ inline int BitsFor( lem::uint64_t max_value )
+ {
+  int bits=1;
+  while( bits<64 && (max_value>>bits)!=0 )
+   bits++;
+
+  return bits;
+ }
+
+ struct EntryLess
+ {
+  int order;
+
+  EntryLess( int _order ) : order(_order) {}
+
+  bool operator()( const NGramsSuccinctStore::Entry &a, const NGramsSuccinctStore::Entry &b ) const
+  {
+   for( int i=0; i<order; ++i )
+    if( a.ie[i]!=b.ie[i] )
+     return a.ie[i]<b.ie[i];
+
+   return false;
+  }
+ };
+}
+
+
+lem::uint64_t NGramsSuccinctStore::GetBits( const lem::uint64_t *data, lem::uint64_t pos, int width )
+{
+ const lem::uint64_t i = pos>>6;
+ const int off = int(pos&63);
+
+ lem::uint64_t v = data[i]>>off;
+ if( off+width>64 )
+  v |= data[i+1]<<(64-off);
+
+ return width==64 ? v : v & ((ONE<<width)-1);
+}
+
+
+void NGramsSuccinctStore::PutBits( std::vector<lem::uint64_t> &data, lem::uint64_t pos, int width, lem::uint64_t value )
+{
+ const lem::uint64_t i = pos>>6;
+ const int off = int(pos&63);
+
+ data[i] |= value<<off;
+ if( off+width>64 )
+  data[i+1] |= value>>(64-off);
+
+ return;
+}
+
+
+// ---------------------------------------------------------------------------
+
+
+lem::uint64_t NGramsSuccinctStore::EliasFano::Select1( lem::uint64_t i ) const
+{
+ lem::uint64_t pos = samples[i/SAMPLE];
+ int r = int(i%SAMPLE);
+
+ lem::uint64_t iw = pos>>6;
+ lem::uint64_t word = high[iw] & (~lem::uint64_t(0)<<(pos&63));
+ while(true)
+  {
+   const int c = PopCount(word);
+   if( r<c )
+    return (iw<<6) + SelectInWord(word,r);
+
+   r -= c;
+   word = high[++iw];
+  }
+}
+
+
+lem::uint64_t NGramsSuccinctStore::EliasFano::Get( lem::uint64_t i ) const
+{
+ const lem::uint64_t hi = Select1(i)-i;
+ return l==0 ? hi : (hi<<l) | GetBits( low, i*l, int(l) );
+}
+
+
+//    [lo,hi),      x.
+lem::uint64_t NGramsSuccinctStore::EliasFano::LowerBound( lem::uint64_t x, lem::uint64_t lo, lem::uint64_t hi ) const
+{
+ while( lo<hi )
+  {
+   const lem::uint64_t mid = lo + (hi-lo)/2;
+   if( Get(mid)<x )
+    lo = mid+1;
+   else
+    hi = mid;
+  }
+
+ return lo;
+}
+
+
+// : n, l,   ,  ,   .
+void NGramsSuccinctStore::EliasFano::Build( const std::vector<lem::uint64_t> &values, std::vector<lem::uint64_t> &out )
+{
+ const lem::uint64_t n = values.size();
+ const lem::uint64_t universe = n==0 ? 1 : values.back()+1;
+
+ lem::uint64_t l=0;
+ while( l<62 && n>0 && (universe>>(l+1))>=n )
+  l++;
+
+ const lem::uint64_t n_high_bits = n + (n==0 ? 0 : values.back()>>l) + 1;
+ std::vector<lem::uint64_t> high( (n_high_bits+63)/64+1, 0 );
+ std::vector<lem::uint64_t> low( (n*l+63)/64+1, 0 );
+ std::vector<lem::uint64_t> samples;
+
+ for( lem::uint64_t i=0; i<n; ++i )
+  {
+   const lem::uint64_t pos = (values[i]>>l)+i;
+   high[pos>>6] |= ONE<<(pos&63);
+
+   if( l>0 )
+    PutBits( low, i*l, int(l), values[i] & ((ONE<<l)-1) );
+
+   if( (i%SAMPLE)==0 )
+    samples.push_back(pos);
+  }
+
+ out.push_back(n);
+ out.push_back(l);
+ out.push_back(n_high_bits);
+ out.push_back(high.size());
+ out.push_back(low.size());
+ out.push_back(samples.size());
+ out.insert( out.end(), high.begin(), high.end() );
+ out.insert( out.end(), low.begin(), low.end() );
+ out.insert( out.end(), samples.begin(), samples.end() );
+ return;
+}
+
+
+//  NULL,         end.
+const lem::uint64_t* NGramsSuccinctStore::EliasFano::Attach( const lem::uint64_t *p, const lem::uint64_t *end )
+{
+ if( end-p<6 )
+  return NULL;
+
+ n = p[0];
+ l = p[1];
+ n_high_bits = p[2];
+ const lem::uint64_t n_high=p[3], n_low=p[4], n_samples=p[5];
+ p += 6;
+
+ if( l>62 ||
+     n_high<(n_high_bits+63)/64 || n_high>lem::uint64_t(end-p) ||
+     n_low<(n*l+63)/64 || n_low>lem::uint64_t(end-p)-n_high ||
+     n_samples<(n+SAMPLE-1)/SAMPLE || n_samples>lem::uint64_t(end-p)-n_high-n_low )
+  return NULL;
+
+ high = p;
+ low = high + n_high;
+ samples = low + n_low;
+ return samples + n_samples;
+}
+
+
+// ---------------------------------------------------------------------------
+
+
+NGramsSuccinctStore::NGramsSuccinctStore(void)
+ : order(0), n(0), max_freq(0), vocab(0), id_bits(0), q_bits(0), ids(NULL), codes(NULL), codebook(NULL)
+{
+ return;
+}
+
+
+void NGramsSuccinctStore::Close(void)
+{
+ mapped.Close();
+ order=0;
+ n=0;
+ max_freq=0;
+ vocab=0;
+ ids=codes=NULL;
+ codebook=NULL;
+ return;
+}
+
+
+bool NGramsSuccinctStore::Open( const lem::Path &filename )
+{
+ Close();
+
+ if( !mapped.Open(filename) )
+  return false;
+
+ const lem::uint64_t n_words = mapped.Size()/sizeof(lem::uint64_t);
+ const lem::uint64_t *p = mapped.At<lem::uint64_t>(0);
+ const lem::uint64_t *end = p + n_words;
+
+ if( n_words<9 || p[0]!=MAGIC || p[1]!=VERSION || p[2]<1 || p[2]>MAX_ORDER )
+  {
+   Close();
+   return false;
+  }
+
+ order = int(p[2]);
+ n = lem::int64_t(p[3]);
+ max_freq = lem::int32_t(p[4]);
+ vocab = p[5];
+ id_bits = int(p[6]);
+ q_bits = int(p[7]);
+ const lem::uint64_t n_codebook = p[8];
+ p += 9;
+
+ if( id_bits<1 || id_bits>64 || q_bits<1 || q_bits>24 || n_codebook>(ONE<<q_bits) || (n>0 && n_codebook==0) )
+  {
+   Close();
+   return false;
+  }
+
+ for( int j=0; j<order; ++j )
+  {
+   p = columns[j].Attach( p, end );
+   if( p==NULL || columns[j].n!=lem::uint64_t(n) )
+    {
+     Close();
+     return false;
+    }
+  }
+
+ //        .
+ if( p>=end || p[0]>lem::uint64_t(end-p-1) || p[0]<(lem::uint64_t(n)*id_bits+63)/64 )
+  {
+   Close();
+   return false;
+  }
+
+ ids = p+1;
+ p = ids + p[0];
+
+ if( p>=end || p[0]>lem::uint64_t(end-p-1) || p[0]<(lem::uint64_t(n)*q_bits+63)/64 )
+  {
+   Close();
+   return false;
+  }
+
+ codes = p+1;
+ p = codes + p[0];
+
+ if( (n_codebook+1)/2>lem::uint64_t(end-p) )
+  {
+   Close();
+   return false;
+  }
+
+ codebook = reinterpret_cast<const lem::int32_t*>(p);
+ return true;
+}
+
+
+std::pair<int,int> NGramsSuccinctStore::Find( const int *ie ) const
+{
+ lem::uint64_t lo=0, hi=lem::uint64_t(n);
+
+ for( int j=0; j<order; ++j )
+  {
+   if( ie[j]<0 || lem::uint64_t(ie[j])>=vocab || lo==hi )
+    return std::make_pair(-1,-1);
+
+   const EliasFano &c = columns[j];
+
+   //    [lo,hi)   ,    .
+   const lem::uint64_t base = j==0 ? 0 : (c.Get(lo)/vocab)*vocab;
+   const lem::uint64_t x = base + lem::uint64_t(ie[j]);
+
+   const lem::uint64_t lo2 = c.LowerBound( x, lo, hi );
+   if( lo2==hi || c.Get(lo2)!=x )
+    return std::make_pair(-1,-1);
+
+   hi = c.LowerBound( x+1, lo2+1, hi );
+   lo = lo2;
+  }
+
+ const int id = int( GetBits( ids, lo*id_bits, id_bits ) )-1;
+ const int w = codebook[ GetBits( codes, lo*q_bits, q_bits ) ];
+ return std::make_pair(id,w);
+}
+
+
+void NGramsSuccinctStore::Get( lem::int64_t i, int *ie, int &id, int &w ) const
+{
+ const lem::uint64_t k = lem::uint64_t(i);
+ for( int j=0; j<order; ++j )
+  ie[j] = int( columns[j].Get(k) % vocab );
+
+ id = int( GetBits( ids, k*id_bits, id_bits ) )-1;
+ w = codebook[ GetBits( codes, k*q_bits, q_bits ) ];
+ return;
+}
+
+
+// ***************************************************************************
+//   -  64- :  (,
+// , ,  , . ,  , 
+// id   ,   ),  Elias-Fano, 
+// id N-,   ,  .
+// ***************************************************************************
+void NGramsSuccinctStore::Write( const lem::Path &filename, int order, std::vector<Entry> &entries, int q_bits )
+{
+ LEM_CHECKIT_Z( order>0 && order<=MAX_ORDER );
+ LEM_CHECKIT_Z( q_bits>0 && q_bits<=24 );
+
+ std::sort( entries.begin(), entries.end(), EntryLess(order) );
+
+ //   N- .
+ if( !entries.empty() )
+  {
+   std::size_t dst=0;
+   for( std::size_t src=1; src<entries.size(); ++src )
+    {
+     bool eq=true;
+     for( int j=0; j<order && eq; ++j )
+      eq = entries[dst].ie[j]==entries[src].ie[j];
+
+     if( eq )
+      entries[dst].w += entries[src].w;
+     else
+      entries[++dst] = entries[src];
+    }
+
+   entries.resize(dst+1);
+  }
+
+ const lem::uint64_t n = entries.size();
+
+ lem::uint64_t vocab=1, max_id=0;
+ lem::int32_t max_freq=0;
+ for( std::size_t i=0; i<entries.size(); ++i )
+  {
+   for( int j=0; j<order; ++j )
+    {
+     if( entries[i].ie[j]<0 )
+      throw E_BaseException( L"NGramsSuccinctStore: negative word id" );
+
+     vocab = std::max( vocab, lem::uint64_t(entries[i].ie[j])+1 );
+    }
+
+   max_id = std::max( max_id, lem::uint64_t(entries[i].id+1) );
+   max_freq = std::max( max_freq, entries[i].w );
+  }
+
+ // ---    ---
+ std::vector<lem::int32_t> freqs;
+ freqs.reserve( entries.size() );
+ for( std::size_t i=0; i<entries.size(); ++i )
+  freqs.push_back( entries[i].w );
+
+ std::sort( freqs.begin(), freqs.end() );
+ freqs.erase( std::unique( freqs.begin(), freqs.end() ), freqs.end() );
+
+ std::vector<lem::int32_t> codebook;
+ std::vector<lem::uint32_t> code( entries.size(), 0 );
+
+ if( freqs.size()<=(std::size_t(1)<<q_bits) )
+  {
+   //    -   .
+   codebook = freqs;
+   for( std::size_t i=0; i<entries.size(); ++i )
+    code[i] = lem::uint32_t( std::lower_bound( codebook.begin(), codebook.end(), entries[i].w ) - codebook.begin() );
+  }
+ else
+  {
+   //  ,   -      .
+   const int n_code = 1<<q_bits;
+   const double log_max = log( double(std::max(max_freq,2)) );
+
+   std::vector<double> sum( n_code, 0.0 );
+   std::vector<lem::int64_t> count( n_code, 0 );
+   for( std::size_t i=0; i<entries.size(); ++i )
+    {
+     const double f = double( std::max( entries[i].w, 1 ) );
+     const int c = std::min( n_code-1, int( log(f)/log_max*(n_code-1) + 0.5 ) );
+     code[i] = lem::uint32_t(c);
+     sum[c] += entries[i].w;
+     count[c]++;
+    }
+
+   codebook.resize(n_code);
+   for( int c=0; c<n_code; ++c )
+    codebook[c] = count[c]==0 ? 0 : lem::int32_t( sum[c]/count[c] + 0.5 );
+  }
+
+ const int code_bits = BitsFor( codebook.empty() ? 0 : codebook.size()-1 );
+ const int id_bits = BitsFor(max_id);
+
+ std::vector<lem::uint64_t> out;
+ out.push_back(MAGIC);
+ out.push_back(VERSION);
+ out.push_back(order);
+ out.push_back(n);
+ out.push_back( lem::uint64_t(max_freq) );
+ out.push_back(vocab);
+ out.push_back(id_bits);
+ out.push_back(code_bits);
+ out.push_back(codebook.size());
+
+ // ---  id  ---
+ std::vector<lem::uint64_t> column;
+ column.reserve( entries.size() );
+ for( int j=0; j<order; ++j )
+  {
+   column.clear();
+   lem::uint64_t group=0;
+   for( std::size_t i=0; i<entries.size(); ++i )
+    {
+     if( i>0 )
+      for( int k=0; k<j; ++k )
+       if( entries[i].ie[k]!=entries[i-1].ie[k] )
+        {
+         group++;
+         break;
+        }
+
+     if( group > (~lem::uint64_t(0)>>2)/vocab )
+      throw E_BaseException( L"NGramsSuccinctStore: too many n-grams for 64-bit keys" );
+
+     column.push_back( group*vocab + lem::uint64_t(entries[i].ie[j]) );
+    }
+
+   EliasFano::Build( column, out );
+  }
+
+ // --- id N-    ---
+ std::vector<lem::uint64_t> packed( (n*id_bits+63)/64+1, 0 );
+ for( std::size_t i=0; i<entries.size(); ++i )
+  PutBits( packed, i*id_bits, id_bits, lem::uint64_t(entries[i].id+1) );
+
+ out.push_back( packed.size() );
+ out.insert( out.end(), packed.begin(), packed.end() );
+
+ packed.assign( (n*code_bits+63)/64+1, 0 );
+ for( std::size_t i=0; i<entries.size(); ++i )
+  PutBits( packed, i*code_bits, code_bits, code[i] );
+
+ out.push_back( packed.size() );
+ out.insert( out.end(), packed.begin(), packed.end() );
+
+ const std::size_t cb_pos = out.size();
+ out.resize( cb_pos + (codebook.size()+1)/2, 0 );
+ if( !codebook.empty() )
+  memcpy( &out[cb_pos], &codebook[0], codebook.size()*sizeof(lem::int32_t) );
+
+ lem::BinaryWriter wr(filename);
+ wr.write( &out[0], out.size()*sizeof(lem::uint64_t) );
+ return;
+}
+
+
+lem::int64_t NGramsSuccinctStore::ConvertBlockFile( const lem::Path &src, const lem::Path &dst, int order, int q_bits )
+{
+ LEM_CHECKIT_Z( order>1 && order<=MAX_ORDER );
+
+ lem::BinaryReader bin(src);
+
+ lem::int64_t handler_flags=0, marks_pos=0, n=0;
+ lem::int32_t max_freq=0;
+ int n_marks=0;
+ bin.read( &handler_flags, sizeof(handler_flags) );
+ bin.read( &marks_pos, sizeof(marks_pos) );
+ bin.read( &n, sizeof(n) );
+ bin.read( &max_freq, sizeof(max_freq) );
+ bin.read( &n_marks, sizeof(n_marks) );
+
+ std::vector<lem::uint64_t> marks_filepos( n_marks );
+ std::vector<lem::uint32_t> marks_n( n_marks );
+ if( n_marks>0 )
+  {
+   bin.seekp64( marks_pos );
+   bin.read( &marks_filepos[0], sizeof(lem::uint64_t)*n_marks );
+   bin.read( &marks_n[0], sizeof(lem::uint32_t)*n_marks );
+  }
+
+ //  : id , id N-, .
+ const int rec_len = order+2;
+
+ std::vector<Entry> entries;
+ entries.reserve( std::size_t(n) );
+
+ std::vector<lem::int32_t> block;
+ for( int i=0; i<n_marks; ++i )
+  {
+   if( marks_n[i]==0 )
+    continue;
+
+   block.resize( marks_n[i]*rec_len );
+   bin.seekp64( marks_filepos[i] );
+   bin.read( &block[0], block.size()*sizeof(lem::int32_t) );
+
+   for( lem::uint32_t k=0; k<marks_n[i]; ++k )
+    {
+     const lem::int32_t *r = &block[k*rec_len];
+
+     Entry e;
+     for( int j=0; j<MAX_ORDER; ++j )
+      e.ie[j] = j<order ? r[j] : 0;
+
+     e.id = r[order];
+     e.w = r[order+1];
+     entries.push_back(e);
+    }
+  }
+
+ Write( dst, order, entries, q_bits );
+ return CastSizeToInt(entries.size());
+}
+
+#endif
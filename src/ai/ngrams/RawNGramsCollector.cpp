@@ -2572,6 +2572,9 @@ RawNGramsCollector::RawNGramsCollector(void)
  upload_to_db=true;
  print_ngrams=false;
 
+ n_shards=0;
+ shards_capacity=0;
+
  Update1Gram.reserve(1000000);
  Update2Gram.reserve(1000000);
  Update3Gram.reserve(1000000);
@@ -2656,6 +2659,135 @@ RawNGramsCollector::~RawNGramsCollector(void)
 }
 
 
+// *****************************************************************
+//   : N-   n_shard 
+//   capacity    , 
+//       outdir,   EndAll
+//        .
+// *****************************************************************
+void RawNGramsCollector::SetShardedCounters( int n_shard, int capacity )
+{
+ LEM_CHECKIT_Z( n_shard>=0 );
+ LEM_CHECKIT_Z( n_shard==0 || capacity>0 );
+
+ n_shards = n_shard;
+ shards_capacity = capacity;
+
+ if( sol_id.NotNull() )
+  CreateShardedCounters();
+
+ return;
+}
+
+
+void RawNGramsCollector::CreateShardedCounters(void)
+{
+ sharded1=NULL;
+ sharded2=NULL;
+ sharded3=NULL;
+ sharded4=NULL;
+ sharded5=NULL;
+
+ if( n_shards==0 )
+  return;
+
+ if( accum_1grams )
+  sharded1 = new NGramsShardedCounter( 1, n_shards, shards_capacity, outdir, lem::format_str( "NGRAM1%s", suffix.c_str() ) );
+
+ if( accum_2grams )
+  sharded2 = new NGramsShardedCounter( 2, n_shards, shards_capacity, outdir, lem::format_str( "NGRAM2%s", suffix.c_str() ) );
+
+ if( accum_3grams )
+  sharded3 = new NGramsShardedCounter( 3, n_shards, shards_capacity, outdir, lem::format_str( "NGRAM3%s", suffix.c_str() ) );
+
+ if( accum_4grams )
+  sharded4 = new NGramsShardedCounter( 4, n_shards, shards_capacity, outdir, lem::format_str( "NGRAM4%s", suffix.c_str() ) );
+
+ if( accum_5grams )
+  sharded5 = new NGramsShardedCounter( 5, n_shards, shards_capacity, outdir, lem::format_str( "NGRAM5%s", suffix.c_str() ) );
+
+ return;
+}
+
+
+// *****************************************************************
+//    . N-  
+//  id     ,   
+//      ,    .
+// *****************************************************************
+void RawNGramsCollector::FlushShardedCounters( bool echo )
+{
+ NGramsShardedCounter::Record r;
+
+ if( sharded1.NotNull() )
+  {
+   sharded1->BeginMerge(echo);
+   while( sharded1->Fetch(r) )
+    {
+     Cache1Gram( r.ie[0], r.freq );
+     if( CastSizeToInt(ngram1_doccache->size())>=max_ngram1_doccache )
+      PurgeDocCache1(echo);
+    }
+
+   sharded1=NULL;
+  }
+
+ if( sharded2.NotNull() )
+  {
+   sharded2->BeginMerge(echo);
+   while( sharded2->Fetch(r) )
+    {
+     Cache2Gram( r.ie[0], r.ie[1], r.freq );
+     if( CastSizeToInt(ngram2_doccache->size())>=max_ngram2_doccache )
+      PurgeDocCache2(echo);
+    }
+
+   sharded2=NULL;
+  }
+
+ if( sharded3.NotNull() )
+  {
+   sharded3->BeginMerge(echo);
+   while( sharded3->Fetch(r) )
+    {
+     Cache3Gram( r.ie[0], r.ie[1], r.ie[2], r.freq );
+     if( CastSizeToInt(ngram3_doccache->size())>=max_ngram3_doccache )
+      PurgeDocCache3(echo);
+    }
+
+   sharded3=NULL;
+  }
+
+ if( sharded4.NotNull() )
+  {
+   sharded4->BeginMerge(echo);
+   while( sharded4->Fetch(r) )
+    {
+     Cache4Gram( r.ie[0], r.ie[1], r.ie[2], r.ie[3], r.freq );
+     if( CastSizeToInt(ngram4_doccache->size())>=max_ngram4_doccache )
+      PurgeDocCache4(echo);
+    }
+
+   sharded4=NULL;
+  }
+
+ if( sharded5.NotNull() )
+  {
+   sharded5->BeginMerge(echo);
+   while( sharded5->Fetch(r) )
+    {
+     Cache5Gram( r.ie[0], r.ie[1], r.ie[2], r.ie[3], r.ie[4], r.freq );
+     if( CastSizeToInt(ngram5_doccache->size())>=max_ngram5_doccache )
+      PurgeDocCache5(echo);
+    }
+
+   sharded5=NULL;
+  }
+
+ return;
+}
+
+
 void RawNGramsCollector::PresetTablesSuffix(void)
 {
  if( !lemmatization )
@@ -2983,6 +3115,7 @@ void RawNGramsCollector::Prepare(
    disk_cache5->Open(outdir,table5);
   } 
 
+ CreateShardedCounters();
 
  db->CommitTx();
  db->BeginTx();
@@ -3837,7 +3970,7 @@ void RawNGramsCollector::Process( const UCString &l )
  //       .
  sentence_word.push_back(l);
 
- if( delims.find(l)!=UNKNOWN || sentence_word.size()>=256 )
+ if( IsSentenceEnd( l, CastSizeToInt(sentence_word.size()) ) )
   {
    // ***   ***
 
@@ -3873,14 +4006,26 @@ void RawNGramsCollector::ProcessSentence( const lem::MCollect<UCString> &sent )
 }
 
 
+bool RawNGramsCollector::IsSentenceEnd( const UCString &l, int n_words ) const
+{
+ return delims.find(l)!=UNKNOWN || n_words>=256;
+}
+
+
+//    N-?
+bool RawNGramsCollector::IsNGramBreak( const UCString &l ) const
+{
+ return l.empty() ||
+        //lem::is_int(l.c_str()) ||
+        //(l.size()==1 && lem::is_udelim(l)) ||
+        l.front()==L'_' || l.front()==L'.' ||
+        (l.length()==1 && delims.find(l)!=UNKNOWN );
+}
+
+
 void RawNGramsCollector::ProcessSingleWord( const UCString &l )
 {
- if( l.empty() ||
-     //lem::is_int(l.c_str()) ||
-     //(l.size()==1 && lem::is_udelim(l)) ||
-     l.front()==L'_' || l.front()==L'.' ||
-     (l.length()==1 && delims.find(l)!=UNKNOWN )
-   ) 
+ if( IsNGramBreak(l) ) 
   {
    //   
    Push(UNKNOWN);
@@ -3901,6 +4046,72 @@ void RawNGramsCollector::ProcessSingleWord( const UCString &l )
 
 
 
+// *****************************************************************
+//   ,     
+//  .    
+//   .   ,    Process 
+//   ,  id     
+//  .
+// *****************************************************************
+void RawNGramsCollector::CountSentence( const lem::MCollect<UCString> &sent )
+{
+ #if defined LEM_THREADS
+ lem::Ptr<lem::Process::CritSecLocker> lock_all;
+ if( n_shards==0 )
+  lock_all = new lem::Process::CritSecLocker(&cs_words);
+ #endif
+
+ lem::MCollect<int> ies;
+ for( lem::Container::size_type i=0; i<sent.size(); ++i )
+  {
+   const UCString &w = sent[i];
+   if( IsNGramBreak(w) )
+    {
+     CountSegment(ies);
+     ies.clear();
+    }
+   else
+    {
+     #if defined LEM_THREADS
+     lem::Process::CritSecLocker lock(&cs_words);
+     #endif
+     ies.push_back( NormalizeAndRegisterWord(w) );
+    }
+  }
+
+ CountSegment(ies);
+ return;
+}
+
+
+//  N-    .
+void RawNGramsCollector::CountSegment( const lem::MCollect<int> &ies )
+{
+ const int n = CastSizeToInt(ies.size());
+
+ for( int i=0; i<n; ++i )
+  {
+   if( accum_1grams )
+    Store1Gram( ies[i], 1 );
+
+   if( accum_2grams && i+2<=n )
+    Store2Gram( ies[i], ies[i+1], 1 );
+
+   if( accum_3grams && i+3<=n )
+    Store3Gram( ies[i], ies[i+1], ies[i+2], 1 );
+
+   if( accum_4grams && i+4<=n )
+    Store4Gram( ies[i], ies[i+1], ies[i+2], ies[i+3], 1 );
+
+   if( accum_5grams && i+5<=n )
+    Store5Gram( ies[i], ies[i+1], ies[i+2], ies[i+3], ies[i+4], 1 );
+  }
+
+ return;
+}
+
+
+
 int RawNGramsCollector::NormalizeAndRegisterWord( const UCString &l )
 {
  if( lemmatization )
@@ -4052,6 +4263,22 @@ void RawNGramsCollector::Store1Gram( int ie11, int freq )
  if( filter!=NULL && !filter->Probe(this,ie11) )
   return; 
 
+ if( sharded1.NotNull() )
+  {
+   const int ie[1] = { ie11 };
+   sharded1->Add( ie, freq );
+  }
+ else
+  {
+   Cache1Gram( ie11, freq );
+  }
+
+ return;
+}
+
+
+void RawNGramsCollector::Cache1Gram( int ie11, int freq )
+{
  NGRAM1_DOCCACHE::iterator it = ngram1_doccache->find( ie11 );
  if( it!=ngram1_doccache->end() )
   {
@@ -4076,6 +4303,22 @@ void RawNGramsCollector::Store2Gram( int ie21, int ie22, int freq )
  if( filter!=NULL && !filter->Probe(this,ie21,ie22) )
   return; 
 
+ if( sharded2.NotNull() )
+  {
+   const int ie[2] = { ie21, ie22 };
+   sharded2->Add( ie, freq );
+  }
+ else
+  {
+   Cache2Gram( ie21, ie22, freq );
+  }
+
+ return;
+}
+
+
+void RawNGramsCollector::Cache2Gram( int ie21, int ie22, int freq )
+{
  NGRAM2_DOCCACHE::iterator it = ngram2_doccache->find( std::make_pair(ie21,ie22) );
  if( it!=ngram2_doccache->end() )
   {
@@ -4099,6 +4342,22 @@ void RawNGramsCollector::Store3Gram( int ie31, int ie32, int ie33, int freq )
  if( filter!=NULL && !filter->Probe(this,ie31,ie32,ie33) )
   return; 
 
+ if( sharded3.NotNull() )
+  {
+   const int ie[3] = { ie31, ie32, ie33 };
+   sharded3->Add( ie, freq );
+  }
+ else
+  {
+   Cache3Gram( ie31, ie32, ie33, freq );
+  }
+
+ return;
+}
+
+
+void RawNGramsCollector::Cache3Gram( int ie31, int ie32, int ie33, int freq )
+{
  lem::triple<int,int,int> ie123(ie31,ie32,ie33);
  NGRAM3_DOCCACHE::iterator it = ngram3_doccache->find( ie123 );
  if( it!=ngram3_doccache->end() )
@@ -4126,6 +4385,22 @@ void RawNGramsCollector::Store4Gram( int ie41, int ie42, int ie43, int ie44, int
  if( filter!=NULL && !filter->Probe(this,ie41,ie42,ie43,ie44) )
   return; 
 
+ if( sharded4.NotNull() )
+  {
+   const int ie[4] = { ie41, ie42, ie43, ie44 };
+   sharded4->Add( ie, freq );
+  }
+ else
+  {
+   Cache4Gram( ie41, ie42, ie43, ie44, freq );
+  }
+
+ return;
+}
+
+
+void RawNGramsCollector::Cache4Gram( int ie41, int ie42, int ie43, int ie44, int freq )
+{
  lem::foursome<int,int,int,int> ie1234(ie41,ie42,ie43,ie44);
  NGRAM4_DOCCACHE::iterator it = ngram4_doccache->find( ie1234 );
  if( it!=ngram4_doccache->end() )
@@ -4153,6 +4428,22 @@ void RawNGramsCollector::Store5Gram( int ie51, int ie52, int ie53, int ie54, int
  if( filter!=NULL && !filter->Probe(this,ie51,ie52,ie53,ie54,ie55) )
   return; 
 
+ if( sharded5.NotNull() )
+  {
+   const int ie[5] = { ie51, ie52, ie53, ie54, ie55 };
+   sharded5->Add( ie, freq );
+  }
+ else
+  {
+   Cache5Gram( ie51, ie52, ie53, ie54, ie55, freq );
+  }
+
+ return;
+}
+
+
+void RawNGramsCollector::Cache5Gram( int ie51, int ie52, int ie53, int ie54, int ie55, int freq )
+{
  lem::tuple5<int,int,int,int,int> ie12345(ie51,ie52,ie53,ie54,ie55);
  NGRAM5_DOCCACHE::iterator it = ngram5_doccache->find( ie12345 );
  if( it!=ngram5_doccache->end() )
@@ -5270,6 +5561,8 @@ void RawNGramsCollector::EndAll( bool echo )
  if(echo)
   lem::mout->printf( "%vf2All documents have been processed, flushing caches...%vn\n" );
 
+ FlushShardedCounters(echo);
+
  //     .
  PurgeDocCache(echo);
 
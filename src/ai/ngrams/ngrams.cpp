@@ -22,6 +22,8 @@
 #include <lem/solarix/_sg_api.h>
 #include <lem/solarix/ngrams.h>
 #include <lem/solarix/ngrams_hashing.h>
+#include <lem/solarix/ngrams_block_search.h>
+#include <lem/solarix/NGramsSuccinctStore.h>
 
 using namespace lem;
 using namespace Solarix;
@@ -33,6 +35,64 @@ static lem::FString to_utf8( const lem::UCString &u )
 }
 
 
+//   .ef ,       : 
+//    .ef    .
+static bool IsSuccinctUpToDate( const lem::Path &ef, const lem::Path &block )
+{
+ if( !ef.DoesExist() )
+  return false;
+
+ if( !block.DoesExist() )
+  return true;
+
+ boost::posix_time::ptime creat, ef_modif, block_modif;
+ lem::BinaryReader ef_file(ef);
+ lem::BinaryReader block_file(block);
+ if( !ef_file.GetTimes( creat, ef_modif ) || !block_file.GetTimes( creat, block_modif ) )
+  return false;
+
+ return ef_modif>=block_modif;
+}
+
+
+//  N-   ,     .
+static void ForEachSuccinct(
+                            const NGramsSuccinctStore &store,
+                            Ngrams *n,
+                            const lem::FString &db_suffix,
+                            const lem::FString &segment_name,
+                            NGramHandler *handler
+                           )
+{
+ int ie[NGramsSuccinctStore::MAX_ORDER];
+ lem::UCString word[NGramsSuccinctStore::MAX_ORDER];
+ const int order = store.GetOrder();
+
+ for( lem::int64_t i=0; i<store.size(); ++i )
+  {
+   int id_ngram=0, w=0;
+   store.Get( i, ie, id_ngram, w );
+
+   for( int j=0; j<order; ++j )
+    word[j] = n->GetWord( db_suffix, segment_name, ie[j] );
+
+   bool go_on=false;
+   switch(order)
+   {
+    case 2: go_on = handler->Do( *n, id_ngram, w, ie[0], ie[1], word[0], word[1] ); break;
+    case 3: go_on = handler->Do( *n, id_ngram, w, ie[0], ie[1], ie[2], word[0], word[1], word[2] ); break;
+    case 4: go_on = handler->Do( *n, id_ngram, w, ie[0], ie[1], ie[2], ie[3], word[0], word[1], word[2], word[3] ); break;
+    case 5: go_on = handler->Do( *n, id_ngram, w, ie[0], ie[1], ie[2], ie[3], ie[4], word[0], word[1], word[2], word[3], word[4] ); break;
+   }
+
+   if( !go_on )
+    break;
+  }
+
+ return;
+}
+
+
 // -------------------------------------------------------------
 
 Ngrams::Cache2::~Cache2(void)
@@ -77,7 +137,10 @@ lem::int64_t Ngrams::Cache2::LoadBin( const lem::Path &filename )
    for( int i=0; i<n_marks; ++i )
     max_n = max( max_n, int(marks_n[i]) );
 
-   search_buffer = new Cached2Gram[max_n];
+   //  N-    -       
+   // ,   .   ,  -.
+   if( !mapped.Open(filename) )
+    search_buffer = new Cached2Gram[max_n];
 
    res = n;
   }
@@ -85,68 +148,73 @@ lem::int64_t Ngrams::Cache2::LoadBin( const lem::Path &filename )
  return res;
 }
 
-std::pair<int/*id*/,int/*w*/> Ngrams::Cache2::find( int x, int y ) const
+//     , . NGramsSuccinctStore.
+lem::int64_t Ngrams::Cache2::LoadSuccinct( const lem::Path &filename )
 {
- const int i_block = ngram2hash(x,y) % n_marks;
- LEM_CHECKIT_Z( i_block>=0 && i_block<n_marks );
+ succinct = new NGramsSuccinctStore;
+ if( !succinct->Open(filename) || succinct->GetOrder()!=2 )
+  {
+   succinct = NULL;
+   return -1;
+  }
 
- bin->seekp64( marks_filepos[i_block] );
+ n = succinct->size();
+ max_freq = succinct->GetMaxFreq();
+ return n;
+}
 
- std::pair<int,int> ngram(x,y);
 
- if( marks_n[i_block]<=10 )
+std::pair<int/*id*/,int/*w*/> Ngrams::Cache2::find( int x, int y ) const
+{
+ if( succinct.NotNull() )
   {
-   Cached2Gram rec;
-   for( lem::uint32_t i=0; i< marks_n[i_block]; ++i )
-    {
-     bin->read( &rec, sizeof(rec) );
-     if( rec.ngram==ngram )
-      return std::make_pair( rec.id, rec.w );
-    } 
+   const int ie[2] = { x, y };
+   return succinct->Find(ie);
   }
- else
-  { 
-   bin->read( search_buffer, sizeof(Cached2Gram)*marks_n[i_block] );
 
-   int i_left=0, i_right=marks_n[i_block]-1;
-   while( (i_right-i_left)>1 )
-    {
-     int i_mid = (i_right+i_left)/2;
-
-     if( search_buffer[i_mid].ngram==ngram )
-      return std::make_pair( search_buffer[i_mid].id, search_buffer[i_mid].w );
-
-     if( search_buffer[i_mid].ngram>ngram )
-      i_left = i_mid;
-     else
-      i_right = i_mid;
-    }
+ const int i_block = ngram2hash(x,y) % n_marks;
+ LEM_CHECKIT_Z( i_block>=0 && i_block<n_marks );
 
-   if( search_buffer[i_left].ngram==ngram )
-    return std::make_pair( search_buffer[i_left].id, search_buffer[i_left].w );
+ std::pair<int,int> ngram(x,y);
 
-   if( search_buffer[i_right].ngram==ngram )
-    return std::make_pair( search_buffer[i_right].id, search_buffer[i_right].w );
+ const Cached2Gram *block = search_buffer;
+ if( mapped.IsOpen() )
+  block = mapped.At<Cached2Gram>( marks_filepos[i_block] );
+ else
+  {
+   bin->seekp64( marks_filepos[i_block] );
+   bin->read( search_buffer, sizeof(Cached2Gram)*marks_n[i_block] );
   }
 
-
- return std::make_pair( -1, -1 );
+ return ngram_find_in_block( block, marks_n[i_block], ngram );
 }
 
 
 void Ngrams::Cache2::ForEach( Ngrams *n, const lem::FString &db_suffix, const lem::FString &segment_name, Ngrams::raw *r, NGramHandler *handler )
 {
+ if( succinct.NotNull() )
+  {
+   ForEachSuccinct( *succinct, n, db_suffix, segment_name, handler );
+   return;
+  }
+
  for( int i_block=0; i_block<n_marks; ++i_block )
   {
-   bin->seekp64( marks_filepos[i_block] );
-   bin->read( search_buffer, sizeof(Cached2Gram)*marks_n[i_block] );
+   const Cached2Gram *block = search_buffer;
+   if( mapped.IsOpen() )
+    block = mapped.At<Cached2Gram>( marks_filepos[i_block] );
+   else
+    {
+     bin->seekp64( marks_filepos[i_block] );
+     bin->read( search_buffer, sizeof(Cached2Gram)*marks_n[i_block] );
+    }
 
    for( int j=0; j<marks_n[i_block]; ++j )
     {
-     const int id_word1 = search_buffer[j].ngram.first;
-     const int id_word2 = search_buffer[j].ngram.second;
-     const int id_ngram = search_buffer[j].id;
-     const int w = search_buffer[j].w;
+     const int id_word1 = block[j].ngram.first;
+     const int id_word2 = block[j].ngram.second;
+     const int id_ngram = block[j].id;
+     const int w = block[j].w;
  
      lem::UCString word1 = n->GetWord( db_suffix, segment_name, id_word1 );
      lem::UCString word2 = n->GetWord( db_suffix, segment_name, id_word2 );
@@ -207,7 +275,10 @@ lem::int64_t Ngrams::Cache3::LoadBin( const lem::Path &filename )
    for( int i=0; i<n_marks; ++i )
     max_n = max( max_n, int(marks_n[i]) );
 
-   search_buffer = new Cached3Gram[max_n];
+   //  N-    -       
+   // ,   .   ,  -.
+   if( !mapped.Open(filename) )
+    search_buffer = new Cached3Gram[max_n];
 
    res = n;
   }
@@ -215,67 +286,73 @@ lem::int64_t Ngrams::Cache3::LoadBin( const lem::Path &filename )
  return res;
 }
 
-std::pair<int/*id*/,int/*w*/> Ngrams::Cache3::find( int x, int y, int z ) const
+//     , . NGramsSuccinctStore.
+lem::int64_t Ngrams::Cache3::LoadSuccinct( const lem::Path &filename )
 {
- const int i_block = ngram3hash(x,y,z) % n_marks;
- LEM_CHECKIT_Z( i_block>=0 && i_block<n_marks );
+ succinct = new NGramsSuccinctStore;
+ if( !succinct->Open(filename) || succinct->GetOrder()!=3 )
+  {
+   succinct = NULL;
+   return -1;
+  }
 
- bin->seekp64( marks_filepos[i_block] );
+ n = succinct->size();
+ max_freq = succinct->GetMaxFreq();
+ return n;
+}
 
- lem::triple<int,int,int> ngram(x,y,z);
 
- if( marks_n[i_block]<=10 )
+std::pair<int/*id*/,int/*w*/> Ngrams::Cache3::find( int x, int y, int z ) const
+{
+ if( succinct.NotNull() )
   {
-   Cached3Gram rec;
-   for( lem::uint32_t i=0; i< marks_n[i_block]; ++i )
-    {
-     bin->read( &rec, sizeof(rec) );
-     if( rec.ngram==ngram )
-      return std::make_pair( rec.id, rec.w );
-    } 
+   const int ie[3] = { x, y, z };
+   return succinct->Find(ie);
   }
- else
-  { 
-   bin->read( search_buffer, sizeof(Cached3Gram)*marks_n[i_block] );
 
-   int i_left=0, i_right=marks_n[i_block]-1;
-   while( (i_right-i_left)>1 )
-    {
-     int i_mid = (i_right+i_left)/2;
-
-     if( search_buffer[i_mid].ngram==ngram )
-      return std::make_pair( search_buffer[i_mid].id, search_buffer[i_mid].w );
-
-     if( search_buffer[i_mid].ngram<ngram )
-      i_right = i_mid;
-     else
-      i_left = i_mid;
-    }
+ const int i_block = ngram3hash(x,y,z) % n_marks;
+ LEM_CHECKIT_Z( i_block>=0 && i_block<n_marks );
 
-   if( search_buffer[i_left].ngram==ngram )
-    return std::make_pair( search_buffer[i_left].id, search_buffer[i_left].w );
+ lem::triple<int,int,int> ngram(x,y,z);
 
-   if( search_buffer[i_right].ngram==ngram )
-    return std::make_pair( search_buffer[i_right].id, search_buffer[i_right].w );
+ const Cached3Gram *block = search_buffer;
+ if( mapped.IsOpen() )
+  block = mapped.At<Cached3Gram>( marks_filepos[i_block] );
+ else
+  {
+   bin->seekp64( marks_filepos[i_block] );
+   bin->read( search_buffer, sizeof(Cached3Gram)*marks_n[i_block] );
   }
 
- return std::make_pair( -1, -1 );
+ return ngram_find_in_block( block, marks_n[i_block], ngram );
 }
 
 void Ngrams::Cache3::ForEach( Ngrams *n, const lem::FString &db_suffix, const lem::FString &segment_name, Ngrams::raw *r, NGramHandler *handler )
 {
+ if( succinct.NotNull() )
+  {
+   ForEachSuccinct( *succinct, n, db_suffix, segment_name, handler );
+   return;
+  }
+
  for( int i_block=0; i_block<n_marks; ++i_block )
   {
-   bin->seekp64( marks_filepos[i_block] );
-   bin->read( search_buffer, sizeof(Cached3Gram)*marks_n[i_block] );
+   const Cached3Gram *block = search_buffer;
+   if( mapped.IsOpen() )
+    block = mapped.At<Cached3Gram>( marks_filepos[i_block] );
+   else
+    {
+     bin->seekp64( marks_filepos[i_block] );
+     bin->read( search_buffer, sizeof(Cached3Gram)*marks_n[i_block] );
+    }
 
    for( int j=0; j<marks_n[i_block]; ++j )
     {
-     const int id_word1 = search_buffer[j].ngram.first;
-     const int id_word2 = search_buffer[j].ngram.second;
-     const int id_word3 = search_buffer[j].ngram.third;
-     const int id_ngram = search_buffer[j].id;
-     const int w = search_buffer[j].w;
+     const int id_word1 = block[j].ngram.first;
+     const int id_word2 = block[j].ngram.second;
+     const int id_word3 = block[j].ngram.third;
+     const int id_ngram = block[j].id;
+     const int w = block[j].w;
  
      lem::UCString word1 = n->GetWord( db_suffix, segment_name, id_word1 );
      lem::UCString word2 = n->GetWord( db_suffix, segment_name, id_word2 );
@@ -336,7 +413,10 @@ lem::int64_t Ngrams::Cache4::LoadBin( const lem::Path &filename )
    for( int i=0; i<n_marks; ++i )
     max_n = max( max_n, int(marks_n[i]) );
 
-   search_buffer = new Cached4Gram[max_n];
+   //  N-    -       
+   // ,   .   ,  -.
+   if( !mapped.Open(filename) )
+    search_buffer = new Cached4Gram[max_n];
 
    res = n;
   }
@@ -344,69 +424,75 @@ lem::int64_t Ngrams::Cache4::LoadBin( const lem::Path &filename )
  return res;
 }
 
-std::pair<int/*id*/,int/*w*/> Ngrams::Cache4::find( int i1, int i2, int i3, int i4 ) const
+//     , . NGramsSuccinctStore.
+lem::int64_t Ngrams::Cache4::LoadSuccinct( const lem::Path &filename )
 {
- const int i_block = ngram4hash(i1,i2,i3,i4) % n_marks;
- LEM_CHECKIT_Z( i_block>=0 && i_block<n_marks );
+ succinct = new NGramsSuccinctStore;
+ if( !succinct->Open(filename) || succinct->GetOrder()!=4 )
+  {
+   succinct = NULL;
+   return -1;
+  }
 
- bin->seekp64( marks_filepos[i_block] );
+ n = succinct->size();
+ max_freq = succinct->GetMaxFreq();
+ return n;
+}
 
- lem::foursome<int,int,int,int> ngram(i1,i2,i3,i4);
 
- if( marks_n[i_block]<=10 )
+std::pair<int/*id*/,int/*w*/> Ngrams::Cache4::find( int i1, int i2, int i3, int i4 ) const
+{
+ if( succinct.NotNull() )
   {
-   Cached4Gram rec;
-   for( lem::uint32_t i=0; i< marks_n[i_block]; ++i )
-    {
-     bin->read( &rec, sizeof(rec) );
-     if( rec.ngram==ngram )
-      return std::make_pair( rec.id, rec.w );
-    } 
+   const int ie[4] = { i1, i2, i3, i4 };
+   return succinct->Find(ie);
   }
- else
-  { 
-   bin->read( search_buffer, sizeof(Cached4Gram)*marks_n[i_block] );
-
-   int i_left=0, i_right=marks_n[i_block]-1;
-   while( (i_right-i_left)>1 )
-    {
-     int i_mid = (i_right+i_left)/2;
 
-     if( search_buffer[i_mid].ngram==ngram )
-      return std::make_pair( search_buffer[i_mid].id, search_buffer[i_mid].w );
-
-     if( search_buffer[i_mid].ngram<ngram )
-      i_right = i_mid;
-     else
-      i_left = i_mid;
-    }
+ const int i_block = ngram4hash(i1,i2,i3,i4) % n_marks;
+ LEM_CHECKIT_Z( i_block>=0 && i_block<n_marks );
 
-   if( search_buffer[i_left].ngram==ngram )
-    return std::make_pair( search_buffer[i_left].id, search_buffer[i_left].w );
+ lem::foursome<int,int,int,int> ngram(i1,i2,i3,i4);
 
-   if( search_buffer[i_right].ngram==ngram )
-    return std::make_pair( search_buffer[i_right].id, search_buffer[i_right].w );
+ const Cached4Gram *block = search_buffer;
+ if( mapped.IsOpen() )
+  block = mapped.At<Cached4Gram>( marks_filepos[i_block] );
+ else
+  {
+   bin->seekp64( marks_filepos[i_block] );
+   bin->read( search_buffer, sizeof(Cached4Gram)*marks_n[i_block] );
   }
 
- return std::make_pair( -1, -1 );
+ return ngram_find_in_block( block, marks_n[i_block], ngram );
 }
 
 
 void Ngrams::Cache4::ForEach( Ngrams *n, const lem::FString &db_suffix, const lem::FString &segment_name, Ngrams::raw *r, NGramHandler *handler )
 {
+ if( succinct.NotNull() )
+  {
+   ForEachSuccinct( *succinct, n, db_suffix, segment_name, handler );
+   return;
+  }
+
  for( int i_block=0; i_block<n_marks; ++i_block )
   {
-   bin->seekp64( marks_filepos[i_block] );
-   bin->read( search_buffer, sizeof(Cached4Gram)*marks_n[i_block] );
+   const Cached4Gram *block = search_buffer;
+   if( mapped.IsOpen() )
+    block = mapped.At<Cached4Gram>( marks_filepos[i_block] );
+   else
+    {
+     bin->seekp64( marks_filepos[i_block] );
+     bin->read( search_buffer, sizeof(Cached4Gram)*marks_n[i_block] );
+    }
 
    for( int j=0; j<marks_n[i_block]; ++j )
     {
-     const int id_word1 = search_buffer[j].ngram.first;
-     const int id_word2 = search_buffer[j].ngram.second;
-     const int id_word3 = search_buffer[j].ngram.third;
-     const int id_word4 = search_buffer[j].ngram.fourth;
-     const int id_ngram = search_buffer[j].id;
-     const int w = search_buffer[j].w;
+     const int id_word1 = block[j].ngram.first;
+     const int id_word2 = block[j].ngram.second;
+     const int id_word3 = block[j].ngram.third;
+     const int id_word4 = block[j].ngram.fourth;
+     const int id_ngram = block[j].id;
+     const int w = block[j].w;
  
      lem::UCString word1 = n->GetWord( db_suffix, segment_name, id_word1 );
      lem::UCString word2 = n->GetWord( db_suffix, segment_name, id_word2 );
@@ -468,7 +554,10 @@ lem::int64_t Ngrams::Cache5::LoadBin( const lem::Path &filename )
    for( int i=0; i<n_marks; ++i )
     max_n = max( max_n, int(marks_n[i]) );
 
-   search_buffer = new Cached5Gram[max_n];
+   //  N-    -       
+   // ,   .   ,  -.
+   if( !mapped.Open(filename) )
+    search_buffer = new Cached5Gram[max_n];
 
    res = n;
   }
@@ -476,70 +565,76 @@ lem::int64_t Ngrams::Cache5::LoadBin( const lem::Path &filename )
  return res;
 }
 
-std::pair<int/*id*/,int/*w*/> Ngrams::Cache5::find( int i1, int i2, int i3, int i4, int i5 ) const
+//     , . NGramsSuccinctStore.
+lem::int64_t Ngrams::Cache5::LoadSuccinct( const lem::Path &filename )
 {
- const int i_block = ngram5hash(i1,i2,i3,i4,i5) % n_marks;
- LEM_CHECKIT_Z( i_block>=0 && i_block<n_marks );
+ succinct = new NGramsSuccinctStore;
+ if( !succinct->Open(filename) || succinct->GetOrder()!=5 )
+  {
+   succinct = NULL;
+   return -1;
+  }
 
- bin->seekp64( marks_filepos[i_block] );
+ n = succinct->size();
+ max_freq = succinct->GetMaxFreq();
+ return n;
+}
 
- lem::tuple5<int,int,int,int,int> ngram(i1,i2,i3,i4,i5);
 
- if( marks_n[i_block]<=10 )
+std::pair<int/*id*/,int/*w*/> Ngrams::Cache5::find( int i1, int i2, int i3, int i4, int i5 ) const
+{
+ if( succinct.NotNull() )
   {
-   Cached5Gram rec;
-   for( lem::uint32_t i=0; i< marks_n[i_block]; ++i )
-    {
-     bin->read( &rec, sizeof(rec) );
-     if( rec.ngram==ngram )
-      return std::make_pair( rec.id, rec.w );
-    } 
+   const int ie[5] = { i1, i2, i3, i4, i5 };
+   return succinct->Find(ie);
   }
- else
-  { 
-   bin->read( search_buffer, sizeof(Cached5Gram)*marks_n[i_block] );
 
-   int i_left=0, i_right=marks_n[i_block]-1;
-   while( (i_right-i_left)>1 )
-    {
-     int i_mid = (i_right+i_left)/2;
-
-     if( search_buffer[i_mid].ngram==ngram )
-      return std::make_pair( search_buffer[i_mid].id, search_buffer[i_mid].w );
-
-     if( search_buffer[i_mid].ngram<ngram )
-      i_right = i_mid;
-     else
-      i_left = i_mid;
-    }
+ const int i_block = ngram5hash(i1,i2,i3,i4,i5) % n_marks;
+ LEM_CHECKIT_Z( i_block>=0 && i_block<n_marks );
 
-   if( search_buffer[i_left].ngram==ngram )
-    return std::make_pair( search_buffer[i_left].id, search_buffer[i_left].w );
+ lem::tuple5<int,int,int,int,int> ngram(i1,i2,i3,i4,i5);
 
-   if( search_buffer[i_right].ngram==ngram )
-    return std::make_pair( search_buffer[i_right].id, search_buffer[i_right].w );
+ const Cached5Gram *block = search_buffer;
+ if( mapped.IsOpen() )
+  block = mapped.At<Cached5Gram>( marks_filepos[i_block] );
+ else
+  {
+   bin->seekp64( marks_filepos[i_block] );
+   bin->read( search_buffer, sizeof(Cached5Gram)*marks_n[i_block] );
   }
 
- return std::make_pair( -1, -1 );
+ return ngram_find_in_block( block, marks_n[i_block], ngram );
 }
 
 
 void Ngrams::Cache5::ForEach( Ngrams *n, const lem::FString &db_suffix, const lem::FString &segment_name, Ngrams::raw *r, NGramHandler *handler )
 {
+ if( succinct.NotNull() )
+  {
+   ForEachSuccinct( *succinct, n, db_suffix, segment_name, handler );
+   return;
+  }
+
  for( int i_block=0; i_block<n_marks; ++i_block )
   {
-   bin->seekp64( marks_filepos[i_block] );
-   bin->read( search_buffer, sizeof(Cached5Gram)*marks_n[i_block] );
+   const Cached5Gram *block = search_buffer;
+   if( mapped.IsOpen() )
+    block = mapped.At<Cached5Gram>( marks_filepos[i_block] );
+   else
+    {
+     bin->seekp64( marks_filepos[i_block] );
+     bin->read( search_buffer, sizeof(Cached5Gram)*marks_n[i_block] );
+    }
 
    for( int j=0; j<marks_n[i_block]; ++j )
     {
-     const int id_word1 = search_buffer[j].ngram.first;
-     const int id_word2 = search_buffer[j].ngram.second;
-     const int id_word3 = search_buffer[j].ngram.third;
-     const int id_word4 = search_buffer[j].ngram.fourth;
-     const int id_word5 = search_buffer[j].ngram.fifth;
-     const int id_ngram = search_buffer[j].id;
-     const int w = search_buffer[j].w;
+     const int id_word1 = block[j].ngram.first;
+     const int id_word2 = block[j].ngram.second;
+     const int id_word3 = block[j].ngram.third;
+     const int id_word4 = block[j].ngram.fourth;
+     const int id_word5 = block[j].ngram.fifth;
+     const int id_ngram = block[j].id;
+     const int w = block[j].w;
  
      lem::UCString word1 = n->GetWord( db_suffix, segment_name, id_word1 );
      lem::UCString word2 = n->GetWord( db_suffix, segment_name, id_word2 );
@@ -603,9 +698,13 @@ lem::int64_t Ngrams::raw::PreloadCachesFromFiles( const lem::Path &folder )
    lem::Path p2(folder);
    p2.ConcateLeaf(filename2);
    
-   if( p2.DoesExist() )
+   lem::Path e2(folder);
+   e2.ConcateLeaf( lem::format_str( L"NGRAM2%hs%hs.ef", suffix.c_str(), segment.c_str() ) );
+
+   const lem::int64_t n2 = IsSuccinctUpToDate(e2,p2) ? cache2.back()->LoadSuccinct(e2) : -1;
+   if( n2>=0 || p2.DoesExist() )
     {
-     nraw2 += cache2.back()->LoadBin(p2); 
+     nraw2 += n2>=0 ? n2 : cache2.back()->LoadBin(p2); 
      max_w2 = std::max( max_w2, (float)cache2.back()->max_freq );
      res += nraw2;
     }
@@ -613,9 +712,14 @@ lem::int64_t Ngrams::raw::PreloadCachesFromFiles( const lem::Path &folder )
    lem::UFString filename3 = lem::format_str( L"NGRAM3%hs%hs", suffix.c_str(), segment.c_str() );
    lem::Path p3(folder);
    p3.ConcateLeaf(filename3);
-   if( p3.DoesExist() )
+
+   lem::Path e3(folder);
+   e3.ConcateLeaf( lem::format_str( L"NGRAM3%hs%hs.ef", suffix.c_str(), segment.c_str() ) );
+
+   const lem::int64_t n3 = IsSuccinctUpToDate(e3,p3) ? cache3.back()->LoadSuccinct(e3) : -1;
+   if( n3>=0 || p3.DoesExist() )
     {
-     nraw3 += cache3.back()->LoadBin(p3);
+     nraw3 += n3>=0 ? n3 : cache3.back()->LoadBin(p3);
      max_w3 = std::max( max_w3, (float)cache3.back()->max_freq );
      res += nraw3;
     }
@@ -623,9 +727,14 @@ lem::int64_t Ngrams::raw::PreloadCachesFromFiles( const lem::Path &folder )
    lem::UFString filename4 = lem::format_str( L"NGRAM4%hs%hs", suffix.c_str(), segment.c_str() );
    lem::Path p4(folder);
    p4.ConcateLeaf(filename4);
-   if( p4.DoesExist() )
+
+   lem::Path e4(folder);
+   e4.ConcateLeaf( lem::format_str( L"NGRAM4%hs%hs.ef", suffix.c_str(), segment.c_str() ) );
+
+   const lem::int64_t n4 = IsSuccinctUpToDate(e4,p4) ? cache4.back()->LoadSuccinct(e4) : -1;
+   if( n4>=0 || p4.DoesExist() )
     {
-     nraw4 += cache4.back()->LoadBin(p4);
+     nraw4 += n4>=0 ? n4 : cache4.back()->LoadBin(p4);
      max_w4 = std::max( max_w4, (float)cache4.back()->max_freq );
      res += nraw4;
     }
@@ -633,9 +742,14 @@ lem::int64_t Ngrams::raw::PreloadCachesFromFiles( const lem::Path &folder )
    lem::UFString filename5 = lem::format_str( L"NGRAM5%hs%hs", suffix.c_str(), segment.c_str() );
    lem::Path p5(folder);
    p5.ConcateLeaf(filename5);
-   if( p5.DoesExist() )
+
+   lem::Path e5(folder);
+   e5.ConcateLeaf( lem::format_str( L"NGRAM5%hs%hs.ef", suffix.c_str(), segment.c_str() ) );
+
+   const lem::int64_t n5 = IsSuccinctUpToDate(e5,p5) ? cache5.back()->LoadSuccinct(e5) : -1;
+   if( n5>=0 || p5.DoesExist() )
     {
-     nraw5 += cache5.back()->LoadBin(p5);
+     nraw5 += n5>=0 ? n5 : cache5.back()->LoadBin(p5);
      max_w5 = std::max( max_w5, (float)cache5.back()->max_freq );
      res += nraw5;
     }
@@ -2955,6 +3069,129 @@ void Ngrams::ForEachRaw5( bool lemmatized, NGramHandler *handler, int sorting_ty
 }
 #endif
 
+#if defined SOL_CAA
+namespace
+{
+ //  N-       .
+ class SuccinctCollector : public NGramHandler
+ {
+  private:
+   void Add( int id_ngram, int freq, int ie1, int ie2, int ie3, int ie4, int ie5 )
+   {
+    NGramsSuccinctStore::Entry e;
+    e.ie[0]=ie1; e.ie[1]=ie2; e.ie[2]=ie3; e.ie[3]=ie4; e.ie[4]=ie5;
+    e.id=id_ngram;
+    e.w=freq;
+    entries.push_back(e);
+    return;
+   }
+
+  public:
+   std::vector<NGramsSuccinctStore::Entry> entries;
+
+   virtual bool Do( Ngrams &ngrams, int id_ngram, int freq, int id_word1, int id_word2,
+                    const lem::UCString &word1, const lem::UCString &word2 )
+   { Add( id_ngram, freq, id_word1, id_word2, 0, 0, 0 ); return true; }
+
+   virtual bool Do( Ngrams &ngrams, int id_ngram, int freq, int id_word1, int id_word2, int id_word3,
+                    const lem::UCString &word1, const lem::UCString &word2, const lem::UCString &word3 )
+   { Add( id_ngram, freq, id_word1, id_word2, id_word3, 0, 0 ); return true; }
+
+   virtual bool Do( Ngrams &ngrams, int id_ngram, int freq, int id_word1, int id_word2, int id_word3, int id_word4,
+                    const lem::UCString &word1, const lem::UCString &word2, const lem::UCString &word3,
+                    const lem::UCString &word4 )
+   { Add( id_ngram, freq, id_word1, id_word2, id_word3, id_word4, 0 ); return true; }
+
+   virtual bool Do( Ngrams &ngrams, int id_ngram, int freq, int id_word1, int id_word2, int id_word3, int id_word4,
+                    int id_word5, const lem::UCString &word1, const lem::UCString &word2, const lem::UCString &word3,
+                    const lem::UCString &word4, const lem::UCString &word5 )
+   { Add( id_ngram, freq, id_word1, id_word2, id_word3, id_word4, id_word5 ); return true; }
+ };
+}
+
+
+// ***************************************************************************
+// -  2..5-   
+// NGRAMn<><>.ef   dest_folder.  - 
+//  ,      ,   N-  .
+//     .       .ef
+//   N-   .
+// ***************************************************************************
+lem::int64_t Ngrams::BuildSuccinctStores( const lem::Path &dest_folder, int q_bits, bool echo )
+{
+ return BuildSuccinctStores( db_raw, dest_folder, q_bits, echo ) +
+        BuildSuccinctStores( db_literal, dest_folder, q_bits, echo );
+}
+
+
+lem::int64_t Ngrams::BuildSuccinctStores( Ngrams::raw &pdb, const lem::Path &dest_folder, int q_bits, bool echo )
+{
+ lem::int64_t res=0;
+
+ for( lem::Container::size_type k=0; k<pdb.segments.size(); ++k )
+  {
+   const lem::FString & segment=pdb.segments[k];
+   lem::FString sgm = segment;
+   sgm.re_clear();
+
+   const bool has[6] = { false, false, pdb.has2, pdb.has3, pdb.has4, pdb.has5 };
+
+   for( int order=2; order<=5; ++order )
+    {
+     lem::Path src(folder);
+     src.ConcateLeaf( lem::format_str( L"NGRAM%d%hs%hs", order, pdb.suffix.c_str(), segment.c_str() ) );
+
+     lem::Path dst(dest_folder);
+     dst.ConcateLeaf( lem::format_str( L"NGRAM%d%hs%hs.ef", order, pdb.suffix.c_str(), segment.c_str() ) );
+
+     lem::int64_t n=0;
+
+     if( src.DoesExist() )
+      {
+       n = NGramsSuccinctStore::ConvertBlockFile( src, dst, order, q_bits );
+      }
+     else if( has[order] && db.NotNull() && db->Connected() )
+      {
+       SuccinctCollector collector;
+
+       db->BeginReadTx();
+       switch(order)
+       {
+        case 2: db->ForEachRaw2( *this, pdb.suffix, sgm, &collector, 0 ); break;
+        case 3: db->ForEachRaw3( *this, pdb.suffix, sgm, &collector, 0 ); break;
+        case 4: db->ForEachRaw4( *this, pdb.suffix, sgm, &collector, 0 ); break;
+        case 5: db->ForEachRaw5( *this, pdb.suffix, sgm, &collector, 0 ); break;
+       }
+       db->CommitReadTx();
+
+       if( collector.entries.empty() )
+        continue;
+
+       NGramsSuccinctStore::Write( dst, order, collector.entries, q_bits );
+       n = CastSizeToInt(collector.entries.size());
+      }
+     else
+      {
+       continue;
+      }
+
+     if( echo )
+      {
+       NGramsSuccinctStore store;
+       store.Open(dst);
+       lem::mout->printf( "NGRAM%d%s%s: %vfE%qd%vn records, %vfE%qd%vn bytes\n",
+        order, pdb.suffix.c_str(), segment.c_str(), n, lem::int64_t(store.GetFileSize()) );
+      }
+
+     res += n;
+    }
+  }
+
+ return res;
+}
+#endif
+
+
 #if defined SOL_CAA
 //      N-  
 lem::int64_t Ngrams::SumFreq( int order, bool lemmatized )
@@ -0,0 +1,1109 @@
+#if defined SOL_CAA && !defined SOL_NO_AA
+
+// CD->16.10.2026
+// LC->16.10.2026
+
+#include <algorithm>
+#include <vector>
+#include <lem/solarix/translation.h>
+#include <lem/solarix/tr_funs.h>
+#include <lem/solarix/TrBytecode.h>
+
+using namespace lem;
+using namespace Solarix;
+
+
+namespace Solarix
+{
+ // ***************************************************************************
+ // -:     ,   -,
+ //      -  ,     
+ //  TrContextInvokation.
+ // ***************************************************************************
+ class TrBytecodeContext : public TrFunContext
+ {
+  private:
+   const TrBytecode &code;
+   int itable;
+   TrValue **slots;
+
+  public:
+   TrBytecodeContext( TrFunContext *outer, const TrBytecode &Code, int iTable, TrValue **Slots )
+    : TrFunContext(outer), code(Code), itable(iTable), slots(Slots) {}
+
+   virtual lem::Ptr<TrValue> GetVar( const UCString &name );
+   virtual void PrintVars( Solarix::Dictionary &dict, lem::OFormatter &out ) const;
+ };
+
+
+ class TrBytecodeCompiler
+ {
+  private:
+   TrBytecode &code;
+   bool ok;
+   int depth;
+
+   typedef std::vector< std::pair<lem::UCString,int> > SCOPE;
+   std::vector<SCOPE> scopes;
+
+   struct Loop
+   {
+    bool is_while;
+    lem::MCollect<int> exits; // ,     
+   };
+
+   lem::PtrCollect<Loop> loops;
+   lem::MCollect<int> fun_exits;
+
+   int Emit( int op, int a=0, int b=0 );
+   int Here(void) const { return CastSizeToInt(code.ops.size()); }
+   void Patch( const lem::MCollect<int> &jumps, int target );
+
+   int NewSlot( const lem::UCString &name );
+   int Resolve( const lem::UCString &name ) const;
+   int OuterName( const lem::UCString &name );
+   int VisibleTable(void);
+
+   void Statement( const TrFunCall *f, bool can_declare );
+   void Expression( const TrFunCall *f );
+   void BuiltIn( const TrFun_BuiltIn *f );
+   void TreeCall( const TrFunCall *f );
+   void LoadVar( const lem::UCString &name );
+
+  public:
+   TrBytecodeCompiler( TrBytecode &Code ) : code(Code), ok(true), depth(0) {}
+
+   bool CompileFunction( const TrFunction &fun );
+ };
+}
+
+
+namespace
+{
+ enum { CellInt, CellBool, CellRef };
+ enum { LOCAL_SLOTS=16, LOCAL_STACK=16, LOCAL_LOOPS=4 };
+
+ //  : int  bool   ,   - 
+ //   TrValue (     ).
+ struct TrCell
+ {
+  int kind;
+  int ival;
+  TrValue *ref;
+  lem::Ptr<TrValue> own;
+
+  TrCell(void) : kind(CellRef), ival(0), ref(NULL) {}
+ };
+
+ struct TrForState
+ {
+  int k, to, step;
+  lem::Ptr<TrValue> var;
+ };
+
+ inline void SetInt( TrCell &c, int x ) { c.kind=CellInt; c.ival=x; }
+ inline void SetBool( TrCell &c, bool x ) { c.kind=CellBool; c.ival=x ? 1 : 0; }
+ inline void SetRef( TrCell &c, TrValue *v ) { c.kind=CellRef; c.ref=v; }
+ inline void SetOwn( TrCell &c, const lem::Ptr<TrValue> &v ) { c.kind=CellRef; c.own=v; c.ref=c.own.get(); }
+
+ inline void Drop( TrCell &c )
+ {
+  if( c.own.NotNull() )
+   c.own.reset();
+  return;
+ }
+
+ inline int CellType( const TrCell &c )
+ {
+  if( c.kind==CellInt )
+   return TrType::Int;
+  else if( c.kind==CellBool )
+   return TrType::Bool;
+  else
+   return c.ref->GetType().GetType();
+ }
+
+ //       ,    TrValue::GetInt/GetBool.
+ int CellToInt( const TrCell &c )
+ {
+  if( c.kind==CellInt )
+   return c.ival;
+  else if( c.kind==CellBool )
+   return TrBoolValue(c.ival!=0).GetInt();
+  else
+   return c.ref->GetInt();
+ }
+
+ bool CellToBool( const TrCell &c )
+ {
+  if( c.kind==CellBool )
+   return c.ival!=0;
+  else if( c.kind==CellInt )
+   return TrIntValue(c.ival).GetBool();
+  else
+   return c.ref->GetBool();
+ }
+
+ lem::Ptr<TrValue> Box( const TrCell &c )
+ {
+  if( c.kind==CellInt )
+   return lem::Ptr<TrValue>( new TrIntValue(c.ival) );
+  else if( c.kind==CellBool )
+   return lem::Ptr<TrValue>( new TrBoolValue(c.ival!=0) );
+  else if( c.own.NotNull() )
+   return c.own;
+  else
+   return lem::Ptr<TrValue>( c.ref, null_deleter() );
+ }
+
+ //  new TrValue(*v)   TrContextInvokation.
+ TrValue* NewValue( const TrCell &c )
+ {
+  if( c.kind==CellInt )
+   return new TrIntValue(c.ival);
+  else if( c.kind==CellBool )
+   return new TrBoolValue(c.ival!=0);
+  else
+   return new TrValue(*c.ref);
+ }
+
+ void AssignCell( TrValue &dst, const TrCell &c )
+ {
+  if( c.kind==CellInt )
+   {
+    TrIntValue v(c.ival);
+    dst.Assign(v);
+   }
+  else if( c.kind==CellBool )
+   {
+    TrBoolValue v(c.ival!=0);
+    dst.Assign(v);
+   }
+  else
+   {
+    dst.Assign(*c.ref);
+   }
+
+  return;
+ }
+
+ bool CellEq( const TrCell &x, const TrCell &y )
+ {
+  const int tx = CellType(x), ty = CellType(y);
+
+  if( tx==TrType::Int && ty==TrType::Int )
+   return CellToInt(x)==CellToInt(y);
+
+  if( tx==TrType::Bool && ty==TrType::Bool )
+   return CellToBool(x)==CellToBool(y);
+
+  lem::Ptr<TrValue> vx = Box(x), vy = Box(y);
+  return vx->eq(*vy);
+ }
+
+ void CheckReturn( const TrFun_User &site, bool returned )
+ {
+  if( !site.ret_type.IsVoid() && !returned )
+   {
+    throw E_BaseException( format_str(L"Missing 'return xxx' statement in function [%s]", site.name.c_str() ) );
+   }
+
+  return;
+ }
+
+
+ class TrBytecodeFrame : lem::NonCopyable
+ {
+  private:
+   TrValue *local[LOCAL_SLOTS];
+   std::vector<TrValue*> heap;
+   int n;
+
+  public:
+   TrValue **slots;
+
+   TrBytecodeFrame( int N ) : n(N)
+   {
+    if( n<=LOCAL_SLOTS )
+     slots = local;
+    else
+     {
+      heap.resize(n);
+      slots = &heap[0];
+     }
+
+    std::fill( slots, slots+n, (TrValue*)NULL );
+   }
+
+   ~TrBytecodeFrame(void)
+   {
+    for( int i=0; i<n; ++i )
+     delete slots[i];
+   }
+ };
+}
+
+
+lem::Ptr<TrValue> TrBytecodeContext::GetVar( const UCString &name )
+{
+ for( int i=code.vis_begin[itable]; i<code.vis_begin[itable+1]; ++i )
+  if( code.vis_name[i].eqi(name) )
+   return lem::Ptr<TrValue>( slots[ code.vis_slot[i] ], null_deleter() );
+
+ return TrFunContext::GetVar(name);
+}
+
+
+void TrBytecodeContext::PrintVars( Solarix::Dictionary &dict, lem::OFormatter &out ) const
+{
+ for( int i=code.vis_begin[itable]; i<code.vis_begin[itable+1]; ++i )
+  {
+   if( code.vis_name[i]==L"((return))" )
+    continue;
+
+   const TrValue &v = *slots[ code.vis_slot[i] ];
+   out.printf( "%vfF%us%vn %vfA%us%vn=", v.GetType().GetName().c_str(), code.vis_name[i].c_str() );
+   v.Print(dict,out);
+   out.eol();
+  }
+
+ TrFunContext::PrintVars(dict,out);
+ return;
+}
+
+
+
+int TrBytecodeCompiler::Emit( int op, int a, int b )
+{
+ TrBytecodeOp x;
+ x.code = op;
+ x.a = a;
+ x.b = b;
+ code.ops.push_back(x);
+
+ switch( op )
+ {
+  case TrBytecode::PushInt:
+  case TrBytecode::PushBool:
+  case TrBytecode::PushConst:
+  case TrBytecode::PushVoid:
+  case TrBytecode::Load:
+  case TrBytecode::LoadOuter:
+  case TrBytecode::Tree:
+   depth++;
+   break;
+
+  case TrBytecode::Assign:
+  case TrBytecode::Declare:
+  case TrBytecode::Pop:
+  case TrBytecode::JumpIfFalse:
+  case TrBytecode::JumpIfTrue:
+  case TrBytecode::Eq:
+  case TrBytecode::Neq:
+  case TrBytecode::Gt:
+  case TrBytecode::Ge:
+  case TrBytecode::Lt:
+  case TrBytecode::Plus:
+  case TrBytecode::Minus:
+  case TrBytecode::Mul:
+  case TrBytecode::Div:
+  case TrBytecode::Mod:
+  case TrBytecode::Return:
+   depth--;
+   break;
+
+  case TrBytecode::ForInit:
+   depth -= 4;
+   break;
+
+  case TrBytecode::Call:
+   depth -= CastSizeToInt(code.call_site[a]->arg_expr.size())-1;
+   break;
+ }
+
+ code.max_stack = std::max( code.max_stack, depth );
+ return Here()-1;
+}
+
+
+void TrBytecodeCompiler::Patch( const lem::MCollect<int> &jumps, int target )
+{
+ for( lem::Container::size_type i=0; i<jumps.size(); ++i )
+  code.ops[ jumps[i] ].a = target;
+
+ return;
+}
+
+
+int TrBytecodeCompiler::NewSlot( const lem::UCString &name )
+{
+ const int slot = code.n_slots++;
+ scopes.back().push_back( std::make_pair(name,slot) );
+ return slot;
+}
+
+
+//   TrContextInvokation::GetVar:    
+// ,   -     .
+int TrBytecodeCompiler::Resolve( const lem::UCString &name ) const
+{
+ for( int i=CastSizeToInt(scopes.size())-1; i>=0; --i )
+  {
+   const SCOPE &s = scopes[i];
+   for( lem::Container::size_type j=0; j<s.size(); ++j )
+    if( s[j].first.eqi(name) )
+     return s[j].second;
+  }
+
+ return UNKNOWN;
+}
+
+
+int TrBytecodeCompiler::OuterName( const lem::UCString &name )
+{
+ for( lem::Container::size_type i=0; i<code.outer_name.size(); ++i )
+  if( code.outer_name[i]==name )
+   return CastSizeToInt(i);
+
+ code.outer_name.push_back(name);
+ return CastSizeToInt(code.outer_name.size())-1;
+}
+
+
+int TrBytecodeCompiler::VisibleTable(void)
+{
+ const int begin = code.vis_begin.back();
+
+ for( int i=CastSizeToInt(scopes.size())-1; i>=0; --i )
+  {
+   const SCOPE &s = scopes[i];
+   for( lem::Container::size_type j=0; j<s.size(); ++j )
+    {
+     code.vis_name.push_back( s[j].first );
+     code.vis_slot.push_back( s[j].second );
+    }
+  }
+
+ const int end = CastSizeToInt(code.vis_name.size());
+ const int n_tables = CastSizeToInt(code.vis_begin.size())-1;
+
+ //          .
+ if( n_tables>0 )
+  {
+   const int prev_begin = code.vis_begin[n_tables-1];
+   if( begin-prev_begin==end-begin )
+    {
+     bool same=true;
+     for( int k=0; k<end-begin && same; ++k )
+      same = code.vis_slot[prev_begin+k]==code.vis_slot[begin+k];
+
+     if( same )
+      {
+       code.vis_name.resize(begin);
+       code.vis_slot.resize(begin);
+       return n_tables-1;
+      }
+    }
+  }
+
+ code.vis_begin.push_back(end);
+ return n_tables;
+}
+
+
+void TrBytecodeCompiler::LoadVar( const lem::UCString &name )
+{
+ const int slot = Resolve(name);
+ if( slot!=UNKNOWN )
+  Emit( TrBytecode::Load, slot );
+ else
+  Emit( TrBytecode::LoadOuter, OuterName(name) );
+
+ return;
+}
+
+
+void TrBytecodeCompiler::TreeCall( const TrFunCall *f )
+{
+ code.tree_call.push_back(f);
+ const int itable = VisibleTable();
+ Emit( TrBytecode::Tree, CastSizeToInt(code.tree_call.size())-1, itable );
+ return;
+}
+
+
+void TrBytecodeCompiler::BuiltIn( const TrFun_BuiltIn *f )
+{
+ const lem::UCString &name = f->name;
+ const int n = CastSizeToInt(f->args.size());
+
+ int op=UNKNOWN;
+ if( name.eqi(L"eq") && n==2 )
+  op = TrBytecode::Eq;
+ else if( name.eqi(L"neq") && n>=2 )
+  op = TrBytecode::Neq;
+ else if( name.eqi(L"gt") && n>=2 )
+  op = TrBytecode::Gt;
+ else if( name.eqi(L"ge") && n>=2 )
+  op = TrBytecode::Ge;
+ else if( name.eqi(L"lt") && n>=2 )
+  op = TrBytecode::Lt;
+ else if( name.eqi(L"arith_plus") && n>=2 )
+  op = TrBytecode::Plus;
+ else if( name.eqi(L"arith_minus") && n>=2 )
+  op = TrBytecode::Minus;
+ else if( name.eqi(L"arith_mul") && n>=2 )
+  op = TrBytecode::Mul;
+ else if( name.eqi(L"arith_div") && n>=2 )
+  op = TrBytecode::Div;
+ else if( name.eqi(L"arith_mod") && n>=2 )
+  op = TrBytecode::Mod;
+
+ if( op!=UNKNOWN )
+  {
+   //       .
+   Expression( f->args[0] );
+   Expression( f->args[1] );
+   Emit( op );
+  }
+ else if( name.eqi(L"log_not") && n>=1 )
+  {
+   Expression( f->args[0] );
+   Emit( TrBytecode::Not );
+  }
+ else if( name.eqi(L"log_and") || name.eqi(L"log_or") )
+  {
+   //    ,   TrFun_BuiltIn::Run.
+   const bool is_and = name.eqi(L"log_and");
+   const int jump = is_and ? TrBytecode::JumpIfFalse : TrBytecode::JumpIfTrue;
+
+   lem::MCollect<int> shortcut;
+   for( int i=0; i<n; ++i )
+    {
+     Expression( f->args[i] );
+     shortcut.push_back( Emit( jump ) );
+    }
+
+   Emit( TrBytecode::PushBool, is_and ? 1 : 0 );
+   const int j_end = Emit( TrBytecode::Jump );
+   depth--;
+   Patch( shortcut, Here() );
+   Emit( TrBytecode::PushBool, is_and ? 0 : 1 );
+   code.ops[j_end].a = Here();
+  }
+ else
+  {
+   TreeCall(f);
+  }
+
+ return;
+}
+
+
+void TrBytecodeCompiler::Expression( const TrFunCall *f )
+{
+ if( !ok )
+  return;
+
+ if( const TrFun_Var *v = dynamic_cast<const TrFun_Var*>(f) )
+  {
+   LoadVar( v->var_name );
+  }
+ else if( const TrFun_Constant *c = dynamic_cast<const TrFun_Constant*>(f) )
+  {
+   const TrValue &x = c->GetValue();
+   if( x.GetType().IsInt() && !x.GetType().IsConst() )
+    Emit( TrBytecode::PushInt, x.GetInt() );
+   else if( x.GetType().IsBool() && !x.GetType().IsConst() )
+    Emit( TrBytecode::PushBool, x.GetBool() ? 1 : 0 );
+   else
+    {
+     code.consts.push_back(&x);
+     Emit( TrBytecode::PushConst, CastSizeToInt(code.consts.size())-1 );
+    }
+  }
+ else if( const TrFun_Assign *a = dynamic_cast<const TrFun_Assign*>(f) )
+  {
+   //      ,   TrFun_Assign::Run.
+   LoadVar( a->var_name );
+   Expression( &*a->expr );
+   Emit( TrBytecode::Assign );
+  }
+ else if( const TrFun_If *i = dynamic_cast<const TrFun_If*>(f) )
+  {
+   if( i->cond.IsNull() || i->f_then.IsNull() )
+    {
+     ok = false;
+     return;
+    }
+
+   Expression( &*i->cond );
+   const int j_else = Emit( TrBytecode::JumpIfFalse );
+   Expression( &*i->f_then );
+   const int j_end = Emit( TrBytecode::Jump );
+   depth--;
+   code.ops[j_else].a = Here();
+
+   if( i->f_else.NotNull() )
+    Expression( &*i->f_else );
+   else
+    Emit( TrBytecode::PushVoid );
+
+   code.ops[j_end].a = Here();
+  }
+ else if( const TrFun_User *u = dynamic_cast<const TrFun_User*>(f) )
+  {
+   bool direct = u->fun!=NULL && u->fun->body.NotNull() &&
+                 u->arg_name.size()==u->fun->arg_name.size() &&
+                 u->arg_expr.size()==u->arg_name.size();
+
+   for( lem::Container::size_type k=0; direct && k<u->arg_name.size(); ++k )
+    direct = u->arg_name[k].eqi( u->fun->arg_name[k] );
+
+   if( direct )
+    {
+     for( lem::Container::size_type k=0; k<u->arg_expr.size(); ++k )
+      Expression( u->arg_expr[k] );
+
+     code.call_site.push_back(u);
+     const int itable = VisibleTable();
+     Emit( TrBytecode::Call, CastSizeToInt(code.call_site.size())-1, itable );
+    }
+   else
+    {
+     TreeCall(u);
+    }
+  }
+ else if( const TrFun_BuiltIn *b = dynamic_cast<const TrFun_BuiltIn*>(f) )
+  {
+   BuiltIn(b);
+  }
+ else if( dynamic_cast<const TrFun_CreateWordform*>(f)!=NULL ||
+          dynamic_cast<const TrFun_Lambda*>(f)!=NULL )
+  {
+   TreeCall(f);
+  }
+ else
+  {
+   //  (, , return...)    
+   //   -    .
+   ok = false;
+  }
+
+ return;
+}
+
+
+void TrBytecodeCompiler::Statement( const TrFunCall *f, bool can_declare )
+{
+ if( !ok )
+  return;
+
+ LEM_CHECKIT_Z( depth==0 );
+
+ if( const TrFun_Group *g = dynamic_cast<const TrFun_Group*>(f) )
+  {
+   scopes.push_back( SCOPE() );
+
+   for( lem::Container::size_type i=0; i<g->items.size() && ok; ++i )
+    Statement( g->items[i], true );
+
+   scopes.pop_back();
+  }
+ else if( const TrFun_Declare *d = dynamic_cast<const TrFun_Declare*>(f) )
+  {
+   //   TrFunContext::AddVar  ,    .
+   if( !can_declare )
+    {
+     ok = false;
+     return;
+    }
+
+   for( lem::Container::size_type i=0; i<d->var_name.size(); ++i )
+    {
+     //    ,    .
+     if( d->var_value[i]!=NULL )
+      {
+       Expression( d->var_value[i] );
+       Emit( TrBytecode::Declare, NewSlot(d->var_name[i]) );
+      }
+     else
+      {
+       code.types.push_back( &d->var_type );
+       Emit( TrBytecode::DeclareType, NewSlot(d->var_name[i]), CastSizeToInt(code.types.size())-1 );
+      }
+    }
+  }
+ else if( const TrFun_If *i = dynamic_cast<const TrFun_If*>(f) )
+  {
+   if( i->cond.IsNull() || i->f_then.IsNull() )
+    {
+     ok = false;
+     return;
+    }
+
+   Expression( &*i->cond );
+   const int j_else = Emit( TrBytecode::JumpIfFalse );
+   Statement( &*i->f_then, false );
+
+   if( i->f_else.NotNull() )
+    {
+     const int j_end = Emit( TrBytecode::Jump );
+     code.ops[j_else].a = Here();
+     Statement( &*i->f_else, false );
+     code.ops[j_end].a = Here();
+    }
+   else
+    {
+     code.ops[j_else].a = Here();
+    }
+  }
+ else if( const TrFun_While *w = dynamic_cast<const TrFun_While*>(f) )
+  {
+   if( w->cond.IsNull() || w->body.IsNull() )
+    {
+     ok = false;
+     return;
+    }
+
+   Loop *loop = new Loop;
+   loop->is_while = true;
+   loops.push_back(loop);
+
+   const int l_cond = Here();
+   Expression( &*w->cond );
+   loop->exits.push_back( Emit( TrBytecode::JumpIfFalse ) );
+   Statement( &*w->body, false );
+   Emit( TrBytecode::Jump, l_cond );
+
+   Patch( loop->exits, Here() );
+   loops.Remove( CastSizeToInt(loops.size())-1 );
+  }
+ else if( const TrFun_For *r = dynamic_cast<const TrFun_For*>(f) )
+  {
+   if( r->i0.IsNull() || r->i1.IsNull() || r->step.IsNull() || r->body.IsNull() )
+    {
+     ok = false;
+     return;
+    }
+
+   const int iloop = code.n_loops++;
+
+   LoadVar( r->varname );
+   Expression( &*r->i0 );
+   Expression( &*r->i1 );
+   Expression( &*r->step );
+   Emit( TrBytecode::ForInit, iloop );
+
+   Loop *loop = new Loop;
+   loop->is_while = false;
+   loops.push_back(loop);
+
+   const int l_test = Here();
+   loop->exits.push_back( Emit( TrBytecode::ForTest, iloop ) );
+   Statement( &*r->body, false );
+   Emit( TrBytecode::ForNext, iloop, l_test );
+
+   //  ForTest     b.
+   const int l_end = Here();
+   for( lem::Container::size_type k=0; k<loop->exits.size(); ++k )
+    {
+     TrBytecodeOp &x = code.ops[ loop->exits[k] ];
+     if( x.code==TrBytecode::ForTest )
+      x.b = l_end;
+     else
+      x.a = l_end;
+    }
+
+   loops.Remove( CastSizeToInt(loops.size())-1 );
+  }
+ else if( const TrFun_Return *ret = dynamic_cast<const TrFun_Return*>(f) )
+  {
+   Expression( &*ret->expr );
+
+   // while   break,  return ( e_return   ),
+   // for  return   .
+   Loop *target = NULL;
+   for( int k=CastSizeToInt(loops.size())-1; k>=0; --k )
+    if( loops[k]->is_while )
+     {
+      target = loops[k];
+      break;
+     }
+
+   if( target!=NULL )
+    target->exits.push_back( Emit( TrBytecode::Return, UNKNOWN, 0 ) );
+   else
+    fun_exits.push_back( Emit( TrBytecode::Return, UNKNOWN, 1 ) );
+  }
+ else if( dynamic_cast<const TrFun_Break*>(f)!=NULL )
+  {
+   if( !loops.empty() )
+    loops.back()->exits.push_back( Emit( TrBytecode::Jump ) );
+   else
+    fun_exits.push_back( Emit( TrBytecode::Jump ) );
+  }
+ else
+  {
+   Expression(f);
+   Emit( TrBytecode::Pop );
+  }
+
+ return;
+}
+
+
+bool TrBytecodeCompiler::CompileFunction( const TrFunction &fun )
+{
+ if( fun.body.IsNull() )
+  return false;
+
+ code.arg_name = fun.arg_name;
+
+ scopes.push_back( SCOPE() );
+ for( lem::Container::size_type i=0; i<fun.arg_name.size(); ++i )
+  NewSlot( fun.arg_name[i] );
+
+ code.ret_slot = NewSlot( L"((return))" );
+
+ Statement( &*fun.body, true );
+
+ Patch( fun_exits, Here() );
+ Emit( TrBytecode::End );
+
+ return ok && depth==0;
+}
+
+
+
+TrBytecode::TrBytecode(void)
+ : n_slots(0), ret_slot(UNKNOWN), n_loops(0), max_stack(0)
+{
+ vis_begin.push_back(0);
+}
+
+
+TrBytecode* TrBytecode::Compile( const TrFunction &fun )
+{
+ TrBytecode *code = new TrBytecode;
+
+ TrBytecodeCompiler compiler(*code);
+ if( !compiler.CompileFunction(fun) )
+  {
+   delete code;
+   return NULL;
+  }
+
+ return code;
+}
+
+
+bool TrBytecode::Accepts( const TrFun_User &site ) const
+{
+ if( site.arg_name.size()!=arg_name.size() || site.arg_expr.size()!=arg_name.size() )
+  return false;
+
+ for( lem::Container::size_type i=0; i<arg_name.size(); ++i )
+  if( !site.arg_name[i].eqi(arg_name[i]) )
+   return false;
+
+ return true;
+}
+
+
+lem::Ptr<TrValue> TrBytecode::Invoke(
+                                     const ElapsedTimeConstraint & constraints,
+                                     PM_Automat &pm,
+                                     TrFunContext &ctx,
+                                     const TrFun_User &site
+                                    ) const
+{
+ TrBytecodeFrame frame(n_slots);
+
+ for( lem::Container::size_type i=0; i<site.arg_expr.size(); ++i )
+  frame.slots[i] = new TrValue( site.arg_expr[i]->Run(constraints,pm,ctx,NULL) );
+
+ return Run( constraints, pm, ctx, frame.slots, site );
+}
+
+
+lem::Ptr<TrValue> TrBytecode::Run(
+                                  const ElapsedTimeConstraint & constraints,
+                                  PM_Automat &pm,
+                                  TrFunContext &outer,
+                                  TrValue **slots,
+                                  const TrFun_User &site
+                                 ) const
+{
+ slots[ret_slot] = new TrTypeValue( site.ret_type );
+
+ bool returned=false;
+ Execute( constraints, pm, outer, slots, returned );
+ CheckReturn( site, returned );
+
+ return lem::Ptr<TrValue>( new TrValue( *slots[ret_slot] ) );
+}
+
+
+void TrBytecode::Execute(
+                         const ElapsedTimeConstraint & constraints,
+                         PM_Automat &pm,
+                         TrFunContext &outer,
+                         TrValue **slots,
+                         bool &returned
+                        ) const
+{
+ TrCell local_stack[LOCAL_STACK];
+ std::vector<TrCell> heap_stack;
+ TrCell *stack = local_stack;
+ if( max_stack>LOCAL_STACK )
+  {
+   heap_stack.resize(max_stack);
+   stack = &heap_stack[0];
+  }
+
+ TrForState local_loops[LOCAL_LOOPS];
+ std::vector<TrForState> heap_loops;
+ TrForState *loop = local_loops;
+ if( n_loops>LOCAL_LOOPS )
+  {
+   heap_loops.resize(n_loops);
+   loop = &heap_loops[0];
+  }
+
+ int sp=0, pc=0;
+
+ for(;;)
+  {
+   const TrBytecodeOp &op = ops[pc++];
+
+   switch( op.code )
+   {
+    case End:
+     return;
+
+    case PushInt:
+     SetInt( stack[sp++], op.a );
+     break;
+
+    case PushBool:
+     SetBool( stack[sp++], op.a!=0 );
+     break;
+
+    case PushConst:
+     SetOwn( stack[sp++], lem::Ptr<TrValue>( new TrValue( *consts[op.a] ) ) );
+     break;
+
+    case PushVoid:
+     SetOwn( stack[sp++], lem::Ptr<TrValue>( new TrValue ) );
+     break;
+
+    case Load:
+     SetRef( stack[sp++], slots[op.a] );
+     break;
+
+    case LoadOuter:
+     SetOwn( stack[sp++], outer.GetVar( outer_name[op.a] ) );
+     break;
+
+    case Assign:
+     {
+      //        .
+      AssignCell( *stack[sp-2].ref, stack[sp-1] );
+      Drop( stack[--sp] );
+      break;
+     }
+
+    case Declare:
+     {
+      TrValue *v = NewValue( stack[sp-1] );
+      delete slots[op.a];
+      slots[op.a] = v;
+      Drop( stack[--sp] );
+      break;
+     }
+
+    case DeclareType:
+     {
+      TrValue *v = new TrTypeValue( *types[op.b] );
+      delete slots[op.a];
+      slots[op.a] = v;
+      break;
+     }
+
+    case Pop:
+     Drop( stack[--sp] );
+     break;
+
+    case Jump:
+     pc = op.a;
+     break;
+
+    case JumpIfFalse:
+    case JumpIfTrue:
+     {
+      const bool f = CellToBool( stack[sp-1] );
+      Drop( stack[--sp] );
+      if( f==(op.code==JumpIfTrue) )
+       pc = op.a;
+      break;
+     }
+
+    case Eq:
+    case Neq:
+     {
+      const bool r = CellEq( stack[sp-2], stack[sp-1] );
+      Drop( stack[--sp] );
+      Drop( stack[sp-1] );
+      SetBool( stack[sp-1], op.code==Eq ? r : !r );
+      break;
+     }
+
+    case Gt:
+    case Ge:
+    case Lt:
+     {
+      const int x = CellToInt( stack[sp-2] );
+      const int y = CellToInt( stack[sp-1] );
+      Drop( stack[--sp] );
+      Drop( stack[sp-1] );
+      SetBool( stack[sp-1], op.code==Gt ? x>y : op.code==Ge ? x>=y : x<y );
+      break;
+     }
+
+    case Not:
+     {
+      const bool f = CellToBool( stack[sp-1] );
+      Drop( stack[sp-1] );
+      SetBool( stack[sp-1], !f );
+      break;
+     }
+
+    case Plus:
+    case Minus:
+    case Mul:
+    case Div:
+    case Mod:
+     {
+      const int x = CellToInt( stack[sp-2] );
+      const int y = CellToInt( stack[sp-1] );
+      Drop( stack[--sp] );
+      Drop( stack[sp-1] );
+
+      int r=0;
+      switch( op.code )
+      {
+       case Plus:  r = x+y; break;
+       case Minus: r = x-y; break;
+       case Mul:   r = x*y; break;
+       case Div:   r = x/y; break;
+       case Mod:   r = x%y; break;
+      }
+
+      SetInt( stack[sp-1], r );
+      break;
+     }
+
+    case ForInit:
+     {
+      TrForState &s = loop[op.a];
+      s.k = CellToInt( stack[sp-3] );
+      s.to = CellToInt( stack[sp-2] );
+      s.step = CellToInt( stack[sp-1] );
+      s.var = Box( stack[sp-4] );
+      for( int k=0; k<4; ++k )
+       Drop( stack[--sp] );
+      break;
+     }
+
+    case ForTest:
+     {
+      TrForState &s = loop[op.a];
+      if( s.step>0 ? s.k<=s.to : s.k>=s.to )
+       {
+        TrIntValue a(s.k);
+        s.var->Assign(a);
+       }
+      else
+       {
+        pc = op.b;
+       }
+
+      break;
+     }
+
+    case ForNext:
+     {
+      loop[op.a].k += loop[op.a].step;
+      pc = op.b;
+      break;
+     }
+
+    case Return:
+     {
+      AssignCell( *slots[ret_slot], stack[sp-1] );
+      Drop( stack[--sp] );
+      if( op.b )
+       returned = true;
+      pc = op.a;
+      break;
+     }
+
+    case Call:
+     {
+      const TrFun_User &site = *call_site[op.a];
+      const int n = CastSizeToInt(site.arg_expr.size());
+      TrBytecodeContext bridge( &outer, *this, op.b, slots );
+
+      lem::Ptr<TrValue> res;
+      const TrBytecode *callee = site.fun->bytecode.get();
+      if( callee!=NULL )
+       {
+        TrBytecodeFrame frame(callee->n_slots);
+        for( int i=0; i<n; ++i )
+         frame.slots[i] = NewValue( stack[sp-n+i] );
+
+        for( int i=0; i<n; ++i )
+         Drop( stack[--sp] );
+
+        res = callee->Run( constraints, pm, bridge, frame.slots, site );
+       }
+      else
+       {
+        //      -  .
+        TrContextInvokation ctx2( &bridge );
+        for( int i=0; i<n; ++i )
+         {
+          ctx2.arg_name.push_back( site.arg_name[i] );
+          ctx2.arg_value.push_back( NewValue( stack[sp-n+i] ) );
+         }
+
+        for( int i=0; i<n; ++i )
+         Drop( stack[--sp] );
+
+        ctx2.arg_name.push_back( L"((return))" );
+        ctx2.arg_value.push_back( new TrTypeValue( site.ret_type ) );
+        site.body->Run( constraints, pm, ctx2, NULL );
+        CheckReturn( site, ctx2.e_return );
+
+        res = new TrValue( ctx2.GetVar(L"((return))") );
+       }
+
+      SetOwn( stack[sp++], res );
+      break;
+     }
+
+    case Tree:
+     {
+      TrBytecodeContext bridge( &outer, *this, op.b, slots );
+      SetOwn( stack[sp++], tree_call[op.a]->Run( constraints, pm, bridge, NULL ) );
+      break;
+     }
+
+    default:
+     LEM_STOPIT;
+   }
+  }
+}
+
+#endif
@@ -2,6 +2,7 @@
 #include <lem/solarix/translation.h>
 #include <lem/solarix/tr_funs.h>
 #include <lem/solarix/tr_trace_actors.h>
+#include <lem/solarix/TrBytecode.h>
 
 using namespace lem;
 using namespace Solarix;
@@ -75,6 +76,13 @@ lem::Ptr<TrValue> TrFun_User::Run(
  LEM_CHECKIT_Z( fun!=NULL );
  LEM_CHECKIT_Z( body!=NULL );
 
+ #if !defined SOL_NO_AA
+ //      ; 
+ //    ,    .
+ if( trace_log==NULL && fun->bytecode.NotNull() && fun->bytecode->Accepts(*this) )
+  return fun->bytecode->Invoke( constraints, pm, ctx, *this );
+ #endif
+
  #if defined SOL_DEBUGGING
  const int mark = TrTraceActor::seq++;
  if( trace_log!=NULL )
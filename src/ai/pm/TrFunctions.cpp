@@ -7,6 +7,7 @@
 #include <lem/solarix/dictionary.h>
 #include <lem/solarix/PM_FunctionLoader.h>
 #include <lem/solarix/tr_funs.h>
+#include <lem/solarix/TrBytecode.h>
 
 using namespace lem;
 using namespace Solarix;
@@ -788,6 +789,10 @@ void TrFunctions::LoadBin( lem::Stream& bin )
  for( lem::Container::size_type i=0; i<static_functions.size(); ++i )
   static_functions[i]->Link( *this );
 
+ #if defined SOL_CAA && !defined SOL_NO_AA
+ CompileBytecode();
+ #endif
+
  return;
 }
 #endif
@@ -826,6 +831,43 @@ int TrFunctions::CountUserFuns(void) const
 }
 
 
+#if defined SOL_CAA && !defined SOL_NO_AA
+void TrFunctions::CompileBytecode(void)
+{
+ //     ,     
+ //      (TrBytecode::Call  bytecode).
+ for( lem::Container::size_type i=0; i<funs.size(); ++i )
+  {
+   TrFunction *fun = funs[i];
+   if( fun->bytecode.IsNull() && fun->body.NotNull() )
+    fun->bytecode = TrBytecode::Compile(*fun);
+  }
+
+ return;
+}
+
+
+void TrFunctions::DropBytecode(void)
+{
+ for( lem::Container::size_type i=0; i<funs.size(); ++i )
+  funs[i]->bytecode.reset();
+
+ return;
+}
+
+
+int TrFunctions::CountBytecodeFuns(void) const
+{
+ int n=0;
+ for( lem::Container::size_type i=0; i<funs.size(); ++i )
+  if( funs[i]->bytecode.NotNull() )
+   n++;
+
+ return n;
+}
+#endif
+
+
 #if defined SOL_LOADTXT && defined SOL_COMPILER
 bool TrFunctions::IsCondictorPointFunction( const lem::UCString &fun ) const
 {
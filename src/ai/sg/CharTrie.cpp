@@ -0,0 +1,183 @@
+// CD->16.10.2026
+// LC->16.10.2026
+
+#include <algorithm>
+#include <deque>
+#include <lem/conversions.h>
+#include <lem/solarix/prefix_tree.h>
+#include <lem/solarix/CharTrie.h>
+
+using namespace lem;
+using namespace Solarix;
+
+
+static void CollectChars( const CharNode &n, std::vector<wchar_t> &chars )
+{
+ for( std::map< wchar_t, CharNode* >::const_iterator it=n.leafs.begin(); it!=n.leafs.end(); ++it )
+  {
+   chars.push_back( it->first );
+   CollectChars( *it->second, chars );
+  }
+
+ return;
+}
+
+
+void CharTrie::AddCode( wchar_t c, int code )
+{
+ const lem::uint32_t u = (lem::uint32_t)c;
+ const lem::uint32_t ipage = u>>PAGE_BITS;
+
+ if( ipage>=pages.size() )
+  pages.resize( ipage+1, -1 );
+
+ if( pages[ipage]==-1 )
+  {
+   pages[ipage] = CastSizeToInt(codes.size());
+   codes.resize( codes.size()+PAGE_SIZE, 0 );
+  }
+
+ codes[ pages[ipage]+(u & (PAGE_SIZE-1)) ] = code;
+ return;
+}
+
+
+CharTrie::CharTrie( const CharNode &root )
+{
+ //   ,   .
+ std::vector<wchar_t> chars;
+ CollectChars( root, chars );
+ std::sort( chars.begin(), chars.end() );
+ chars.erase( std::unique( chars.begin(), chars.end() ), chars.end() );
+
+ for( std::size_t i=0; i<chars.size(); ++i )
+  AddCode( chars[i], CastSizeToInt(i)+1 );
+
+ //    0;    check=-1.
+ base.push_back(0);
+ check.push_back(-2);
+ node.push_back(&root);
+
+ int first_free=1;
+ std::vector<int> child_code;
+ std::deque< std::pair<const CharNode*,int> > queue;
+ queue.push_back( std::make_pair(&root,0) );
+
+ while( !queue.empty() )
+  {
+   const CharNode &n = *queue.front().first;
+   const int state = queue.front().second;
+   queue.pop_front();
+
+   if( n.leafs.empty() )
+    continue;
+
+   //   std::map    ,     .
+   child_code.clear();
+   for( std::map< wchar_t, CharNode* >::const_iterator it=n.leafs.begin(); it!=n.leafs.end(); ++it )
+    child_code.push_back( Code(it->first) );
+
+   //   :   base+ .
+   int b = std::max( 1, first_free-child_code.front() );
+   for(;;)
+    {
+     bool fits=true;
+     for( std::size_t k=0; k<child_code.size() && fits; ++k )
+      {
+       const std::size_t t = std::size_t(b+child_code[k]);
+       fits = t>=check.size() || check[t]==-1;
+      }
+
+     if( fits )
+      break;
+
+     b++;
+    }
+
+   const std::size_t need = std::size_t(b+child_code.back()+1);
+   if( need>check.size() )
+    {
+     base.resize( need, 0 );
+     check.resize( need, -1 );
+     node.resize( need, NULL );
+    }
+
+   base[state] = b;
+
+   std::size_t k=0;
+   for( std::map< wchar_t, CharNode* >::const_iterator it=n.leafs.begin(); it!=n.leafs.end(); ++it, ++k )
+    {
+     const int t = b+child_code[k];
+     check[t] = state;
+     node[t] = it->second;
+     queue.push_back( std::make_pair( (const CharNode*)it->second, t ) );
+    }
+
+   while( first_free<CastSizeToInt(check.size()) && check[first_free]!=-1 )
+    first_free++;
+  }
+
+ return;
+}
+
+
+bool CharTrie::IsFinal( int state ) const
+{
+ return !node[state]->entries.empty();
+}
+
+
+const lem::MCollect<const Solarix::SG_Entry*>& CharTrie::GetEntries( int state ) const
+{
+ return node[state]->entries;
+}
+
+
+bool CharTrie::Match( const lem::UCString &str ) const
+{
+ int state=Root;
+
+ for( int i=0; i<str.length(); ++i )
+  {
+   state = Probe( state, lem::to_uupper(str[i]) );
+   if( state==-1 )
+    return false;
+  }
+
+ return true;
+}
+
+
+// ****************************************************************************
+//    ,       str.
+// ****************************************************************************
+int CharTrie::MatchLen( const wchar_t *str ) const
+{
+ int state=Root;
+ int lexem_len=0;
+
+ for( int icur=0; str[icur]!=0; )
+  {
+   state = Probe( state, lem::to_uupper(str[icur]) );
+   if( state==-1 )
+    break;
+
+   icur++;
+
+   if( IsFinal(state) )
+    lexem_len = icur;
+  }
+
+ return lexem_len;
+}
+
+
+int CharTrie::CountStates(void) const
+{
+ int n=0;
+ for( std::size_t i=0; i<check.size(); ++i )
+  if( check[i]!=-1 )
+   n++;
+
+ return n;
+}
@@ -0,0 +1,483 @@
+// CD->16.10.2026
+// LC->16.10.2026
+
+#include <algorithm>
+#include <cstring>
+#include <lem/streams.h>
+#include <lem/oformatter.h>
+#include <lem/conversions.h>
+#include <lem/solarix/Charpos2EntryEnumerator.h>
+#include <lem/solarix/Charpos2EntryStorage_Postings.h>
+
+using namespace Solarix;
+
+
+namespace
+{
+ const lem::uint32_t POSTINGS_MAGIC = 0x31504550U; // "PEP1"
+
+ struct PostingsHeader
+ {
+  lem::uint32_t magic;
+  lem::uint32_t n_lists;
+ };
+
+ inline bool FirstLess( int x, const Charpos2EntryStorage_Postings::SkipEntry &e )
+ { return x<e.first; }
+
+ inline bool CharposLess( const Charpos2EntryStorage_Postings::ListInfo &l, lem::uint32_t charpos )
+ { return l.charpos<charpos; }
+
+ void WriteVarint( std::vector<lem::uint8_t> &buf, lem::uint32_t x )
+ {
+  while( x>=0x80 )
+   {
+    buf.push_back( lem::uint8_t(x|0x80) );
+    x >>= 7;
+   }
+
+  buf.push_back( lem::uint8_t(x) );
+  return;
+ }
+
+
+ class Charpos2EntryEnumerator_Postings : public Charpos2EntryEnumerator
+ {
+  private:
+   std::vector<lem::uint32_t> charpos;
+   int icur;
+
+  public:
+   Charpos2EntryEnumerator_Postings( const std::vector<lem::uint32_t> &_charpos )
+    : charpos(_charpos), icur(-1) {}
+
+   virtual bool Fetch(void) { return ++icur<CastSizeToInt(charpos.size()); }
+   virtual lem::uint32_t GetChar(void) { return 0x00ffffff & charpos[icur]; }
+   virtual int GetPos(void) { return (0xff000000&charpos[icur]) >> 24; }
+ };
+}
+
+
+Charpos2EntryStorage_Postings::Charpos2EntryStorage_Postings( const lem::Path &_filename )
+ : filename(_filename), data(NULL), data_size(0), lists(NULL), n_lists(0), in_tx(false)
+{
+ Open();
+ return;
+}
+
+
+Charpos2EntryStorage_Postings::~Charpos2EntryStorage_Postings(void)
+{
+ return;
+}
+
+
+void Charpos2EntryStorage_Postings::Open(void)
+{
+ mapped.Close();
+ image.clear();
+ data = NULL;
+ data_size = 0;
+ lists = NULL;
+ n_lists = 0;
+
+ if( !filename.DoesExist() )
+  return;
+
+ if( mapped.Open(filename) )
+  {
+   data = mapped.Data();
+   data_size = mapped.Size();
+  }
+ else
+  {
+   lem::BinaryReader rdr(filename);
+   image.resize( rdr.fsize() );
+   if( !image.empty() )
+    rdr.read( &image[0], CastSizeToInt(image.size()) );
+
+   data = image.empty() ? NULL : &image[0];
+   data_size = image.size();
+  }
+
+ if( data_size==0 )
+  return;
+
+ PostingsHeader hdr;
+ if( data_size<sizeof(hdr) )
+  hdr.magic=0;
+ else
+  std::memcpy( &hdr, data, sizeof(hdr) );
+
+ if( hdr.magic!=POSTINGS_MAGIC || data_size<sizeof(hdr)+hdr.n_lists*sizeof(ListInfo) )
+  {
+   lem::MemFormatter msg;
+   msg.printf( "Invalid format of prefix entry postings file %us", filename.GetUnicode().c_str() );
+   throw lem::E_BaseException( msg.string() );
+  }
+
+ n_lists = CastSizeToInt(hdr.n_lists);
+ lists = reinterpret_cast<const ListInfo*>( data+sizeof(hdr) );
+
+ //      ,     
+ //       .
+ for( int i=0; i<n_lists; ++i )
+  {
+   const ListInfo &l = lists[i];
+
+   bool ok = l.n_blocks==(l.n_ies+BLOCK_SIZE-1)/BLOCK_SIZE &&
+             (l.offset%4)==0 &&
+             l.offset>=sizeof(hdr)+hdr.n_lists*sizeof(ListInfo) &&
+             l.offset+lem::uint64_t(l.n_blocks)*sizeof(SkipEntry)<=data_size;
+
+   if( ok )
+    {
+     const SkipEntry *skip = reinterpret_cast<const SkipEntry*>( data+l.offset );
+     const lem::uint64_t packed_pos = l.offset+lem::uint64_t(l.n_blocks)*sizeof(SkipEntry);
+     for( lem::uint32_t b=0; ok && b<l.n_blocks; ++b )
+      ok = packed_pos+skip[b].offset<=data_size;
+    }
+
+   if( !ok )
+    {
+     lists = NULL;
+     n_lists = 0;
+
+     lem::MemFormatter msg;
+     msg.printf( "Postings list #%d at offset %qd is out of the prefix entry postings file %us", i, lem::int64_t(l.offset), filename.GetUnicode().c_str() );
+     throw lem::E_BaseException( msg.string() );
+    }
+  }
+
+ return;
+}
+
+
+// ****************************************************************************
+//  : ,   charpos  , 
+//        ,   4.
+// ****************************************************************************
+void Charpos2EntryStorage_Postings::Write(void)
+{
+ std::vector<lem::uint8_t> body;
+ std::vector<ListInfo> dir;
+ dir.reserve( pending.size() );
+
+ const lem::uint32_t body_pos = lem::uint32_t( sizeof(PostingsHeader)+pending.size()*sizeof(ListInfo) );
+
+ std::vector<SkipEntry> skip;
+ std::vector<lem::uint8_t> packed;
+
+ for( std::map< lem::uint32_t, std::vector<int> >::const_iterator it=pending.begin(); it!=pending.end(); ++it )
+  {
+   const std::vector<int> &ies = it->second;
+   if( ies.empty() )
+    continue;
+
+   skip.clear();
+   packed.clear();
+
+   for( std::size_t i=0; i<ies.size(); ++i )
+    {
+     if( (i%BLOCK_SIZE)==0 )
+      {
+       SkipEntry e;
+       e.first = ies[i];
+       e.offset = lem::uint32_t(packed.size());
+       skip.push_back(e);
+      }
+     else
+      {
+       WriteVarint( packed, lem::uint32_t(ies[i]-ies[i-1]) );
+      }
+    }
+
+   ListInfo l;
+   l.charpos = it->first;
+   l.n_ies = lem::uint32_t(ies.size());
+   l.n_blocks = lem::uint32_t(skip.size());
+   l.offset = body_pos + lem::uint32_t(body.size());
+   dir.push_back(l);
+
+   const lem::uint8_t *s = reinterpret_cast<const lem::uint8_t*>(&skip[0]);
+   body.insert( body.end(), s, s+skip.size()*sizeof(SkipEntry) );
+   body.insert( body.end(), packed.begin(), packed.end() );
+
+   while( (body.size()%4)!=0 )
+    body.push_back(0);
+  }
+
+ //         .
+ if( dir.size()!=pending.size() )
+  {
+   const lem::uint32_t shift = lem::uint32_t( (pending.size()-dir.size())*sizeof(ListInfo) );
+   for( std::size_t i=0; i<dir.size(); ++i )
+    dir[i].offset -= shift;
+  }
+
+ PostingsHeader hdr;
+ hdr.magic = POSTINGS_MAGIC;
+ hdr.n_lists = lem::uint32_t(dir.size());
+
+ //   ,     .
+ mapped.Close();
+ image.clear();
+ data = NULL;
+ lists = NULL;
+ n_lists = 0;
+
+ {
+  lem::BinaryWriter wrt(filename);
+  wrt.write( &hdr, sizeof(hdr) );
+  if( !dir.empty() )
+   wrt.write( &dir[0], CastSizeToInt(dir.size()*sizeof(ListInfo)) );
+  if( !body.empty() )
+   wrt.write( &body[0], CastSizeToInt(body.size()) );
+ }
+
+ Open();
+ return;
+}
+
+
+const Charpos2EntryStorage_Postings::ListInfo* Charpos2EntryStorage_Postings::Find( lem::uint32_t charpos ) const
+{
+ const ListInfo *end = lists+n_lists;
+ const ListInfo *it = std::lower_bound( lists, end, charpos, CharposLess );
+ return it!=end && it->charpos==charpos ? it : NULL;
+}
+
+
+void Charpos2EntryStorage_Postings::ThrowTruncated( const ListInfo &list ) const
+{
+ lem::MemFormatter msg;
+ msg.printf( "Postings list at offset %qd is truncated in the prefix entry postings file %us", lem::int64_t(list.offset), filename.GetUnicode().c_str() );
+ throw lem::E_BaseException( msg.string() );
+}
+
+
+//    ies (  BLOCK_SIZE ),   .
+//     Open,       
+//    .
+int Charpos2EntryStorage_Postings::DecodeBlock( const ListInfo &list, int iblock, int *ies ) const
+{
+ const SkipEntry *skip = reinterpret_cast<const SkipEntry*>( data+list.offset );
+ const lem::uint8_t *p = reinterpret_cast<const lem::uint8_t*>( skip+list.n_blocks ) + skip[iblock].offset;
+ const lem::uint8_t *end = data+data_size;
+
+ const int n = iblock+1<int(list.n_blocks) ? int(BLOCK_SIZE) : int(list.n_ies)-iblock*BLOCK_SIZE;
+
+ int x = skip[iblock].first;
+ ies[0] = x;
+
+ for( int k=1; k<n; ++k )
+  {
+   if( p>=end )
+    ThrowTruncated( list );
+
+   lem::uint32_t d = *p++;
+   if( d>=0x80 )
+    {
+     d &= 0x7f;
+     int shift=7;
+     lem::uint8_t b;
+     do
+      {
+       if( p>=end )
+        ThrowTruncated( list );
+
+       b = *p++;
+       d |= lem::uint32_t(b&0x7f)<<shift;
+       shift += 7;
+      }
+     while( b>=0x80 );
+    }
+
+   x += int(d);
+   ies[k] = x;
+  }
+
+ return n;
+}
+
+
+void Charpos2EntryStorage_Postings::Decode( const ListInfo &list, std::vector<int> &ies ) const
+{
+ ies.resize( list.n_ies );
+ for( int b=0; b<int(list.n_blocks); ++b )
+  DecodeBlock( list, b, &ies[b*BLOCK_SIZE] );
+
+ return;
+}
+
+
+void Charpos2EntryStorage_Postings::BeginTx(void)
+{
+ if( in_tx )
+  return;
+
+ in_tx = true;
+ pending.clear();
+
+ for( int i=0; i<n_lists; ++i )
+  Decode( lists[i], pending[ lists[i].charpos ] );
+
+ return;
+}
+
+
+void Charpos2EntryStorage_Postings::CommitTx(void)
+{
+ if( !in_tx )
+  return;
+
+ Write();
+ pending.clear();
+ in_tx = false;
+ return;
+}
+
+
+void Charpos2EntryStorage_Postings::ClearCharpos( lem::uint32_t c, int pos )
+{
+ const bool own_tx = !in_tx;
+ if( own_tx )
+  BeginTx();
+
+ pending.erase( c | (pos<<24) );
+
+ if( own_tx )
+  CommitTx();
+
+ return;
+}
+
+
+void Charpos2EntryStorage_Postings::Store( lem::uint32_t c, int pos, const std::set<int> &ies )
+{
+ const bool own_tx = !in_tx;
+ if( own_tx )
+  BeginTx();
+
+ std::vector<int> &dst = pending[ c | (pos<<24) ];
+ dst.assign( ies.begin(), ies.end() );
+
+ if( own_tx )
+  CommitTx();
+
+ return;
+}
+
+
+void Charpos2EntryStorage_Postings::Get( lem::uint32_t c, int pos, std::set<int> &ies )
+{
+ ies.clear();
+
+ const ListInfo *list = Find( c | (pos<<24) );
+ if( list!=NULL )
+  {
+   std::vector<int> v;
+   Decode( *list, v );
+   ies.insert( v.begin(), v.end() );
+  }
+
+ return;
+}
+
+
+void Charpos2EntryStorage_Postings::GetIntersected( lem::uint32_t c, int pos, const std::set<int> &ies0, std::set<int> &ies )
+{
+ lem::MCollect<int> v0, v;
+ v0.reserve( ies0.size() );
+ for( std::set<int>::const_iterator it=ies0.begin(); it!=ies0.end(); ++it )
+  v0.push_back(*it);
+
+ IntersectSorted( c, pos, v0, v );
+
+ for( lem::Container::size_type i=0; i<v.size(); ++i )
+  ies.insert( v[i] );
+
+ return;
+}
+
+
+void Charpos2EntryStorage_Postings::GetSorted( lem::uint32_t c, int pos, lem::MCollect<int> &ies )
+{
+ ies.clear();
+
+ const ListInfo *list = Find( c | (pos<<24) );
+ if( list!=NULL )
+  {
+   ies.resize( list->n_ies );
+   for( int b=0; b<int(list->n_blocks); ++b )
+    DecodeBlock( *list, b, &ies[b*BLOCK_SIZE] );
+  }
+
+ return;
+}
+
+
+// ****************************************************************************
+//   ies0  : ,   
+//  ,      ,
+//        .
+// ****************************************************************************
+void Charpos2EntryStorage_Postings::IntersectSorted(
+                                                    lem::uint32_t c,
+                                                    int pos,
+                                                    const lem::MCollect<int> &ies0,
+                                                    lem::MCollect<int> &ies
+                                                   )
+{
+ ies.clear();
+
+ const ListInfo *list = Find( c | (pos<<24) );
+ if( list==NULL || ies0.empty() )
+  return;
+
+ const SkipEntry *skip = reinterpret_cast<const SkipEntry*>( data+list->offset );
+ const int n_blocks = int(list->n_blocks);
+ const int n0 = CastSizeToInt(ies0.size());
+
+ int buf[BLOCK_SIZE];
+ int i=0, b=0;
+
+ while( i<n0 && b<n_blocks )
+  {
+   if( b+1<n_blocks && skip[b+1].first<=ies0[i] )
+    b = int( std::upper_bound( skip+b+1, skip+n_blocks, ies0[i], FirstLess )-skip )-1;
+
+   const int n = DecodeBlock( *list, b, buf );
+
+   int k=0;
+   while( i<n0 && k<n )
+    {
+     const int x = ies0[i], y = buf[k];
+     if( x==y )
+      {
+       ies.push_back(x);
+       i++;
+       k++;
+      }
+     else if( x<y )
+      i++;
+     else
+      k++;
+    }
+
+   b++;
+  }
+
+ return;
+}
+
+
+Charpos2EntryEnumerator* Charpos2EntryStorage_Postings::Enumerate(void)
+{
+ std::vector<lem::uint32_t> charpos;
+ charpos.reserve(n_lists);
+ for( int i=0; i<n_lists; ++i )
+  charpos.push_back( lists[i].charpos );
+
+ return new Charpos2EntryEnumerator_Postings(charpos);
+}
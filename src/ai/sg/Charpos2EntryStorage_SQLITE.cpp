@@ -1,3 +1,5 @@
+#include <algorithm>
+#include <iterator>
 #include <lem/sqlite_helpers.h>
 #include <lem/oformatter.h>
 #include <lem/conversions.h>
@@ -298,6 +300,76 @@ void Charpos2EntryStorage_SQLITE::GetIntersected(
 }
 
 
+//    ies   ,   
+//     std::set.
+void Charpos2EntryStorage_SQLITE::SelectSorted( lem::uint32_t charpos, lem::MCollect<int> &ies )
+{
+ ies.clear();
+
+ lem::FString sql( lem::format_str( "SELECT ies FROM charpos2entry WHERE charpos=%u", charpos ).c_str() );
+
+ sqlite3_stmt *stmt=NULL;
+ const char *dummy;
+ int res = sqlite3_prepare( hdb, sql.c_str(), sql.length(), &stmt, &dummy );
+ if( res==SQLITE_OK )
+  {
+   res = sqlite3_step( stmt );
+   if( res == SQLITE_ROW )
+    {
+     const char* str = (const char*)sqlite3_column_text(stmt,0);
+
+     int key0=-1;
+     int icur=0;
+
+     while( str[icur]!=0 )
+      {
+       if( str[icur]==' ' )
+        icur++;
+
+       if( str[icur]<'0' || str[icur]>'9' )
+        break;
+
+       int x=0;
+       while( str[icur]>='0' && str[icur]<='9' )
+        x = x*10 + Digit2Int(str[icur++]);
+
+       const int keyi = key0==-1 ? x : key0+x;
+       key0 = keyi;
+
+       ies.push_back(keyi);
+      }
+    }
+
+   sqlite3_finalize(stmt);
+  }
+
+ return;
+}
+
+
+void Charpos2EntryStorage_SQLITE::GetSorted( lem::uint32_t c, int pos, lem::MCollect<int> &ies )
+{
+ SelectSorted( c | (pos<<24), ies );
+ return;
+}
+
+
+void Charpos2EntryStorage_SQLITE::IntersectSorted(
+                                                  lem::uint32_t c,
+                                                  int pos,
+                                                  const lem::MCollect<int> &ies0,
+                                                  lem::MCollect<int> &ies
+                                                 )
+{
+ lem::MCollect<int> all;
+ SelectSorted( c | (pos<<24), all );
+
+ ies.clear();
+ std::set_intersection( ies0.begin(), ies0.end(), all.begin(), all.end(), std::back_inserter(ies) );
+ return;
+}
+
+
 Charpos2EntryEnumerator* Charpos2EntryStorage_SQLITE::Enumerate(void)
 {
  lem::FString Select("SELECT charpos FROM charpos2entry");
@@ -5,7 +5,16 @@ using namespace lem;
 using namespace Solarix;
 
 LS_ResultSet_SQLITE::LS_ResultSet_SQLITE( sqlite3_stmt *h )
- : LS_ResultSet(NULL)
+ : LS_ResultSet(NULL), cache(NULL), sql(NULL)
+{
+ LEM_CHECKIT_Z(h!=NULL);
+ stmt = h;
+ return;
+}
+
+
+LS_ResultSet_SQLITE::LS_ResultSet_SQLITE( sqlite3_stmt *h, StatementCache<sqlite3_stmt*> *_cache, const char *_sql )
+ : LS_ResultSet(NULL), cache(_cache), sql(_sql)
 {
  LEM_CHECKIT_Z(h!=NULL);
  stmt = h;
@@ -16,7 +25,18 @@ LS_ResultSet_SQLITE::LS_ResultSet_SQLITE( sqlite3_stmt *h )
 LS_ResultSet_SQLITE::~LS_ResultSet_SQLITE(void)
 {
  LEM_CHECKIT_Z(stmt!=NULL);
- sqlite3_finalize(stmt);
+
+ if( cache!=NULL )
+  {
+   sqlite3_reset(stmt);
+   sqlite3_clear_bindings(stmt);
+   cache->Put( sql, stmt );
+  }
+ else
+  {
+   sqlite3_finalize(stmt);
+  }
+
  stmt=NULL;
  return; 
 }
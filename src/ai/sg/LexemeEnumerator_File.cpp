@@ -19,7 +19,7 @@ bool LexemeEnumerator_File::Fetch(void)
 
 const Lexem* LexemeEnumerator_File::Get( Solarix::Lexem &lex )
 { 
- lex = entries->ml_ref[icur];
+ lex = entries->ml_ref.GetString(icur);
  return &entries->ml_ref[icur];
 }
 
@@ -0,0 +1,155 @@
+// -----------------------------------------------------------------------------
+// File LEXEMEFUZZYINDEX.CPP
+//
+// (c) by Koziev Elijah     all rights reserved
+//
+// SOLARIX Intellectronix Project http://www.solarix.ru
+//                                http://sourceforge.net/projects/solarix
+//
+// Content:
+// BK-       WordEntries_File.
+// -----------------------------------------------------------------------------
+//
+// CD->16.10.2026
+// LC->16.10.2026
+// --------------
+
+#include <algorithm>
+#include <lem/solarix/LexemDictionary.h>
+#include <lem/solarix/LexemeFuzzyIndex.h>
+
+using namespace Solarix;
+
+
+//  ,     lem::Fuzzy::levinshtein_distance,
+//       -    LEM_CSTRING_LEN.
+int LexemeFuzzyIndex::Distance( const lem::UCString &a, const lem::UCString &b )
+{
+ const int n1 = a.length();
+ const int n2 = b.length();
+
+ int buf1[LEM_CSTRING_LEN+1], buf2[LEM_CSTRING_LEN+1];
+ int *p = buf1, *q = buf2;
+
+ for( int j=0; j<=n2; ++j )
+  p[j] = j;
+
+ for( int i=1; i<=n1; ++i )
+  {
+   q[0] = i;
+   const wchar_t ca = a[i-1];
+
+   for( int j=1; j<=n2; ++j )
+    {
+     const int d_del = p[j]+1;
+     const int d_ins = q[j-1]+1;
+     const int d_sub = p[j-1] + ( ca==b[j-1] ? 0 : 1 );
+     q[j] = std::min( std::min( d_del, d_ins ), d_sub );
+    }
+
+   std::swap(p,q);
+  }
+
+ return p[n2];
+}
+
+
+void LexemeFuzzyIndex::Clear(void)
+{
+ nodes.clear();
+ n_lexem=0;
+ return;
+}
+
+
+void LexemeFuzzyIndex::Build( const LexemDictionary &lexems )
+{
+ Clear();
+
+ n_lexem = CastSizeToInt(lexems.size());
+ nodes.reserve( lexems.size() );
+
+ for( int i=0; i<n_lexem; ++i )
+  {
+   //     ,  Lexem  .
+   const lem::UCString lex = lexems.GetString(i);
+   if( lex.empty() )
+    continue;
+
+   Node new_node;
+   new_node.ilexem = i;
+   new_node.first_child = new_node.next_sibling = -1;
+   new_node.dist = 0;
+
+   if( nodes.empty() )
+    {
+     nodes.push_back(new_node);
+     continue;
+    }
+
+   int inode=0;
+   while(true)
+    {
+     const int d = Distance( lex, lexems.GetString( nodes[inode].ilexem ) );
+
+     int ichild = nodes[inode].first_child;
+     while( ichild!=-1 && nodes[ichild].dist!=d )
+      ichild = nodes[ichild].next_sibling;
+
+     if( ichild==-1 )
+      {
+       //       -    .
+       new_node.dist = d;
+       new_node.next_sibling = nodes[inode].first_child;
+       nodes[inode].first_child = CastSizeToInt(nodes.size());
+       nodes.push_back(new_node);
+       break;
+      }
+
+     inode = ichild;
+    }
+  }
+
+ return;
+}
+
+
+void LexemeFuzzyIndex::Find(
+                            const LexemDictionary &lexems,
+                            const lem::UCString &word,
+                            int max_dist,
+                            lem::MCollect<int> &found
+                           ) const
+{
+ if( nodes.empty() )
+  return;
+
+ const lem::Container::size_type n0 = found.size();
+
+ lem::MCollect<int> stack;
+ stack.push_back(0);
+
+ while( !stack.empty() )
+  {
+   const int inode = stack.back();
+   stack.pop_back();
+
+   const Node &node = nodes[inode];
+   const int d = Distance( word, lexems.GetString(node.ilexem) );
+   if( d<=max_dist )
+    found.push_back( node.ilexem );
+
+   //          
+   //     [d-max_dist,d+max_dist].
+   for( int ichild=node.first_child; ichild!=-1; ichild=nodes[ichild].next_sibling )
+    {
+     const int dc = nodes[ichild].dist;
+     if( dc>=d-max_dist && dc<=d+max_dist )
+      stack.push_back(ichild);
+    }
+  }
+
+ std::sort( found.begin()+n0, found.end() );
+
+ return;
+}
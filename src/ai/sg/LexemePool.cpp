@@ -0,0 +1,487 @@
+// CD->16.10.2026
+// LC->16.10.2026
+
+#include <string.h>
+#include <algorithm>
+#include <lem/conversions.h>
+#include <lem/solarix/LexemePool.h>
+
+using namespace Solarix;
+
+
+namespace
+{
+ const lem::uint32_t MAX_SLOTS = 1U<<24; // d1   24 
+ const lem::uint32_t MAX_D0 = 256;
+ const lem::uint32_t MAX_D1_TRIES = 1U<<16; //     
+ const lem::uint32_t IMAGE_MAGIC = 0x4c4f4f50; // "POOL"
+
+ //  ,     offset, disp, slot2id  text.
+ struct ImageHeader
+ {
+  lem::uint32_t magic;
+  lem::uint32_t n_offset, n_text, n_disp, n_slot2id;
+  lem::uint32_t n_slots;
+  lem::uint32_t tail_from; //        -
+  lem::uint32_t reserved;
+ };
+
+ inline lem::uint32_t Mix( lem::uint32_t h )
+ {
+  h ^= h>>16;
+  h *= 0x85ebca6bU;
+  h ^= h>>13;
+  h *= 0xc2b2ae35U;
+  h ^= h>>16;
+  return h;
+ }
+
+ inline int EncodeUtf8( lem::uint32_t c, lem::uint8_t *buf )
+ {
+  if( c<0x80 )
+   {
+    buf[0] = lem::uint8_t(c);
+    return 1;
+   }
+
+  if( c<0x800 )
+   {
+    buf[0] = lem::uint8_t( 0xc0 | (c>>6) );
+    buf[1] = lem::uint8_t( 0x80 | (c&0x3f) );
+    return 2;
+   }
+
+  if( c<0x10000 )
+   {
+    buf[0] = lem::uint8_t( 0xe0 | (c>>12) );
+    buf[1] = lem::uint8_t( 0x80 | ((c>>6)&0x3f) );
+    buf[2] = lem::uint8_t( 0x80 | (c&0x3f) );
+    return 3;
+   }
+
+  buf[0] = lem::uint8_t( 0xf0 | ((c>>18)&0x07) );
+  buf[1] = lem::uint8_t( 0x80 | ((c>>12)&0x3f) );
+  buf[2] = lem::uint8_t( 0x80 | ((c>>6)&0x3f) );
+  buf[3] = lem::uint8_t( 0x80 | (c&0x3f) );
+  return 4;
+ }
+}
+
+
+LexemePool::LexemePool(void)
+ : n_slots(0), image(NULL)
+{
+ Sync();
+ return;
+}
+
+
+void LexemePool::Sync(void)
+{
+ text_ptr = text.empty() ? NULL : &text[0];
+ offset_ptr = offset.empty() ? NULL : &offset[0];
+ disp_ptr = disp.empty() ? NULL : &disp[0];
+ slot2id_ptr = slot2id.empty() ? NULL : &slot2id[0];
+ n_offset = lem::uint32_t( offset.size() );
+ n_disp = lem::uint32_t( disp.size() );
+ n_slot2id = lem::uint32_t( slot2id.size() );
+ image = NULL;
+ return;
+}
+
+
+//      .
+void LexemePool::Detach(void)
+{
+ if( image==NULL )
+  return;
+
+ text.assign( text_ptr, text_ptr + (n_offset==0 ? 0 : offset_ptr[n_offset-1]) );
+ offset.assign( offset_ptr, offset_ptr+n_offset );
+ disp.assign( disp_ptr, disp_ptr+n_disp );
+ slot2id.assign( slot2id_ptr, slot2id_ptr+n_slot2id );
+ Sync();
+ return;
+}
+
+
+void LexemePool::Clear(void)
+{
+ text.clear();
+ offset.clear();
+ disp.clear();
+ slot2id.clear();
+ tail.clear();
+ n_slots=0;
+ Sync();
+ return;
+}
+
+
+void LexemePool::Reserve( int n_lexem, int n_bytes )
+{
+ Detach();
+ offset.reserve( n_lexem+1 );
+ text.reserve( n_bytes );
+ Sync();
+ return;
+}
+
+
+void LexemePool::Shrink(void)
+{
+ if( image!=NULL )
+  return;
+
+ std::vector<lem::uint8_t>( text ).swap( text );
+ std::vector<lem::uint32_t>( offset ).swap( offset );
+ Sync();
+ return;
+}
+
+
+int LexemePool::Add( const lem::UCString &lexem )
+{
+ const int id = Append(lexem);
+ tail.insert( std::make_pair( Hash( lexem.c_str(), lexem.length() ).h1, lem::int32_t(id) ) );
+ return id;
+}
+
+
+int LexemePool::Append( const lem::UCString &lexem )
+{
+ Detach();
+
+ if( offset.empty() )
+  offset.push_back(0);
+
+ lem::uint8_t buf[4];
+ for( int i=0; i<lexem.length(); ++i )
+  {
+   const int n = EncodeUtf8( (lem::uint32_t)lexem[i], buf );
+   text.insert( text.end(), buf, buf+n );
+  }
+
+ offset.push_back( lem::uint32_t(text.size()) );
+ Sync();
+ return CastSizeToInt(offset.size())-2;
+}
+
+
+void LexemePool::IndexTail( int id_from )
+{
+ for( int id=id_from; id<size(); ++id )
+  {
+   const lem::UCString s = Get(id);
+   tail.insert( std::make_pair( Hash( s.c_str(), s.length() ).h1, lem::int32_t(id) ) );
+  }
+
+ return;
+}
+
+
+LexemePool::KeyHash LexemePool::Hash( const wchar_t *s, int len ) const
+{
+ lem::uint32_t h1=2166136261U, h2=0x9e3779b9U;
+ for( int i=0; i<len; ++i )
+  {
+   const lem::uint32_t c = (lem::uint32_t)s[i];
+   h1 = (h1 ^ c) * 16777619U;
+   h2 = (h2 + c) * 0x01000193U + (h2>>7);
+  }
+
+ h1 = Mix(h1);
+ h2 = Mix(h2 ^ lem::uint32_t(len));
+
+ KeyHash k;
+ k.h1 = h1;
+ k.h2 = h2;
+ k.bucket = k.f1 = k.f2 = 0;
+ if( n_disp!=0 )
+  {
+   k.bucket = h1 % n_disp;
+   k.f1 = h2 % n_slots;
+   k.f2 = n_slots>1 ? 1 + Mix(h1^h2) % (n_slots-1) : 0;
+  }
+
+ return k;
+}
+
+
+bool LexemePool::Equal( int id, const wchar_t *s, int len ) const
+{
+ const lem::uint8_t *p = text_ptr + offset_ptr[id];
+ const lem::uint8_t *end = text_ptr + offset_ptr[id+1];
+
+ lem::uint8_t buf[4];
+ for( int i=0; i<len; ++i )
+  {
+   const int n = EncodeUtf8( (lem::uint32_t)s[i], buf );
+   if( end-p<n )
+    return false;
+
+   for( int k=0; k<n; ++k )
+    if( p[k]!=buf[k] )
+     return false;
+
+   p += n;
+  }
+
+ return p==end;
+}
+
+
+bool LexemePool::Build(void)
+{
+ Detach();
+ disp.clear();
+ slot2id.clear();
+ tail.clear();
+ Sync();
+
+ const lem::uint32_t n = lem::uint32_t( size() );
+ if( n==0 )
+  return false;
+
+ //   0.8,     3 .
+ n_slots = n + n/4 + 1;
+ if( n_slots>=MAX_SLOTS )
+  {
+   IndexTail(0);
+   return false;
+  }
+
+ const lem::uint32_t n_buckets = n/3 + 1;
+ disp.resize( n_buckets, 0 );
+ Sync();
+
+ std::vector<KeyHash> keys( n );
+ for( lem::uint32_t id=0; id<n; ++id )
+  {
+   const lem::UCString s = Get( CastSizeToInt(id) );
+   keys[id] = Hash( s.c_str(), s.length() );
+  }
+
+ //    ,     
+ // :    ,   .
+ std::vector<lem::uint32_t> bucket_begin( n_buckets+1, 0 );
+ for( lem::uint32_t id=0; id<n; ++id )
+  bucket_begin[ keys[id].bucket+1 ]++;
+
+ for( lem::uint32_t b=0; b<n_buckets; ++b )
+  bucket_begin[b+1] += bucket_begin[b];
+
+ std::vector<lem::uint32_t> bucket_keys( n );
+ std::vector<lem::uint32_t> fill( bucket_begin.begin(), bucket_begin.end()-1 );
+ for( lem::uint32_t id=0; id<n; ++id )
+  bucket_keys[ fill[ keys[id].bucket ]++ ] = id;
+
+ std::vector< std::pair<lem::uint32_t,lem::uint32_t> > order;
+ order.reserve( n_buckets );
+ for( lem::uint32_t b=0; b<n_buckets; ++b )
+  if( bucket_begin[b+1]>bucket_begin[b] )
+   order.push_back( std::make_pair( bucket_begin[b+1]-bucket_begin[b], b ) );
+
+ std::sort( order.begin(), order.end() );
+ std::reverse( order.begin(), order.end() );
+
+ std::vector<lem::int32_t> table( n_slots, -1 );
+ std::vector<lem::uint32_t> slots;
+
+ for( std::size_t i=0; i<order.size(); ++i )
+  {
+   const lem::uint32_t b = order[i].second;
+   const lem::uint32_t kb = bucket_begin[b], ke = bucket_begin[b+1];
+   const lem::uint32_t d1_tries = ke-kb==1 ? n_slots : std::min( n_slots, MAX_D1_TRIES );
+
+   bool placed=false;
+   for( lem::uint32_t d0=0; d0<MAX_D0 && !placed; ++d0 )
+    for( lem::uint32_t d1=0; d1<d1_tries && !placed; ++d1 )
+     {
+      slots.clear();
+      bool ok=true;
+      for( lem::uint32_t k=kb; k<ke && ok; ++k )
+       {
+        const KeyHash &h = keys[ bucket_keys[k] ];
+        const lem::uint32_t slot = lem::uint32_t( (lem::uint64_t(h.f1) + lem::uint64_t(d0)*h.f2 + d1) % n_slots );
+        ok = table[slot]==-1 && std::find( slots.begin(), slots.end(), slot )==slots.end();
+        slots.push_back(slot);
+       }
+
+      if( ok )
+       {
+        for( lem::uint32_t k=kb; k<ke; ++k )
+         table[ slots[k-kb] ] = lem::int32_t( bucket_keys[k] );
+
+        disp[b] = (d0<<24) | d1;
+        placed = true;
+       }
+     }
+
+   if( !placed )
+    {
+     //      -   
+     disp.clear();
+     Sync();
+     IndexTail(0);
+     return false;
+    }
+  }
+
+ slot2id.swap(table);
+ Sync();
+ return true;
+}
+
+
+int LexemePool::Find( const lem::UCString &lexem ) const
+{
+ const KeyHash h = Hash( lexem.c_str(), lexem.length() );
+
+ if( n_slot2id!=0 )
+  {
+   const lem::uint32_t d = disp_ptr[h.bucket];
+   const lem::uint32_t d0 = d>>24, d1 = d & 0x00ffffffU;
+   const lem::uint32_t slot = lem::uint32_t( (lem::uint64_t(h.f1) + lem::uint64_t(d0)*h.f2 + d1) % n_slots );
+
+   const int id = slot2id_ptr[slot];
+   if( id!=-1 && Equal( id, lexem.c_str(), lexem.length() ) )
+    return id;
+  }
+
+ if( !tail.empty() )
+  {
+   typedef std::multimap<lem::uint32_t,lem::int32_t>::const_iterator IT;
+   std::pair<IT,IT> range = tail.equal_range( h.h1 );
+   for( IT it=range.first; it!=range.second; ++it )
+    if( Equal( it->second, lexem.c_str(), lexem.length() ) )
+     return it->second;
+  }
+
+ return -1;
+}
+
+
+lem::UCString LexemePool::Get( int id ) const
+{
+ lem::UCString res;
+
+ const lem::uint8_t *p = text_ptr + offset_ptr[id];
+ const lem::uint8_t *end = text_ptr + offset_ptr[id+1];
+ while( p<end && res.length()<lem::UCString::max_len )
+  {
+   lem::uint32_t c = *p++;
+   int more=0;
+   if( c>=0xf0 )
+    {
+     c &= 0x07;
+     more=3;
+    }
+   else if( c>=0xe0 )
+    {
+     c &= 0x0f;
+     more=2;
+    }
+   else if( c>=0xc0 )
+    {
+     c &= 0x1f;
+     more=1;
+    }
+
+   for( ; more>0 && p<end; --more )
+    c = (c<<6) | (*p++ & 0x3f);
+
+   res += wchar_t(c);
+  }
+
+ return res;
+}
+
+
+lem::uint64_t LexemePool::GetMemoryUsage(void) const
+{
+ //  : ,    
+ const lem::uint64_t tail_node = sizeof(std::pair<const lem::uint32_t,lem::int32_t>) + 4*sizeof(void*);
+
+ return lem::uint64_t( text.capacity() ) +
+        offset.capacity()*sizeof(lem::uint32_t) +
+        disp.capacity()*sizeof(lem::uint32_t) +
+        slot2id.capacity()*sizeof(lem::int32_t) +
+        tail.size()*tail_node;
+}
+
+
+void LexemePool::SaveImage( lem::Stream &bin ) const
+{
+ ImageHeader h;
+ memset( &h, 0, sizeof(h) );
+ h.magic = IMAGE_MAGIC;
+ h.n_offset = n_offset;
+ h.n_text = n_offset==0 ? 0 : offset_ptr[n_offset-1];
+ h.n_disp = n_disp;
+ h.n_slot2id = n_slot2id;
+ h.n_slots = n_slots;
+
+ //   -   :  ,  
+ //   ,    Build.
+ h.tail_from = lem::uint32_t( size() );
+ for( std::multimap<lem::uint32_t,lem::int32_t>::const_iterator it=tail.begin(); it!=tail.end(); ++it )
+  h.tail_from = std::min( h.tail_from, lem::uint32_t(it->second) );
+
+ bin.write( &h, sizeof(h) );
+ if( h.n_offset ) bin.write( offset_ptr, h.n_offset*sizeof(lem::uint32_t) );
+ if( h.n_disp ) bin.write( disp_ptr, h.n_disp*sizeof(lem::uint32_t) );
+ if( h.n_slot2id ) bin.write( slot2id_ptr, h.n_slot2id*sizeof(lem::int32_t) );
+ if( h.n_text ) bin.write( text_ptr, h.n_text );
+ return;
+}
+
+
+bool LexemePool::AttachImage( const void *data, lem::uint64_t size )
+{
+ if( size<sizeof(ImageHeader) )
+  return false;
+
+ const ImageHeader &h = *(const ImageHeader*)data;
+ const lem::uint64_t need = sizeof(ImageHeader) +
+                            (lem::uint64_t(h.n_offset)+h.n_disp+h.n_slot2id)*4 +
+                            h.n_text;
+
+ if(
+    h.magic!=IMAGE_MAGIC ||
+    need>size ||
+    (h.n_slot2id!=0 && (h.n_disp==0 || h.n_slots!=h.n_slot2id)) ||
+    h.tail_from>(h.n_offset==0 ? 0 : h.n_offset-1)
+   )
+  return false;
+
+ const lem::uint32_t *a = (const lem::uint32_t*)( (const lem::uint8_t*)data + sizeof(ImageHeader) );
+ if( h.n_offset!=0 && a[h.n_offset-1]!=h.n_text )
+  return false;
+
+ Clear();
+
+ offset_ptr = h.n_offset ? a : NULL;
+ disp_ptr = h.n_disp ? a+h.n_offset : NULL;
+ slot2id_ptr = h.n_slot2id ? (const lem::int32_t*)( a+h.n_offset+h.n_disp ) : NULL;
+ text_ptr = (const lem::uint8_t*)( a+h.n_offset+h.n_disp+h.n_slot2id );
+ n_offset = h.n_offset;
+ n_disp = h.n_disp;
+ n_slot2id = h.n_slot2id;
+ n_slots = h.n_slots;
+ image = data;
+
+ IndexTail( int(h.tail_from) );
+ return true;
+}
+
+
+lem::uint64_t LexemePool::GetImageSize(void) const
+{
+ if( image==NULL )
+  return 0;
+
+ return sizeof(ImageHeader) +
+        (lem::uint64_t(n_offset)+n_disp+n_slot2id)*4 +
+        (n_offset==0 ? 0 : offset_ptr[n_offset-1]);
+}
@@ -138,12 +138,13 @@ static lem::CString null_if_minus8( int x )
 
 
 LexiconStorage_SQLITE::LexiconStorage_SQLITE()
+ : stmt_cache(FinalizeStatement)
 {
 }
 
 
 LexiconStorage_SQLITE::LexiconStorage_SQLITE( const lem::UFString &connection_string )
-:sqlite_connection_string(connection_string)
+:sqlite_connection_string(connection_string), stmt_cache(FinalizeStatement)
 {
  Connect();
  return;
@@ -168,6 +169,8 @@ void LexiconStorage_SQLITE::Disconnect(void)
 {
  if( hdb!=NULL )
   {
+   //        .
+   stmt_cache.Clear();
    sqlite3_close(hdb);
    hdb=NULL;
   }
@@ -319,6 +322,97 @@ LS_ResultSet* LexiconStorage_SQLITE::ListByQuery( const lem::FString & sql )
   }
 }
 
+void LexiconStorage_SQLITE::FinalizeStatement( sqlite3_stmt *stmt )
+{
+ sqlite3_finalize(stmt);
+ return;
+}
+
+
+sqlite3_stmt* LexiconStorage_SQLITE::PrepareCached( const char *sql )
+{
+ sqlite3_stmt *stmt = stmt_cache.Take(sql);
+ if( stmt==NULL )
+  {
+   const char *dummy=NULL;
+   int res = sqlite3_prepare_v2( hdb, sql, -1, &stmt, &dummy );
+   if( res!=SQLITE_OK )
+    RaiseError(sql);
+  }
+
+ return stmt;
+}
+
+
+LS_ResultSet* LexiconStorage_SQLITE::ListPrepared( const char *sql, sqlite3_stmt *stmt )
+{
+ return new LS_ResultSet_SQLITE( stmt, &stmt_cache, sql );
+}
+
+
+void LexiconStorage_SQLITE::BindText( sqlite3_stmt *stmt, int iparam, const lem::UFString &value )
+{
+ const lem::FString utf8( lem::to_utf8(value) );
+ sqlite3_bind_text( stmt, iparam, utf8.c_str(), utf8.length(), SQLITE_TRANSIENT );
+ return;
+}
+
+
+LS_ResultSet* LexiconStorage_SQLITE::ListByQuery( const char *sql, int p1 )
+{
+ sqlite3_stmt *stmt = PrepareCached(sql);
+ sqlite3_bind_int( stmt, 1, p1 );
+ return ListPrepared(sql,stmt);
+}
+
+
+LS_ResultSet* LexiconStorage_SQLITE::ListByQuery( const char *sql, int p1, int p2 )
+{
+ sqlite3_stmt *stmt = PrepareCached(sql);
+ sqlite3_bind_int( stmt, 1, p1 );
+ sqlite3_bind_int( stmt, 2, p2 );
+ return ListPrepared(sql,stmt);
+}
+
+
+LS_ResultSet* LexiconStorage_SQLITE::ListByQuery( const char *sql, const lem::UFString &p1 )
+{
+ sqlite3_stmt *stmt = PrepareCached(sql);
+ BindText( stmt, 1, p1 );
+ return ListPrepared(sql,stmt);
+}
+
+
+LS_ResultSet* LexiconStorage_SQLITE::ListByQuery( const char *sql, const lem::UFString &p1, int p2 )
+{
+ sqlite3_stmt *stmt = PrepareCached(sql);
+ BindText( stmt, 1, p1 );
+ sqlite3_bind_int( stmt, 2, p2 );
+ return ListPrepared(sql,stmt);
+}
+
+
+int LexiconStorage_SQLITE::SelectInt( const char *sql, int p1 )
+{
+ lem::Ptr<LS_ResultSet> rs( ListByQuery(sql,p1) );
+ return rs->Fetch() ? rs->GetInt(0) : UNKNOWN;
+}
+
+
+int LexiconStorage_SQLITE::SelectInt( const char *sql, int p1, int p2 )
+{
+ lem::Ptr<LS_ResultSet> rs( ListByQuery(sql,p1,p2) );
+ return rs->Fetch() ? rs->GetInt(0) : UNKNOWN;
+}
+
+
+int LexiconStorage_SQLITE::SelectInt( const char *sql, const lem::UFString &p1 )
+{
+ lem::Ptr<LS_ResultSet> rs( ListByQuery(sql,p1) );
+ return rs->Fetch() ? rs->GetInt(0) : UNKNOWN;
+}
+
+
 int LexiconStorage_SQLITE::SelectInt( const lem::UFString &Select )
 {
  return SelectInt( lem::to_utf8(Select) );
@@ -2732,63 +2826,45 @@ LS_ResultSet* LexiconStorage_SQLITE::ListRecognitionRules( int id_language, bool
 
 LS_ResultSet* LexiconStorage_SQLITE::ListRecognitionRulesForWord( int id_language, const lem::UCString & word )
 {
- lem::UFString str_word(word.c_str());
- sqlite_escape( str_word );
-
- lem::MemFormatter mem;
+ const lem::UFString str_word(word.c_str());
 
  if( id_language==ANY_STATE )
-  mem.printf( "SELECT id FROM recog_rule WHERE word='%us'", str_word.c_str() );
+  return ListByQuery( "SELECT id FROM recog_rule WHERE word=?", str_word );
  else
-  mem.printf( "SELECT id FROM recog_rule WHERE word='%us' AND id_language=%d", str_word.c_str(), id_language );
-
- return ListByQuery( mem.string() );
+  return ListByQuery( "SELECT id FROM recog_rule WHERE word=? AND id_language=?", str_word, id_language );
 }
 
 
 
 LA_RecognitionRule* LexiconStorage_SQLITE::GetRecognitionRule( int id )
 {
- lem::FString Select(lem::format_str( "SELECT name, id_language, is_regex, is_prefix, is_affix, "
-  "r_condition, id_entry, rel, coords, is_syllab, id_src, case_sensitive FROM recog_rule WHERE id=%d", id ) );
+ lem::Ptr<LS_ResultSet> rs( ListByQuery( "SELECT name, id_language, is_regex, is_prefix, is_affix, "
+  "r_condition, id_entry, rel, coords, is_syllab, id_src, case_sensitive FROM recog_rule WHERE id=?", id ) );
 
- sqlite3_stmt *stmt=NULL;
- const char *dummy=NULL;
- int res = sqlite3_prepare_v2( hdb, Select.c_str(), Select.length(), &stmt, &dummy );
- if( res==SQLITE_OK )
+ if( rs->Fetch() )
   {
-   if( sqlite3_step( stmt ) == SQLITE_ROW )
-    {
-     lem::UCString name = lem::sqlite_column_ucstring(stmt,0);
-     const int id_language = sqlite3_column_int(stmt,1);
-     const bool is_regex = sqlite3_column_int(stmt,2)==1;
-     const bool is_prefix = sqlite3_column_int(stmt,3)==1;
-     const bool is_affix = sqlite3_column_int(stmt,4)==1;
-     lem::UFString condition = lem::sqlite_column_ufstring(stmt,5);
-     const int ekey = sqlite3_column_int(stmt,6);
-     const lem::Real1 rel = lem::Real1(sqlite3_column_int(stmt,7));
-     lem::UFString str_coords = lem::sqlite_column_ufstring(stmt,8);
-     const bool is_syllab = sqlite3_column_int(stmt,9)==1;
-     const int id_src = sqlite3_column_int(stmt,10);
-     const bool case_sensitive = sqlite3_column_int(stmt,11)==1;
-
-     Solarix::CP_Array coords;
-     coords.Parse(str_coords);
-
-     sqlite3_finalize(stmt);
-
-     return new LA_RecognitionRule( id, name, case_sensitive, id_language, is_syllab, is_regex, is_prefix, is_affix,
-        condition, ekey, rel, coords, id_src );
-    }
-   else
-    {
-     LEM_STOPIT;
-     return NULL;
-    }
+   lem::UCString name = rs->GetUCString(0);
+   const int id_language = rs->GetInt(1);
+   const bool is_regex = rs->GetInt(2)==1;
+   const bool is_prefix = rs->GetInt(3)==1;
+   const bool is_affix = rs->GetInt(4)==1;
+   lem::UFString condition = rs->GetUFString(5);
+   const int ekey = rs->GetInt(6);
+   const lem::Real1 rel = lem::Real1(rs->GetInt(7));
+   lem::UFString str_coords = rs->GetUFString(8);
+   const bool is_syllab = rs->GetInt(9)==1;
+   const int id_src = rs->GetInt(10);
+   const bool case_sensitive = rs->GetInt(11)==1;
+
+   Solarix::CP_Array coords;
+   coords.Parse(str_coords);
+
+   return new LA_RecognitionRule( id, name, case_sensitive, id_language, is_syllab, is_regex, is_prefix, is_affix,
+      condition, ekey, rel, coords, id_src );
   }
  else
   {
-   RaiseError(__FILE__,__LINE__);
+   LEM_STOPIT;
    return NULL;
   }
 }
@@ -2975,9 +3051,7 @@ int LexiconStorage_SQLITE::FindWordEntrySet( const lem::UCString &set_name )
    )
   return UNKNOWN;
 
- lem::MemFormatter mem;
- mem.printf( "SELECT id FROM word_entry_set WHERE name='%us'", to_upper(set_name).c_str() );
- return sqlite_select_int( hdb, lem::to_utf8(mem.string()) );
+ return SelectInt( "SELECT id FROM word_entry_set WHERE name=?", lem::UFString( to_upper(set_name).c_str() ) );
 }
 
 void LexiconStorage_SQLITE::DeleteWordEntrySets(void)
@@ -2989,44 +3063,31 @@ void LexiconStorage_SQLITE::DeleteWordEntrySets(void)
 
 WordEntrySetItem* LexiconStorage_SQLITE::GetWordEntrySet( int id )
 {
- lem::FString Select(lem::format_str( "SELECT ies, name FROM word_entry_set WHERE id=%d", id ) );
-
- sqlite3_stmt *stmt=NULL;
- const char *dummy=NULL;
- int res = sqlite3_prepare_v2( hdb, Select.c_str(), Select.length(), &stmt, &dummy );
- if( res==SQLITE_OK )
+ lem::Ptr<LS_ResultSet> rs( ListByQuery( "SELECT ies, name FROM word_entry_set WHERE id=?", id ) );
+ if( rs->Fetch() )
   {
-   if( sqlite3_step( stmt ) == SQLITE_ROW )
-    {
-     WordEntrySetItem *res = new WordEntrySetItem();
-     res->id = id;
+   WordEntrySetItem *res = new WordEntrySetItem();
+   res->id = id;
 
-     res->name = lem::sqlite_column_ucstring(stmt,1);
-     lem::UFString s = lem::sqlite_column_ufstring(stmt,0);
-
-     lem::MCollect<lem::UCString> toks;
-     lem::parse( s, toks, false );
-     for( lem::Container::size_type i=0; i<toks.size(); ++i )
-      {
-       const int id_entry = lem::to_int(toks[i]);
-       res->ies.insert(id_entry);   
-      }
+   res->name = rs->GetUCString(1);
+   lem::UFString s = rs->GetUFString(0);
 
-     sqlite3_finalize(stmt);
-     return res;
-    }
-   else
+   lem::MCollect<lem::UCString> toks;
+   lem::parse( s, toks, false );
+   for( lem::Container::size_type i=0; i<toks.size(); ++i )
     {
-     lem::MemFormatter mem;
-     mem.printf( "Co not find word entry set with id=%d", id );
-     throw lem::E_BaseException(mem.string());
-    } 
+     const int id_entry = lem::to_int(toks[i]);
+     res->ies.insert(id_entry);   
+    }
+
+   return res;
   }
  else
   {
-   RaiseError(__FILE__,__LINE__);
-   return NULL;
-  }
+   lem::MemFormatter mem;
+   mem.printf( "Co not find word entry set with id=%d", id );
+   throw lem::E_BaseException(mem.string());
+  } 
 }
 
 
@@ -4313,9 +4374,7 @@ int LexiconStorage_SQLITE::FindWordSet( const lem::UCString &set_name )
    )
   return UNKNOWN;
 
- lem::MemFormatter mem;
- mem.printf( "SELECT id FROM word_set WHERE name='%us'", to_upper(set_name).c_str() );
- return sqlite_select_int( hdb, lem::to_utf8(mem.string()) );
+ return SelectInt( "SELECT id FROM word_set WHERE name=?", lem::UFString( to_upper(set_name).c_str() ) );
 }
 
 
@@ -4327,46 +4386,33 @@ void LexiconStorage_SQLITE::DeleteWordSets(void)
 
 WordSetItem* LexiconStorage_SQLITE::GetWordSet( int id )
 {
- lem::FString Select(lem::format_str( "SELECT words, name, case_sensitive FROM word_set WHERE id=%d", id ) );
-
- sqlite3_stmt *stmt=NULL;
- const char *dummy=NULL;
- int res = sqlite3_prepare_v2( hdb, Select.c_str(), Select.length(), &stmt, &dummy );
- if( res==SQLITE_OK )
+ lem::Ptr<LS_ResultSet> rs( ListByQuery( "SELECT words, name, case_sensitive FROM word_set WHERE id=?", id ) );
+ if( rs->Fetch() )
   {
-   if( sqlite3_step( stmt ) == SQLITE_ROW )
-    {
-     WordSetItem *res = new WordSetItem();
-     res->id = id;
+   WordSetItem *res = new WordSetItem();
+   res->id = id;
 
-     res->name = lem::sqlite_column_ucstring(stmt,1);
-     lem::UFString s = lem::sqlite_column_ufstring(stmt,0);
+   res->name = rs->GetUCString(1);
+   lem::UFString s = rs->GetUFString(0);
 
-     lem::Collect<lem::UFString> toks;
-     const wchar_t delimiters[2] = { WORD_SET_DELIMITER, 0 };
-     lem::parse( s, toks, delimiters );
-     for( lem::Container::size_type i=0; i<toks.size(); ++i )
-      {
-       res->words.insert(toks[i].c_str());
-      }
+   lem::Collect<lem::UFString> toks;
+   const wchar_t delimiters[2] = { WORD_SET_DELIMITER, 0 };
+   lem::parse( s, toks, delimiters );
+   for( lem::Container::size_type i=0; i<toks.size(); ++i )
+    {
+     res->words.insert(toks[i].c_str());
+    }
 
-     res->case_sensitive = sqlite3_column_int(stmt,2)==1;
+   res->case_sensitive = rs->GetInt(2)==1;
 
-     sqlite3_finalize(stmt);
-     return res;
-    }
-   else
-    {
-     lem::MemFormatter mem;
-     mem.printf( "Co not find word set with id=%d", id );
-     throw lem::E_BaseException(mem.string());
-    } 
+   return res;
   }
  else
   {
-   RaiseError(__FILE__,__LINE__);
-   return NULL;
-  }
+   lem::MemFormatter mem;
+   mem.printf( "Co not find word set with id=%d", id );
+   throw lem::E_BaseException(mem.string());
+  } 
 }
 
 
@@ -4408,16 +4454,13 @@ bool LexiconStorage_SQLITE::FindMisspelling( int id_language, const lem::UCStrin
 {
  lem::UFString s( word.c_str() );
  s.to_upper();
- sqlite_escape(s);
 
- lem::MemFormatter mem;
+ LS_ResultSet *rs;
 
  if( id_language==UNKNOWN || id_language==ANY_STATE )
-  mem.printf( "SELECT substitution FROM misspelling WHERE original_word='%us'", s.c_str() );
+  rs = ListByQuery( "SELECT substitution FROM misspelling WHERE original_word=?", s );
  else 
-  mem.printf( "SELECT substitution FROM misspelling WHERE original_word='%us' AND id_language=%d", s.c_str(), id_language );
-
- LS_ResultSet *rs = ListByQuery(mem.string());
+  rs = ListByQuery( "SELECT substitution FROM misspelling WHERE original_word=? AND id_language=?", s, id_language );
 
  while( rs->Fetch() )
   {
@@ -4942,10 +4985,7 @@ KB_Facts* LexiconStorage_SQLITE::LoadFacts( int id_facts )
  KB_Facts * res = new KB_Facts();
  res->id = id_facts;
 
- lem::MemFormatter mem;
- mem.printf( "SELECT id_language, name, n_arg, n_ret, query_mode, ret_type, violation_score FROM kb_facts WHERE id=%d", id_facts );
-
- lem::Ptr<LS_ResultSet> rs( ListByQuery(mem.string()) );
+ lem::Ptr<LS_ResultSet> rs( ListByQuery( "SELECT id_language, name, n_arg, n_ret, query_mode, ret_type, violation_score FROM kb_facts WHERE id=?", id_facts ) );
  if( rs->Fetch() )
   {
    res->id_language = rs->GetInt(0);
@@ -4971,9 +5011,7 @@ KB_Facts* LexiconStorage_SQLITE::LoadFacts( int id_facts )
 
 LS_ResultSet* LexiconStorage_SQLITE::ListFactsInGroup( int id_facts )
 {
- lem::MemFormatter mem;
- mem.printf( "SELECT id FROM kb_fact WHERE id_group=%d ORDER BY id", id_facts );
- return ListByQuery( mem.string() );
+ return ListByQuery( "SELECT id FROM kb_fact WHERE id_group=? ORDER BY id", id_facts );
 }
 
 
@@ -4983,10 +5021,7 @@ KB_Fact* LexiconStorage_SQLITE::LoadFact( int id )
  KB_Fact * res = new KB_Fact();
  res->id_group = id;
 
- lem::MemFormatter mem;
- mem.printf( "SELECT id_group, Coalesce(boolean_return,-1), Coalesce(integer_return,-1), false_score FROM kb_fact WHERE id=%d", id );
-
- lem::Ptr<LS_ResultSet> rs( ListByQuery(mem.string()) );
+ lem::Ptr<LS_ResultSet> rs( ListByQuery( "SELECT id_group, Coalesce(boolean_return,-1), Coalesce(integer_return,-1), false_score FROM kb_fact WHERE id=?", id ) );
  if( rs->Fetch() )
   {
    res->id_group = rs->GetInt(0);
@@ -4999,9 +5034,7 @@ KB_Fact* LexiconStorage_SQLITE::LoadFact( int id )
    LEM_STOPIT;
   }
 
- mem.printf( "SELECT id FROM kb_argument_point WHERE id_fact=%d ORDER BY argument_index", id );
-
- lem::Ptr<LS_ResultSet> rs2( ListByQuery(mem.string()) );
+ lem::Ptr<LS_ResultSet> rs2( ListByQuery( "SELECT id FROM kb_argument_point WHERE id_fact=? ORDER BY argument_index", id ) );
  while( rs2->Fetch() )
  {
   const int id_arg = rs2->GetInt(0);
@@ -5015,21 +5048,17 @@ KB_Fact* LexiconStorage_SQLITE::LoadFact( int id )
 
 KB_Argument* LexiconStorage_SQLITE::LoadFactArgument( int id )
 {
- lem::MemFormatter mem;
- mem.printf( "SELECT is_regex, word_text, id_entry, id_class,"
+ KB_Argument * res = new KB_Argument();
+
+ lem::Ptr<LS_ResultSet> rs( ListByQuery( "SELECT is_regex, word_text, id_entry, id_class,"
              "   wordset_name, wordentryset_name,"
              "   n_coords, id_coord1, id_state1, affirm1, id_coord2,"
              "   id_state2, affirm2, id_coord3, id_state3, affirm3,"
              "   id_coord4, id_state4, affirm4,"
              "   thesauruscheck_link, thesauruscheck_entry,"
              "   is_positive, case_sensitive, id_metaentry"
-             " FROM kb_argument_point WHERE id=%d"
-             , id );
-
-
- KB_Argument * res = new KB_Argument();
-
- lem::Ptr<LS_ResultSet> rs( ListByQuery( mem.string() ) );
+             " FROM kb_argument_point WHERE id=?"
+             , id ) );
  if( rs->Fetch() )
   {
    res->is_regex = rs->GetInt(0)==1;
@@ -5158,27 +5187,44 @@ int LexiconStorage_SQLITE::FindFactByEntries(
                                              KB_CheckingResult &result
                                             )
 {
- lem::MemFormatter mem;
-
- mem.printf( "SELECT F.id, Coalesce(F.boolean_return,-1), Coalesce(F.integer_return,-1), F.false_score"
-             " FROM kb_fact_index2 I, kb_fact F"
-             " WHERE I.id_group=%d AND I.id_entry1=%d", id_facts, id_entry1 );
-
- if( n_arg>1 )
-  mem.printf( " AND I.id_entry2=%d", id_entry2 );
-
- if( n_arg>2 )
-  mem.printf( " AND I.id_entry3=%d", id_entry3 );
-
- if( n_arg>3 )
-  mem.printf( " AND I.id_entry4=%d", id_entry4 );
+ //    -   ,   
+ //   .
+ static const char* sqls[5] = {
+  "SELECT F.id, Coalesce(F.boolean_return,-1), Coalesce(F.integer_return,-1), F.false_score"
+  " FROM kb_fact_index2 I, kb_fact F"
+  " WHERE I.id_group=? AND I.id_entry1=? AND F.id=I.id_fact",
+  "SELECT F.id, Coalesce(F.boolean_return,-1), Coalesce(F.integer_return,-1), F.false_score"
+  " FROM kb_fact_index2 I, kb_fact F"
+  " WHERE I.id_group=? AND I.id_entry1=? AND I.id_entry2=? AND F.id=I.id_fact",
+  "SELECT F.id, Coalesce(F.boolean_return,-1), Coalesce(F.integer_return,-1), F.false_score"
+  " FROM kb_fact_index2 I, kb_fact F"
+  " WHERE I.id_group=? AND I.id_entry1=? AND I.id_entry2=? AND I.id_entry3=? AND F.id=I.id_fact",
+  "SELECT F.id, Coalesce(F.boolean_return,-1), Coalesce(F.integer_return,-1), F.false_score"
+  " FROM kb_fact_index2 I, kb_fact F"
+  " WHERE I.id_group=? AND I.id_entry1=? AND I.id_entry2=? AND I.id_entry3=? AND I.id_entry4=? AND F.id=I.id_fact",
+  "SELECT F.id, Coalesce(F.boolean_return,-1), Coalesce(F.integer_return,-1), F.false_score"
+  " FROM kb_fact_index2 I, kb_fact F"
+  " WHERE I.id_group=? AND I.id_entry1=? AND I.id_entry2=? AND I.id_entry3=? AND I.id_entry4=? AND I.id_entry5=? AND F.id=I.id_fact"
+ };
+
+ LEM_CHECKIT_Z( n_arg>=1 && n_arg<=5 );
+ if( n_arg<1 || n_arg>5 )
+  {
+   // LEM_CHECKIT_Z     ,    
+   //     .
+   result = KB_NotMatchedResult();
+   return UNKNOWN;
+  }
 
- if( n_arg>4 )
-  mem.printf( " AND I.id_entry5=%d", id_entry5 );
+ const char *sql = sqls[n_arg-1];
+ const int id_entries[5] = { id_entry1, id_entry2, id_entry3, id_entry4, id_entry5 };
 
-  mem.printf(" AND F.id=I.id_fact" );
+ sqlite3_stmt *stmt = PrepareCached(sql);
+ sqlite3_bind_int( stmt, 1, id_facts );
+ for( int i=0; i<n_arg; ++i )
+  sqlite3_bind_int( stmt, i+2, id_entries[i] );
 
- lem::Ptr<LS_ResultSet> rs( ListByQuery(mem.string()) );
+ lem::Ptr<LS_ResultSet> rs( ListPrepared(sql,stmt) );
  if( rs->Fetch() )
   {
    const int id_fact = rs->GetInt(0);
@@ -5220,25 +5266,27 @@ void LexiconStorage_SQLITE::FindFactsByEntries(
                                                lem::MCollect<int> & id_fact
                                               )
 {
- lem::MemFormatter mem;
-
- mem.printf( "SELECT id_fact"
-             " FROM kb_fact_index2"
-             " WHERE id_group=%d AND id_entry1=%d", id_facts, id_entry1 );
-
- if( n_arg>1 )
-  mem.printf( " AND id_entry2=%d", id_entry2 );
+ static const char* sqls[5] = {
+  "SELECT id_fact FROM kb_fact_index2 WHERE id_group=? AND id_entry1=?",
+  "SELECT id_fact FROM kb_fact_index2 WHERE id_group=? AND id_entry1=? AND id_entry2=?",
+  "SELECT id_fact FROM kb_fact_index2 WHERE id_group=? AND id_entry1=? AND id_entry2=? AND id_entry3=?",
+  "SELECT id_fact FROM kb_fact_index2 WHERE id_group=? AND id_entry1=? AND id_entry2=? AND id_entry3=? AND id_entry4=?",
+  "SELECT id_fact FROM kb_fact_index2 WHERE id_group=? AND id_entry1=? AND id_entry2=? AND id_entry3=? AND id_entry4=? AND id_entry5=?"
+ };
 
- if( n_arg>2 )
-  mem.printf( " AND id_entry3=%d", id_entry3 );
+ LEM_CHECKIT_Z( n_arg>=1 && n_arg<=5 );
+ if( n_arg<1 || n_arg>5 )
+  return;
 
- if( n_arg>3 )
-  mem.printf( " AND id_entry4=%d", id_entry4 );
+ const char *sql = sqls[n_arg-1];
+ const int id_entries[5] = { id_entry1, id_entry2, id_entry3, id_entry4, id_entry5 };
 
- if( n_arg>4 )
-  mem.printf( " AND id_entry5=%d", id_entry5 );
+ sqlite3_stmt *stmt = PrepareCached(sql);
+ sqlite3_bind_int( stmt, 1, id_facts );
+ for( int i=0; i<n_arg; ++i )
+  sqlite3_bind_int( stmt, i+2, id_entries[i] );
 
- lem::Ptr<LS_ResultSet> rs( ListByQuery(mem.string()) );
+ lem::Ptr<LS_ResultSet> rs( ListPrepared(sql,stmt) );
  while( rs->Fetch() )
   {
    const int id = rs->GetInt(0);
@@ -5264,46 +5312,41 @@ int LexiconStorage_SQLITE::FindFactByWords(
                                            KB_CheckingResult &result
                                           )
 {
- lem::MemFormatter mem;
-
- lem::UFString word1_str( word1.c_str() );
- sqlite_escape(word1_str);
-
- mem.printf( "SELECT F.id, Coalesce(F.boolean_return,-1), Coalesce(F.integer_return,-1), F.false_score"
-             " FROM kb_fact_index1 I, kb_fact F"
-             " WHERE I.id_group=%d AND I.word1=%us", id_facts, word1_str.c_str() );
-
- if( n_arg>1 )
-  {
-   lem::UFString str( word2.c_str() );
-   sqlite_escape(str);
-   mem.printf( " AND I.word2=%us", str.c_str() );
-  }
-
- if( n_arg>2 )
+ //    ,      .
+ static const char* sqls[5] = {
+  "SELECT F.id, Coalesce(F.boolean_return,-1), Coalesce(F.integer_return,-1), F.false_score"
+  " FROM kb_fact_index1 I, kb_fact F"
+  " WHERE I.id_group=? AND I.word1=? AND F.id=I.id_fact",
+  "SELECT F.id, Coalesce(F.boolean_return,-1), Coalesce(F.integer_return,-1), F.false_score"
+  " FROM kb_fact_index1 I, kb_fact F"
+  " WHERE I.id_group=? AND I.word1=? AND I.word2=? AND F.id=I.id_fact",
+  "SELECT F.id, Coalesce(F.boolean_return,-1), Coalesce(F.integer_return,-1), F.false_score"
+  " FROM kb_fact_index1 I, kb_fact F"
+  " WHERE I.id_group=? AND I.word1=? AND I.word2=? AND I.word3=? AND F.id=I.id_fact",
+  "SELECT F.id, Coalesce(F.boolean_return,-1), Coalesce(F.integer_return,-1), F.false_score"
+  " FROM kb_fact_index1 I, kb_fact F"
+  " WHERE I.id_group=? AND I.word1=? AND I.word2=? AND I.word3=? AND I.word4=? AND F.id=I.id_fact",
+  "SELECT F.id, Coalesce(F.boolean_return,-1), Coalesce(F.integer_return,-1), F.false_score"
+  " FROM kb_fact_index1 I, kb_fact F"
+  " WHERE I.id_group=? AND I.word1=? AND I.word2=? AND I.word3=? AND I.word4=? AND I.word5=? AND F.id=I.id_fact"
+ };
+
+ LEM_CHECKIT_Z( n_arg>=1 && n_arg<=5 );
+ if( n_arg<1 || n_arg>5 )
   {
-   lem::UFString str( word3.c_str() );
-   sqlite_escape(str);
-   mem.printf( " AND I.word3=%us", str.c_str() );
-  }
-
- if( n_arg>3 )
-  {
-   lem::UFString str( word4.c_str() );
-   sqlite_escape(str);
-   mem.printf( " AND I.word4=%us", str.c_str() );
+   result = KB_NotMatchedResult();
+   return UNKNOWN;
   }
 
- if( n_arg>4 )
-  {
-   lem::UFString str( word5.c_str() );
-   sqlite_escape(str);
-   mem.printf( " AND I.word5=%us", str.c_str() );
-  }
+ const char *sql = sqls[n_arg-1];
+ const lem::UCString* words[5] = { &word1, &word2, &word3, &word4, &word5 };
 
- mem.printf( " AND F.id=I.id_fact" );
+ sqlite3_stmt *stmt = PrepareCached(sql);
+ sqlite3_bind_int( stmt, 1, id_facts );
+ for( int i=0; i<n_arg; ++i )
+  BindText( stmt, i+2, lem::UFString( words[i]->c_str() ) );
 
- lem::Ptr<LS_ResultSet> rs( ListByQuery(mem.string()) );
+ lem::Ptr<LS_ResultSet> rs( ListPrepared(sql,stmt) );
  if( rs->Fetch() )
   {
    const int id_fact = rs->GetInt(0);
@@ -5495,9 +5538,7 @@ int LexiconStorage_SQLITE::StoreTreeScorerGroup( const lem::UCString & name, con
 
 void LexiconStorage_SQLITE::LoadTreeScorerGroupParams( int id, TreeScorerGroupParams & params )
 {
- lem::MemFormatter mem;
- mem.printf( "SELECT allow_unmatched_children FROM ts_group WHERE id=%d", id );
- lem::Ptr<LS_ResultSet> rs( ListByQuery(mem.string()) );
+ lem::Ptr<LS_ResultSet> rs( ListByQuery( "SELECT allow_unmatched_children FROM ts_group WHERE id=?", id ) );
  if( rs->Fetch() )
   {
    params.allow_unmatched_children = rs->GetInt(0)==1;
@@ -5511,12 +5552,7 @@ void LexiconStorage_SQLITE::LoadTreeScorerGroupParams( int id, TreeScorerGroupPa
 
 int LexiconStorage_SQLITE::FindTreeScorerGroup( const lem::UCString & name )
 {
- lem::UFString escaped_name(name.c_str());
- sqlite_escape(escaped_name);
-
- lem::MemFormatter ms;
- ms.printf( "SELECT id FROM ts_group WHERE name='%us'", escaped_name.c_str() );
- const int id = SelectInt( ms.string() );
+ const int id = SelectInt( "SELECT id FROM ts_group WHERE name=?", lem::UFString(name.c_str()) );
  return id;
 }
 
@@ -5592,7 +5628,7 @@ void LexiconStorage_SQLITE::ListTreeScoreGroupMembers( int id_group, lem::MColle
 {
  LEM_CHECKIT_Z( id_group!=UNKNOWN );
 
- lem::Ptr<LS_ResultSet> rs( ListByQuery(lem::format_str( "SELECT id_root FROM ts_group2root WHERE id_group=%d", id_group )) );
+ lem::Ptr<LS_ResultSet> rs( ListByQuery( "SELECT id_root FROM ts_group2root WHERE id_group=?", id_group ) );
  while( rs->Fetch() )
  {
   roots.push_back( rs->GetInt(0) );
@@ -5881,12 +5917,8 @@ void LexiconStorage_SQLITE::ListTreeScorers(
                                             lem::MCollect<int> & anchor_is_root
                                            )
 {
- lem::MemFormatter mem;
-
  const int id_entry = root.GetEntryKey();
- mem.printf( "SELECT id_head_point, score_type, score_expr, root_node FROM ts_head_lemma WHERE id_entry=%d AND id_group=%d", id_entry, id_group );
- 
- lem::Ptr<LS_ResultSet> rs( ListByQuery(mem.string()) );
+ lem::Ptr<LS_ResultSet> rs( ListByQuery( "SELECT id_head_point, score_type, score_expr, root_node FROM ts_head_lemma WHERE id_entry=? AND id_group=?", id_entry, id_group ) );
  while( rs->Fetch() )
   {
    int id_headpoint = rs->GetInt(0);
@@ -5904,11 +5936,8 @@ void LexiconStorage_SQLITE::ListTreeScorers(
  rs.Delete();
 
 
- lem::UFString word_str( root.GetNormalized()->c_str() );
- sqlite_escape(word_str);
-
- mem.printf( "SELECT id_head_point, score_type, score_expr, root_node FROM ts_head_word WHERE word='%us'", word_str.c_str() );
- rs = ListByQuery(mem.string());
+ const lem::UFString word_str( root.GetNormalized()->c_str() );
+ rs = ListByQuery( "SELECT id_head_point, score_type, score_expr, root_node FROM ts_head_word WHERE word=?", word_str );
  while( rs->Fetch() )
   {
    int id_headpoint = rs->GetInt(0);
@@ -5935,11 +5964,7 @@ void LexiconStorage_SQLITE::ListGenericTreeScorers(
                                                    lem::MCollect<TreeScorerResult*> & scores
                                                   )
 {
- lem::MemFormatter mem;
-
- mem.printf( "SELECT id_head_point, score_type, score_expr FROM generic_tree_scorer WHERE id_group=%d", id_group );
- 
- lem::Ptr<LS_ResultSet> rs( ListByQuery(mem.string()) );
+ lem::Ptr<LS_ResultSet> rs( ListByQuery( "SELECT id_head_point, score_type, score_expr FROM generic_tree_scorer WHERE id_group=?", id_group ) );
  while( rs->Fetch() )
   {
    int id_headpoint = rs->GetInt(0);
@@ -5962,17 +5987,14 @@ void LexiconStorage_SQLITE::ListGenericTreeScorers(
 
 int LexiconStorage_SQLITE::GetTreeScorerHeadpointSrc( int id_point )
 {
- lem::MemFormatter mem;
- mem.printf( "SELECT id_src FROM ts_point WHERE id=%d", id_point );
- return SelectInt( mem.string() );
+ return SelectInt( "SELECT id_src FROM ts_point WHERE id=?", id_point );
 }
 
 
 
 TreeScorerPoint* LexiconStorage_SQLITE::LoadTreeScorerPoint( int id_point )
 {
- lem::MemFormatter mem;
- mem.printf( "SELECT id, word_text, id_entry, id_class,"
+ return LoadTreeScorerPoint( ListByQuery( "SELECT id, word_text, id_entry, id_class,"
              " wordset_name, wordentryset_name, wordformset_name,"
              " n_coords, id_coord1, id_state1, affirm1, id_coord2,"
              " id_state2, affirm2, id_coord3, id_state3, affirm3,"
@@ -5986,10 +6008,8 @@ TreeScorerPoint* LexiconStorage_SQLITE::LoadTreeScorerPoint( int id_point )
              " br_marker_0, br_coord1_0, br_for_group_0,"
              " br_affirm_1, br_coord0_1, br_marker_1, br_coord1_1, br_for_group_1,"
              " br_affirm_2, br_coord0_2, br_marker_2, br_coord1_2, br_for_group_2"
-             " FROM ts_point WHERE id=%d"
-             , id_point );
-
- return LoadTreeScorerPoint( mem.string() );
+             " FROM ts_point WHERE id=?"
+             , id_point ) );
 }
 
 
@@ -5998,10 +6018,7 @@ TreeScorerPoint* LexiconStorage_SQLITE::LoadTreeScorerPoint( int id_point )
 
 void LexiconStorage_SQLITE::LoadTreeScorerChildNodes( int id_point, lem::MCollect<TreeScorerPoint*> & scorer_leafs )
 {
- lem::MemFormatter mem;
- mem.printf( "SELECT id FROM ts_point WHERE id_parent=%d", id_point );
-
- lem::Ptr<LS_ResultSet> rs( ListByQuery( mem.string() ) );
+ lem::Ptr<LS_ResultSet> rs( ListByQuery( "SELECT id FROM ts_point WHERE id_parent=?", id_point ) );
  while( rs->Fetch() )
   {
    int id = rs->GetInt(0);
@@ -6014,11 +6031,11 @@ void LexiconStorage_SQLITE::LoadTreeScorerChildNodes( int id_point, lem::MCollec
 
 
 
-TreeScorerPoint* LexiconStorage_SQLITE::LoadTreeScorerPoint( const lem::UFString & query )
+TreeScorerPoint* LexiconStorage_SQLITE::LoadTreeScorerPoint( LS_ResultSet * rs_arg )
 { 
  TreeScorerPoint * res = new TreeScorerPoint();
 
- lem::Ptr<LS_ResultSet> rs( ListByQuery(lem::to_utf8(query) ) );
+ lem::Ptr<LS_ResultSet> rs( rs_arg );
  if( rs->Fetch() )
   {
    res->id = rs->GetInt(0);
@@ -6140,9 +6157,7 @@ TreeScorerPoint* LexiconStorage_SQLITE::LoadTreeScorerPoint( const lem::UFString
 
 void LexiconStorage_SQLITE::LoadTreeScorerPredicates( TreeScorerPoint * p )
 {
- lem::MemFormatter mem;
- mem.printf( "SELECT id FROM ts_predicate WHERE id_point=%d", p->id );
- lem::Ptr<LS_ResultSet> rs( ListByQuery( mem.string() ) );
+ lem::Ptr<LS_ResultSet> rs( ListByQuery( "SELECT id FROM ts_predicate WHERE id_point=?", p->id ) );
  while( rs->Fetch() )
   {
    TreeScorerPredicate * predicate = LoadTreeScorerPredicate(rs->GetInt(0));
@@ -6156,9 +6171,7 @@ void LexiconStorage_SQLITE::LoadTreeScorerPredicates( TreeScorerPoint * p )
 
 TreeScorerPredicate* LexiconStorage_SQLITE::LoadTreeScorerPredicate( int id )
 {
- lem::MemFormatter mem;
- mem.printf( "SELECT func_name, narg, id_class1 FROM ts_predicate WHERE id=%d", id );
- lem::Ptr<LS_ResultSet> rs( ListByQuery(mem.string()) );
+ lem::Ptr<LS_ResultSet> rs( ListByQuery( "SELECT func_name, narg, id_class1 FROM ts_predicate WHERE id=?", id ) );
  rs->Fetch();
 
  lem::UCString func_name = rs->GetUCString(0);
@@ -6255,10 +6268,7 @@ void LexiconStorage_SQLITE::GetMetaEntryItems( int id_metaentry, lem::MCollect<i
  LEM_CHECKIT_Z( id_metaentry!=UNKNOWN );
  entries.clear();
 
- lem::MemFormatter mem;
- mem.printf( "SELECT id_entry FROM metaentry_item WHERE id_metaentry=%d", id_metaentry );
- 
- lem::Ptr<LS_ResultSet> rs( ListByQuery(mem.string()) );
+ lem::Ptr<LS_ResultSet> rs( ListByQuery( "SELECT id_entry FROM metaentry_item WHERE id_metaentry=?", id_metaentry ) );
 
  while( rs->Fetch() )
  {
@@ -6279,9 +6289,7 @@ LS_ResultSet* LexiconStorage_SQLITE::ListMetaEntries()
 
 MetaEntry* LexiconStorage_SQLITE::LoadMetaEntry( int id )
 {
- lem::MemFormatter mem;
- mem.printf( "SELECT id_class, name FROM metaentry WHERE id=%d", id );
- lem::Ptr<LS_ResultSet> rs( ListByQuery(mem.string()) );
+ lem::Ptr<LS_ResultSet> rs( ListByQuery( "SELECT id_class, name FROM metaentry WHERE id=?", id ) );
 
  if( rs->Fetch() )
  {
@@ -6294,6 +6302,7 @@ MetaEntry* LexiconStorage_SQLITE::LoadMetaEntry( int id )
  }
  else
  {
+  lem::MemFormatter mem;
   mem.printf( "Can not load metaentry id=%d", id );
   throw lem::E_BaseException( mem.string() );
  }
@@ -6304,9 +6313,7 @@ MetaEntry* LexiconStorage_SQLITE::LoadMetaEntry( int id )
 bool LexiconStorage_SQLITE::DoesMetaEntryContains( int id_metaentry, int id_entry )
 {
  LEM_CHECKIT_Z( id_metaentry!=UNKNOWN );
- lem::MemFormatter mem;
- mem.printf( "SELECT id FROM metaentry_item WHERE id_metaentry=%d AND id_entry=%d", id_metaentry, id_entry );
- return SelectInt( mem.string() )!=-1;
+ return SelectInt( "SELECT id FROM metaentry_item WHERE id_metaentry=? AND id_entry=?", id_metaentry, id_entry )!=-1;
 }
 
 
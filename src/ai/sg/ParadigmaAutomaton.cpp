@@ -0,0 +1,478 @@
+// CD->16.10.2026
+// LC->16.10.2026
+
+#include <algorithm>
+#include <map>
+#include <cwchar>
+#include <lem/conversions.h>
+#include <lem/solarix/ParadigmaMatcher.h>
+#include <lem/solarix/ParadigmaAutomaton.h>
+
+using namespace Solarix;
+
+
+namespace
+{
+ const std::size_t MAX_ALTERNATIVES=256;
+ const int MAX_RANGE=4096;
+
+ //   : ,  [...]  .
+ struct Atom
+ {
+  bool any;
+  bool negated;
+  std::vector<wchar_t> chars; //   , 
+
+  Atom(void) : any(false), negated(false) {}
+
+  // c -    , 0 -  ,    .
+  bool Has( wchar_t c ) const
+  {
+   if( any )
+    return c!=L'\n';
+
+   const bool r = c!=0 && std::binary_search( chars.begin(), chars.end(), c );
+   return negated ? !r : r;
+  }
+ };
+
+ typedef std::vector<Atom> AtomSeq;
+
+
+ // ***************************************************************************
+ //   .    
+ // (.+), (.*), .+  .*      ,  [...], 
+ //     (...|...)  . 
+ //    .   - ,  
+ //  .
+ // ***************************************************************************
+ class SuffixParser
+ {
+  private:
+   const wchar_t *s;
+   int i, n;
+
+   static bool IsMeta( wchar_t c )
+   { return c!=0 && std::wcschr( L"()[]{}|.*+?^$\\", c )!=NULL; }
+
+   static bool Escaped( wchar_t c, wchar_t &res )
+   {
+    // \d, \w, \x41  ..  
+    if( (c>=L'0' && c<=L'9') || (c>=L'a' && c<=L'z') || (c>=L'A' && c<=L'Z') )
+     return false;
+
+    res = c;
+    return true;
+   }
+
+   static void Add( Atom &a, wchar_t c )
+   { a.chars.push_back( lem::to_uupper(c) ); }
+
+   bool ParseClass( Atom &a )
+   {
+    if( i<n && s[i]==L'^' )
+     {
+      a.negated = true;
+      i++;
+     }
+
+    bool first=true;
+    for(;;)
+     {
+      if( i>=n )
+       return false;
+
+      wchar_t c = s[i];
+      if( c==L']' && !first )
+       {
+        i++;
+        break;
+       }
+
+      first=false;
+
+      if( c==L'[' )
+       return false; // [:alpha:]  ..
+
+      if( c==L'\\' )
+       {
+        if( i+1>=n || !Escaped(s[i+1],c) )
+         return false;
+
+        i+=2;
+       }
+      else
+       i++;
+
+      if( i+1<n && s[i]==L'-' && s[i+1]!=L']' )
+       {
+        wchar_t c2 = s[i+1];
+        if( c2==L'\\' )
+         {
+          if( i+2>=n || !Escaped(s[i+2],c2) )
+           return false;
+
+          i+=3;
+         }
+        else if( c2==L'[' )
+         return false;
+        else
+         i+=2;
+
+        if( c2<c || int(c2-c)>MAX_RANGE )
+         return false;
+
+        for( wchar_t x=c; ; ++x )
+         {
+          Add( a, x );
+          if( x==c2 )
+           break;
+         }
+       }
+      else
+       {
+        Add( a, c );
+       }
+     }
+
+    std::sort( a.chars.begin(), a.chars.end() );
+    a.chars.erase( std::unique( a.chars.begin(), a.chars.end() ), a.chars.end() );
+    return true;
+   }
+
+   bool ParseAtom( Atom &a )
+   {
+    wchar_t c = s[i];
+
+    if( c==L'.' )
+     {
+      a.any = true;
+      i++;
+      return true;
+     }
+
+    if( c==L'[' )
+     {
+      i++;
+      return ParseClass(a);
+     }
+
+    if( c==L'\\' )
+     {
+      if( i+1>=n || !Escaped(s[i+1],c) )
+       return false;
+
+      i+=2;
+      Add( a, c );
+      return true;
+     }
+
+    if( IsMeta(c) )
+     return false;
+
+    Add( a, c );
+    i++;
+    return true;
+   }
+
+   bool ParseSeq( std::vector<AtomSeq> &alts )
+   {
+    alts.clear();
+    alts.push_back( AtomSeq() );
+
+    while( i<n && s[i]!=L')' && s[i]!=L'|' )
+     {
+      std::vector<AtomSeq> item;
+
+      if( s[i]==L'(' )
+       {
+        i++;
+        if( i+1<n && s[i]==L'?' && s[i+1]==L':' )
+         i+=2;
+
+        if( !ParseAlt(item) || i>=n || s[i]!=L')' )
+         return false;
+
+        i++;
+       }
+      else
+       {
+        Atom a;
+        if( !ParseAtom(a) )
+         return false;
+
+        item.push_back( AtomSeq(1,a) );
+       }
+
+      if( i<n && (s[i]==L'*' || s[i]==L'+' || s[i]==L'?' || s[i]==L'{') )
+       return false;
+
+      if( alts.size()*item.size()>MAX_ALTERNATIVES )
+       return false;
+
+      std::vector<AtomSeq> prod;
+      for( std::size_t a=0; a<alts.size(); ++a )
+       for( std::size_t b=0; b<item.size(); ++b )
+        {
+         prod.push_back( alts[a] );
+         prod.back().insert( prod.back().end(), item[b].begin(), item[b].end() );
+        }
+
+      alts.swap(prod);
+     }
+
+    return true;
+   }
+
+   bool ParseAlt( std::vector<AtomSeq> &alts )
+   {
+    if( !ParseSeq(alts) )
+     return false;
+
+    while( i<n && s[i]==L'|' )
+     {
+      i++;
+
+      std::vector<AtomSeq> more;
+      if( !ParseSeq(more) )
+       return false;
+
+      alts.insert( alts.end(), more.begin(), more.end() );
+      if( alts.size()>MAX_ALTERNATIVES )
+       return false;
+     }
+
+    return true;
+   }
+
+  public:
+   SuffixParser( const lem::UFString &str ) : s(str.c_str()), i(0), n(str.length()) {}
+
+   bool Parse( int &min_prefix, int &max_prefix, std::vector<AtomSeq> &alts )
+   {
+    if( n>0 && s[n-1]==L'$' && (n<2 || s[n-2]!=L'\\') )
+     n--;
+
+    if( i<n && s[i]==L'^' )
+     i++;
+
+    min_prefix = max_prefix = 0;
+
+    static const wchar_t* heads[] = { L"(.+)", L"(.*)", L".+", L".*" };
+    for( int k=0; k<4; ++k )
+     {
+      const int len = CastSizeToInt( std::wcslen(heads[k]) );
+      if( n-i>=len && std::wcsncmp( s+i, heads[k], len )==0 )
+       {
+        min_prefix = std::wcschr( heads[k], L'+' )!=NULL ? 1 : 0;
+        max_prefix = -1;
+        i+=len;
+        break;
+       }
+     }
+
+    //         
+    // ,    .
+    return ParseSeq(alts) && i==n;
+   }
+ };
+}
+
+
+void ParadigmaAutomaton::SetClass( wchar_t c, int cls )
+{
+ const lem::uint32_t u = (lem::uint32_t)c;
+ const lem::uint32_t ipage = u>>PAGE_BITS;
+
+ if( ipage>=pages.size() )
+  pages.resize( ipage+1, -1 );
+
+ if( pages[ipage]==-1 )
+  {
+   pages[ipage] = CastSizeToInt(codes.size());
+   codes.resize( codes.size()+PAGE_SIZE, 0 );
+  }
+
+ codes[ pages[ipage]+(u & (PAGE_SIZE-1)) ] = cls;
+ return;
+}
+
+
+ParadigmaAutomaton::ParadigmaAutomaton( const lem::MCollect<ParadigmaMatcher*> &matchers )
+ : n_classes(1)
+{
+ //      .
+ std::vector<AtomSeq> seqs;
+ for( lem::Container::size_type i=0; i<matchers.size(); ++i )
+  {
+   if( matchers[i]->Empty() )
+    continue; //     
+
+   const lem::UFString str = matchers[i]->ToString();
+
+   int min_prefix=0, max_prefix=0;
+   std::vector<AtomSeq> alts;
+   SuffixParser parser(str);
+   if( !parser.Parse( min_prefix, max_prefix, alts ) )
+    {
+     fallback.push_back( CastSizeToInt(i) );
+     continue;
+    }
+
+   for( std::size_t k=0; k<alts.size(); ++k )
+    {
+     Rule r;
+     r.imatcher = CastSizeToInt(i);
+     r.min_prefix = min_prefix;
+     r.max_prefix = max_prefix;
+     rules.push_back(r);
+     seqs.push_back( alts[k] );
+    }
+  }
+
+ // ,      ,
+ //        .
+ std::vector<const Atom*> atoms;
+ std::vector<int> atom_base;
+ std::vector<wchar_t> chars;
+ for( std::size_t k=0; k<seqs.size(); ++k )
+  {
+   atom_base.push_back( CastSizeToInt(atoms.size()) );
+   for( std::size_t j=0; j<seqs[k].size(); ++j )
+    {
+     atoms.push_back( &seqs[k][j] );
+     chars.insert( chars.end(), seqs[k][j].chars.begin(), seqs[k][j].chars.end() );
+    }
+  }
+
+ std::sort( chars.begin(), chars.end() );
+ chars.erase( std::unique( chars.begin(), chars.end() ), chars.end() );
+
+ std::vector< std::vector<bool> > class_sig;
+ std::map< std::vector<bool>, int > sig2class;
+
+ std::vector<bool> sig( atoms.size() );
+ for( std::size_t a=0; a<atoms.size(); ++a )
+  sig[a] = atoms[a]->Has(0);
+
+ class_sig.push_back(sig);
+ sig2class.insert( std::make_pair( sig, 0 ) );
+
+ for( std::size_t k=0; k<chars.size(); ++k )
+  {
+   for( std::size_t a=0; a<atoms.size(); ++a )
+    sig[a] = atoms[a]->Has( chars[k] );
+
+   std::map< std::vector<bool>, int >::const_iterator it = sig2class.find(sig);
+   int cls;
+   if( it==sig2class.end() )
+    {
+     cls = n_classes++;
+     class_sig.push_back(sig);
+     sig2class.insert( std::make_pair( sig, cls ) );
+    }
+   else
+    {
+     cls = it->second;
+    }
+
+   if( cls!=0 )
+    SetClass( chars[k], cls );
+  }
+
+ //  :  -    , 
+ //        .
+ std::vector< std::vector<int> > states;
+ std::map< std::vector<int>, int > state2id;
+
+ std::vector<int> key;
+ key.push_back(0);
+ for( std::size_t k=0; k<seqs.size(); ++k )
+  key.push_back( CastSizeToInt(k) );
+
+ states.push_back(key);
+ state2id.insert( std::make_pair( key, 0 ) );
+ final_begin.push_back(0);
+
+ for( std::size_t istate=0; istate<states.size(); ++istate )
+  {
+   const std::vector<int> cur = states[istate];
+   const int depth = cur.front();
+
+   for( std::size_t k=1; k<cur.size(); ++k )
+    if( CastSizeToInt(seqs[ cur[k] ].size())==depth )
+     final_rules.push_back( cur[k] );
+
+   final_begin.push_back( CastSizeToInt(final_rules.size()) );
+   next.resize( (istate+1)*n_classes, -1 );
+
+   for( int cls=0; cls<n_classes; ++cls )
+    {
+     key.clear();
+     key.push_back( depth+1 );
+
+     for( std::size_t k=1; k<cur.size(); ++k )
+      {
+       const int irule = cur[k];
+       const int len = CastSizeToInt(seqs[irule].size());
+       if( len>depth && class_sig[cls][ atom_base[irule]+len-1-depth ] )
+        key.push_back(irule);
+      }
+
+     if( key.size()==1 )
+      continue;
+
+     std::map< std::vector<int>, int >::const_iterator it = state2id.find(key);
+     int inext;
+     if( it==state2id.end() )
+      {
+       inext = CastSizeToInt(states.size());
+       states.push_back(key);
+       state2id.insert( std::make_pair( key, inext ) );
+      }
+     else
+      {
+       inext = it->second;
+      }
+
+     next[ istate*n_classes+cls ] = inext;
+    }
+  }
+
+ return;
+}
+
+
+void ParadigmaAutomaton::Match( const lem::UCString &word, lem::MCollect<int> &hits ) const
+{
+ hits.clear();
+
+ const int n = word.length();
+ int state=0;
+
+ for( int depth=0; ; ++depth )
+  {
+   const int rest = n-depth;
+   for( int k=final_begin[state]; k<final_begin[state+1]; ++k )
+    {
+     const Rule &r = rules[ final_rules[k] ];
+     if( rest>=r.min_prefix && (r.max_prefix==-1 || rest<=r.max_prefix) )
+      hits.push_back( r.imatcher );
+    }
+
+   if( depth==n )
+    break;
+
+   state = next[ state*n_classes + Class( lem::to_uupper( word[n-1-depth] ) ) ];
+   if( state==-1 )
+    break;
+  }
+
+ if( hits.size()>1 )
+  {
+   std::sort( hits.begin(), hits.end() );
+   hits.resize( std::unique( hits.begin(), hits.end() )-hits.begin() );
+  }
+
+ return;
+}
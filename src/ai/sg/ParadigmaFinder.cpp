@@ -1,6 +1,9 @@
+#include <algorithm>
+#include <lem/macros.h>
 #include <lem/smart_pointers.h>
 #include <lem/solarix/LexiconStorage.h>
 #include <lem/solarix/ParadigmaMatcher.h>
+#include <lem/solarix/ParadigmaAutomaton.h>
 #include <lem/solarix/ParadigmaFinder.h>
 
 using namespace Solarix;
@@ -9,6 +12,7 @@ ParadigmaFinder::ParadigmaFinder( LexiconStorage *_storage )
 {
  loaded = false;
  storage = _storage;
+ automaton = NULL;
  return;
 }
 
@@ -20,6 +24,8 @@ ParadigmaFinder::~ParadigmaFinder(void)
    delete it->second;
   }
 
+ delete automaton;
+
  return;
 }
 
@@ -52,6 +58,9 @@ void ParadigmaFinder::Add( const ParadigmaMatcher &matcher, int PartOfSpeech, in
    it->second->push_back( std::make_pair(id,m) );
   }
 
+ //     
+ lem_rub_off(automaton);
+
  return;
 }
 
@@ -59,7 +68,9 @@ void ParadigmaFinder::Add( const ParadigmaMatcher &matcher, int PartOfSpeech, in
 
 // *************************************************************************************
 //  ,       , 
-//  id  .
+//  id  .      
+//  ,  -  ,     .
+//  id  ,   FindLinear.
 // *************************************************************************************
 void ParadigmaFinder::Find( int PartOfSpeech, const lem::UCString &entry_name, lem::MCollect<int> &found_ids )
 {
@@ -67,6 +78,57 @@ void ParadigmaFinder::Find( int PartOfSpeech, const lem::UCString &entry_name, l
  lem::Process::RWU_ReaderGuard rlock(cs);
  #endif
 
+ if( !loaded || automaton==NULL )
+  {
+   #if defined LEM_THREADS
+   lem::Process::RWU_WriterGuard wlock(rlock);
+   #endif
+
+   if( !loaded )
+    LoadFromDB();
+
+   if( automaton==NULL )
+    automaton = new ParadigmaAutomaton(matchers);
+  }
+
+ const bool any_class = PartOfSpeech==UNKNOWN || PartOfSpeech==ANY_STATE;
+
+ lem::MCollect<int> hits;
+ automaton->Match( entry_name, hits );
+
+ const lem::MCollect<int> &fallback = automaton->GetFallback();
+ if( !fallback.empty() )
+  {
+   for( lem::Container::size_type i=0; i<fallback.size(); ++i )
+    {
+     const int k = fallback[i];
+     if( (any_class || id_class[k]==PartOfSpeech) && matchers[k]->Match(entry_name) )
+      hits.push_back(k);
+    }
+
+   std::sort( hits.begin(), hits.end() );
+  }
+
+ for( lem::Container::size_type i=0; i<hits.size(); ++i )
+  {
+   const int k = hits[i];
+   if( any_class || id_class[k]==PartOfSpeech )
+    found_ids.push_back( ids[k] );
+  }
+
+ return;
+}
+
+
+// *************************************************************************************
+//    ,    Find.
+// *************************************************************************************
+void ParadigmaFinder::FindLinear( int PartOfSpeech, const lem::UCString &entry_name, lem::MCollect<int> &found_ids )
+{
+ #if defined LEM_THREADS
+ lem::Process::RWU_ReaderGuard rlock(cs);
+ #endif
+
  if( !loaded )
   {
    #if defined LEM_THREADS
@@ -0,0 +1,239 @@
+#include <algorithm>
+#include <lem/smart_pointers.h>
+#include <lem/solarix/LS_ResultSet.h>
+#include <lem/solarix/ThesaurusStorage.h>
+#include <lem/solarix/TagSets.h>
+#include <lem/solarix/SG_NetGraph.h>
+
+using namespace Solarix;
+
+
+namespace
+{
+ template < class ROW >
+ struct ByEntry1
+ {
+  bool operator()( const ROW &a, const ROW &b ) const
+  { return a.ekey1<b.ekey1 || (a.ekey1==b.ekey1 && a.id<b.id); }
+ };
+
+ template < class ROW >
+ struct ByEntry2
+ {
+  bool operator()( const ROW &a, const ROW &b ) const
+  { return a.ekey2<b.ekey2 || (a.ekey2==b.ekey2 && a.id<b.id); }
+ };
+
+ template < class ROW >
+ struct ById
+ {
+  bool operator()( const ROW &a, const ROW &b ) const
+  { return a.id<b.id; }
+
+  bool operator()( const ROW &a, int id ) const
+  { return a.id<id; }
+ };
+}
+
+
+void SG_NetGraph::Adjacency::Find( int ekey, const Edge* &begin, const Edge* &end ) const
+{
+ begin = end = NULL;
+
+ std::vector<int>::const_iterator it = std::lower_bound( keys.begin(), keys.end(), ekey );
+ if( it!=keys.end() && *it==ekey )
+  {
+   const size_t i = it-keys.begin();
+   begin = &edges[0] + offsets[i];
+   end = &edges[0] + offsets[i+1];
+  }
+
+ return;
+}
+
+
+SG_NetGraph::SG_NetGraph( ThesaurusStorage &db, TagSets &tag_sets )
+{
+ std::vector<LinkRow> rows;
+
+ lem::Ptr<LS_ResultSet> rs( db.ListAllWordLinks() );
+ while( rs->Fetch() )
+  {
+   LinkRow r;
+   r.id = rs->GetInt(0);
+   r.ekey1 = rs->GetInt(1);
+   r.ekey2 = rs->GetInt(2);
+   r.link_type = rs->GetInt(3);
+   r.id_tags = rs->GetInt(4);
+   rows.push_back(r);
+  }
+
+ rs.Delete();
+
+ //     (tags=-1)      sg_link_tag,
+ //    ,  SG_Net::GetWordLinkTags.   
+ //  id .
+ lem::Ptr<LS_ResultSet> rs_tags( db.ListAllWordLinkTags() );
+ lem::MCollect< std::pair<int,int> > atomized_tags;
+ int id_link=UNKNOWN;
+ bool fetched = rs_tags->Fetch();
+ while( fetched )
+  {
+   id_link = rs_tags->GetInt(0);
+   atomized_tags.clear();
+
+   do
+    {
+     atomized_tags.push_back( std::make_pair( rs_tags->GetInt(1), rs_tags->GetInt(2) ) );
+     fetched = rs_tags->Fetch();
+    }
+   while( fetched && rs_tags->GetInt(0)==id_link );
+
+   std::vector<LinkRow>::iterator it = std::lower_bound( rows.begin(), rows.end(), id_link, ById<LinkRow>() );
+   if( it!=rows.end() && it->id==id_link && it->id_tags==UNKNOWN )
+    it->id_tags = tag_sets.Register(atomized_tags);
+  }
+
+ rs_tags.Delete();
+
+ for( size_t i=0; i<rows.size(); ++i )
+  if( rows[i].id_tags==UNKNOWN )
+   rows[i].id_tags = 0;
+  else
+   //       TagSets.
+   tag_sets[ rows[i].id_tags ];
+
+ Build(rows);
+ return;
+}
+
+
+void SG_NetGraph::Build( std::vector<LinkRow> &rows )
+{
+ for( int pass=0; pass<2; ++pass )
+  {
+   Adjacency &adj = pass==0 ? outgoing : incoming;
+
+   if( pass==0 )
+    std::sort( rows.begin(), rows.end(), ByEntry1<LinkRow>() );
+   else
+    std::sort( rows.begin(), rows.end(), ByEntry2<LinkRow>() );
+
+   adj.keys.clear();
+   adj.offsets.clear();
+   adj.edges.clear();
+   adj.edges.reserve( rows.size() );
+
+   for( size_t i=0; i<rows.size(); ++i )
+    {
+     const LinkRow &r = rows[i];
+     const int key = pass==0 ? r.ekey1 : r.ekey2;
+
+     if( adj.keys.empty() || adj.keys.back()!=key )
+      {
+       adj.keys.push_back(key);
+       adj.offsets.push_back( CastSizeToInt(adj.edges.size()) );
+      }
+
+     Edge e;
+     e.id_link = r.id;
+     e.ekey = pass==0 ? r.ekey2 : r.ekey1;
+     e.link_type = r.link_type;
+     e.id_tags = r.id_tags;
+     adj.edges.push_back(e);
+    }
+
+   adj.offsets.push_back( CastSizeToInt(adj.edges.size()) );
+  }
+
+ return;
+}
+
+
+//       -     .
+void SG_NetGraph::ListRows( std::vector<LinkRow> &rows ) const
+{
+ rows.clear();
+ rows.reserve( outgoing.edges.size()+1 );
+
+ for( size_t i=0; i<outgoing.keys.size(); ++i )
+  for( int j=outgoing.offsets[i]; j<outgoing.offsets[i+1]; ++j )
+   {
+    const Edge &e = outgoing.edges[j];
+
+    LinkRow r;
+    r.id = e.id_link;
+    r.ekey1 = outgoing.keys[i];
+    r.ekey2 = e.ekey;
+    r.link_type = e.link_type;
+    r.id_tags = e.id_tags;
+    rows.push_back(r);
+   }
+
+ return;
+}
+
+
+SG_NetGraph* SG_NetGraph::WithLink( int id_link, int ekey1, int ekey2, int link_type, int id_tags ) const
+{
+ LEM_CHECKIT_Z( id_tags!=UNKNOWN );
+
+ std::vector<LinkRow> rows;
+ ListRows(rows);
+
+ LinkRow r;
+ r.id = id_link;
+ r.ekey1 = ekey1;
+ r.ekey2 = ekey2;
+ r.link_type = link_type;
+ r.id_tags = id_tags;
+ rows.push_back(r);
+
+ SG_NetGraph *g = new SG_NetGraph();
+ g->Build(rows);
+ return g;
+}
+
+
+SG_NetGraph* SG_NetGraph::WithoutLink( int id_link ) const
+{
+ std::vector<LinkRow> rows;
+ ListRows(rows);
+
+ for( size_t i=0; i<rows.size(); ++i )
+  if( rows[i].id==id_link )
+   {
+    rows.erase( rows.begin()+i );
+    break;
+   }
+
+ SG_NetGraph *g = new SG_NetGraph();
+ g->Build(rows);
+ return g;
+}
+
+
+SG_NetGraph* SG_NetGraph::WithLinkTags( int id_link, int id_tags ) const
+{
+ LEM_CHECKIT_Z( id_tags!=UNKNOWN );
+
+ std::vector<LinkRow> rows;
+ ListRows(rows);
+
+ for( size_t i=0; i<rows.size(); ++i )
+  if( rows[i].id==id_link )
+   {
+    rows[i].id_tags = id_tags;
+    break;
+   }
+
+ SG_NetGraph *g = new SG_NetGraph();
+ g->Build(rows);
+ return g;
+}
+
+
+bool SG_NetGraph::IsAllowedType( int link_type, const lem::MCollect<int> &types )
+{
+ return types.empty() || types.find(link_type)!=UNKNOWN;
+}
@@ -447,6 +447,71 @@ LS_ResultSet* ThesaurusStorage_MySQL::ListWordLinks(void)
 
 
 
+//      ,   -1  ,  
+//    .    SG_NetGraph.
+LS_ResultSet* ThesaurusStorage_MySQL::ListAllWordLinks(void)
+{
+ lem::FString Select("SELECT id, id_entry1, id_entry2, istate, Coalesce(tags,-1) FROM sg_link ORDER BY id");
+
+ MySQLCnx *c = cnx->GetDb();
+ #if defined LEM_THREADS
+ c->cs.Enter();
+ #endif
+
+ std::auto_ptr<TransactionGuard> read_tx(cnx->GetReadTx());
+
+ int ok = mysql_query( c->mysql, Select.c_str() );
+ if( ok==0 )
+  {
+   MYSQL_RES *res = mysql_store_result( c->mysql );
+   if( res!=NULL )
+    {
+     return new LS_ResultSet_MySQL(c,res,read_tx.release());
+    }
+  }
+
+ #if defined LEM_THREADS
+ c->cs.Leave();
+ #endif
+
+ cnx->Error(Select);
+ NEVER_RETURNS(NULL);
+}
+
+
+//      ,   .
+//    SG_NetGraph.
+LS_ResultSet* ThesaurusStorage_MySQL::ListAllWordLinkTags(void)
+{
+ lem::FString Select("SELECT id_link, id_tag, ivalue FROM sg_link_tag ORDER BY id_link");
+
+ MySQLCnx *c = cnx->GetDb();
+ #if defined LEM_THREADS
+ c->cs.Enter();
+ #endif
+
+ std::auto_ptr<TransactionGuard> read_tx(cnx->GetReadTx());
+
+ int ok = mysql_query( c->mysql, Select.c_str() );
+ if( ok==0 )
+  {
+   MYSQL_RES *res = mysql_store_result( c->mysql );
+   if( res!=NULL )
+    {
+     return new LS_ResultSet_MySQL(c,res,read_tx.release());
+    }
+  }
+
+ #if defined LEM_THREADS
+ c->cs.Leave();
+ #endif
+
+ cnx->Error(Select);
+ NEVER_RETURNS(NULL);
+}
+
+
+
 LS_ResultSet* ThesaurusStorage_MySQL::ListWordLinks( int ekey1 )
 {
  LEM_CHECKIT_Z( ekey1!=UNKNOWN );
@@ -598,6 +598,49 @@ LS_ResultSet* ThesaurusStorage_SQLITE::ListWordLinks(void)
 
 
 
+//      ,   -1  ,  
+//    .    SG_NetGraph.
+LS_ResultSet* ThesaurusStorage_SQLITE::ListAllWordLinks(void)
+{
+ lem::FString Select("SELECT id, id_entry1, id_entry2, istate, Coalesce(tags,-1) FROM sg_link ORDER BY id");
+
+ sqlite3_stmt *stmt=NULL;
+ const char *dummy=NULL;
+ int res = sqlite3_prepare_v2( hdb, Select.c_str(), Select.length(), &stmt, &dummy );
+ if( res==SQLITE_OK )
+  {
+   return new LS_ResultSet_SQLITE(stmt);
+  }
+ else
+  {
+   lem::MemFormatter msg;
+   msg.printf( "SQLite error in file %s:%d, message=%us", __FILE__, __LINE__, lem::sqlite_errmsg(hdb).c_str() );
+   throw E_BaseException(msg.string());
+  }
+}
+
+//      ,   .
+//    SG_NetGraph.
+LS_ResultSet* ThesaurusStorage_SQLITE::ListAllWordLinkTags(void)
+{
+ lem::FString Select("SELECT id_link, id_tag, ivalue FROM sg_link_tag ORDER BY id_link");
+
+ sqlite3_stmt *stmt=NULL;
+ const char *dummy=NULL;
+ int res = sqlite3_prepare_v2( hdb, Select.c_str(), Select.length(), &stmt, &dummy );
+ if( res==SQLITE_OK )
+  {
+   return new LS_ResultSet_SQLITE(stmt);
+  }
+ else
+  {
+   lem::MemFormatter msg;
+   msg.printf( "SQLite error in file %s:%d, message=%us", __FILE__, __LINE__, lem::sqlite_errmsg(hdb).c_str() );
+   throw E_BaseException(msg.string());
+  }
+}
+
+
 LS_ResultSet* ThesaurusStorage_SQLITE::ListWordLinks( int ekey1 )
 {
  LEM_CHECKIT_Z( ekey1!=UNKNOWN );
@@ -851,7 +894,7 @@ void ThesaurusStorage_SQLITE::DeleteWordLink( int id )
 
  lem::MemFormatter ms;
 
- ms.printf( "DELETE sg_link_tag WHERE id_link=%d", id );
+ ms.printf( "DELETE FROM sg_link_tag WHERE id_link=%d", id );
 
  lem::FString s(lem::to_utf8(ms.string()));
  int res = sqlite3_exec( hdb, s.c_str(), NULL, NULL, NULL );
@@ -862,7 +905,7 @@ void ThesaurusStorage_SQLITE::DeleteWordLink( int id )
    throw E_BaseException(msg.string());
   }
 
- ms.printf( "DELETE sg_link WHERE id=%d", id );
+ ms.printf( "DELETE FROM sg_link WHERE id=%d", id );
 
  s = lem::to_utf8(ms.string());
  res = sqlite3_exec( hdb, s.c_str(), NULL, NULL, NULL );
@@ -947,7 +990,7 @@ void ThesaurusStorage_SQLITE::SetWordLinkTags( int id_link, int id_tag_set )
 
  lem::MemFormatter ms;
 
- ms.printf( "DELETE sg_link_tag WHERE id_link=%d", id_link );
+ ms.printf( "DELETE FROM sg_link_tag WHERE id_link=%d", id_link );
 
  lem::FString s(lem::to_utf8(ms.string()));
  int res = sqlite3_exec( hdb, s.c_str(), NULL, NULL, NULL );
@@ -979,7 +1022,7 @@ void ThesaurusStorage_SQLITE::ClearWordLinkTags( int id_link )
 
  lem::MemFormatter ms;
 
- ms.printf( "DELETE sg_link_tag WHERE id_link=%d", id_link );
+ ms.printf( "DELETE FROM sg_link_tag WHERE id_link=%d", id_link );
 
  lem::FString s(lem::to_utf8(ms.string()));
  int res = sqlite3_exec( hdb, s.c_str(), NULL, NULL, NULL );
@@ -39,6 +39,11 @@ WordEntries_File::WordEntries_File( SynGram * _sg, const Dictionary_Config &cfg
                // 1 .
 
  lazy_load = false; //   -       . 
+ use_entry_mapping = true;
+ entries_offset = 0;
+
+ lookup_entries_count = UNKNOWN;
+ use_fuzzy_index = true;
 
  for( int j=0; j<(int)DIM_A(predefined_entry); j++ )
   predefined_entry[j]=UNKNOWN;
@@ -137,7 +142,7 @@ int WordEntries_File::CountForms( int id_language )
 
 bool WordEntries_File::IsWordForm( const Solarix::Lexem &lex )
 {
- return ml_ref.Find(lex)!=NULL;
+ return ml_ref.FindId(lex)!=UNKNOWN;
 }
 
 
@@ -307,6 +312,86 @@ WordFormEnumerator* WordEntries_File::ListWordForms_Fuzzy( const lem::UCString &
 }
 
 
+//      lookup_table,    .
+//          ,  
+//  ,      .
+bool WordEntries_File::PrepareFuzzyIndex(void)
+{
+ if( !use_fuzzy_index )
+  return false;
+
+ #if defined LEM_THREADS
+ lem::Process::CritSecLocker guard(&cs_fuzzy);
+ #endif
+
+ const int n_lexem = CastSizeToInt(ml_ref.size());
+
+ if(
+    lookup_table.sorted_lexem_index.empty() ||
+    CastSizeToInt(lookup_table.sorted_lexem_index.size())!=n_lexem ||
+    lookup_entries_count!=size()
+   )
+  return false;
+
+ if( fuzzy_index.CountLexems()!=n_lexem )
+  fuzzy_index.Build( ml_ref );
+
+ return true;
+}
+
+
+bool WordEntries_File::FindFuzzyLexemes( const lem::UCString &word, int max_dist, lem::MCollect<int> &ilexems )
+{
+ if( !PrepareFuzzyIndex() )
+  return false;
+
+ fuzzy_index.Find( ml_ref, word, max_dist, ilexems );
+ return true;
+}
+
+
+//    ( , ),  
+//      ilexem  .
+void WordEntries_File::ListLexemeForms( int ilexem, lem::MCollect< std::pair<int,int> > &index_form )
+{
+ const int lexem_slot = ilexem<CastSizeToInt(lookup_table.lexem_to_slot.size()) ? lookup_table.lexem_to_slot[ilexem] : UNKNOWN;
+ if( lexem_slot==UNKNOWN )
+  return;
+
+ const WordEntries_LookUpItem & slot = lookup_table.lexem_slot[lexem_slot];
+ for( int k=0; k<slot.len; ++k )
+  {
+   const int index = FindEntryIndexByKey( lookup_table.entry_index[ slot.start_index+k ] );
+   const SG_Entry & e = GetWordEntry(index);
+
+   for( lem::Container::size_type j=0; j<e.forms().size(); ++j )
+    if( ml_ref.GetId( &e.forms()[j].name() )==ilexem )
+     index_form.push_back( std::make_pair( index, CastSizeToInt(j) ) );
+  }
+
+ return;
+}
+
+
+bool WordEntries_File::FindFuzzyForms( const lem::UCString &word, int max_dist, lem::MCollect<Word_Coord> &forms )
+{
+ lem::MCollect<int> ilexems;
+ if( !FindFuzzyLexemes( word, max_dist, ilexems ) )
+  return false;
+
+ lem::MCollect< std::pair<int,int> > index_form;
+ for( lem::Container::size_type i=0; i<ilexems.size(); ++i )
+  ListLexemeForms( ilexems[i], index_form );
+
+ std::sort( index_form.begin(), index_form.end() );
+
+ for( lem::Container::size_type i=0; i<index_form.size(); ++i )
+  forms.push_back( Word_Coord( GetWordEntry(index_form[i].first).GetKey(), index_form[i].second ) );
+
+ return true;
+}
+
+
 WordFormEnumerator* WordEntries_File::ListWordForms_Globbing( const lem::UFString &mask )
 {
  lem::UFString umask(mask);
@@ -380,12 +465,14 @@ void WordEntries_File::SaveBin( lem::Stream &bin ) const
  epos_begin_pos = bin.tellp();
  entry_pos_tmp.SaveBin(bin);
 
+ //   -  (,)   .
  lem::MCollect< std::pair<int,int> > key_to_index_tmp;
- key_to_index_tmp.reserve(key_to_index.size());
- for( std::map< int/*entry_key*/, int/*entry_index*/ >::const_iterator it=key_to_index.begin(); it!=key_to_index.end(); ++it )
-  {
-   key_to_index_tmp.push_back(*it);
-  }
+ key_to_index_tmp.reserve(entry.size());
+ for( lem::Container::size_type key=0; key<key_to_index.size(); ++key )
+  if( key_to_index[key]!=UNKNOWN )
+   {
+    key_to_index_tmp.push_back( std::make_pair( CastSizeToInt(key), key_to_index[key] ) );
+   }
  key_to_index_tmp.SaveBin(bin);
 
  lem::MCollect<Lexem> ML_fronts_tmp;
@@ -444,6 +531,7 @@ void WordEntries_File::LoadBin( lem::Stream &bin )
   }
 */
  lookup_table.LoadBin(bin);
+ lookup_table.BuildSlotIndex();
 
 /*
 // #if LEM_DEBUGGING==1
@@ -492,8 +580,14 @@ void WordEntries_File::LoadBin( lem::Stream &bin )
 
    lem::MCollect< std::pair<int,int> > key_to_index_tmp;
    key_to_index_tmp.LoadBin(bin);
-   for( lem::Container::size_type i=0; i<key_to_index_tmp.size(); ++i )
-    key_to_index.insert( key_to_index_tmp[i] );
+   if( !key_to_index_tmp.empty() )
+    {
+     //    ,     - .
+     key_to_index.resize( key_to_index_tmp.back().first+1 );
+     key_to_index.fill(UNKNOWN);
+     for( lem::Container::size_type i=0; i<key_to_index_tmp.size(); ++i )
+      key_to_index[ key_to_index_tmp[i].first ] = key_to_index_tmp[i].second;
+    }
 
    lem::MCollect<Lexem> ML_tmp;
    ML_tmp.LoadBin(bin);
@@ -522,7 +616,7 @@ void WordEntries_File::LoadBin( lem::Stream &bin )
 
    for( lem::Container::size_type ie=0; ie<entry.size(); ie++ )
     {
-     key_to_index.insert( std::make_pair( entry[ ientry[ie] ]->GetKey(), ie ) );
+     IndexEntryKey( entry[ ientry[ie] ]->GetKey(), CastSizeToInt(ie) );
     }
 
    coord_ref.AllAttached();
@@ -557,6 +651,9 @@ void WordEntries_File::LoadBin( lem::Stream &bin )
 
  bin.seekp( end_pos );
 
+ lookup_entries_count = n_entry;
+ fuzzy_index.Clear();
+
  return;
 }
 
@@ -704,8 +801,8 @@ int WordEntries_File::AddEntry( SG_Entry *e )
  int cls = e->GetClass();
  #endif
 
- LEM_CHECKIT_Z( key_to_index.find(e->GetKey())==key_to_index.end() );
- key_to_index.insert( std::make_pair( e->GetKey(), ientry.size() ) );
+ LEM_CHECKIT_Z( FindEntryIndexByKey(e->GetKey())==UNKNOWN );
+ IndexEntryKey( e->GetKey(), CastSizeToInt(ientry.size()) );
 
  ientry.push_back( CastSizeToInt(entry.size()) );
  entry.push_back( e );
@@ -796,17 +893,18 @@ void WordEntries_File::DetailedReport( OFormatter &txtfile )
 
  txtfile.printf(
                 "Multilexem dictionary contains %d unique items\n"
-                , ml_ref.get_list().size()
+                , ml_ref.size()
                );
 
  int n_real=0; //   
  int max_len=0;
- for( lem::Container::size_type i=0; i<ml_ref.get_list().size(); i++ )
+ for( lem::Container::size_type i=0; i<ml_ref.size(); i++ )
   {
-   if( ml_ref.get_list()[i].Count_Lexems()>1 )
+   const Lexem l( ml_ref.GetString(CastSizeToInt(i)) );
+   if( l.Count_Lexems()>1 )
     n_real++;
 
-   max_len = std::max( max_len, ml_ref.get_list()[i].length() );
+   max_len = std::max( max_len, l.length() );
   }
 
 
@@ -814,9 +912,12 @@ void WordEntries_File::DetailedReport( OFormatter &txtfile )
 
  txtfile.printf( "Max length of a lexem=%d\n", max_len );
 
- for( lem::Container::size_type i4=0; i4<ml_ref.get_list().size(); i4++ )
-  if( ml_ref.get_list()[i4].Count_Lexems()>1 )
-   txtfile.printf( "%us\n", ml_ref.get_list()[i4].c_str() );
+ for( lem::Container::size_type i4=0; i4<ml_ref.size(); i4++ )
+  {
+   const Lexem l( ml_ref.GetString(CastSizeToInt(i4)) );
+   if( l.Count_Lexems()>1 )
+    txtfile.printf( "%us\n", l.c_str() );
+  }
 
  txtfile.printf( "%10h- END OF MULTILEXEM DICTIONARY %10h-\n" );
 
@@ -1042,7 +1143,7 @@ void WordEntries_File::SortUp(void)
 
  key_to_index.clear();
  for( lem::Container::size_type ie=0; ie<entry.size(); ie++ )
-  key_to_index.insert( std::make_pair( GetWordEntry(ie).GetKey(), ie ) );
+  IndexEntryKey( GetWordEntry(ie).GetKey(), CastSizeToInt(ie) );
 
  //  .
 
@@ -1099,38 +1200,35 @@ void WordEntries_LookUp::InitLexems( const LexemDictionary & lexems )
  for( lem::Container::size_type i=0; i<lexem2index.size(); ++i )
   sorted_lexem_index.push_back( lexem2index[i].second );
 
+ BuildSlotIndex();
+
  return;
 }
 
 
+void WordEntries_LookUp::BuildSlotIndex(void)
+{
+ lexem_to_slot.clear();
+ lexem_to_slot.resize( sorted_lexem_index.size() );
+ for( lem::Container::size_type i=0; i<lexem_to_slot.size(); ++i )
+  lexem_to_slot[i] = UNKNOWN;
+
+ for( lem::Container::size_type i=0; i<sorted_lexem_index.size(); ++i )
+  lexem_to_slot[ sorted_lexem_index[i] ] = CastSizeToInt(i);
+
+ return;
+}
+
+
+//    - ,    
+//     .
 int WordEntries_LookUp::Findlexem( const LexemDictionary & lexems, const lem::UCString & lexem ) const
 {
- if( !sorted_lexem_index.empty() )
-  {
-   int ileft=0, iright=CastSizeToInt( sorted_lexem_index.size() )-1;
-   while( (iright-ileft)>1 )
-    {
-     const int imid = (iright+ileft)/2;
-     const Lexem & l = lexems[ sorted_lexem_index[imid] ];
-     if( lexem < l )
-      ileft = imid;
-     else if( lexem > l )
-      iright = imid;
-     else
-      return imid;
-    }
+ const int id = lexems.FindId(lexem);
+ if( id==UNKNOWN || id>=CastSizeToInt(lexem_to_slot.size()) )
+  return UNKNOWN;
 
-   if( lexems[ sorted_lexem_index[ileft] ] == lexem )
-    return ileft;
-   else if( lexems[ sorted_lexem_index[iright] ] == lexem )
-    return iright;
-   else
-    return UNKNOWN;
-  }
- else
-  {
-   return UNKNOWN;
-  }
+ return lexem_to_slot[id];
 }
 
 
@@ -1139,6 +1237,7 @@ void WordEntries_LookUp::Clear()
  lexem_slot.clear();
  entry_index.clear();
  sorted_lexem_index.clear();
+ lexem_to_slot.clear();
  return;
 }
 
@@ -1276,6 +1375,9 @@ void WordEntries_File::BuildLookUpTable(void)
     }
   }
 
+ lookup_entries_count = nword;
+ fuzzy_index.Clear();
+
 /* 
  lem::Ptr<SymbolEnumerator> senum( gg.entries().Enumerate() );
  int max_id_char=0;
@@ -1460,16 +1562,37 @@ const SG_Entry& WordEntries_File::GetEntryByKey( int key )
 
 int WordEntries_File::FindEntryIndexByKey( int key ) const
 {
- #if LEM_DEBUGGING==1
-  if(
-     key==UNKNOWN ||
-     !key_to_index.count(key) ||
-     key_to_index.find(key) == key_to_index.end()
-    )
-   throw E_RunTime();
- #endif
+ if( key<0 || key>=CastSizeToInt(key_to_index.size()) )
+  return UNKNOWN;
     
- return key_to_index.find(key)->second;
+ return key_to_index[key];
+}
+
+
+void WordEntries_File::IndexEntryKey( int key, int index )
+{
+ LEM_CHECKIT_Z( key>=0 );
+
+ if( key>=CastSizeToInt(key_to_index.size()) )
+  {
+   const int n0 = CastSizeToInt(key_to_index.size());
+   key_to_index.resize( std::max( key+1, n0+n0/2 ) );
+   for( int i=n0; i<CastSizeToInt(key_to_index.size()); ++i )
+    key_to_index[i] = UNKNOWN;
+  }
+
+ key_to_index[key] = index;
+ return;
+}
+
+
+void WordEntries_File::ListEntryKeys( lem::MCollect<int> &keys ) const
+{
+ for( lem::Container::size_type key=0; key<key_to_index.size(); ++key )
+  if( key_to_index[key]!=UNKNOWN )
+   keys.push_back( CastSizeToInt(key) );
+
+ return;
 }
 
 int WordEntries_File::size(void) const
@@ -1634,7 +1757,7 @@ int WordEntries_File::LoadEntry( lem::StrParser<lem::UFString> &txt )
  entry.push_back(e);
 
  //      
- key_to_index.insert( std::make_pair(e->GetKey(),ie) );
+ IndexEntryKey( e->GetKey(), ie );
 
  // TODO ...
  LEM_STOPIT;
@@ -1701,21 +1824,95 @@ const IntCollect& WordEntries_File::GetUEntries(void)
 }
 
 
+//     entry   .   
+//      ,    
+// ,      - .
+static inline void EntryFence(void)
+{
+ #if defined LEM_THREADS
+  #if defined LEM_WINDOWS
+  MemoryBarrier();
+  #elif defined __GNUC__
+  __sync_synchronize();
+  #endif
+ #endif
+}
+
+
+// ,   ,  .  
+//        ,   false
+//     .
+bool WordEntries_File::PublishEntry( int index, SG_Entry *e )
+{
+ SG_Entry **slot = &entry[index];
+
+ #if defined LEM_THREADS
+  #if defined LEM_WINDOWS
+  return InterlockedCompareExchangePointer( (PVOID volatile*)slot, e, NULL )==NULL;
+  #elif defined __GNUC__
+  return __sync_bool_compare_and_swap( slot, (SG_Entry*)NULL, e );
+  #else
+  lem::Process::CritSecLocker lock(&cs);
+  if( *slot!=NULL )
+   return false;
+  *slot = e;
+  return true;
+  #endif
+ #else
+ *slot = e;
+ return true;
+ #endif
+}
+
+
 void WordEntries_File::LoadEntry( int index )
 {
  if( !lazy_load )
   return;
 
+ if( *(SG_Entry* const volatile*)&entry[index]!=NULL )
+  {
+   EntryFence();
+   return;
+  }
+
+ if( entries_map.IsOpen() )
+  {
+   //          ,
+   //         ,   .
+   const lem::uint64_t pos = entries_offset+entry_pos[index];
+   if( pos>=entries_map.Size() )
+    {
+     lem::MemFormatter msg;
+     msg.printf( "Entry #%d at offset %qd is out of the entries file %us", index, lem::int64_t(pos), entries_path.GetUnicode().c_str() );
+     throw E_BaseException( msg.string() );
+    }
+
+   lem::MemReadStream rdr( entries_map.Data()+pos, size_t(entries_map.Size()-pos) );
+
+   SG_Entry *e = new SG_Entry();
+   e->LoadBin(rdr);
+   e->ReattachToRefs(*sg);
+
+   if( !PublishEntry( index, e ) )
+    delete e;
+
+   return;
+  }
+
  #if defined LEM_THREADS
  lem::Process::CritSecLocker lock(&cs);
  #endif
 
- if( entry[index]==NULL )
+ const bool loaded = *(SG_Entry* const volatile*)&entry[index]!=NULL;
+ EntryFence();
+
+ if( !loaded )
   {
    if( entries_bin.IsNull() )
     entries_bin = new lem::BinaryReader(entries_path);
 
-   entries_bin->seekp( entry_pos[index] );
+   entries_bin->seekp64( entries_offset+entry_pos[index] );
    SG_Entry *e = new SG_Entry();
    e->LoadBin(*entries_bin);
 
@@ -1738,17 +1935,38 @@ void WordEntries_File::LoadEntry( int index )
       }
     }
    */
-   entry[index] = e;
+   EntryFence();
+   *(SG_Entry* volatile*)&entry[index] = e;
   }
 
  return;
 }
 
 
-void WordEntries_File::SetLazyLoad( const lem::Path & morphology_path )
+//        ,    
+//  -  offset   .
+void WordEntries_File::SetLazyLoad( const lem::Path & morphology_path, lem::uint64_t offset )
 {
  lazy_load = true;
  entries_path = morphology_path;
+ entries_offset = offset;
+
+ entries_map.Close();
+ if( use_entry_mapping )
+  entries_map.Open(entries_path);
+
+ return;
+}
+
+
+void WordEntries_File::SetEntryMapping( bool f )
+{
+ use_entry_mapping = f;
+
+ entries_map.Close();
+ if( use_entry_mapping && lazy_load )
+  entries_map.Open(entries_path);
+
  return;
 }
 
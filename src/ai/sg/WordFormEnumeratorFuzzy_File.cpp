@@ -5,6 +5,16 @@
 using namespace Solarix;
 
 
+namespace {
+ //      :     ,
+ //    -   .
+ static bool index_form_sorter( const std::pair<int,int> & x, const std::pair<int,int> & y )
+ {
+  return x.first!=y.first ? x.first>y.first : x.second<y.second;
+ }
+}
+
+
 WordFormEnumeratorFuzzy_File::WordFormEnumeratorFuzzy_File(
                                                            WordEntries_File * _entries,
                                                            const lem::UCString &_mask,
@@ -21,18 +31,59 @@ WordFormEnumeratorFuzzy_File::WordFormEnumeratorFuzzy_File(
 void WordFormEnumeratorFuzzy_File::Prefetch(void)
 {
  const Solarix::LexemDictionary &lex0 = entries->ml_ref;
- const MCollect<Solarix::Lexem> &lex = lex0.get_list();
 
  int min_ival = int(100*min_val);
 
- std::map<const Solarix::Lexem*,int> ptr_lex;
- for( lem::Container::size_type i=0; i<lex.size(); ++i )
+ //     ->  .
+ std::map<int,int> id_lex;
+
+ //  get_like_percent  100-100*d/min(len1,len2),  d -  ,
+ //   l>min_ival    d<=(100-min_ival)*len(mask)/100. 
+ //     ,     .
+ const int max_dist = (100-min_ival)*mask.length()/100;
+
+ lem::MCollect<int> ilexems;
+ if( entries->FindFuzzyLexemes( mask, max_dist, ilexems ) )
+  {
+   lem::MCollect< std::pair<int,int> > index_form;
+
+   for( lem::Container::size_type i=0; i<ilexems.size(); ++i )
+    {
+     const lem::UCString lexem = lex0.GetString( ilexems[i] );
+     const int l = lem::Fuzzy::get_like_percent( (const lem::UCString&)mask, lexem );
+
+     if( l>min_ival )
+      {
+       id_lex.insert( std::make_pair( ilexems[i], l ) );
+       entries->ListLexemeForms( ilexems[i], index_form );
+      }
+    }
+
+   std::sort( index_form.begin(), index_form.end(), index_form_sorter );
+
+   for( lem::Container::size_type i=0; i<index_form.size(); ++i )
+    {
+     const Solarix::SG_Entry &e = entries->GetWordEntry( index_form[i].first );
+     const int id = lex0.GetId( &e.forms()[ index_form[i].second ].name() );
+
+     WordFormEnumeratorListing_File::Hit h;
+     h.ekey = e.GetKey();
+     h.iform = index_form[i].second;
+     h.val = 0.01F*id_lex.find(id)->second;
+     hits.push_back( h );
+    }
+
+   std::stable_sort( hits.begin(), hits.end(), WordFormEnumeratorListing_File::HitsComparator );
+   return;
+  }
+
+ for( int i=0; i<CastSizeToInt(lex0.size()); ++i )
   {
-   const int l = lem::Fuzzy::get_like_percent( (const lem::UCString&)mask, (const lem::UCString&)lex[i] );
+   const int l = lem::Fuzzy::get_like_percent( (const lem::UCString&)mask, lex0.GetString(i) );
 
    if( l>min_ival )
     {
-     ptr_lex.insert( std::make_pair( &lex[i], l ) );
+     id_lex.insert( std::make_pair( i, l ) );
     }
   }
 
@@ -47,10 +98,10 @@ void WordFormEnumeratorFuzzy_File::Prefetch(void)
    for( lem::Container::size_type j=0; j<e.forms().size(); ++j )
     {
      const SG_EntryForm &f = e.forms()[j];
-     const Solarix::Lexem *ptr = &f.name();
+     const int id = lex0.GetId( &f.name() );
 
-     std::map<const Solarix::Lexem*,int>::const_iterator it=ptr_lex.find(ptr);
-     if( it!=ptr_lex.end() )
+     std::map<int,int>::const_iterator it=id_lex.find(id);
+     if( it!=id_lex.end() )
       {
        const int l = it->second; //   0...100
        WordFormEnumeratorListing_File::Hit h;
@@ -20,14 +20,14 @@ WordFormEnumeratorGlobbing_File::WordFormEnumeratorGlobbing_File(
 void WordFormEnumeratorGlobbing_File::Prefetch(void)
 {
  const Solarix::LexemDictionary &lex0 = entries->ml_ref;
- const MCollect<Solarix::Lexem> &lex = lex0.get_list();
 
- std::set<const Solarix::Lexem*> ptr_lex;
- for( lem::Container::size_type i=0; i<lex.size(); ++i )
+ //    ,  Lexem    .
+ std::set<int> id_lex;
+ for( int i=0; i<CastSizeToInt(lex0.size()); ++i )
   {
-   if( lem::regex_match( mask.c_str(), lex[i].c_str() ) )
+   if( lem::regex_match( mask.c_str(), lex0.GetString(i).c_str() ) )
     {
-     ptr_lex.insert( &lex[i] );
+     id_lex.insert( i );
     }
   }
 
@@ -39,10 +39,10 @@ void WordFormEnumeratorGlobbing_File::Prefetch(void)
    for( lem::Container::size_type j=0; j<e.forms().size(); ++j )
     {
      const SG_EntryForm &f = e.forms()[j];
-     const Solarix::Lexem *ptr = &f.name();
+     const int id = lex0.GetId( &f.name() );
 
-     std::set<const Solarix::Lexem*>::const_iterator it=ptr_lex.find(ptr);
-     if( it!=ptr_lex.end() )
+     std::set<int>::const_iterator it=id_lex.find(id);
+     if( it!=id_lex.end() )
       {
        WordFormEnumeratorListing_File::Hit h;
        h.ekey = e.GetKey();
@@ -67,11 +67,13 @@
 #include <lem/solarix/CriteriaInStorage.h>
 #include <lem/solarix/LanguageUsage.h>
 #include <lem/solarix/prefix_tree.h>
+#include <lem/solarix/CharTrie.h>
 #include <lem/solarix/dsa_main.h>
 #include <lem/solarix/Paradigma.h>
 #include <lem/solarix/SG_Calibrator.h>
 #include <lem/solarix/MetaEntry.h>
 #include <lem/solarix/ExactWordEntryLocator.h>
+#include <lem/solarix/WordRecognitionCache.h>
 #include <lem/solarix/sg_autom.h>
 
 
@@ -101,6 +103,7 @@ SynGram::SynGram( Dictionary & dict, const Dictionary_Config &cfg )
 
  #if defined SOL_CAA
  prefix_tree = NULL;
+ prefix_trie = NULL;
  #endif
 
  internal_offset_buffer = cfg.internal_offset;
@@ -118,6 +121,7 @@ SynGram::~SynGram(void)
  lem_rub_off(lang_usage);
 
  #if defined SOL_CAA
+ lem_rub_off(prefix_trie);
  lem_rub_off(prefix_tree);
  #endif
 
@@ -1126,6 +1130,9 @@ bool x4= DetectInternalFlexion( L"
 */
  word_entries->AddEntry(e);
 
+ //         .
+ GetDict().GetRecognitionCache().Invalidate();
+
  //   .
  lem::MCollect<lem::UCString> endings;
 
@@ -1313,6 +1320,7 @@ void SynGram::LoadEntry(
        dummy->SetKey( new_ekey );
 
        word_entries->ReplaceEntry( ie, dummy );
+       GetDict().GetRecognitionCache().Invalidate();
 
        if( !GetDict().GetCurrentOriginator().empty() && lem::LogFile::IsOpen() )
         {
@@ -2127,6 +2135,29 @@ const CharNode& SynGram::GetPrefixTree(void)
 }
 
 
+//        ().
+const CharTrie& SynGram::GetPrefixTrie(void)
+{
+ const CharNode &tree = GetPrefixTree();
+
+ #if defined LEM_THREADS
+ lem::Process::RWU_ReaderGuard rlock(cs_prefix_tree);
+ #endif
+
+ if( prefix_trie==NULL )
+  {
+   #if defined LEM_THREADS
+   lem::Process::RWU_WriterGuard wlock(rlock);
+   #endif
+
+   if( prefix_trie==NULL )
+    prefix_trie = new CharTrie(tree);
+  }
+
+ return *prefix_trie;
+}
+
+
 CharNode* SynGram::GetPrefixTreeForAllLanguages(void)
 {
  return word_entries->GetPrefixTreeForAllLanguages();
@@ -2192,7 +2223,9 @@ bool SynGram::IsOmonym( int iclass, const lem::UCString & ename ) const
 #if defined SOL_LOADTXT
 int SynGram::LoadEntry( lem::StrParser<lem::UFString> &txt )
 {
- return word_entries->LoadEntry(txt);
+ const int ekey = word_entries->LoadEntry(txt);
+ GetDict().GetRecognitionCache().Invalidate();
+ return ekey;
 }
 #endif
 
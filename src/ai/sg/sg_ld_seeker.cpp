@@ -82,7 +82,7 @@ void LD_Seeker::Clear(void)
 static const LexemDictionary *Ref=NULL;
 static bool HashComp( int a, int b )
 {
- return Ref->get_list()[a].GetHash() > Ref->get_list()[b].GetHash();
+ return Ref->GetString(a).GetHash() > Ref->GetString(b).GetHash();
 }
 
 //int LD_Seeker::Calc_Hash( const UCString &s ) const
@@ -126,18 +126,14 @@ LD_Seeker::LD_Seeker( const LexemDictionary *ptr, LexicalAutomat *La, SynGram &s
  la = La;
  Allocate();
 
- ilexem_2_ientry.resize( ptr->get_list().size() );
+ ilexem_2_ientry.resize( ptr->size() );
 
- std::map< const Lexem*, int > lex_2_index;
- typedef std::map< const Lexem*, int >::const_iterator ITER2;
-
- for( lem::Container::size_type i1=0; i1<ptr->get_list().size(); ++i1 )
+ for( lem::Container::size_type i1=0; i1<ptr->size(); ++i1 )
   {
 //   list.insert( std::make_pair( Calc_Hash( ptr->get_list()[i] ), i ) );
 
-   hash_2_ilexem[ ptr->get_list()[i1].GetHash16() ].push_back(i1);
+   hash_2_ilexem[ ptr->GetString( CastSizeToInt(i1) ).GetHash16() ].push_back(i1);
 
-   lex_2_index.insert( std::make_pair( &ptr->get_list()[i1], i1 ) );
    ilexem_2_ientry[i1] = UNKNOWN; 
   }
 
@@ -177,17 +173,14 @@ for( int i=0; i<65536; ++i )
 
    for( lem::Container::size_type iform=0; iform<e.forms().size(); iform++ )
     {
-     //    .
-     const Lexem *form = &e.forms()[iform].name();
- 
-     ITER2 it = lex_2_index.find( form );
+     //        .
+     const int ilexem = ptr->GetId( &e.forms()[iform].name() );
 
-     if( it!=lex_2_index.end() )
-      ilexem_2_ientry[ it->second ] = ekey;
+     if( ilexem!=UNKNOWN )
+      ilexem_2_ientry[ ilexem ] = ekey;
     }
   }
 
- lex_2_index.clear();
 /*
  for( ITER i=list.begin(); i!=list.end(); i++ )
   {
@@ -284,118 +277,17 @@ mout->printf( "\nmin=%d max=%d average=%d\n", minn, maxn, avrg/65536 );
    }
 
 */
-//int iii =  Calc_Hash(x);
- #if LEM_DEBUGGING==1
- const int xi = x.GetHash16(); 
- #endif
-
- const lem::MCollect<int> &hlist = hash_2_ilexem[ x.GetHash16() ];
-
- #if LEM_DEBUGGING==1
- const int nx = hlist.size();
- #endif
-
- if( !hlist.empty() )
-  {
-   // ,      hlist,   
-   //   .      
-   //    
-   const UCString::hash_type H = x.GetHash();
-
-   int i0 = 0; 
-   int i1 = CastSizeToInt(hlist.size())-1;
-   int h0 = ld->get_list()[ hlist.front() ].GetHash();
-   int h1 = ld->get_list()[ hlist.back() ].GetHash();
-
-/*
-for( int i=0; i<hlist.size(); i++ )
- {
-  int ilexem = hlist[i];
-  mout->printf( " %us ", ld->get_list()[ilexem].c_str() );
- }
-*/
-
-   //     -
-   if( h0==h1 )
-    {
-     for( Container::size_type i=0; i<hlist.size(); i++ )
-      {
-       int ilexem = hlist[i];
-   
-//const UCString &l = ld->get_list()[ilexem];
-//const int h16 = Calc_Hash(l);
-
-       if( ld->get_list()[ilexem]==x )
-        //       -   
-        //    ,      
-        // .        
-        //  . 
-        return ilexem_2_ientry[ilexem];
-       }
-    }
-   else
-    {
-     int i_pos=UNKNOWN;
-
-     while(true)
-      {
-       if( (i1-i0)<4 )
-        {
-         for( int i=i0; i<=i1; i++ )
-          if( ld->get_list()[ hlist[i] ].GetHash() == H )
-           {
-            i_pos = i;
-            break;   
-           }
-
-         break;
-        }
-
-       int i_mid = (i1+i0)/2;
-       int h_mid = ld->get_list()[ hlist[i_mid] ].GetHash();
-
-       if( h_mid == H )
-        {
-         i_pos = i_mid;
-         break; 
-        }
-
-       if( h_mid < H )
-        {
-         i1 = i_mid;
-         h1 = h_mid;
-        }
-       else
-        {
-         i0 = i_mid;
-         h0 = h_mid;
-        }
-      }
-
-     if( i_pos!=UNKNOWN )
-      {
-       //  ,      .
-
-       while( i_pos>0 )
-        if( ld->get_list()[ hlist[i_pos-1] ].GetHash()!=H )
-         break;
-        else
-         i_pos--; 
-
-       //       
-       while( i_pos<CastSizeToInt(hlist.size()) )
-        if( ld->get_list()[ hlist[i_pos] ].GetHash()!=H )
-         break;
-        else if( ld->get_list()[ hlist[i_pos] ] == x )
-         {
-//mout->printf( "[%us]\n", ld->get_list()[ hlist[i_pos] ].c_str() );
-          return ilexem_2_ientry[ hlist[i_pos] ];
-         } 
-        else
-         i_pos++;  
-      }
-    }
-  }
+ //     :     
+ // ,    Lexem   . 
+ // hash_2_ilexem     ,     
+ //     .
+ const int ilexem = ld->FindId(x);
+ if( ilexem!=UNKNOWN && ilexem<CastSizeToInt(ilexem_2_ientry.size()) )
+  //       -   
+  //    ,      
+  // .        
+  //  . 
+  return ilexem_2_ientry[ilexem];
 
 
  if( dynforms )
@@ -442,9 +334,9 @@ bool LD_Seeker::Normalize( const UCString &word, UCString &normalized ) const
 bool LD_Seeker::FindRoots( const UCString &x, std::set<int> &result ) const
 {
  bool found=false;
- for( lem::Container::size_type i=0; i<ld->get_list().size(); i++ )
+ for( lem::Container::size_type i=0; i<ld->size(); i++ )
   {
-   const UCString &kw = ld->get_list()[i];
+   const UCString kw = ld->GetString( CastSizeToInt(i) );
 
    if( kw.eq_beg(x) )
     {  
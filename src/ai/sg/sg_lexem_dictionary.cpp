@@ -1,177 +1,401 @@
-// -----------------------------------------------------------------------------
-// File SG_LEXEM_DICTIONARY.CPP
-//
-// (c) by Elijah Koziev
-//
-// Content:
-// SOLARIX Intellectronix Project  http://www.solarix.ru
-//
-//  LexemDictionary -    .
-// -----------------------------------------------------------------------------
-//
-// CD->06.08.2005
-// LC->24.11.2010
-// --------------
-
-#include <lem/solarix/dictionary.h>
-#include <lem/solarix/sg_autom.h>
-#include <lem/solarix/LexemDictionary.h>
-
-using namespace std;
-using namespace lem;
-using namespace Solarix;
-
-
-LexemDictionary::LexemDictionary( int Reserve ):SolidRef<Lexem>(Reserve)
-{}
-
+// -----------------------------------------------------------------------------
+// File SG_LEXEM_DICTIONARY.CPP
+//
+// (c) by Elijah Koziev
+//
+// Content:
+// SOLARIX Intellectronix Project  http://www.solarix.ru
+//
+//  LexemDictionary -    .
+// -----------------------------------------------------------------------------
+//
+// CD->06.08.2005
+// LC->16.10.2026
+// --------------
+
+#include <new>
+#include <string.h>
+#include <lem/solarix/dictionary.h>
+#include <lem/solarix/sg_autom.h>
+#include <lem/solarix/LexemDictionary.h>
+
+using namespace std;
+using namespace lem;
+using namespace Solarix;
+
+
+namespace
+{
+ //       ,   
+ //       .
+ inline void MemoryFence(void)
+ {
+  #if defined LEM_THREADS
+   #if defined LEM_WINDOWS
+   MemoryBarrier();
+   #elif defined __GNUC__
+   __sync_synchronize();
+   #endif
+  #endif
+ }
+}
+
+
+LexemDictionary::LexemDictionary( int Reserve )
+ : pool_image(NULL), pool_image_size(0), save_pool_image(false),
+   capacity(0), items(NULL), built(NULL), old_first_item(NULL)
+{
+ LEM_CHECKIT_Z( Reserve>=0 );
+
+ #if defined SOL_LOADTXT
+ next_pool_build = 1024;
+ #endif
+
+ Allocate(Reserve);
+ return;
+}
+
+
 LexemDictionary::~LexemDictionary(void)
-{}
-
-
-LD_Seeker* LexemDictionary::Get_Seeker( SynGram &sg, LexicalAutomat *la )
-{
- return new LD_Seeker(this,la,sg);
-}
-
-
-#if defined SOL_LOADBIN
+{
+ DestroyItems();
+ ::operator delete(items);
+ delete[] built;
+}
+
+
+void LexemDictionary::Allocate( int n )
+{
+ DestroyItems();
+ ::operator delete(items);
+ delete[] built;
+
+ //        ,   
+ //      .   
+ // ,  ,     ,  
+ //  .
+ capacity = n;
+ items = n>0 ? static_cast<Lexem*>( ::operator new( size_t(n)*sizeof(Lexem) ) ) : NULL;
+
+ const int n_block = (n+BLOCK_SIZE-1)>>BLOCK_SHIFT;
+ built = new lem::uint8_t[ n_block+1 ];
+ memset( built, 0, n_block+1 );
+
+ return;
+}
+
+
+void LexemDictionary::DestroyItems(void)
+{
+ if( built==NULL )
+  return;
+
+ const int n_block = (capacity+BLOCK_SIZE-1)>>BLOCK_SHIFT;
+ for( int iblock=0; iblock<n_block; ++iblock )
+  {
+   Lexem *block = items + (iblock<<BLOCK_SHIFT);
+   for( int k=0; k<built[iblock]; ++k )
+    block[k].~Lexem();
+
+   built[iblock]=0;
+  }
+
+ return;
+}
+
+
+//      Lexem .   .
+void LexemDictionary::BuildBlock( int iblock ) const
+{
+ const int i0 = iblock<<BLOCK_SHIFT;
+ const int n = std::min( int(BLOCK_SIZE), CastSizeToInt(size())-i0 );
+
+ int k = built[iblock];
+ if( k>=n )
+  return;
+
+ for( ; k<n; ++k )
+  new( items+i0+k ) Lexem( pool.Get(i0+k) );
+
+ MemoryFence();
+ ((volatile lem::uint8_t*)built)[iblock] = lem::uint8_t(k);
+
+ return;
+}
+
+
+const Lexem* LexemDictionary::Materialize( int id ) const
+{
+ LEM_CHECKIT_Z( id>=0 && id<CastSizeToInt(size()) );
+
+ const int iblock = id>>BLOCK_SHIFT;
+
+ #if defined LEM_THREADS && !defined LEM_WINDOWS && !defined __GNUC__
+ lem::Process::CritSecLocker lock(&cs_items);
+ BuildBlock(iblock);
+ #else
+ //     ,    
+ //  .
+ if( ((const volatile lem::uint8_t*)built)[iblock] > (id&(BLOCK_SIZE-1)) )
+  MemoryFence();
+ else
+  {
+   #if defined LEM_THREADS
+   lem::Process::CritSecLocker lock(&cs_items);
+   #endif
+   BuildBlock(iblock);
+  }
+ #endif
+
+ return items+id;
+}
+
+
+#if defined SOL_LOADTXT
+const Lexem* LexemDictionary::Add( const Lexem &x )
+{
+ #if defined LEM_THREADS
+ lem::Process::CritSecLocker lock(&cs_items);
+ #endif
+
+ int id = pool.Find(x);
+ if( id==-1 )
+  {
+   //  , -   
+   //       
+   // .
+   if( CastSizeToInt(size())==capacity )
+    throw lem::E_BaseException( L"Insufficient space in LexemDictionary!\n" );
+
+   id = pool.Add(x);
+
+   //       ,   
+   //    -.
+   if( CastSizeToInt(size())>=next_pool_build )
+    {
+     pool.Build();
+     next_pool_build = CastSizeToInt(size())*3/2 + 1024;
+    }
+  }
+
+ BuildBlock( id>>BLOCK_SHIFT );
+ return items+id;
+}
+#endif
+
+
+const Lexem* LexemDictionary::Find( const Lexem &x ) const
+{
+ const int id = FindId(x);
+ return id==UNKNOWN ? NULL : Materialize(id);
+}
+
+
+int LexemDictionary::FindId( const lem::UCString &x ) const
+{
+ const int id = pool.Find(x);
+ return id==-1 ? UNKNOWN : id;
+}
+
+
+int LexemDictionary::GetId( const Lexem *ptr ) const
+{
+ if( ptr==NULL || ptr<items || ptr>=items+size() )
+  return UNKNOWN;
+
+ return CastSizeToInt( ptr-items );
+}
+
+
+const Lexem* LexemDictionary::reattach( const Lexem *Old_Ptr ) const
+{
+ if( !Old_Ptr )
+  return &null_item;
+
+ //          ,  
+ //   ,       -
+ //  .
+ LEM_CHECKIT_Z( Old_Ptr>=old_first_item );
+
+ const int i_old = CastSizeToInt( Old_Ptr - old_first_item );
+ return Materialize(i_old);
+}
+
+
+int LexemDictionary::CountMaterialized(void) const
+{
+ int n=0;
+ const int n_block = (capacity+BLOCK_SIZE-1)>>BLOCK_SHIFT;
+ for( int iblock=0; iblock<n_block; ++iblock )
+  n += built[iblock];
+
+ return n;
+}
+
+
+//        -   
+//  .
+lem::uint64_t LexemDictionary::GetMemoryUsage(void) const
+{
+ const int n_block = (capacity+BLOCK_SIZE-1)>>BLOCK_SHIFT;
+ return pool.GetMemoryUsage() +
+        lem::uint64_t(CountMaterialized())*sizeof(Lexem) +
+        lem::uint64_t(n_block);
+}
+
+
+LD_Seeker* LexemDictionary::Get_Seeker( SynGram &sg, LexicalAutomat *la )
+{
+ return new LD_Seeker(this,la,sg);
+}
+
+
+#if defined SOL_LOADBIN
 LD_Seeker* LexemDictionary::Load_Seeker( lem::Stream &bin, LexicalAutomat *La )
 {
  LD_Seeker * seeker = new LD_Seeker( this, La );
  seeker->LoadBin(bin);
  return seeker;
 }
-#endif
-
-#if defined SOL_SAVEBIN
-// *******************************************************************
-//       -  
-// .      , 
-//  -     
-//  (  ).  ,    
-//     ---...
-// *******************************************************************
-void LexemDictionary::SaveBin( lem::Stream &bin ) const
-{
- const Lexem *first = &*list.begin();
- bin.write( &first, sizeof(first) );
-
- int n=list.size();
- bin.write( &n, sizeof(n) );
-
- for( Container::size_type i=0; i<list.size(); i++ )
-  {
-   const Lexem& l = list[i];
-
-   uint8_t packed=0, pack_flags=0;
-
-   // ,     .
-
-   if(
-      i &&                  //       
-                            // -    -  .
-
-      l.Can_Be_Packed( list[i-1], &pack_flags ) //  
-                                         //    -   
-                                         //   ,  
-                                         // .
-     )
-    packed = pack_flags;
-
-   bin.write( &packed, sizeof(packed) );
-
-   if( packed )
-    {
-     //   
-     l.SaveBin_Packed( bin, list[i-1], pack_flags );
-    }
-   else
-    {
-     //   
-     l.SaveBin(bin);
-    }
-  }
-
- //    
- lem::Stream::pos_type pos = bin.tellp();
- bin.write( &pos, sizeof(pos) );
-
- return;
-}
-#endif
-
-
-#if defined SOL_LOADBIN
-void LexemDictionary::LoadBin( lem::Stream &bin )
-{
- bin.read( &old_first_item, sizeof(old_first_item) );
-
- lem::Stream::pos_type beg_is = bin.tellp();
-
- int n=0;
- bin.read( &n, sizeof(n) );
-
- const int cap = CastSizeToInt(list.capacity());
- list.clear();
-
- #if defined SOL_LOADTXT && defined SOL_COMPILER
- Lexem prior;
-
- for( int i=0; i<n; i++ )
-  {
-   Lexem add;
-
-   uint8_t pack_flags;
-   bin.read( &pack_flags, sizeof(pack_flags) );
-   if( !pack_flags )
-    add.LoadBin(bin);
-   else
-    add.LoadBin_Packed( bin, prior, pack_flags );
-
-   const int iSublist = unsigned( get_hash(add) ) & 0x00ffU;
-   MCollect<int> &sl = sublist[iSublist];
-   sl.push_back( CastSizeToInt(list.size()) );
-
-   list.push_back(add);
-   prior = add;
-  }
- #else
-
- list.resize(n);
-
- if( cap>n )
-  list.reserve( cap );
-
- #if LEM_DEBUGGING==1
- const int cap2 = CastSizeToInt(list.capacity());
- #endif
-
- const Lexem * prior = NULL;
-
- for( int i=0; i<n; i++ )
-  {
-   Lexem & add = list[i];
-
-   uint8_t pack_flags;
-   bin.read( &pack_flags, sizeof(pack_flags) );
-   if( !pack_flags )
-    add.LoadBin(bin);
-   else
-    add.LoadBin_Packed( bin, *prior, pack_flags );
-
-   prior = &add;
-  }
-
- #endif
-
- lem::Stream::pos_type pos_is = bin.tellp();
-
- lem::Stream::pos_type pos;
- bin.read( &pos, sizeof(pos) );
-
- LEM_CHECKIT_Z( pos==pos_is );
-
- return;
-}
-#endif
+#endif
+
+#if defined SOL_SAVEBIN
+// *******************************************************************
+//       -  
+// .      , 
+//  -     
+//  (  ).  ,    
+//     ---...
+// *******************************************************************
+void LexemDictionary::SaveBin( lem::Stream &bin ) const
+{
+ //     ,     
+ //     .
+ const Lexem *first = items;
+ bin.write( &first, sizeof(first) );
+
+ int n=CastSizeToInt(size());
+ if( save_pool_image )
+  {
+   //        .
+   const int marker=POOL_IMAGE;
+   bin.write( &marker, sizeof(marker) );
+  }
+
+ bin.write( &n, sizeof(n) );
+
+ Lexem prior;
+ for( int i=0; i<n && !save_pool_image; i++ )
+  {
+   const Lexem l( pool.Get(i) );
+
+   uint8_t packed=0, pack_flags=0;
+
+   // ,     .
+
+   if(
+      i &&                  //       
+                            // -    -  .
+
+      l.Can_Be_Packed( prior, &pack_flags ) //  
+                                         //    -   
+                                         //   ,  
+                                         // .
+     )
+    packed = pack_flags;
+
+   bin.write( &packed, sizeof(packed) );
+
+   if( packed )
+    {
+     //   
+     l.SaveBin_Packed( bin, prior, pack_flags );
+    }
+   else
+    {
+     //   
+     l.SaveBin(bin);
+    }
+
+   prior = l;
+  }
+
+ //    
+ lem::Stream::pos_type pos = bin.tellp();
+ bin.write( &pos, sizeof(pos) );
+
+ return;
+}
+#endif
+
+
+#if defined SOL_LOADBIN
+void LexemDictionary::LoadBin( lem::Stream &bin )
+{
+ bin.read( &old_first_item, sizeof(old_first_item) );
+
+ int n=0;
+ bin.read( &n, sizeof(n) );
+
+ const bool use_pool_image = n==POOL_IMAGE;
+ if( use_pool_image )
+  bin.read( &n, sizeof(n) );
+
+ //       ,   
+ //     .
+ if( n>capacity )
+  Allocate(n);
+ else
+  DestroyItems();
+
+ pool.Clear();
+
+ if( use_pool_image )
+  {
+   //        , -
+   //    .
+   if( pool_image==NULL || !pool.AttachImage( pool_image, pool_image_size ) || pool.size()!=n )
+    throw lem::E_BaseException( L"Lexeme pool image is missing or damaged" );
+  }
+ else
+  pool.Reserve( n, 0 );
+
+ Lexem prior;
+
+ for( int i=0; i<n && !use_pool_image; i++ )
+  {
+   Lexem add;
+
+   uint8_t pack_flags;
+   bin.read( &pack_flags, sizeof(pack_flags) );
+   if( !pack_flags )
+    add.LoadBin(bin);
+   else
+    add.LoadBin_Packed( bin, prior, pack_flags );
+
+   pool.Append(add);
+   prior = add;
+  }
+
+ #if defined LEM_DEBUGON
+ const lem::Stream::pos_type pos_is = bin.tellp();
+ #endif
+
+ lem::Stream::pos_type pos;
+ bin.read( &pos, sizeof(pos) );
+
+ LEM_CHECKIT_Z( pos==pos_is );
+
+ if( !use_pool_image )
+  {
+   pool.Shrink();
+   pool.Build();
+  }
+
+ #if defined SOL_LOADTXT
+ next_pool_build = n*3/2 + 1024;
+ #endif
+
+ return;
+}
+#endif
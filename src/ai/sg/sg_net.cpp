@@ -64,6 +64,7 @@
 #include <lem/solarix/WordEntryEnumerator.h>
 #include <lem/solarix/SG_TagFilter.h>
 #include <lem/solarix/ExactWordEntryLocator.h>
+#include <lem/solarix/SG_NetGraph.h>
 
 using namespace lem;
 using namespace Solarix;
@@ -108,6 +109,8 @@ void SG_Net::SetStorage( ThesaurusStorage *_db, bool _do_delete )
  if( do_delete_storage )
   delete db;
 
+ PublishGraph(NULL);
+
  do_delete_storage = _do_delete;
  db = _db;
 
@@ -117,6 +120,61 @@ void SG_Net::SetStorage( ThesaurusStorage *_db, bool _do_delete )
 }
 
 
+void SG_Net::LoadGraph(void)
+{
+ LEM_CHECKIT_Z(db!=NULL);
+
+ #if defined LEM_THREADS
+ lem::Process::CritSecLocker guard(&cs_graph_edit);
+ #endif
+
+ PublishGraph( new SG_NetGraph(*db,*tag_sets) );
+ return;
+}
+
+
+void SG_Net::DropGraph(void)
+{
+ #if defined LEM_THREADS
+ lem::Process::CritSecLocker guard(&cs_graph_edit);
+ #endif
+
+ PublishGraph(NULL);
+ return;
+}
+
+
+bool SG_Net::IsGraphLoaded(void)
+{
+ return GetGraph().get()!=NULL;
+}
+
+
+boost::shared_ptr<const SG_NetGraph> SG_Net::GetGraph(void)
+{
+ #if defined LEM_THREADS
+ lem::Process::CritSecLocker guard(&cs_graph);
+ #endif
+
+ return graph;
+}
+
+
+// Замена снимка. Прежний снимок удаляется, когда его отпустит последний
+// читатель, и не под cs_graph.
+void SG_Net::PublishGraph( const SG_NetGraph *g )
+{
+ boost::shared_ptr<const SG_NetGraph> new_graph(g);
+
+ #if defined LEM_THREADS
+ lem::Process::CritSecLocker guard(&cs_graph);
+ #endif
+
+ graph.swap(new_graph);
+ return;
+}
+
+
 // ************************************************************
 // Сколько связок заданного типа зарегистрировано в тезаурусе.
 // В расчет берутся связи между словами и между фразами.
@@ -154,7 +212,18 @@ int SG_Net::CountAllLinks(void) const
 
 int SG_Net::AddWordLink( const SG_NetLink &lnk )
 {
- return db->AddWordLink( lnk.GetEntryKey0(), lnk.GetEntryKey1(), lnk.GetLink().GetState(), lnk.GetTags() );
+ #if defined LEM_THREADS
+ lem::Process::CritSecLocker guard(&cs_graph_edit);
+ #endif
+
+ const int id = db->AddWordLink( lnk.GetEntryKey0(), lnk.GetEntryKey1(), lnk.GetLink().GetState(), lnk.GetTags() );
+
+ // У новой связи атомарных тэгов еще нет.
+ boost::shared_ptr<const SG_NetGraph> g( GetGraph() );
+ if( g.get()!=NULL )
+  PublishGraph( g->WithLink( id, lnk.GetEntryKey0(), lnk.GetEntryKey1(), lnk.GetLink().GetState(), lnk.GetTags()==UNKNOWN ? 0 : lnk.GetTags() ) );
+
+ return id;
 }
 
 
@@ -185,6 +254,23 @@ void SG_Net::Find_Linked_Entries(
                                  const SG_TagFilter *filter
                                 )
 {
+ boost::shared_ptr<const SG_NetGraph> g( GetGraph() );
+ if( g.get()!=NULL )
+  {
+   const SG_NetGraph::Edge *e, *e_end;
+   g->GetOutgoing( EntryKey0, e, e_end );
+   for( ; e!=e_end; ++e )
+    if( e->link_type==ilink.GetState() )
+     {
+      if( filter!=NULL && !filter->Match( (*tag_sets)[ e->id_tags ] ) )
+       continue;
+
+      res_list.push_back( e->ekey );
+     }
+
+   return;
+  }
+
  lem::Ptr<LS_ResultSet> rs( db->ListWordLinks( EntryKey0, ilink.GetState() ) );
  while( rs->Fetch() )
   {
@@ -217,6 +303,8 @@ void SG_Net::Find_Linked_Entries(
 {
  const float w_deminish=0.4F;
 
+ boost::shared_ptr<const SG_NetGraph> g( GetGraph() );
+
  if( outgoing )
   {
    // Исходящие связи, быстрый алгоритм.
@@ -225,33 +313,58 @@ void SG_Net::Find_Linked_Entries(
    if( allowed!=NULL )
     for( lem::Container::size_type i=0; i<allowed->size(); ++i )
      types.push_back( allowed->get(i).GetState() );
- 
-   lem::Ptr<LS_ResultSet> rs( db->ListWordLinks( EntryKey0, types ) );
 
-   while( rs->Fetch() )
+   if( g.get()!=NULL )
+    {
+     // Тот же обход по снимку связей в памяти, в том же порядке.
+     const SG_NetGraph::Edge *e, *e_end;
+     g->GetOutgoing( EntryKey0, e, e_end );
+     for( ; e!=e_end; ++e )
+      {
+       if( !SG_NetGraph::IsAllowedType( e->link_type, types ) || list.find(e->ekey)!=list.end() )
+        continue;
+
+       if( filter!=NULL && !filter->Match( (*tag_sets)[ e->id_tags ] ) )
+        continue; 
+
+       list.insert(e->ekey);
+
+       const int link_w = sg->coords()[I_NET].states()[ e->link_type ].GetWeight();
+
+       float w2 = depth-link_w; 
+       if( w2>0 )
+        Find_Linked_Entries( e->ekey, w2-w_deminish, list, incoming, outgoing );
+      }
+    }
+   else
     {
-     const int ekey2 = rs->GetInt(1);
+     lem::Ptr<LS_ResultSet> rs( db->ListWordLinks( EntryKey0, types ) );
 
-     if( list.find(ekey2)==list.end() )
+     while( rs->Fetch() )
       {
-       if( filter!=NULL )
+       const int ekey2 = rs->GetInt(1);
+
+       if( list.find(ekey2)==list.end() )
         {
-         const int id_link = rs->GetInt(0);
-         const int id_tags = rs->GetInt(4);
-         SG_TagsList tags = GetWordLinkTags( id_tags, id_link );
+         if( filter!=NULL )
+          {
+           const int id_link = rs->GetInt(0);
+           const int id_tags = rs->GetInt(4);
+           SG_TagsList tags = GetWordLinkTags( id_tags, id_link );
 
-         if( !filter->Match( tags ) )
-          continue; 
-        }
+           if( !filter->Match( tags ) )
+            continue; 
+          }
   
-       list.insert(ekey2);
+         list.insert(ekey2);
 
-       const int link_type = rs->GetInt(3);
-       const int link_w = sg->coords()[I_NET].states()[ link_type ].GetWeight();
+         const int link_type = rs->GetInt(3);
+         const int link_w = sg->coords()[I_NET].states()[ link_type ].GetWeight();
 
-       float w2 = depth-link_w; 
-       if( w2>0 )
-        Find_Linked_Entries( ekey2, w2-w_deminish, list, incoming, outgoing );
+         float w2 = depth-link_w; 
+         if( w2>0 )
+          Find_Linked_Entries( ekey2, w2-w_deminish, list, incoming, outgoing );
+        }
       }
     }
   }
@@ -264,32 +377,55 @@ void SG_Net::Find_Linked_Entries(
      for( lem::Container::size_type i=0; i<allowed->size(); ++i )
       types.push_back( allowed->get(i).GetState() );
     }
- 
-   lem::Ptr<LS_ResultSet> rs( db->ListWordLinks2( EntryKey0, types ) );
 
-   while( rs->Fetch() )
+   if( g.get()!=NULL )
+    {
+     const SG_NetGraph::Edge *e, *e_end;
+     g->GetIncoming( EntryKey0, e, e_end );
+     for( ; e!=e_end; ++e )
+      {
+       if( !SG_NetGraph::IsAllowedType( e->link_type, types ) || list.find(e->ekey)!=list.end() )
+        continue;
+
+       if( filter!=NULL && !filter->Match( (*tag_sets)[ e->id_tags ] ) )
+        continue; 
+
+       list.insert(e->ekey);
+
+       const int link_w = sg->coords()[I_NET].states()[ e->link_type ].GetWeight();
+
+       if( depth>0 )
+        Find_Linked_Entries( e->ekey, depth-link_w-w_deminish, list, incoming, outgoing );
+      }
+    }
+   else
     {
-     const int ekey1 = rs->GetInt(1);
+     lem::Ptr<LS_ResultSet> rs( db->ListWordLinks2( EntryKey0, types ) );
 
-     if( list.find(ekey1)==list.end() )
+     while( rs->Fetch() )
       {
-       if( filter!=NULL )
+       const int ekey1 = rs->GetInt(1);
+
+       if( list.find(ekey1)==list.end() )
         {
-         const int id_link = rs->GetInt(0);
-         const int id_tags = rs->GetInt(4);
-         SG_TagsList tags = GetWordLinkTags( id_tags, id_link );
+         if( filter!=NULL )
+          {
+           const int id_link = rs->GetInt(0);
+           const int id_tags = rs->GetInt(4);
+           SG_TagsList tags = GetWordLinkTags( id_tags, id_link );
 
-         if( !filter->Match( tags ) )
-          continue; 
-        }
+           if( !filter->Match( tags ) )
+            continue; 
+          }
   
-       list.insert(ekey1);
+         list.insert(ekey1);
 
-       const int link_type = rs->GetInt(3);
-       const int link_w = sg->coords()[I_NET].states()[ link_type ].GetWeight();
+         const int link_type = rs->GetInt(3);
+         const int link_w = sg->coords()[I_NET].states()[ link_type ].GetWeight();
 
-       if( depth>0 )
-        Find_Linked_Entries( ekey1, depth-link_w-w_deminish, list, incoming, outgoing );
+         if( depth>0 )
+          Find_Linked_Entries( ekey1, depth-link_w-w_deminish, list, incoming, outgoing );
+        }
       }
     }
   }
@@ -983,7 +1119,7 @@ SG_TagsList SG_Net::GetWordLinkTags( int id_link )
   return NULL;
  
  int id_tags2 = tag_sets->Register(atomized_tags);
- return (*tag_sets)[id_tags];
+ return (*tag_sets)[id_tags2];
 }
 
 
@@ -1002,7 +1138,7 @@ SG_TagsList SG_Net::GetPhraseLinkTags( int id_link )
   return NULL;
  
  int id_tags2 = tag_sets->Register(atomized_tags);
- return (*tag_sets)[id_tags];
+ return (*tag_sets)[id_tags2];
 }
 
 
@@ -1024,7 +1160,7 @@ SG_TagsList SG_Net::GetWordLinkTags( int id_tags, int id_link )
   return NULL;
  
  int id_tags2 = tag_sets->Register(atomized_tags);
- return (*tag_sets)[id_tags];
+ return (*tag_sets)[id_tags2];
 }
 
 
@@ -1044,7 +1180,7 @@ SG_TagsList SG_Net::GetPhraseLinkTags( int id_tags, int id_link )
   return NULL;
  
  int id_tags2 = tag_sets->Register(atomized_tags);
- return (*tag_sets)[id_tags];
+ return (*tag_sets)[id_tags2];
 }
 
 
@@ -1362,7 +1498,16 @@ void SG_Net::RemoveComplexLink( int LinkID )
 
 void SG_Net::RemoveWordsLink( int LinkID )
 {
+ #if defined LEM_THREADS
+ lem::Process::CritSecLocker guard(&cs_graph_edit);
+ #endif
+
  db->DeleteWordLink(LinkID);
+
+ boost::shared_ptr<const SG_NetGraph> g( GetGraph() );
+ if( g.get()!=NULL )
+  PublishGraph( g->WithoutLink(LinkID) );
+
  return;
 }
 
@@ -1372,12 +1517,7 @@ int SG_Net::AddWordsLink( int ie0, int link_type, int ie1, SG_TagsList tags )
  if( ie0==UNKNOWN || link_type==UNKNOWN || ie1==UNKNOWN )
   return UNKNOWN;
 
- const int ekey0 = sg->GetEntry(ie0).GetKey();
- const int ekey1 = sg->GetEntry(ie1).GetKey();
- const int id_tag_set = (*tag_sets)[tags];
- const int id = db->AddWordLink( ekey0, ekey1, link_type, id_tag_set );
-
- return id;
+ return AddWordsLink( ie0, link_type, ie1, (*tag_sets)[tags] );
 }
 
 
@@ -1388,8 +1528,17 @@ int SG_Net::AddWordsLink( int ie0, int link_type, int ie1, int tags )
 
  const int ekey0 = sg->GetEntry(ie0).GetKey();
  const int ekey1 = sg->GetEntry(ie1).GetKey();
+
+ #if defined LEM_THREADS
+ lem::Process::CritSecLocker guard(&cs_graph_edit);
+ #endif
+
  const int id = db->AddWordLink( ekey0, ekey1, link_type, tags );
 
+ boost::shared_ptr<const SG_NetGraph> g( GetGraph() );
+ if( g.get()!=NULL )
+  PublishGraph( g->WithLink( id, ekey0, ekey1, link_type, tags==UNKNOWN ? 0 : tags ) );
+
  return id;
 }
 
@@ -1419,15 +1568,27 @@ int SG_Net::AddComplexLink( int id1, int link_type, int id2, int tags )
 
 void SG_Net::SetLinkTags( int id_link, Solarix::SG_TagsList tags )
 {
- const int id_tag_set = (*tag_sets)[tags];
- db->SetWordLinkTags( id_link, id_tag_set ); 
+ SetLinkTags( id_link, (*tag_sets)[tags] );
  return;
 }
 
 
 void SG_Net::SetLinkTags( int id_link, int id_tags )
 {
+ #if defined LEM_THREADS
+ lem::Process::CritSecLocker guard(&cs_graph_edit);
+ #endif
+
  db->SetWordLinkTags( id_link, id_tags ); 
+
+ boost::shared_ptr<const SG_NetGraph> g( GetGraph() );
+ if( g.get()!=NULL )
+  {
+   // SetWordLinkTags стирает атомарные тэги связи, так что -1 означает
+   // отсутствие тэгов.
+   PublishGraph( g->WithLinkTags( id_link, id_tags==UNKNOWN ? 0 : id_tags ) );
+  }
+
  return;
 }
 
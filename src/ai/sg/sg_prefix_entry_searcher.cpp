@@ -122,8 +122,10 @@ void PrefixEntrySearcher::Search(
  if( lem::lem_is_empty(prefix) )
   return;
 
- std::set<int> *ies1 = new std::set<int>;
- std::set<int> *ies2 = new std::set<int>;
+ //     :  
+ //      std::set   .
+ lem::MCollect<int> *ies1 = new lem::MCollect<int>;
+ lem::MCollect<int> *ies2 = new lem::MCollect<int>;
 
  WideStringUcs4 ucs4( prefix );
  lem::uint32_t c;
@@ -132,13 +134,13 @@ void PrefixEntrySearcher::Search(
   {
    if( pos==0 )
     {
-     storage->Get( c, pos, *ies1 );
+     storage->GetSorted( c, pos, *ies1 );
     }
    else
     {
      std::swap( ies1, ies2 );
      ies1->clear();
-     storage->GetIntersected( c, pos, *ies2, *ies1 );
+     storage->IntersectSorted( c, pos, *ies2, *ies1 );
     }
  
    pos++;
@@ -146,7 +148,7 @@ void PrefixEntrySearcher::Search(
 
  if( max_ie_count!=lem::int_max && CastSizeToInt(ies1->size())>max_ie_count )
   {
-   for( std::set<int>::const_iterator it=ies1->begin(); it!=ies1->end() && CastSizeToInt(ies.size())<=max_ie_count; ++it )
+   for( lem::MCollect<int>::const_iterator it=ies1->begin(); it!=ies1->end() && CastSizeToInt(ies.size())<=max_ie_count; ++it )
     ies.push_back( *it );
   }
  else
@@ -353,8 +355,10 @@ void PrefixEntrySearcher::GetEntriesForCharPos( int ipos, lem::uint32_t ucs4, st
 
 int PrefixEntrySearcher::FindMaxPrefixLen( const wchar_t * text ) const
 {
- std::set<int> *ies1 = new std::set<int>;
- std::set<int> *ies2 = new std::set<int>;
+ //     :  
+ //      std::set   .
+ lem::MCollect<int> *ies1 = new lem::MCollect<int>;
+ lem::MCollect<int> *ies2 = new lem::MCollect<int>;
 
  Ucs4ToUCString prefix_assembler;
 
@@ -365,13 +369,13 @@ int PrefixEntrySearcher::FindMaxPrefixLen( const wchar_t * text ) const
   {
    if( pos==0 )
     {
-     storage->Get( c, pos, *ies1 );
+     storage->GetSorted( c, pos, *ies1 );
     }
    else
     {
      std::swap( ies1, ies2 );
      ies1->clear();
-     storage->GetIntersected( c, pos, *ies2, *ies1 );
+     storage->IntersectSorted( c, pos, *ies2, *ies1 );
     }
  
    if( ies1->empty() )
@@ -0,0 +1,311 @@
+// CD->16.10.2026
+// LC->16.10.2026
+
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+
+#if defined LEM_WINDOWS
+#include <windows.h>
+#else
+#include <sys/types.h>
+#include <sys/stat.h>
+#endif
+
+#include <lem/conversions.h>
+#include <lem/solarix/exceptions.h>
+#include <lem/solarix/DictionarySnapshot.h>
+
+using namespace lem;
+using namespace Solarix;
+
+
+namespace
+{
+ const lem::uint32_t MAGIC = 0x504e5353; // "SSNP"
+ const lem::uint32_t VERSION = 2;
+ const lem::uint64_t PAGE = 4096; //  
+ const int COPY_BLOCK = 1048576;
+
+ struct Header
+ {
+  lem::uint32_t magic, version;
+  lem::uint32_t ptr_size, wchar_size; //         
+  lem::uint32_t cstring_len, n_sections;
+  lem::uint64_t table_pos;
+ };
+
+ void FillHeader( Header &h )
+ {
+  memset( &h, 0, sizeof(h) );
+  h.magic = MAGIC;
+  h.version = VERSION;
+  h.ptr_size = sizeof(void*);
+  h.wchar_size = sizeof(wchar_t);
+  h.cstring_len = LEM_CSTRING_LEN;
+  return;
+ }
+
+ //    to  from: to     
+ // ,     .
+ bool ReplaceFile( const lem::Path &from, const lem::Path &to )
+ {
+  #if defined LEM_WINDOWS
+  return MoveFileExW( from.GetUnicode().c_str(), to.GetUnicode().c_str(), MOVEFILE_REPLACE_EXISTING|MOVEFILE_WRITE_THROUGH )==TRUE;
+  #else
+  return ::rename( from.GetAscii().c_str(), to.GetAscii().c_str() )==0;
+  #endif
+ }
+
+ //      .
+ bool GetFileStamp( const lem::Path &p, lem::uint64_t &size, lem::uint64_t &mtime )
+ {
+  if( p.empty() )
+   return false;
+
+  #if defined LEM_WINDOWS
+  WIN32_FILE_ATTRIBUTE_DATA data;
+  if( GetFileAttributesExW( p.GetUnicode().c_str(), GetFileExInfoStandard, &data )!=TRUE )
+   return false;
+
+  size = (lem::uint64_t(data.nFileSizeHigh)<<32) | data.nFileSizeLow;
+  mtime = (lem::uint64_t(data.ftLastWriteTime.dwHighDateTime)<<32) | data.ftLastWriteTime.dwLowDateTime;
+  #else
+  struct stat st;
+  if( stat( p.GetAscii().c_str(), &st )!=0 )
+   return false;
+
+  size = lem::uint64_t(st.st_size);
+  mtime = lem::uint64_t(st.st_mtime);
+  #endif
+
+  return true;
+ }
+}
+
+
+const DictionarySnapshot::Section* DictionarySnapshot::Find( int id ) const
+{
+ for( std::size_t i=0; i<sections.size(); ++i )
+  if( sections[i].id==lem::uint32_t(id) )
+   return &sections[i];
+
+ return NULL;
+}
+
+
+bool DictionarySnapshot::Open( const lem::Path &filename )
+{
+ Close();
+
+ if( !filename.DoesExist() )
+  return false;
+
+ if( !mapped.Open(filename) )
+  return false;
+
+ if( mapped.Size()<sizeof(Header) )
+  {
+   Close();
+   return false;
+  }
+
+ Header expected;
+ FillHeader( expected );
+
+ const Header &h = *mapped.At<Header>(0);
+ if(
+    h.magic!=expected.magic ||
+    h.version!=expected.version ||
+    h.ptr_size!=expected.ptr_size ||
+    h.wchar_size!=expected.wchar_size ||
+    h.cstring_len!=expected.cstring_len ||
+    h.table_pos+h.n_sections*sizeof(Section)>mapped.Size()
+   )
+  {
+   //     .
+   Close();
+   return false;
+  }
+
+ const Section *s = mapped.At<Section>(h.table_pos);
+ sections.assign( s, s+h.n_sections );
+
+ for( std::size_t i=0; i<sections.size(); ++i )
+  if( sections[i].offset+sections[i].size>mapped.Size() )
+   {
+    Close();
+    return false;
+   }
+
+ path = filename;
+ return true;
+}
+
+
+void DictionarySnapshot::Close(void)
+{
+ mapped.Close();
+ sections.clear();
+ path.clear();
+ return;
+}
+
+
+bool DictionarySnapshot::HasSection( int id, const lem::Path &source ) const
+{
+ const Section *s = Find(id);
+ if( s==NULL )
+  return false;
+
+ lem::uint64_t size=0, mtime=0;
+ return GetFileStamp( source, size, mtime ) &&
+        size==s->source_size &&
+        mtime==s->source_mtime;
+}
+
+
+lem::uint64_t DictionarySnapshot::GetSectionOffset( int id ) const
+{
+ const Section *s = Find(id);
+ LEM_CHECKIT_Z( s!=NULL );
+ return s->offset;
+}
+
+
+lem::uint64_t DictionarySnapshot::GetSectionSize( int id ) const
+{
+ const Section *s = Find(id);
+ LEM_CHECKIT_Z( s!=NULL );
+ return s->size;
+}
+
+
+const void* DictionarySnapshot::GetSectionData( int id ) const
+{
+ const Section *s = Find(id);
+ LEM_CHECKIT_Z( s!=NULL );
+ return mapped.Data()+s->offset;
+}
+
+
+lem::Stream* DictionarySnapshot::OpenSection( int id ) const
+{
+ const Section *s = Find(id);
+ if( s==NULL )
+  return NULL;
+
+ return new lem::MemReadStream( mapped.Data()+s->offset, size_t(s->size) );
+}
+
+
+
+DictionarySnapshot::Writer::Writer( const lem::Path &filename )
+ : path(filename)
+{
+ image_path = lem::Path( path.GetUnicode()+L".tmp" );
+ tmp_path = lem::Path( path.GetUnicode()+L".section.tmp" );
+
+ //    ,      .
+ bin = new lem::BinaryWriter(image_path);
+ Header h;
+ memset( &h, 0, sizeof(h) );
+ bin->write( &h, sizeof(h) );
+
+ return;
+}
+
+
+DictionarySnapshot::Writer::~Writer(void)
+{
+ section_bin.Delete();
+ if( tmp_path.DoesExist() )
+  tmp_path.DoRemove();
+
+ //    -     .
+ if( !bin.IsNull() )
+  {
+   bin.Delete();
+   image_path.DoRemove();
+  }
+
+ return;
+}
+
+
+lem::Stream& DictionarySnapshot::Writer::BeginSection( int id, const lem::Path &source )
+{
+ LEM_CHECKIT_Z( section_bin.IsNull() );
+
+ Section s;
+ memset( &s, 0, sizeof(s) );
+ s.id = id;
+ if( !GetFileStamp( source, s.source_size, s.source_mtime ) )
+  throw E_BaseException( lem::format_str( L"Dictionary snapshot: can not find module file [%ls]", source.GetUnicode().c_str() ).c_str() );
+
+ sections.push_back(s);
+
+ section_bin = new lem::BinaryWriter(tmp_path);
+ return *section_bin;
+}
+
+
+//        .
+void DictionarySnapshot::Writer::EndSection(void)
+{
+ LEM_CHECKIT_Z( !section_bin.IsNull() );
+ section_bin.Delete();
+
+ lem::uint64_t pos = bin->tellp64();
+ const lem::uint64_t aligned = (pos+PAGE-1)/PAGE*PAGE;
+
+ std::vector<char> buffer( COPY_BLOCK, 0 );
+ if( aligned>pos )
+  bin->write( &buffer[0], aligned-pos );
+
+ Section &s = sections.back();
+ s.offset = aligned;
+
+ lem::BinaryReader rdr(tmp_path);
+ const lem::uint64_t size = rdr.fsize64();
+ for( lem::uint64_t done=0; done<size; )
+  {
+   const int n = int( std::min( lem::uint64_t(COPY_BLOCK), size-done ) );
+   rdr.read( &buffer[0], n );
+   bin->write( &buffer[0], n );
+   done += n;
+  }
+
+ s.size = size;
+ return;
+}
+
+
+lem::uint64_t DictionarySnapshot::Writer::Finish(void)
+{
+ LEM_CHECKIT_Z( section_bin.IsNull() );
+
+ const lem::uint64_t table_pos = bin->tellp64();
+ if( !sections.empty() )
+  bin->write( &sections[0], sections.size()*sizeof(Section) );
+
+ const lem::uint64_t total = bin->tellp64();
+
+ Header h;
+ FillHeader( h );
+ h.n_sections = CastSizeToInt(sections.size());
+ h.table_pos = table_pos;
+
+ bin->seekp64(0);
+ bin->write( &h, sizeof(h) );
+ bin->flush();
+ bin.Delete();
+
+ if( !ReplaceFile( image_path, path ) )
+  {
+   image_path.DoRemove();
+   throw E_BaseException( lem::format_str( L"Dictionary snapshot: can not replace [%ls]", path.GetUnicode().c_str() ).c_str() );
+  }
+
+ return total;
+}
@@ -6,7 +6,8 @@
 #endif
 
 #if defined LEM_LINUX
-#include <memory.h>
+#include <pthread.h>
+#include <map>
 #endif
 
 #include <lem/runtime_checks.h>
@@ -16,9 +17,161 @@
 using namespace Solarix;
 
 #if defined LEM_LINUX
-volatile int ElapsedTimeConstraint::time_seq=0;
+namespace Solarix
+{
+ // ***************************************************************************
+ //      .    
+ // ,    ,    exceeded
+ //  .     -   
+ //  Exceeded()    ,   .
+ // ***************************************************************************
+ class ElapsedTimeService : lem::NonCopyable
+ {
+  private:
+   typedef std::pair<time_t,long> KEY;
+   typedef std::multimap< KEY, ElapsedTimeConstraint* > QUEUE;
+
+   pthread_mutex_t mx;
+   pthread_cond_t cv;
+   QUEUE queue;
+   bool started;
+
+   static KEY GetKey( const struct timespec & t ) { return KEY( t.tv_sec, t.tv_nsec ); }
+
+   static void* ThreadFunction( void * data );
+   void Run(void);
+
+  public:
+   ElapsedTimeService(void);
+
+   static ElapsedTimeService& GetInstance(void);
+
+   void Add( ElapsedTimeConstraint * c );
+   void Remove( ElapsedTimeConstraint * c );
+ };
+}
+
+
+static pthread_once_t service_once = PTHREAD_ONCE_INIT;
+static ElapsedTimeService * service = NULL;
+
+static void CreateService(void)
+{
+ service = new ElapsedTimeService();
+ return;
+}
+
+
+ElapsedTimeService& ElapsedTimeService::GetInstance(void)
+{
+ //     :    
+ //    ,    .
+ pthread_once( &service_once, CreateService );
+ return *service;
+}
+
+
+ElapsedTimeService::ElapsedTimeService(void)
+ : started(false)
+{
+ pthread_mutex_init( &mx, NULL );
+
+ pthread_condattr_t attr;
+ pthread_condattr_init( &attr );
+ pthread_condattr_setclock( &attr, CLOCK_MONOTONIC );
+ pthread_cond_init( &cv, &attr );
+ pthread_condattr_destroy( &attr );
+}
+
+
+void* ElapsedTimeService::ThreadFunction( void * data )
+{
+ ((ElapsedTimeService*)data)->Run();
+ return NULL;
+}
+
+
+void ElapsedTimeService::Run(void)
+{
+ pthread_mutex_lock( &mx );
+
+ while(true)
+  {
+   if( queue.empty() )
+    {
+     pthread_cond_wait( &cv, &mx );
+     continue;
+    }
+
+   struct timespec now;
+   clock_gettime( CLOCK_MONOTONIC, &now );
+   const KEY key_now = GetKey(now);
+
+   while( !queue.empty() && !(key_now < queue.begin()->first) )
+    {
+     queue.begin()->second->exceeded = true;
+     queue.erase( queue.begin() );
+    }
+
+   if( !queue.empty() )
+    {
+     const struct timespec wake = queue.begin()->second->deadline;
+     pthread_cond_timedwait( &cv, &mx, &wake );
+    }
+  }
+
+ pthread_mutex_unlock( &mx );
+ return;
+}
+
+
+void ElapsedTimeService::Add( ElapsedTimeConstraint * c )
+{
+ pthread_mutex_lock( &mx );
+
+ if( !started )
+  {
+   pthread_t thread;
+   if( pthread_create( &thread, NULL, ThreadFunction, this )!=0 )
+    {
+     pthread_mutex_unlock( &mx );
+     throw lem::E_BaseException( L"ElapsedTimeConstraint: can not start the timer thread" );
+    }
+
+   pthread_detach( thread );
+   started = true;
+  }
+
+ QUEUE::iterator it = queue.insert( std::make_pair( GetKey(c->deadline), c ) );
+
+ //      -     .
+ if( it==queue.begin() )
+  pthread_cond_signal( &cv );
+
+ pthread_mutex_unlock( &mx );
+ return;
+}
+
+
+void ElapsedTimeService::Remove( ElapsedTimeConstraint * c )
+{
+ pthread_mutex_lock( &mx );
+
+ //        .
+ std::pair<QUEUE::iterator,QUEUE::iterator> r = queue.equal_range( GetKey(c->deadline) );
+ for( QUEUE::iterator it=r.first; it!=r.second; ++it )
+  if( it->second==c )
+   {
+    queue.erase(it);
+    break;
+   }
+
+ pthread_mutex_unlock( &mx );
+ return;
+}
 #endif
 
+
 ElapsedTimeConstraint::ElapsedTimeConstraint( int _max_elapsed_millisec )
 {
  max_elapsed_millisec = _max_elapsed_millisec;
@@ -48,47 +201,17 @@ ElapsedTimeConstraint::ElapsedTimeConstraint( int _max_elapsed_millisec )
 
    #elif defined LEM_LINUX
 
-//    timer_is_armed=true;
-
-/*
-    se.sigev_notify = SIGEV_THREAD;
-    se.sigev_signo = 1;
-    se.sigev_notify_function = &timer_routine;
-    se.sigev_value.sival_ptr = this;
-    int rc = timer_create(CLOCK_REALTIME, &se, &tt);
-    if( rc!=0 )
-     throw lem::E_BaseException( L"Can not create new timer by timer_create" );
-     
-    tv.it_interval.tv_sec = 0;
-    tv.it_interval.tv_nsec = 0;
-    tv.it_value.tv_sec = (max_elapsed_millisec/1000) + ( (max_elapsed_millisec%1000)>0 ? 1 : 0 );
-    tv.it_value.tv_nsec = 0;
-    rc = timer_settime(tt, 0, &tv, NULL);
-    if( rc!=0 )
-     throw lem::E_BaseException( L"Can not set timer by timer_settime" );
-*/
-
-/*
-    // Establishing handler for signal SIG
-    sa.sa_flags = SA_SIGINFO;
-    sa.sa_sigaction = timer_routine;
-    sigemptyset(&sa.sa_mask);
-    if (sigaction( SIGRTMIN, &sa, NULL ) == -1)
-     throw lem::E_BaseException( L"ElapsedTimeConstraint: error in sigaction" );
-
-    // Create the timer
-    sev.sigev_notify = SIGEV_SIGNAL;
-    sev.sigev_signo = SIGRTMIN;
-    sev.sigev_value.sival_ptr = this;
-    if( timer_create( CLOCK_REALTIME, &sev, &timerid ) == -1 )
-     throw lem::E_BaseException( L"ElapsedTimeConstraint: error in timer_create" );
-
-    // Start the timer
-    its.it_value.tv_sec = (max_elapsed_millisec/1000) + ( (max_elapsed_millisec%1000)>0 ? 1 : 0 );
-    its.it_value.tv_nsec = 0;
-    its.it_interval.tv_sec = 0;
-    its.it_interval.tv_nsec = 0;
-*/
+   clock_gettime( CLOCK_MONOTONIC, &deadline );
+   deadline.tv_sec += max_elapsed_millisec/1000;
+   deadline.tv_nsec += (max_elapsed_millisec%1000)*1000000L;
+   if( deadline.tv_nsec>=1000000000L )
+    {
+     deadline.tv_sec++;
+     deadline.tv_nsec -= 1000000000L;
+    }
+
+   ElapsedTimeService::GetInstance().Add(this);
+   timer_is_armed=true;
    #else
 
    thread = new lem::Process::Thread( ThreadFunction );
@@ -105,15 +228,7 @@ VOID CALLBACK ElapsedTimeConstraint::TimerCallback( PVOID lpParameter, BOOLEAN T
  self->exceeded = true;
  return;
 }
-#elif defined LEM_LINUX
-void ElapsedTimeConstraint::timer_routine( int sig, siginfo_t * si, void * uc )
-{
- ElapsedTimeConstraint * self = (ElapsedTimeConstraint*)si->si_value.sival_ptr;
- self->exceeded = true;
- signal( sig, SIG_IGN );
- return;
-}
-#else
+#elif !defined LEM_LINUX
 void ElapsedTimeConstraint::ThreadFunction( void * data )
 {
  ElapsedTimeConstraint * self = (ElapsedTimeConstraint*)data;
@@ -135,7 +250,7 @@ ElapsedTimeConstraint::~ElapsedTimeConstraint()
  #elif defined LEM_LINUX
  if( timer_is_armed )
   {
-   timer_delete(&timerid);
+   ElapsedTimeService::GetInstance().Remove(this);
   }
  #else
  if( thread!=NULL )
@@ -1,5 +1,5 @@
 // CD->07.03.2009
-// LC->26.04.2009
+// LC->16.10.2026
 // --------------
 
 #if defined SOL_CAA
@@ -14,7 +14,7 @@ using namespace Solarix;
 SegmentingSentenceTokenizer::SegmentingSentenceTokenizer( const Solarix::Dictionary &dict, int language )
  : SentenceTokenizer(dict,language)
 {
- lookup = lem::Ptr<Solarix::CharNode>( (Solarix::CharNode*)&dict.GetSynGram().GetPrefixTree(), null_deleter() );
+ lookup = &dict.GetSynGram().GetPrefixTrie();
  seeker = dict.seeker;
 
  const SG_Language &lang = dict.GetSynGram().languages()[language];
@@ -41,13 +41,13 @@ bool SegmentingSentenceTokenizer::IsTokenDelimiter( wchar_t c ) const
 
 bool SegmentingSentenceTokenizer::IsUnbreakableFront( wchar_t c ) const
 {
- return lookup->probe(c)!=NULL;
+ return lookup->Probe(CharTrie::Root,c)!=-1;
 }
 
 
 bool SegmentingSentenceTokenizer::IsUnbreakableFront( const lem::UCString &s ) const
 {
- return lookup->match(s);
+ return lookup->Match(s);
 }
 
 bool SegmentingSentenceTokenizer::IsMatched( const lem::UCString &s ) const
@@ -57,7 +57,7 @@ bool SegmentingSentenceTokenizer::IsMatched( const lem::UCString &s ) const
 
 int SegmentingSentenceTokenizer::MatchLen( const lem::UFString & s, int i0 ) const
 {
- return lookup->match_len( s.c_str()+i0 );
+ return lookup->MatchLen( s.c_str()+i0 );
 }
 
 #endif
@@ -74,6 +74,7 @@
 #include <lem/solarix/WordEntries_SQLite.h>
 #include <lem/solarix/NGramsStorage_SQLITE.h>
 #include <lem/solarix/Charpos2EntryStorage_SQLITE.h>
+#include <lem/solarix/Charpos2EntryStorage_Postings.h>
 #include <lem/solarix/dictionary.h>
 #include <lem/solarix/Thesaurus.h>
 #include <lem/solarix/WordEntry.h>
@@ -88,6 +89,8 @@
 #include <lem/solarix/LemmatizatorStorage_SQLITE.h>
 #include <lem/solarix/LEMM_Compiler.h>
 #include <lem/solarix/MorphologyModels.h>
+#include <lem/solarix/WordRecognitionCache.h>
+#include <lem/solarix/DictionarySnapshot.h>
 
 #if defined SOL_MYSQL_DICTIONARY_STORAGE
 #include <lem/solarix/LexiconStorage_MySQL.h>
@@ -157,7 +160,7 @@ Dictionary::Dictionary(
                        OFormatter *Err_Pipe,
                        const Dictionary_Config &_cfg
                       )
- : cfg(_cfg), lemmatizer(NULL), debug_symbols(NULL)
+ : cfg(_cfg), lemmatizer(NULL), debug_symbols(NULL), recognition_cache(NULL)
 {
  #if defined LEM_THREADS
  lem::Process::CritSecLocker cs_guard(&cs_init);
@@ -189,6 +192,7 @@ Dictionary::Dictionary(
 
  storage = new StorageConnections();
  debug_symbols = new DebugSymbols();
+ recognition_cache = new WordRecognitionCache();
 
  //  .
  InitA(cfg);
@@ -267,6 +271,7 @@ void Dictionary::Delete(void)
 
  lem_rub_off(lemmatizer);
  lem_rub_off(debug_symbols);
+ lem_rub_off(recognition_cache);
 
  #if defined SOL_LOADTXT && defined SOL_COMPILER
  lem_rub_off(lemmatizer_compiler);
@@ -281,6 +286,7 @@ void Dictionary::Delete(void)
  stemmer.Delete();
  #endif
 
+ snapshot.Delete();
 
  lem_rub_off(storage);
 
@@ -498,6 +504,21 @@ lem::UFString Dictionary::SubstituteConnectionString(
 #endif
 
 #if defined SOL_LOADBIN
+//       ,    
+//     .
+static bool UseSnapshotSection( const DictionarySnapshot &snapshot, int id, const lem::Path &source )
+{
+ if( !snapshot.IsOpen() )
+  return false;
+
+ const bool ok = snapshot.HasSection( id, source );
+ if( !ok && lem::LogFile::IsOpen() )
+  lem::LogFile::logfile->printf( "Dictionary snapshot has no up-to-date section %d for [%us]\n", id, source.GetUnicode().c_str() );
+
+ return ok;
+}
+
+
 bool Dictionary::LoadModules(
                              const lem::Path &_dictionary_xml,
                              const Load_Options &opt
@@ -507,6 +528,9 @@ bool Dictionary::LoadModules(
   return false;
 
  dictionary_xml = _dictionary_xml;
+
+ //       .
+ recognition_cache->Invalidate();
   
  lem::Xml::Parser p;
  p.Load(dictionary_xml);
@@ -649,6 +673,33 @@ bool Dictionary::LoadModules(
    morphology_path = morphology_path.GetAbsolutePath();
   }
 
+ //     ,    
+ //    -  ,     
+ //  .
+ lem::Ptr<DictionarySnapshot> snapshot_file( new DictionarySnapshot() );
+ if( opt.snapshot )
+  {
+   const lem::Xml::Node* snapshot_nod = p.Find_By_Path( L"dataroot.snapshot" );
+   if( snapshot_nod!=NULL && !snapshot_nod->GetBody().empty() )
+    {
+     lem::Path snapshot_path(base_path);
+     snapshot_path.ConcateLeaf( lem::Path(snapshot_nod->GetBody()) );
+     snapshot_path = snapshot_path.GetAbsolutePath();
+
+     const bool snapshot_ok = snapshot_file->Open( snapshot_path );
+     if( lem::LogFile::IsOpen() )
+      lem::LogFile::logfile->printf( "Dictionary snapshot [%us] %s\n", snapshot_path.GetUnicode().c_str(), snapshot_ok ? "is opened" : "is missing or built by another engine version" );
+    }
+  }
+
+ //         : 
+ //          .
+ const bool snapshot_morphology = !morphology_path.empty() &&
+                                  nod->FindAttr(L"storage")==UNKNOWN &&
+                                  UseSnapshotSection( *snapshot_file, DictionarySnapshot::Morphology, morphology_path ) &&
+                                  UseSnapshotSection( *snapshot_file, DictionarySnapshot::Lexemes, morphology_path );
+ bool snapshot_used = snapshot_morphology;
+
  int iattr1 = nod->FindAttr(L"storage");
  if( iattr1!=UNKNOWN )
   {
@@ -697,9 +748,16 @@ bool Dictionary::LoadModules(
   {
    WordEntries_File *entries = new WordEntries_File( &GetSynGram(), cfg );
 
+   if( snapshot_morphology )
+    entries->SetLexemePoolImage( snapshot_file->GetSectionData(DictionarySnapshot::Lexemes), snapshot_file->GetSectionSize(DictionarySnapshot::Lexemes) );
+
    if( !opt.lexicon )
     {
-     entries->SetLazyLoad( morphology_path );
+     if( snapshot_morphology )
+      entries->SetLazyLoad( snapshot_file->GetPath(), snapshot_file->GetSectionOffset(DictionarySnapshot::Morphology) );
+     else
+      entries->SetLazyLoad( morphology_path );
+
      GetLexAuto().SetLazyLoad();
     }
 
@@ -708,7 +766,15 @@ bool Dictionary::LoadModules(
 
  if( !morphology_path.empty() )
   {
-   LoadMorphology( morphology_path, opt );
+   if( snapshot_morphology )
+    {
+     lem::Ptr<lem::Stream> bin( snapshot_file->OpenSection(DictionarySnapshot::Morphology) );
+     LoadBin(*bin,opt);
+    }
+   else
+    {
+     LoadMorphology( morphology_path, opt );
+    }
   }
 
  const lem::Xml::Node* lexicon_provider = p.Find_By_Path( L"dataroot.lexicon_provider" );
@@ -1015,6 +1081,9 @@ bool Dictionary::LoadModules(
          throw E_BaseException(msg.string());
         }
       }
+
+     if( opt.semnet_in_memory )
+      GetSynGram().Get_Net().LoadGraph();
     }
   }
 
@@ -1023,9 +1092,19 @@ bool Dictionary::LoadModules(
    nod = p.Find_By_Path( L"dataroot.affixes" );
    if( nod!=NULL && nod->GetBody().empty()==false )
     { 
-     lem::Path affix_path(base_path);
+     affix_path = base_path;
      affix_path.ConcateLeaf( lem::Path(nod->GetBody()) );
-     LoadAffixTable(affix_path);
+
+     if( UseSnapshotSection( *snapshot_file, DictionarySnapshot::Affixes, affix_path ) )
+      {
+       lem::Ptr<lem::Stream> afxbin( snapshot_file->OpenSection(DictionarySnapshot::Affixes) );
+       LoadAffixTable(*afxbin);
+       snapshot_used = true;
+      }
+     else
+      {
+       LoadAffixTable(affix_path);
+      }
     }
   }
  else
@@ -1039,9 +1118,19 @@ bool Dictionary::LoadModules(
    nod = p.Find_By_Path( L"dataroot.seeker" );
    if( nod!=NULL && nod->GetBody().empty()==false )
     { 
-     lem::Path seeker_path(base_path);
+     seeker_path = base_path;
      seeker_path.ConcateLeaf( lem::Path(nod->GetBody()) );
-     LoadSeeker(seeker_path);
+
+     if( UseSnapshotSection( *snapshot_file, DictionarySnapshot::Seeker, seeker_path ) )
+      {
+       lem::Ptr<lem::Stream> skrbin( snapshot_file->OpenSection(DictionarySnapshot::Seeker) );
+       LoadSeeker(*skrbin);
+       snapshot_used = true;
+      }
+     else
+      {
+       LoadSeeker(seeker_path);
+      }
     }
   }
 
@@ -1165,7 +1254,7 @@ bool Dictionary::LoadModules(
       }
      else
       {
-       if( prefix_entry_searcher_provider.eqi(L"sqlite") )
+       if( prefix_entry_searcher_provider.eqi(L"sqlite") || prefix_entry_searcher_provider.eqi(L"postings") )
         {
          prefix_entry_searcher_connection_string = BuildSQLiteConnectionString( p, pes_db->GetBody(), base_path );
         }
@@ -1200,6 +1289,11 @@ bool Dictionary::LoadModules(
   }
 
 
+ //      ,     
+ //   .
+ if( snapshot_used )
+  snapshot = snapshot_file;
+
  //     
  // ...
 
@@ -1297,15 +1391,22 @@ void Dictionary::LoadAffixTable( const lem::Path &affix_path )
  if( lem::LogFile::IsOpen() )
   lem::LogFile::logfile->printf( "Loading affixes table from [%us]...\n", affix_path.GetUnicode().c_str() );
 
- affix_table = boost::shared_ptr<Solarix::Affix_Table>( new Solarix::Affix_Table() );
  BinaryReader afxbin( affix_path );
- affix_table->LoadBin( afxbin );
+ LoadAffixTable( afxbin );
 
  if( lem::LogFile::IsOpen() )
   lem::LogFile::logfile->printf( "Affixes table has been loaded from [%us]\n", affix_path.GetUnicode().c_str() );
 
  return;
 }
+
+
+void Dictionary::LoadAffixTable( lem::Stream &afxbin )
+{
+ affix_table = boost::shared_ptr<Solarix::Affix_Table>( new Solarix::Affix_Table() );
+ affix_table->LoadBin( afxbin );
+ return;
+}
 #endif
 
 
@@ -1316,13 +1417,20 @@ void Dictionary::LoadSeeker( const lem::Path &seeker_path )
   lem::LogFile::logfile->printf( "Loading seeker from [%us]...\n", seeker_path.GetUnicode().c_str() );
 
  lem::BinaryReader skrbin( seeker_path );
- seeker = boost::shared_ptr<Solarix::LD_Seeker>( GetSynGram().GetEntries().Load_Seeker(skrbin) );
+ LoadSeeker( skrbin );
 
  if( lem::LogFile::IsOpen() )
   lem::LogFile::logfile->printf( "Seeker has been loaded from [%us]\n", seeker_path.GetUnicode().c_str() );
 
  return;
 }
+
+
+void Dictionary::LoadSeeker( lem::Stream &skrbin )
+{
+ seeker = boost::shared_ptr<Solarix::LD_Seeker>( GetSynGram().GetEntries().Load_Seeker(skrbin) );
+ return;
+}
 #endif
 
 
@@ -1514,6 +1622,58 @@ void Dictionary::SaveBin( lem::Stream &bin ) const
  return;
 }
 
+
+/*********************************************************************
+       . 
+    SaveBin,    ,  
+       (Load_Options::lexicon). 
+        ,  
+    .   , 
+    dictionary.xml   <snapshot>.  
+   ,   ,   
+   ,   .    
+ .
+**********************************************************************/
+lem::uint64_t Dictionary::SaveSnapshot( const lem::Path &filename )
+{
+ WordEntries_File *entries = dynamic_cast<WordEntries_File*>( &GetSynGram().GetEntries() );
+ if( entries==NULL || entries->IsLazyLoad() )
+  throw E_BaseException( L"Dictionary snapshot requires the lexicon to be loaded into memory" );
+
+ DictionarySnapshot::Writer wr( filename );
+
+ entries->SetSaveLexemePoolImage(true);
+ try
+  {
+   SaveBin( wr.BeginSection( DictionarySnapshot::Morphology, morphology_path ) );
+  }
+ catch(...)
+  {
+   entries->SetSaveLexemePoolImage(false);
+   throw;
+  }
+
+ entries->SetSaveLexemePoolImage(false);
+ wr.EndSection();
+
+ entries->SaveLexemePoolImage( wr.BeginSection( DictionarySnapshot::Lexemes, morphology_path ) );
+ wr.EndSection();
+
+ if( affix_table && !affix_path.empty() )
+  {
+   affix_table->SaveBin( wr.BeginSection( DictionarySnapshot::Affixes, affix_path ) );
+   wr.EndSection();
+  }
+
+ if( seeker && !seeker_path.empty() )
+  {
+   seeker->SaveBin( wr.BeginSection( DictionarySnapshot::Seeker, seeker_path ) );
+   wr.EndSection();
+  }
+
+ return wr.Finish();
+}
+
 #endif
 
 #if defined SOL_REPORT
@@ -2702,6 +2862,20 @@ lem::Ptr<PrefixEntrySearcher> Dictionary::GetPrefixEntrySearcher( int max_found_
          stg = new Charpos2EntryStorage_MySQL( (StorageConnection_MySQL*)cnx );
          #endif 
         }
+       else if( prefix_entry_searcher_provider.eqi(L"postings") )
+        {
+         //       SQLite-, 
+         //   prefix_entry_searcher_db.
+         const lem::Path postings_path( prefix_entry_searcher_connection_string + L".postings" );
+         if( !postings_path.DoesExist() )
+          {
+           lem::MemFormatter mem;
+           mem.printf( "Can not find prefix entry postings file %us", postings_path.GetUnicode().c_str() );
+           throw lem::E_BaseException( mem.string() );
+          }
+
+         stg = new Charpos2EntryStorage_Postings( postings_path );
+        }
        else
         {
          stg = new Charpos2EntryStorage_SQLITE( prefix_entry_searcher_connection_string );
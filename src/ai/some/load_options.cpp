@@ -5,6 +5,7 @@ using namespace Solarix;
 Load_Options::Load_Options(void)
 {
  load_semnet = true;
+ semnet_in_memory = false;
  affix_table = false;
  seeker = false;
  stemmer = true;
@@ -12,4 +13,5 @@ Load_Options::Load_Options(void)
 
  lemmatizer = true;
  force_lemmatizer_fastest_mode = false;
+ snapshot = true;
 }
@@ -53,6 +53,8 @@
 #include <lem/solarix/WordEntries_File.h>
 #include <lem/solarix/AlphabetStorage_SQLITE.h>
 #include <lem/solarix/Charpos2EntryStorage_SQLITE.h>
+#include <lem/solarix/Charpos2EntryStorage_Postings.h>
+#include <lem/solarix/Charpos2EntryEnumerator.h>
 
 #include <lem/solarix/ygres.h>
 
@@ -345,6 +347,29 @@ void Compiler::SavePrefixEntrySearcher( const lem::Path &p ) const
  
  pes.Commit();
 
+ //        , Dictionary   
+ // SQLite-  prefix_entry_searcher_provider=postings.
+ const lem::Path postings_path( p.GetUnicode()+L".postings" );
+ if( postings_path.DoesExist() )
+  postings_path.DoRemove();
+
+ Charpos2EntryStorage_Postings postings( postings_path );
+ postings.BeginTx();
+
+ std::set<int> ies;
+ lem::Ptr<Charpos2EntryEnumerator> cenum( stg->Enumerate() );
+ while( cenum->Fetch() )
+  {
+   const lem::uint32_t c = cenum->GetChar();
+   const int pos = cenum->GetPos();
+
+   ies.clear();
+   stg->Get( c, pos, ies );
+   postings.Store( c, pos, ies );
+  }
+
+ postings.CommitTx();
+
  return;
 }
 
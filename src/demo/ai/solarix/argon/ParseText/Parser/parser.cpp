@@ -4,10 +4,19 @@
 #include <vector>
 #include <string>
 #include <map>
+#include <deque>
 #include <algorithm>
 #include <boost/regex.hpp>
 
+#if defined LEM_THREADS
+#include <boost/bind.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition.hpp>
+#endif
+
 #include <lem/startup.h>
+#include <lem/streams.h>
 #include <lem/console_streams.h>
 #include <lem/date_time.h>
 #include <lem/xml_parser.h>
@@ -25,6 +34,8 @@
 
 #if defined LEM_WINDOWS
 #include <windows.h>
+#else
+#include <unistd.h>
 #endif
 
 #include <libdesr.h>
@@ -103,6 +114,7 @@ class SentenceEOL : public SentenceBroker
 void ShowHelp()
 {
  lem::mout->printf( "\n\nUsage: parser -d dictionary_path input_text_file -o output_xml_file\n\n" );
+ lem::mout->printf( "Bulk parsing: -threads N (0 - one per core), -progress seconds, -checkpoint sentences, -resume\n\n" );
  exit(0);
 }
 
@@ -226,6 +238,743 @@ static void DumpMorphTokens( Solarix::Dictionary & dict, Solarix::CasingCoder &
 }
 
 
+//  ,     .
+struct ParsingParams
+{
+ int language_id;
+ int beam_size;
+ int tagger_type; // -1 - none, 0 - CRF POS tagger
+ int parser_type; // -1 - none, 0 - DeSR, 1 - top-down
+ bool emit_morph;
+ bool render_tree;
+
+ //  DeSR:       ,
+ //    .
+ lem::Path desr_conf, desr_model;
+ const ModelCodeBook * desr_codebook;
+};
+
+
+// ,    ,    .
+struct ParsingJob
+{
+ int seq;          //     
+ int sent_index;   //  sent_count  ,    
+ int paragraph_id;
+ lem::UFString sentence;
+
+ lem::UFString xml; //   XML  
+ int n_token;
+
+ bool failed;         //   
+ lem::UFString error; //  ,    
+
+ ParsingJob() : seq(0), sent_index(0), paragraph_id(0), n_token(0), failed(false) {}
+};
+
+
+//   .      
+//       DeSR,    .
+class SentenceParser
+{
+ private:
+  Solarix::Dictionary & dict;
+  const ParsingParams & params;
+  Solarix::CasingCoder & cc;
+  Solarix::WrittenTextAnalysisSession analysis;
+  void * hDESR;
+
+  SentenceParser( const SentenceParser & );
+  void operator=( const SentenceParser & );
+
+  void Parse( ParsingJob & job, lem::OUFormatter & out_stream );
+
+ public:
+  SentenceParser( Solarix::Dictionary & _dict, const ParsingParams & _params );
+  ~SentenceParser();
+
+  //     job.xml,  -  job.failed/job.error.
+  void Process( ParsingJob & job );
+};
+
+
+SentenceParser::SentenceParser( Solarix::Dictionary & _dict, const ParsingParams & _params )
+ : dict(_dict), params(_params), cc( _dict.GetLexAuto().GetCasingCoder() ), analysis( &_dict, NULL ), hDESR(NULL)
+{
+ analysis.params.SetLanguageID(params.language_id);
+ analysis.params.AllowPrimaryFuzzyWordRecog = false;
+ analysis.params.AllowDynform = true;
+ analysis.params.ApplyModel = true;
+
+ //       
+// const int MaxMillisecTimeout = 180000;
+ const int MaxMillisecTimeout = 0;
+ analysis.params.timeout.max_elapsed_millisecs = MaxMillisecTimeout>0 ? MaxMillisecTimeout : lem::int_max;
+
+ //   .        
+ analysis.params.timeout.max_alt = params.beam_size;
+
+ analysis.params.CompleteAnalysisOnly = false;
+ analysis.params.ConfigureSkipToken();
+
+ if( params.parser_type==0 )
+  hDESR = DesrInit( 10, params.desr_conf.GetAscii().c_str(), params.desr_model.GetAscii().c_str() );
+
+ return;
+}
+
+
+SentenceParser::~SentenceParser()
+{
+ if( hDESR!=NULL )
+  DesrDeleteEngine(hDESR);
+
+ return;
+}
+
+
+void SentenceParser::Process( ParsingJob & job )
+{
+ try
+  {
+   lem::MemFormatter mem;
+   Parse( job, mem );
+   job.xml = mem.string();
+  }
+ catch( const lem::E_BaseException & ex )
+  {
+   job.failed = true;
+   job.error = ex.what();
+  }
+ catch( const std::exception &ex )
+  {
+   job.failed = true;
+   job.error = lem::from_utf8( ex.what() );
+  }
+ catch(...)
+  {
+   job.failed = true;
+  }
+
+ return;
+}
+
+
+void SentenceParser::Parse( ParsingJob & job, lem::OUFormatter & out_stream )
+{
+ const lem::UFString & sentence = job.sentence;
+
+ lem::UFString xml_str = EncodeStrXml(sentence.c_str());
+ out_stream.printf( "\n\n<sentence paragraph_id='%d'>\n<text>%us</text>\n", job.paragraph_id, xml_str.c_str() );
+
+ if( params.parser_type==-1 )
+  {
+   if( params.tagger_type==0 )
+    {
+     //       ,    .
+     analysis.ApplyFilters(sentence);
+    }
+   else
+    {
+     //    POS Tagger...
+     analysis.MorphologicalAnalysis(sentence);
+    }
+
+   const Res_Pack & pack0 = analysis.GetPack();
+   const Solarix::Variator & tagging = * pack0.vars().front();
+   DumpMorphTokens( dict, cc, tagging, params.emit_morph, out_stream );
+
+   job.n_token = CastSizeToInt(tagging.roots_list().size()-2);
+  }
+ else if( params.parser_type==0 )
+  {
+   // DESR  
+
+   //       ,    .
+   analysis.ApplyFilters(sentence);
+
+   const Res_Pack & pack0 = analysis.GetPack();
+   const Solarix::Variator & tagging = * pack0.vars().front();
+
+   if( params.tagger_type!=-1 )
+    DumpMorphTokens( dict, cc, tagging, params.emit_morph, out_stream );
+
+   job.n_token = CastSizeToInt(tagging.roots_list().size()-2);
+
+   //  ,   POS Tagger'
+   out_stream.printf( "\n<syntax_tree>\n" );
+
+   lem::FString desr_input;
+
+   for( lem::Container::size_type i=1; i<tagging.roots_list().size()-1; ++i )
+   {
+    const Solarix::Word_Form & wf = tagging.roots_list()[i]->GetNode();
+
+    const ModelTagMatcher * tm = params.desr_codebook->Match( &wf, dict );
+    int id_tag = tm==NULL ? -1 : tm->GetId();
+
+    #if LEM_DEBUGGING==1
+    lem::mout->printf( "token #%d word=%us tag=%d ", i, wf.GetName()->c_str(), id_tag );
+    tm->Print( *lem::mout, dict );
+    lem::mout->eol();
+    tm->Match( wf, dict );
+    #endif
+
+    desr_input.Add_Dirty( lem::format_str( "%d\t_\t_\t_\t%d\t_\t?\t?\t_\t_\n", CastSizeToInt(i), id_tag ) );
+   }
+
+   char * desr_res_str = DesrTag( hDESR, desr_input.c_str() );
+
+   std::string s_res( desr_res_str );
+
+   //    
+   boost::regex rx_line( "^(.+?)\t(.+?)\t(.+?)\t(.+?)\t(.+?)\t(.+?)\t(.+?)\t(.+?)\t(.+?)\t(.+?)$", boost::regex_constants::icase );
+
+   boost::sregex_iterator m2;
+   int itoken=1;
+   for( boost::sregex_iterator it( s_res.begin(), s_res.end(), rx_line ); it!=m2; ++it, ++itoken )
+   {
+    const boost::match_results<std::string::const_iterator> & mx = *it;
+    const std::string & parent_id = mx[7].str();
+    lem::UFString link_name = lem::from_utf8( mx[8].str().c_str() );
+
+    int word_index = itoken-1;
+    int parent_index = lem::to_int(parent_id)-1;
+
+    const Solarix::Word_Form & node_wf = tagging.roots_list()[itoken]->GetNode();
+    lem::UFString node_word( EncodeStrXml( node_wf.GetName()->c_str()) );
+
+    if( parent_index==-1 )
+     {
+      out_stream.printf( "<node is_root='true'>" );
+      out_stream.printf( "<token>%d</token><word>%us</word><parent>-1</parent><parent_word></parent_word><link_type></link_type></node>\n", word_index, node_word.c_str() );
+     }
+    else
+     {
+      const Solarix::Word_Form & parent_wf = tagging.roots_list()[parent_index+1]->GetNode();
+      lem::UFString parent_word( EncodeStrXml( parent_wf.GetName()->c_str()) );
+      out_stream.printf( "<node><token>%d</token><word>%us</word><parent>%d</parent><parent_word>%us</parent_word><link_type>%us</link_type></node>\n", word_index, node_word.c_str(), parent_index, parent_word.c_str(), link_name.c_str() );
+     }
+   }
+
+   DesrFreeResult( hDESR, desr_res_str );
+
+   out_stream.printf( "</syntax_tree>\n" );
+  }
+ else if( params.parser_type==1 )
+  {
+   //  top-down 
+   //  POS Tagger  .
+
+   analysis.SyntacticAnalysis(sentence);
+   const Res_Pack & linkage = analysis.GetPack();
+
+   const Solarix::Variator & var = * linkage.vars().front();
+
+   Solarix::Variator tagging;
+   for( lem::Container::size_type i=0; i<var.roots_list().size(); ++i )
+    {
+     Solarix::Tree_Node * node = var.roots_list()[i];
+     tagging.Add( node );
+    }
+
+   const int n_token = tagging.roots_list().size()-2;
+
+   if( params.tagger_type!=-1 )
+    {
+     DumpMorphTokens( dict, cc, tagging, params.emit_morph, out_stream );
+
+     for( lem::Container::size_type i=0; i<var.roots_list().size(); ++i )
+     {
+      tagging.ForgetTree(i);
+     }
+    }
+
+   std::set<int> roots;
+   std::map<int, std::pair<int,int> > child_to_parent;
+   std::map<int,lem::UCString> node2word;
+
+   out_stream.printf( "\n<syntax_tree>\n" );
+   for( lem::Container::size_type i=1; i<var.roots_list().size()-1; ++i )
+   {
+    const Solarix::Tree_Node & node = * var.roots_list()[i];
+
+    roots.insert( node.GetNode().GetOriginPos() );
+    node2word.insert( std::make_pair( node.GetNode().GetOriginPos(), *node.GetNode().GetName() ) );
+
+    AssembleEdges( node, child_to_parent, node2word );
+   }
+
+   for( int word_pos=0; word_pos<n_token; ++word_pos )
+   {
+    lem::UFString node_word( EncodeStrXml( node2word[word_pos].c_str()) );
+
+    if( roots.find(word_pos)!=roots.end() )
+     out_stream.printf( "<node is_root='true'><token>%d</token><word>%us</word><parent>-1</parent><link_type>ROOT</link_type></node>\n", word_pos, node_word.c_str() );
+    else if( child_to_parent.find(word_pos)==child_to_parent.end() )
+     out_stream.printf( "<node is_orphant='true'><token>%d</token><word>%us</word><parent>-1</parent><link_type>UNKNOWN</link_type></node>\n", word_pos, node_word.c_str() );
+    else
+     {
+      const std::pair<int,int> & parent_and_link = child_to_parent[ word_pos ];
+      const UCString & link_name = dict.GetSynGram().coords()[0].GetStateName( parent_and_link.second );
+      lem::UFString parent_word( EncodeStrXml( node2word[parent_and_link.first].c_str()) );
+      out_stream.printf( "<node><token>%d</token><word>%us</word><parent>%d</parent><parent_word>%us</parent_word><link_type>%us</link_type></node>\n", word_pos, node_word.c_str(), parent_and_link.first, parent_word.c_str(), link_name.c_str() );
+     }
+   }
+
+   out_stream.printf( "</syntax_tree>\n" );
+
+   if( params.render_tree )
+    {
+     lem::MemFormatter mem;
+     Solarix::print_syntax_tree( L"", linkage, dict, mem, false, false );
+     lem::UFString str = mem.string();
+     lem::UFString encoded_tree = EncodeStrXml(str.c_str()).subst_all( '\r', ' ' );
+
+     out_stream.printf( "<syntax_tree_rendering>\n<![CDATA[\n%us\n]]>\n</syntax_tree_rendering>\n", encoded_tree.c_str() );
+    }
+  }
+
+ out_stream.printf( "</sentence>\n" );
+
+ return;
+}
+
+
+
+//       , 
+//        .
+//
+//  XML   MemFormatter'     
+//   .      ,
+//         ,   
+//   ,       .
+class ParsingWriter
+{
+ private:
+  lem::OUFormatter & out_stream;
+  lem::Stream & out_file;
+  lem::Path checkpoint_path;
+  int checkpoint_every; //      , 0 -  
+  int progress_every;   //     , 0 -  
+  bool verbose;
+
+  lem::ElapsedTime elapsed_time;
+  int last_progress;       //    
+  int last_checkpoint;     // counter     
+  int start_counter, start_word_count; //    
+
+  bool failed;         //     ,  
+  lem::UFString error; //   
+
+  void SaveCheckpoint( int sent_index );
+
+ public:
+  int counter;    //   
+  int word_count;
+
+  ParsingWriter(
+                lem::OUFormatter & _out_stream,
+                lem::Stream & _out_file,
+                const lem::Path & _checkpoint_path,
+                int _checkpoint_every,
+                int _progress_every,
+                bool _verbose
+               );
+
+  void Start( int _counter, int _word_count );
+
+  //    .    ,
+  //   ,     false.   
+  //   ,      - 
+  //   ,  Failed()   .
+  bool Write( const ParsingJob & job );
+
+  bool Failed() const { return failed; }
+  void PrintError() const;
+
+  //       .
+  boost::posix_time::time_duration Finish( int n_thread );
+
+  //   ,  false   .
+  static bool LoadCheckpoint(
+                             const lem::Path & checkpoint_path,
+                             int & sent_index,
+                             int & counter,
+                             int & word_count,
+                             lem::Stream::pos_type & offset
+                            );
+
+  //       .
+  static bool TruncateOutput( const lem::Path & out_path, lem::Stream::pos_type offset );
+};
+
+
+ParsingWriter::ParsingWriter(
+                             lem::OUFormatter & _out_stream,
+                             lem::Stream & _out_file,
+                             const lem::Path & _checkpoint_path,
+                             int _checkpoint_every,
+                             int _progress_every,
+                             bool _verbose
+                            )
+ : out_stream(_out_stream), out_file(_out_file), checkpoint_path(_checkpoint_path),
+   checkpoint_every(_checkpoint_every), progress_every(_progress_every), verbose(_verbose),
+   last_progress(0), last_checkpoint(0), start_counter(0), start_word_count(0), failed(false), counter(0), word_count(0)
+{
+}
+
+
+void ParsingWriter::Start( int _counter, int _word_count )
+{
+ counter = start_counter = last_checkpoint = _counter;
+ word_count = start_word_count = _word_count;
+ last_progress = 0;
+ elapsed_time.start();
+ return;
+}
+
+
+bool ParsingWriter::Write( const ParsingJob & job )
+{
+ LEM_CHECKIT_Z( job.seq==counter && !failed );
+
+ if( verbose )
+  lem::mout->printf( "%d: %us\n", job.seq, job.sentence.c_str() );
+
+ if( job.failed )
+  {
+   failed = true;
+   error = job.error;
+   return false;
+  }
+
+ out_stream.GetStream()->wputs( job.xml.c_str() );
+
+ counter++;
+ word_count += job.n_token;
+
+ if( checkpoint_every>0 && counter-last_checkpoint>=checkpoint_every )
+  {
+   SaveCheckpoint( job.sent_index );
+   last_checkpoint = counter;
+  }
+
+ if( progress_every>0 )
+  {
+   const int sec = elapsed_time.sec();
+   if( sec-last_progress>=progress_every )
+    {
+     last_progress = sec;
+     const double dt = elapsed_time.msec()/1000.0;
+     lem::mout->printf( "%d sentences, %d words, %g sentences/sec, %g words/sec\n", counter, word_count,
+      dt>0 ? (counter-start_counter)/dt : 0.0, dt>0 ? (word_count-start_word_count)/dt : 0.0 );
+    }
+  }
+
+ return true;
+}
+
+
+void ParsingWriter::PrintError() const
+{
+ if( error.empty() )
+  lem::mout->printf( "\nUnknown internal parser error\n" );
+ else
+  lem::mout->printf( "\nInternal parser error: %us\n", error.c_str() );
+
+ return;
+}
+
+
+//    -  :
+// sent_index counter word_count ___
+//
+//      ,   
+//  :      ,  
+//   ,      .
+void ParsingWriter::SaveCheckpoint( int sent_index )
+{
+ out_stream.flush();
+ const lem::Stream::pos_type offset = out_file.tellp();
+
+ lem::UFString tmp_name( checkpoint_path.GetUnicode() );
+ tmp_name += L".tmp";
+ const lem::Path tmp_path( tmp_name );
+
+ FILE * f = fopen( tmp_path.GetAscii().c_str(), "wt" );
+ if( f==NULL )
+  {
+   lem::mout->printf( "Can not write checkpoint file [%us]\n", tmp_path.GetUnicode().c_str() );
+   return;
+  }
+
+ bool ok = fprintf( f, "%d %d %d %llu\n", sent_index, counter, word_count, (unsigned long long)offset )>0;
+ ok = fflush(f)==0 && ok;
+ #if !defined LEM_WINDOWS
+ ok = fsync( fileno(f) )==0 && ok;
+ #endif
+ ok = fclose(f)==0 && ok;
+
+ if( ok )
+  {
+   #if defined LEM_WINDOWS
+   ok = MoveFileExW( tmp_path.GetUnicode().c_str(), checkpoint_path.GetUnicode().c_str(), MOVEFILE_REPLACE_EXISTING|MOVEFILE_WRITE_THROUGH )!=FALSE;
+   #else
+   ok = rename( tmp_path.GetAscii().c_str(), checkpoint_path.GetAscii().c_str() )==0;
+   #endif
+  }
+
+ if( !ok )
+  {
+   lem::mout->printf( "Can not write checkpoint file [%us]\n", checkpoint_path.GetUnicode().c_str() );
+   tmp_path.DoRemove();
+  }
+
+ return;
+}
+
+
+bool ParsingWriter::LoadCheckpoint(
+                                   const lem::Path & checkpoint_path,
+                                   int & sent_index,
+                                   int & counter,
+                                   int & word_count,
+                                   lem::Stream::pos_type & offset
+                                  )
+{
+ FILE * f = fopen( checkpoint_path.GetAscii().c_str(), "rt" );
+ if( f==NULL )
+  return false;
+
+ unsigned long long off=0;
+ const bool ok = fscanf( f, "%d %d %d %llu", &sent_index, &counter, &word_count, &off )==4;
+ fclose(f);
+
+ offset = lem::Stream::pos_type(off);
+ return ok;
+}
+
+
+bool ParsingWriter::TruncateOutput( const lem::Path & out_path, lem::Stream::pos_type offset )
+{
+ #if defined LEM_WINDOWS
+ HANDLE h = CreateFileW( out_path.GetUnicode().c_str(), GENERIC_WRITE, 0, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL );
+ if( h==INVALID_HANDLE_VALUE )
+  return false;
+
+ LARGE_INTEGER pos;
+ pos.QuadPart = LONGLONG(offset);
+ const bool ok = SetFilePointerEx( h, pos, NULL, FILE_BEGIN ) && SetEndOfFile(h);
+ CloseHandle(h);
+ return ok;
+ #else
+ return truncate( out_path.GetAscii().c_str(), off_t(offset) )==0;
+ #endif
+}
+
+
+boost::posix_time::time_duration ParsingWriter::Finish( int n_thread )
+{
+ elapsed_time.stop();
+ boost::posix_time::time_duration dt = elapsed_time.elapsed();
+
+ const double sec = dt.total_milliseconds()/1000.0;
+ lem::mout->printf( "Done, sentence_count=%d, elapsed_time=%d sec, rate=%g words/sec\n", counter, dt.total_seconds(), sec>0 ? (word_count-start_word_count)/sec : 0.0 );
+ lem::mout->printf( "threads=%d, word_count=%d, rate=%g sentences/sec\n", n_thread, word_count, sec>0 ? (counter-start_counter)/sec : 0.0 );
+
+ return dt;
+}
+
+
+
+#if defined LEM_THREADS
+//  :         ,
+//    ,      
+//  .  , ,    ,
+//   -       
+//   .
+class ParsingPipeline
+{
+ private:
+  boost::mutex cs;
+  boost::condition job_ready;    //   :     
+  boost::condition result_ready; //   :   
+  boost::condition window_free;  //   :    
+
+  std::deque<ParsingJob*> jobs;
+  std::map<int,ParsingJob*> results;
+  int window;
+  int next_seq;   //   ,   
+  int next_write; //    
+  bool eof;
+  bool aborted;   //     ,  
+
+  boost::thread_group threads;
+
+  void Worker( SentenceParser * parser );
+  void Writer( ParsingWriter * writer );
+
+  ParsingPipeline( const ParsingPipeline & );
+  void operator=( const ParsingPipeline & );
+
+ public:
+  ParsingPipeline( const std::vector<SentenceParser*> & parsers, ParsingWriter & writer, int first_seq, int _window );
+  ~ParsingPipeline();
+
+  //   , job->seq   . 
+  // false,    -  ,   
+  // .
+  bool Push( ParsingJob * job );
+
+  //  :      . 
+  //    -  ,   .
+  void Finish();
+};
+
+
+ParsingPipeline::ParsingPipeline( const std::vector<SentenceParser*> & parsers, ParsingWriter & writer, int first_seq, int _window )
+ : window(_window), next_seq(first_seq), next_write(first_seq), eof(false), aborted(false)
+{
+ for( lem::Container::size_type i=0; i<parsers.size(); ++i )
+  threads.create_thread( boost::bind( &ParsingPipeline::Worker, this, parsers[i] ) );
+
+ threads.create_thread( boost::bind( &ParsingPipeline::Writer, this, &writer ) );
+ return;
+}
+
+
+ParsingPipeline::~ParsingPipeline()
+{
+ Finish();
+ return;
+}
+
+
+bool ParsingPipeline::Push( ParsingJob * job )
+{
+ boost::mutex::scoped_lock lock(cs);
+ LEM_CHECKIT_Z( job->seq==next_seq );
+
+ while( next_seq-next_write>=window && !aborted )
+  window_free.wait(lock);
+
+ if( aborted )
+  {
+   delete job;
+   return false;
+  }
+
+ jobs.push_back(job);
+ next_seq++;
+ job_ready.notify_one();
+ return true;
+}
+
+
+void ParsingPipeline::Finish()
+{
+ {
+  boost::mutex::scoped_lock lock(cs);
+  if( eof )
+   return;
+
+  eof = true;
+  job_ready.notify_all();
+  result_ready.notify_all();
+ }
+
+ threads.join_all();
+
+ for( std::deque<ParsingJob*>::iterator it=jobs.begin(); it!=jobs.end(); ++it )
+  delete *it;
+ jobs.clear();
+
+ for( std::map<int,ParsingJob*>::iterator it=results.begin(); it!=results.end(); ++it )
+  delete it->second;
+ results.clear();
+
+ return;
+}
+
+
+void ParsingPipeline::Worker( SentenceParser * parser )
+{
+ while( true )
+  {
+   ParsingJob * job = NULL;
+
+   {
+    boost::mutex::scoped_lock lock(cs);
+    while( jobs.empty() && !eof && !aborted )
+     job_ready.wait(lock);
+
+    if( jobs.empty() || aborted )
+     break;
+
+    job = jobs.front();
+    jobs.pop_front();
+   }
+
+   parser->Process(*job);
+
+   boost::mutex::scoped_lock lock(cs);
+   results.insert( std::make_pair( job->seq, job ) );
+   if( job->seq==next_write )
+    result_ready.notify_one();
+  }
+
+ return;
+}
+
+
+void ParsingPipeline::Writer( ParsingWriter * writer )
+{
+ while( true )
+  {
+   ParsingJob * job = NULL;
+
+   {
+    boost::mutex::scoped_lock lock(cs);
+    while( true )
+     {
+      std::map<int,ParsingJob*>::iterator it = results.find(next_write);
+      if( it!=results.end() )
+       {
+        job = it->second;
+        results.erase(it);
+        break;
+       }
+
+      if( eof && next_write==next_seq )
+       return;
+
+      result_ready.wait(lock);
+     }
+   }
+
+   const bool ok = writer->Write(*job);
+   delete job;
+
+   boost::mutex::scoped_lock lock(cs);
+   if( !ok )
+    {
+     //   :     
+     //  ,     Push   .
+     aborted = true;
+     job_ready.notify_all();
+     window_free.notify_all();
+     return;
+    }
+
+   next_write++;
+   window_free.notify_one();
+  }
+}
+#endif
+
+
+
 int main( int argc, char *argv[] )
 {
  lem::LemInit initer;
@@ -240,6 +989,10 @@ int main( int argc, char *argv[] )
  bool emit_morph=true;
  int start_index=0;
  int max_count=lem::int_max;
+ int n_thread=1;          // 0 -   
+ bool resume=false;       //    
+ int checkpoint_every=0;  //     N 
+ int progress_every=0;    //    N 
 
  int tagger_type=-1; // -1 - none, 0 - CRF POS tagger
  int parser_type=-1; // -1 - none, 0 - DeSR, 1 - top-down
@@ -255,7 +1008,7 @@ int main( int argc, char *argv[] )
     opt = opt+1;
 
    try
-   { 
+   {
     if( strcmp( opt, "dict" )==0 )
      dict_path = lem::Path(argv[++i]);
     else if( strcmp( opt, "start_index" )==0 )
@@ -280,6 +1033,14 @@ int main( int argc, char *argv[] )
      eol = true;
     else if( strcmp( opt, "emit_morph" )==0 )
      emit_morph = lem::to_int(argv[++i])==1;
+    else if( strcmp( opt, "threads" )==0 )
+     n_thread = lem::to_int(argv[++i]);
+    else if( strcmp( opt, "resume" )==0 )
+     resume = true;
+    else if( strcmp( opt, "checkpoint" )==0 )
+     checkpoint_every = lem::to_int(argv[++i]);
+    else if( strcmp( opt, "progress" )==0 )
+     progress_every = lem::to_int(argv[++i]);
     else if( strcmp( opt, "d" )==0 )
      dict_path = lem::Path(argv[++i]);
     else if( strcmp( opt, "o" )==0 )
@@ -298,17 +1059,17 @@ int main( int argc, char *argv[] )
    }
    catch( const E_BaseException & e )
    {
-    lem::mout->printf( "Command line option %s parsing error: %us", e.what() );
+    lem::mout->printf( "Command line option %s parsing error: %us", argv[i], e.what() );
     exit(1);
    }
    catch( std::exception & e )
    {
-    lem::mout->printf( "Command line option %s parsing error: %s", e.what() );
+    lem::mout->printf( "Command line option %s parsing error: %s", argv[i], e.what() );
     exit(1);
    }
    catch(...)
    {
-    lem::mout->printf( "Command line option %s parsing error" );
+    lem::mout->printf( "Command line option %s parsing error", argv[i] );
     exit(1);
    }
   }
@@ -323,6 +1084,13 @@ int main( int argc, char *argv[] )
   }
  }
 
+ #if defined LEM_THREADS
+ if( n_thread<=0 )
+  n_thread = std::max( 1, int(boost::thread::hardware_concurrency()) );
+ #else
+ n_thread = 1;
+ #endif
+
 
  Dictionary dict;
 
@@ -357,8 +1125,15 @@ int main( int argc, char *argv[] )
 
  // -------------------------------------------------------------------------
 
+ ParsingParams params;
+ params.beam_size = beam_size;
+ params.tagger_type = tagger_type;
+ params.parser_type = parser_type;
+ params.emit_morph = emit_morph;
+ params.render_tree = render_tree;
+
  ModelCodeBook desr_codebook;
- void * hDESR = NULL;
+ params.desr_codebook = &desr_codebook;
 
  if( parser_type==0 )
   {
@@ -393,7 +1168,8 @@ int main( int argc, char *argv[] )
    lem::BinaryReader desr_codebook_stream( desr_codebook_path );
    desr_codebook.LoadBin( desr_codebook_stream );
 
-   hDESR = DesrInit( 10, desr_conf.GetAscii().c_str(), desr_model.GetAscii().c_str() );
+   params.desr_conf = desr_conf;
+   params.desr_model = desr_model;
   }
 
  // -------------------------------------------------------------------------
@@ -406,31 +1182,18 @@ int main( int argc, char *argv[] )
    exit(1);
   }
 
+ params.language_id = language_id;
 
- Solarix::WrittenTextAnalysisSession current_analysis( &dict, NULL );
- current_analysis.params.SetLanguageID(language_id);
- current_analysis.params.AllowPrimaryFuzzyWordRecog = false;
- current_analysis.params.AllowDynform = true;
- current_analysis.params.ApplyModel = true;
-
- //       
-// const int MaxMillisecTimeout = 180000;
- const int MaxMillisecTimeout = 0;
- current_analysis.params.timeout.max_elapsed_millisecs = MaxMillisecTimeout>0 ? MaxMillisecTimeout : lem::int_max;
-
- //   .        
- current_analysis.params.timeout.max_alt = beam_size;
-
- current_analysis.params.CompleteAnalysisOnly = false;
- current_analysis.params.ConfigureSkipToken();
-
- Solarix::CasingCoder& cc = dict.GetLexAuto().GetCasingCoder();
+ //    -   ,  .
+ std::vector<SentenceParser*> parsers;
+ for( int i=0; i<n_thread; ++i )
+  parsers.push_back( new SentenceParser( dict, params ) );
 
 
 /*
  // ------------------------------
  printf( "DEBUG parser.cpp 1\n" );
- 
+
  lem::UFString sentence0 = lem::from_utf8("Кошка и собаки спят.");
  current_analysis.ApplyFilters(sentence0);
 
@@ -451,20 +1214,74 @@ int main( int argc, char *argv[] )
   }
 
 
+ //       .
+ lem::UFString checkpoint_name( out_path.GetUnicode() );
+ checkpoint_name += L".checkpoint";
+ const lem::Path checkpoint_path( checkpoint_name );
 
- lem::OUFormatter out_stream( out_path );
- out_stream.printf( "<?xml version='1.0' encoding='utf-8' ?>\n<parsing>\n" );
+ int resume_sent_index=0, resume_counter=0, resume_word_count=0;
+ lem::Stream::pos_type resume_offset=0;
 
- lem::ElapsedTime elapsed_time;
- elapsed_time.start();
- int word_count=0;
- int counter=0;
+ if( resume )
+  {
+   if( out_path.DoesExist() && ParsingWriter::LoadCheckpoint( checkpoint_path, resume_sent_index, resume_counter, resume_word_count, resume_offset ) )
+    {
+     lem::mout->printf( "Resuming after sentence #%d, %d sentences already written\n", resume_sent_index, resume_counter );
+     start_index = std::max( start_index, resume_sent_index+1 );
+    }
+   else
+    {
+     lem::mout->printf( "No checkpoint [%us], starting from the beginning\n", checkpoint_path.GetUnicode().c_str() );
+     resume = false;
+    }
+  }
 
+ //        . , 
+ //    , :      
+ //       .
+ lem::Ptr<lem::Stream> out_file;
+ if( resume )
+  {
+   if( !ParsingWriter::TruncateOutput( out_path, resume_offset ) )
+    {
+     lem::mout->printf( "Can not truncate [%us] to the checkpoint offset %qd\n", out_path.GetUnicode().c_str(), lem::int64_t(resume_offset) );
+     exit(1);
+    }
+
+   out_file = new lem::BinaryUpdater( out_path );
+   out_file->seekp( resume_offset );
+  }
+ else
+  {
+   out_file = new lem::BinaryWriter( out_path );
+  }
+
+ lem::Char_Stream::UTF8_Reader * out_utf8 = new lem::Char_Stream::UTF8_Reader( out_file );
+ if( !resume )
+  out_utf8->Write_Beginning();
+
+ lem::OUFormatter out_stream( out_utf8, true );
+
+ if( !resume )
+  out_stream.printf( "<?xml version='1.0' encoding='utf-8' ?>\n<parsing>\n" );
+
+ ParsingWriter writer( out_stream, *out_file, checkpoint_path, checkpoint_every, progress_every, verbose );
+ writer.Start( resume_counter, resume_word_count );
+
+ int counter=resume_counter;
  int sent_count=0;
 
+ #if defined LEM_THREADS
+ lem::Ptr<ParsingPipeline> pipeline;
+ if( n_thread>1 )
+  pipeline = new ParsingPipeline( parsers, writer, counter, n_thread*16 );
+ #endif
+
+ bool stopped=false; //  ,   
+
  try
  {
-  for( int ifile=0; ifile<filenames.size() && sent_count<max_count; ++ifile )
+  for( int ifile=0; ifile<filenames.size() && sent_count<max_count && !stopped; ++ifile )
   {
    const lem::Path & input_file = filenames[ifile];
 
@@ -482,272 +1299,93 @@ int main( int argc, char *argv[] )
 
    while( segmenter->Fetch() )
    {
-    try
+    UFString sentence( segmenter->GetFetchedSentence() );
+    sent_count++;
+    if( sent_count<start_index )
+     continue;
+
+    if( sent_count>max_count )
+     break;
+
+    if( !sentence.empty() )
     {
-     UFString sentence( segmenter->GetFetchedSentence() );
-     sent_count++;
-     if( sent_count<start_index )
-      continue;
-   
-     if( sent_count>max_count )
-      break;
-   
-     if( !sentence.empty() )
-     {
-      sentence.trim();
-      lem::UFString xml_str = EncodeStrXml(sentence.c_str());
-      int paragraph_id = segmenter->GetFetchedParagraphID();
-      out_stream.printf( "\n\n<sentence paragraph_id='%d'>\n<text>%us</text>\n", paragraph_id, xml_str.c_str() );
-   
-   
-   
-      if( verbose )
-       lem::mout->printf( "%d: %us\n", counter, sentence.c_str() );
-   
-      counter++;
-   
-      if( parser_type==-1 )
-       {
-        if( tagger_type==0 )
-         {
-          //       ,    .
-          current_analysis.ApplyFilters(sentence);
-         }
-        else
-         {
-          //    POS Tagger...
-          current_analysis.MorphologicalAnalysis(sentence);
-         }
-   
-   
-   
-        const Res_Pack & pack0 = current_analysis.GetPack();
-        const Solarix::Variator & tagging = * pack0.vars().front();
-        DumpMorphTokens( dict, cc, tagging, emit_morph, out_stream );
-     
-     
-     
-        const int n_token = CastSizeToInt(tagging.roots_list().size()-2);
-        word_count += n_token;
-       }
-      else if( parser_type==0 )
-       {
-        // DESR  
-   
-   
-        //       ,    .
-        current_analysis.ApplyFilters(sentence);
-   
-        const Res_Pack & pack0 = current_analysis.GetPack();
-        const Solarix::Variator & tagging = * pack0.vars().front();
-   
-        if( tagger_type!=-1 )
-         DumpMorphTokens( dict, cc, tagging, emit_morph, out_stream );
-     
-     
-        const int n_token = CastSizeToInt(tagging.roots_list().size()-2);
-        word_count += n_token;
-   
-        
-        //  ,   POS Tagger'
-        out_stream.printf( "\n<syntax_tree>\n" );
-     
-     
-     
-        lem::FString desr_input;
-     
-        for( lem::Container::size_type i=1; i<tagging.roots_list().size()-1; ++i )
-        {
-         const Solarix::Word_Form & wf = tagging.roots_list()[i]->GetNode();
-     
-         const ModelTagMatcher * tm = desr_codebook.Match( &wf, dict );
-         int id_tag = tm==NULL ? -1 : tm->GetId();
-   
-         #if LEM_DEBUGGING==1
-         lem::mout->printf( "token #%d word=%us tag=%d ", i, wf.GetName()->c_str(), id_tag );
-         tm->Print( *lem::mout, dict );
-         lem::mout->eol();
-         tm->Match( wf, dict );
-         #endif
-         
-         desr_input.Add_Dirty( lem::format_str( "%d\t_\t_\t_\t%d\t_\t?\t?\t_\t_\n", CastSizeToInt(i), id_tag ) );
-        }
-     
-        // lem::mout->printf( "DEBUG: Before syntax...\n" );
-        char * desr_res_str = DesrTag( hDESR, desr_input.c_str() );
-        // lem::mout->printf( "DEBUG: After syntax...\n" );
-     
-     
-        std::string s_res( desr_res_str );
-     
-        //    
-        boost::regex rx_line( "^(.+?)\t(.+?)\t(.+?)\t(.+?)\t(.+?)\t(.+?)\t(.+?)\t(.+?)\t(.+?)\t(.+?)$", boost::regex_constants::icase );
-     
-        boost::sregex_iterator m2;
-        int itoken=1;
-        for( boost::sregex_iterator it( s_res.begin(), s_res.end(), rx_line ); it!=m2; ++it, ++itoken )
-        {
-         const boost::match_results<std::string::const_iterator> & mx = *it;
-         const std::string & parent_id = mx[7].str();
-         lem::UFString link_name = lem::from_utf8( mx[8].str().c_str() );
-     
-         int word_index = itoken-1;
-         int parent_index = lem::to_int(parent_id)-1;
-     
-         const Solarix::Word_Form & node_wf = tagging.roots_list()[itoken]->GetNode();
-         lem::UFString node_word( EncodeStrXml( node_wf.GetName()->c_str()) );
-     
-         if( parent_index==-1 )
-          {
-           out_stream.printf( "<node is_root='true'>" );
-           out_stream.printf( "<token>%d</token><word>%us</word><parent>-1</parent><parent_word></parent_word><link_type></link_type></node>\n", word_index, node_word.c_str() );
-          }
-         else
-          {
-           const Solarix::Word_Form & parent_wf = tagging.roots_list()[parent_index+1]->GetNode();
-           lem::UFString parent_word( EncodeStrXml( parent_wf.GetName()->c_str()) );
-           out_stream.printf( "<node><token>%d</token><word>%us</word><parent>%d</parent><parent_word>%us</parent_word><link_type>%us</link_type></node>\n", word_index, node_word.c_str(), parent_index, parent_word.c_str(), link_name.c_str() );
-          }
-     
-        }
-     
-     
-        DesrFreeResult( hDESR, desr_res_str );
-     
-     
-     
-        out_stream.printf( "</syntax_tree>\n" );
-        
-        
-       }
-      else if( parser_type==1 )
-       {
-        //  top-down 
-        //  POS Tagger  .
-   
-        current_analysis.SyntacticAnalysis(sentence);
-        const Res_Pack & linkage = current_analysis.GetPack();
-   
-        const Solarix::Variator & var = * linkage.vars().front();
-        int nroot = var.roots_list().size();
-   
-        Solarix::Variator tagging;
-        for( lem::Container::size_type i=0; i<var.roots_list().size(); ++i )
-         {
-          Solarix::Tree_Node * node = var.roots_list()[i];
-          tagging.Add( node );
-         }
-   
-        const int n_token = tagging.roots_list().size()-2;
-   
-        if( tagger_type!=-1 )
-         {
-          DumpMorphTokens( dict, cc, tagging, emit_morph, out_stream );
-          
-          for( lem::Container::size_type i=0; i<var.roots_list().size(); ++i )
-          {
-           tagging.ForgetTree(i);
-          }
-         }
-   
-        std::set<int> roots;
-        std::map<int, std::pair<int,int> > child_to_parent;
-        std::map<int,lem::UCString> node2word;
-   
-        out_stream.printf( "\n<syntax_tree>\n" );
-        for( lem::Container::size_type i=1; i<var.roots_list().size()-1; ++i )
-        {
-         const Solarix::Tree_Node & node = * var.roots_list()[i];
-     
-         roots.insert( node.GetNode().GetOriginPos() );
-         node2word.insert( std::make_pair( node.GetNode().GetOriginPos(), *node.GetNode().GetName() ) );
-     
-         AssembleEdges( node, child_to_parent, node2word );
-        }
-        
-        for( int word_pos=0; word_pos<n_token; ++word_pos )
+     sentence.trim();
+
+     ParsingJob * job = new ParsingJob();
+     job->seq = counter++;
+     job->sent_index = sent_count;
+     job->paragraph_id = segmenter->GetFetchedParagraphID();
+     job->sentence = sentence;
+
+     #if defined LEM_THREADS
+     if( pipeline.get()!=NULL )
+      {
+       if( !pipeline->Push(job) )
         {
-         lem::UFString node_word( EncodeStrXml( node2word[word_pos].c_str()) );
-     
-         if( roots.find(word_pos)!=roots.end() )
-          out_stream.printf( "<node is_root='true'><token>%d</token><word>%us</word><parent>-1</parent><link_type>ROOT</link_type></node>\n", word_pos, node_word.c_str() );
-         else if( child_to_parent.find(word_pos)==child_to_parent.end() )
-          out_stream.printf( "<node is_orphant='true'><token>%d</token><word>%us</word><parent>-1</parent><link_type>UNKNOWN</link_type></node>\n", word_pos, node_word.c_str() );
-         else
-          {
-           const std::pair<int,int> & parent_and_link = child_to_parent[ word_pos ];
-           const UCString & link_name = dict.GetSynGram().coords()[0].GetStateName( parent_and_link.second );
-           lem::UFString parent_word( EncodeStrXml( node2word[parent_and_link.first].c_str()) );
-           out_stream.printf( "<node><token>%d</token><word>%us</word><parent>%d</parent><parent_word>%us</parent_word><link_type>%us</link_type></node>\n", word_pos, node_word.c_str(), parent_and_link.first, parent_word.c_str(), link_name.c_str() );
-          }
+         stopped = true;
+         break;
         }
-     
-        out_stream.printf( "</syntax_tree>\n" );
-     
-        if( render_tree )
-         {
-          lem::MemFormatter mem;
-          Solarix::print_syntax_tree( L"", linkage, dict, mem, false, false );
-          lem::UFString str = mem.string();
-          lem::UFString encoded_tree = EncodeStrXml(str.c_str()).subst_all( '\r', ' ' );
-   
-          out_stream.printf( "<syntax_tree_rendering>\n<![CDATA[\n%us\n]]>\n</syntax_tree_rendering>\n", encoded_tree.c_str() );
-         }
-       }
 
+       continue;
+      }
+     #endif
 
-      out_stream.printf( "</sentence>\n" );
-     }
-    }
-    catch( const lem::E_BaseException & ex )
-    {
-     lem::mout->printf( "\nInternal parser error: %us\n", ex.what() );
-     exit(1);
-    }
-    catch( const std::exception &ex )
-    {
-     lem::mout->printf( "\nInternal parser error: %s\n", ex.what() );
-     exit(1);
-    }
-    catch(...)
-    {
-     lem::mout->printf( "\nUnknown internal parser error\n" );
-     exit(1);
+     parsers.front()->Process(*job);
+     const bool ok = writer.Write(*job);
+     delete job;
+
+     if( !ok )
+      {
+       stopped = true;
+       break;
+      }
     }
    }
 
    delete segmenter;
   }
+
+  #if defined LEM_THREADS
+  if( pipeline.get()!=NULL )
+   pipeline->Finish();
+  #endif
  }
  catch( const E_BaseException & e )
  {
-  lem::mout->printf( "Command line option %s parsing error: %us", e.what() );
+  lem::mout->printf( "\nError: %us\n", e.what() );
   exit(1);
  }
  catch( std::exception & e )
  {
-  lem::mout->printf( "Command line option %s parsing error: %s", e.what() );
+  lem::mout->printf( "\nError: %s\n", e.what() );
   exit(1);
  }
  catch(...)
  {
-  lem::mout->printf( "Unknown error" );
+  lem::mout->printf( "\nUnknown error\n" );
   exit(1);
  }
 
+ //      ,    .
+ //   ,      .
+ if( writer.Failed() )
+  {
+   writer.PrintError();
+   out_stream.flush();
+   exit(1);
+  }
 
  out_stream.printf( "\n</parsing>" );
  out_stream.close();
 
- elapsed_time.stop();
- boost::posix_time::time_duration dt = elapsed_time.elapsed();
+ writer.Finish( n_thread );
 
- lem::mout->printf( "Done, sentence_count=%d, elapsed_time=%d sec, rate=%g words/sec\n", counter, dt.total_seconds(), (word_count*1000.0/dt.total_milliseconds()) );
+ //  ,     .
+ if( checkpoint_every>0 && checkpoint_path.DoesExist() )
+  checkpoint_path.DoRemove();
+
+ for( lem::Container::size_type i=0; i<parsers.size(); ++i )
+  delete parsers[i];
 
- if( parser_type==0 )
-  {
-   DesrDeleteEngine(hDESR);
-  }
- 
  return 0;
 }
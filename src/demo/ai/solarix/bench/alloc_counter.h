@@ -0,0 +1,68 @@
+// -----------------------------------------------------------------------------
+// File ALLOC_COUNTER.H
+//
+// (c) by Koziev Elijah     all rights reserved
+//
+// SOLARIX Intellectronix Project http://www.solarix.ru
+//                                http://sourceforge.net/projects/solarix
+//
+// Content:
+//     :   operator new 
+// operator delete,    n_heap_alloc  
+// .     ,   .
+//  ,    .
+//
+//    ,     
+//   -     main.
+// -----------------------------------------------------------------------------
+//
+// CD->16.10.2026
+// LC->16.10.2026
+// --------------
+
+#if !defined BENCH_ALLOC_COUNTER__H
+ #define BENCH_ALLOC_COUNTER__H
+
+ #include <stdlib.h>
+ #include <new>
+ #include <lem/integer.h>
+
+ static lem::int64_t n_heap_alloc=0;
+
+ #if __cplusplus>=201103L
+  #define BENCH_THROW_BAD_ALLOC
+  #define BENCH_NOTHROW noexcept
+ #else
+  #define BENCH_THROW_BAD_ALLOC throw(std::bad_alloc)
+  #define BENCH_NOTHROW throw()
+ #endif
+
+ void* operator new( size_t size ) BENCH_THROW_BAD_ALLOC
+ {
+  n_heap_alloc++;
+  void *p = malloc( size ? size : 1 );
+  if( p==NULL )
+   throw std::bad_alloc();
+  return p;
+ }
+
+ void* operator new[]( size_t size ) BENCH_THROW_BAD_ALLOC
+ {
+  n_heap_alloc++;
+  void *p = malloc( size ? size : 1 );
+  if( p==NULL )
+   throw std::bad_alloc();
+  return p;
+ }
+
+ void operator delete( void *p ) BENCH_NOTHROW
+ {
+  free(p);
+ }
+
+ void operator delete[]( void *p ) BENCH_NOTHROW
+ {
+  free(p);
+ }
+
+#endif
@@ -0,0 +1,185 @@
+// -----------------------------------------------------------------------------
+// File ARENA_BENCH.CPP
+//
+// (c) by Koziev Elijah     all rights reserved
+//
+// SOLARIX Intellectronix Project http://www.solarix.ru
+//                                http://sourceforge.net/projects/solarix
+//
+// Content:
+//             
+//   ( :      
+//   new    delete)     .
+//
+//      SynPatternTreeNode::Match:  
+//    - LexerTextPos,  
+//      . 
+//    ,   ;  
+//      (BestResults::
+// Clear),  -   .    BestResults 
+// LexerTextPos,    .     
+//  operator new,    -  .
+//         .
+//
+// : arena_bench [_ [_ [__]]]
+// -----------------------------------------------------------------------------
+//
+// CD->16.10.2026
+// LC->16.10.2026
+// --------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include <lem/date_time.h>
+#include <lem/mem_arena.h>
+#include <lem/solarix/LexerTextPos.h>
+#include <lem/solarix/SynPatternBestResults.h>
+
+#include "alloc_counter.h"
+
+using namespace Solarix;
+
+static const int N_VARIANT=3; //   
+
+
+struct Stat
+{
+ long heap_alloc;
+ long arena_alloc;
+ double msec;
+ long checksum;
+
+ Stat(void) : heap_alloc(0), arena_alloc(0), msec(0), checksum(0) {}
+};
+
+
+static void ParseSentence( lem::MemArena *arena, int n_token, int n_candidate, unsigned int seed, Stat &stat )
+{
+ // :     .
+ std::vector<LexerTextPos*> tokens;
+ tokens.reserve( n_token*N_VARIANT );
+ const LexerTextPos *prev = NULL;
+ for( int i=0; i<n_token; ++i )
+  for( int k=0; k<N_VARIANT; ++k )
+   {
+    LexerTextPos *t = new(arena) LexerTextPos( prev, NULL, -k, i, 1, i );
+    tokens.push_back(t);
+    if( k==0 )
+     prev = t;
+   }
+
+ //      .
+ unsigned int r = seed;
+ for( int i=0; i<n_token; ++i )
+  {
+   BestResults *best = BestResults::Create(arena);
+   int best_len = 0;
+
+   for( int c=0; c<n_candidate; ++c )
+    {
+     r = r*1103515245u + 12345u;
+     const int len = 1 + int( (r>>8) % 4u );
+     if( len<best_len )
+      continue;
+
+     if( len>best_len )
+      {
+       best->Clear();
+       best_len = len;
+      }
+
+     MATCHING_ALTS *alts = best->New<MATCHING_ALTS>();
+     EXPORTED_COORDS *coords = best->New<EXPORTED_COORDS>();
+     EXPORTED_NODES *nodes = best->New<EXPORTED_NODES>();
+     for( int j=0; j<len; ++j )
+      {
+       const LexerTextPos *t = tokens[ ( (i+j)%n_token )*N_VARIANT ];
+       alts->insert( std::make_pair( t->GetWordform(), j ) );
+       coords->insert( std::make_pair( j, c ) );
+       nodes->push_back( std::make_pair( (const lem::UCString*)NULL, t->GetWordform() ) );
+      }
+
+     best->best_matching_alts.push_back(alts);
+     best->best_exported_coords.push_back(coords);
+     best->best_exported_nodes.push_back(nodes);
+     best->matching_len.push_back(len);
+     best->start_token.push_back( tokens[i*N_VARIANT] );
+    }
+
+   for( int k=0; k<best->matching_len.size(); ++k )
+    stat.checksum += best->matching_len[k] + int(best->best_matching_alts[k]->size());
+
+   BestResults::Destroy(best);
+  }
+
+ //  :      .
+ if( arena==NULL )
+  {
+   for( std::size_t i=0; i<tokens.size(); ++i )
+    delete tokens[i];
+  }
+ else
+  {
+   stat.arena_alloc += arena->CountAllocations();
+   arena->Reset();
+  }
+
+ return;
+}
+
+
+static Stat Run( bool use_arena, int n_sentence, int n_token, int n_candidate )
+{
+ Stat stat;
+ lem::MemArena arena;
+
+ const long heap0 = n_heap_alloc;
+ lem::ElapsedTime timer;
+ timer.start();
+
+ for( int i=0; i<n_sentence; ++i )
+  ParseSentence( use_arena ? &arena : NULL, n_token, n_candidate, unsigned(i)+1u, stat );
+
+ timer.stop();
+ stat.heap_alloc = n_heap_alloc-heap0;
+ stat.msec = timer.elapsed().total_microseconds()/1000.0;
+ return stat;
+}
+
+
+static void Print( const char *mode, const Stat &s, int n_sentence )
+{
+ printf( "%s\t%.1f\t%.1f\t%.4f\t%ld\n", mode, double(s.heap_alloc)/n_sentence,
+  double(s.arena_alloc)/n_sentence, s.msec/n_sentence, s.checksum );
+ return;
+}
+
+
+int main( int argc, char *argv[] )
+{
+ const int n_sentence = argc>1 ? atoi(argv[1]) : 2000;
+ const int n_token = argc>2 ? atoi(argv[2]) : 20;
+ const int n_candidate = argc>3 ? atoi(argv[3]) : 200;
+
+ printf( "# %d sentences, %d tokens, %d candidates per position\n", n_sentence, n_token, n_candidate );
+ printf( "mode\theap_allocs_per_sentence\tarena_allocs_per_sentence\tmsec_per_sentence\tchecksum\n" );
+
+ // ,        .
+ Run( false, n_sentence/10+1, n_token, n_candidate );
+
+ const Stat heap = Run( false, n_sentence, n_token, n_candidate );
+ const Stat arena = Run( true, n_sentence, n_token, n_candidate );
+
+ Print( "heap", heap, n_sentence );
+ Print( "arena", arena, n_sentence );
+
+ if( heap.checksum!=arena.checksum )
+  {
+   printf( "Checksum mismatch\n" );
+   return 1;
+  }
+
+ return 0;
+}
@@ -0,0 +1,177 @@
+// -----------------------------------------------------------------------------
+// File BATCH_BENCH.CPP
+//
+// (c) by Koziev Elijah     all rights reserved
+//
+// SOLARIX Intellectronix Project http://www.solarix.ru
+//                                http://sourceforge.net/projects/solarix
+//
+// Content:
+//      sol_SyntaxAnalysisBatch8
+//   : 1, 2, 4, 8   .     
+//         ,  
+//   (   ),   .
+//             .
+//
+// : batch_bench <dictionary.xml> <_utf8> [_]
+// -----------------------------------------------------------------------------
+//
+// CD->16.10.2026
+// LC->16.10.2026
+// --------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+#include <fstream>
+
+#include <boost/thread/thread.hpp>
+
+#include <lem/unicode.h>
+#include <lem/date_time.h>
+#include <lem/solarix/solarix_grammar_engine.h>
+
+
+//      n_batch ,   .
+static int RunCorpus(
+                     HGREN hEngine,
+                     const std::vector<const char*> &sentences,
+                     int n_batch,
+                     int n_thread
+                    )
+{
+ std::vector<HGREN_RESPACK> packs( n_batch );
+ int checksum=0;
+
+ for( size_t i0=0; i0<sentences.size(); i0+=n_batch )
+  {
+   const int n = int( std::min( sentences.size()-i0, size_t(n_batch) ) );
+
+   sol_SyntaxAnalysisBatch8(
+                            hEngine,
+                            (const char**)&sentences[i0],
+                            n,
+                            SOL_GREN_MODEL,
+                            SOL_GREN_REORDER_TREE,
+                            0,
+                            -1,
+                            n_thread,
+                            &packs[0]
+                           );
+
+   for( int k=0; k<n; ++k )
+    if( packs[k]!=NULL )
+     {
+      checksum += sol_CountRoots( packs[k], 0 );
+      sol_DeleteResPack( packs[k] );
+     }
+    else
+     {
+      checksum--;
+     }
+  }
+
+ return checksum;
+}
+
+
+int main( int argc, char *argv[] )
+{
+ if( argc<3 )
+  {
+   printf( "Usage: batch_bench <dictionary.xml> <corpus file, utf8, one sentence per line> [number of passes]\n" );
+   return 1;
+  }
+
+ const int n_pass = argc>3 ? atoi(argv[3]) : 1;
+
+ std::vector<std::string> lines;
+ std::ifstream rdr( argv[2] );
+ std::string line;
+ while( std::getline( rdr, line ) )
+  {
+   if( !line.empty() && line[line.size()-1]=='\r' )
+    line.erase( line.size()-1 );
+
+   if( !line.empty() )
+    lines.push_back(line);
+  }
+
+ if( lines.empty() )
+  {
+   printf( "No sentences in %s\n", argv[2] );
+   return 1;
+  }
+
+ std::vector<const char*> sentences;
+ for( size_t i=0; i<lines.size(); ++i )
+  sentences.push_back( lines[i].c_str() );
+
+ HGREN hEngine = sol_CreateGrammarEngineW( lem::from_utf8(argv[1]).c_str() );
+ if( hEngine==NULL )
+  {
+   printf( "Can not load dictionary %s\n", argv[1] );
+   return 1;
+  }
+
+ const int n_core = std::max( 1, int(boost::thread::hardware_concurrency()) );
+ const int n_batch = 256;
+
+ std::vector<int> thread_counts;
+ thread_counts.push_back(1);
+ thread_counts.push_back(2);
+ thread_counts.push_back(4);
+ thread_counts.push_back(8);
+ if( n_core!=1 && n_core!=2 && n_core!=4 && n_core!=8 )
+  thread_counts.push_back(n_core);
+
+ // :        .
+ RunCorpus( hEngine, sentences, n_batch, n_core );
+
+ printf( "# %d sentences, %d passes, batch=%d, %d cores\n", int(sentences.size()), n_pass, n_batch, n_core );
+ printf( "threads\tsec\tsent_per_sec\tspeedup\tchecksum\n" );
+
+ double base_rate=0;
+ int base_checksum=0;
+ bool ok=true;
+
+ for( size_t t=0; t<thread_counts.size(); ++t )
+  {
+   const int n_thread = thread_counts[t];
+   int checksum=0;
+
+   lem::ElapsedTime timer;
+   timer.start();
+
+   for( int ipass=0; ipass<n_pass; ++ipass )
+    checksum = RunCorpus( hEngine, sentences, n_batch, n_thread );
+
+   timer.stop();
+
+   const double sec = timer.elapsed().total_microseconds()/1000000.0;
+   const double rate = sec>0 ? sentences.size()*double(n_pass)/sec : 0.0;
+
+   if( t==0 )
+    {
+     base_rate = rate;
+     base_checksum = checksum;
+    }
+   else if( checksum!=base_checksum )
+    {
+     ok = false;
+    }
+
+   printf( "%d\t%.3f\t%.1f\t%.2f\t%d\n", n_thread, sec, rate, base_rate>0 ? rate/base_rate : 0.0, checksum );
+  }
+
+ sol_DeleteGrammarEngine(hEngine);
+
+ if( !ok )
+  {
+   printf( "ERROR: results differ between thread counts\n" );
+   return 1;
+  }
+
+ return 0;
+}
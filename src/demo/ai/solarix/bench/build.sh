@@ -0,0 +1,8 @@
+#  .   solarix_grammar_engine.so (engines/build.sh)
+
+if [ -d "/tmp/gren_bench" ]
+then echo "."
+else mkdir "/tmp/gren_bench"
+fi
+
+make -f makefile.linux64
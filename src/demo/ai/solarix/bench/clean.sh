@@ -0,0 +1 @@
+make clean -f makefile.linux64
@@ -0,0 +1,169 @@
+// -----------------------------------------------------------------------------
+// File ENTRIES_BENCH.CPP
+//
+// (c) by Koziev Elijah     all rights reserved
+//
+// SOLARIX Intellectronix Project http://www.solarix.ru
+//                                http://sourceforge.net/projects/solarix
+//
+// Content:
+//      WordEntries_File:  
+// (seek+read  BinaryReader   )  
+//         . 
+//     ,    
+//         1, 8  32 .
+//       .
+//
+// : entries_bench <dictionary.xml> [___] [_utf8]
+// -----------------------------------------------------------------------------
+//
+// CD->16.10.2026
+// LC->16.10.2026
+// --------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include <boost/thread/thread.hpp>
+#include <boost/bind.hpp>
+
+#include <lem/unicode.h>
+#include <lem/date_time.h>
+#include <lem/smart_pointers.h>
+#include <lem/solarix/dictionary.h>
+#include <lem/solarix/load_options.h>
+#include <lem/solarix/WordEntry.h>
+#include <lem/solarix/WordEntries_File.h>
+#include <lem/solarix/WrittenTextAnalysisSession.h>
+
+using namespace Solarix;
+
+
+struct BenchRun
+{
+ WordEntries_File *entries;
+ std::vector<int> keys;
+
+ void Worker( int n_touch, int seed, lem::int64_t *sum )
+ {
+  lem::int64_t s=0;
+  const int nkey = int(keys.size());
+
+  for( int i=0; i<n_touch; ++i )
+   {
+    const SG_Entry &e = entries->GetEntry( keys[ (seed+i) % nkey ] );
+    s += CastSizeToInt(e.forms().size());
+   }
+
+  *sum = s;
+  return;
+ }
+};
+
+
+int main( int argc, char *argv[] )
+{
+ if( argc<2 )
+  {
+   printf( "Usage: entries_bench <dictionary.xml> [entries per thread] [sentence, utf8]\n" );
+   return 1;
+  }
+
+ const int n_touch = argc>2 ? atoi(argv[2]) : 100000;
+ const lem::UFString sentence = argc>3 ? lem::UFString( lem::from_utf8(argv[3]).c_str() ) : lem::UFString();
+
+ printf( "mode\tthreads\tload_ms\tfirst_sentence_ms\tentries_per_sec\tchecksum\n" );
+
+ const char* mode_names[2] = { "stream", "mmap" };
+ const int n_threads[3] = { 1, 8, 32 };
+ lem::int64_t checksum0=-1;
+
+ for( int mode=0; mode<2; ++mode )
+  for( int it=0; it<3; ++it )
+   {
+    //      :      .
+    lem::Ptr<Dictionary> dict( new Dictionary );
+    Load_Options opt;
+    opt.affix_table = true;
+    opt.seeker = true;
+    opt.lexicon = false;
+
+    lem::ElapsedTime load_timer;
+    load_timer.start();
+    if( !dict->LoadModules( lem::Path(argv[1]), opt ) )
+     {
+      printf( "Can not load dictionary %s\n", argv[1] );
+      return 1;
+     }
+    load_timer.stop();
+
+    BenchRun run;
+    run.entries = dynamic_cast<WordEntries_File*>( &dict->GetSynGram().GetEntries() );
+    if( run.entries==NULL )
+     {
+      printf( "Lexicon of %s is not stored in the binary file\n", argv[1] );
+      return 1;
+     }
+
+    run.entries->SetEntryMapping( mode==1 );
+
+    double first_ms=0;
+    if( !sentence.empty() )
+     {
+      WrittenTextAnalysisSession session( &*dict, NULL );
+      session.params.SetLanguageID( dict->GetDefaultLanguage() );
+
+      lem::ElapsedTime timer;
+      timer.start();
+      session.MorphologicalAnalysis(sentence);
+      timer.stop();
+      first_ms = timer.elapsed().total_microseconds()/1000.0;
+     }
+
+    lem::MCollect<int> keys;
+    run.entries->ListEntryKeys(keys);
+    if( keys.empty() )
+     {
+      printf( "No entries in %s\n", argv[1] );
+      return 1;
+     }
+
+    run.keys.assign( keys.begin(), keys.end() );
+    srand(1);
+    std::random_shuffle( run.keys.begin(), run.keys.end() );
+
+    const int n_thread = n_threads[it];
+    std::vector<lem::int64_t> sums( n_thread, 0 );
+
+    lem::ElapsedTime timer;
+    timer.start();
+
+    boost::thread_group threads;
+    for( int i=0; i<n_thread; ++i )
+     threads.create_thread( boost::bind( &BenchRun::Worker, &run, n_touch, i*7919, &sums[i] ) );
+
+    threads.join_all();
+    timer.stop();
+
+    //        ,  
+    //       .
+    const lem::int64_t checksum = sums[0];
+    const double sec = timer.elapsed().total_microseconds()/1000000.0;
+
+    printf( "%s\t%d\t%d\t%.3f\t%.0f\t%lld\n", mode_names[mode], n_thread, load_timer.msec(), first_ms,
+     sec>0 ? double(n_thread)*n_touch/sec : 0.0, (long long)checksum );
+
+    if( checksum0==-1 )
+     checksum0 = checksum;
+    else if( checksum0!=checksum )
+     {
+      printf( "Mismatch between stream and mmap entries\n" );
+      return 1;
+     }
+   }
+
+ return 0;
+}
@@ -0,0 +1,179 @@
+// -----------------------------------------------------------------------------
+// File FUZZY_BENCH.CPP
+//
+// (c) by Koziev Elijah     all rights reserved
+//
+// SOLARIX Intellectronix Project http://www.solarix.ru
+//                                http://sourceforge.net/projects/solarix
+//
+// Content:
+//   :       BK-
+//   .       , 
+//  ListWordForms_Fuzzy    nmissmax=1 ( 
+// sol_ProjectMisspelledWord),    .
+//
+// : fuzzy_bench <dictionary.xml> <__utf8> [_]
+// -----------------------------------------------------------------------------
+//
+// CD->16.10.2026
+// LC->16.10.2026
+// --------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+#include <fstream>
+
+#include <lem/unicode.h>
+#include <lem/date_time.h>
+#include <lem/smart_pointers.h>
+#include <lem/solarix/dictionary.h>
+#include <lem/solarix/load_options.h>
+#include <lem/solarix/la_autom.h>
+#include <lem/solarix/WordEntries_File.h>
+#include <lem/solarix/WordFormEnumerator.h>
+
+using namespace Solarix;
+
+
+//         ,   .
+static double RunFuzzy( WordEntries &entries, const std::vector<lem::UCString> &words, lem::int64_t &checksum )
+{
+ lem::ElapsedTime timer;
+ timer.start();
+
+ checksum=0;
+ for( size_t i=0; i<words.size(); ++i )
+  {
+   lem::Ptr<WordFormEnumerator> wenum( entries.ListWordForms_Fuzzy( words[i], 0.7F ) );
+   int n=0;
+   while( wenum->Fetch() )
+    checksum += (++n)*( lem::int64_t(wenum->GetEntryKey())*31 + wenum->GetFormIndex() );
+  }
+
+ timer.stop();
+ const double sec = timer.elapsed().total_microseconds()/1000000.0;
+ return sec>0 ? words.size()/sec : 0.0;
+}
+
+
+static double RunMisspelled( LexicalAutomat &la, int id_lang, const std::vector<lem::UCString> &words, lem::int64_t &checksum )
+{
+ lem::ElapsedTime timer;
+ timer.start();
+
+ checksum=0;
+ for( size_t i=0; i<words.size(); ++i )
+  {
+   MCollect<Word_Coord> found_list;
+   MCollect<ProjScore> val_list;
+   PtrCollect<LA_ProjectInfo> inf_list;
+   la.ProjectWord( words[i], found_list, val_list, inf_list, LexicalAutomat::Wordforms, 1, id_lang, NULL );
+
+   for( lem::Container::size_type j=0; j<found_list.size(); ++j )
+    checksum += (j+1)*( lem::int64_t(found_list[j].GetEntry())*31 + found_list[j].GetForm() );
+  }
+
+ timer.stop();
+ const double sec = timer.elapsed().total_microseconds()/1000000.0;
+ return sec>0 ? words.size()/sec : 0.0;
+}
+
+
+int main( int argc, char *argv[] )
+{
+ if( argc<3 )
+  {
+   printf( "Usage: fuzzy_bench <dictionary.xml> <words file, utf8> [number of words]\n" );
+   return 1;
+  }
+
+ const size_t n_word = argc>3 ? atoi(argv[3]) : 200;
+
+ std::vector<lem::UCString> words;
+ std::ifstream rdr( argv[2] );
+ std::string line;
+ while( std::getline( rdr, line ) && words.size()<n_word )
+  {
+   if( !line.empty() && line[line.size()-1]=='\r' )
+    line.erase( line.size()-1 );
+
+   std::wstring w = lem::from_utf8(line);
+   if( w.length()<4 || w.length()>=lem::UCString::max_len )
+    continue;
+
+   // :        
+   std::swap( w[w.length()/2-1], w[w.length()/2] );
+
+   lem::UCString uw( w.c_str() );
+   uw.to_upper();
+   words.push_back(uw);
+  }
+
+ if( words.empty() )
+  {
+   printf( "No words in %s\n", argv[2] );
+   return 1;
+  }
+
+ Dictionary dict;
+ Load_Options opt;
+ opt.lexicon=true;
+ if( !dict.LoadModules( lem::Path(argv[1]), opt ) )
+  {
+   printf( "Can not load dictionary %s\n", argv[1] );
+   return 1;
+  }
+
+ WordEntries_File *entries = dynamic_cast<WordEntries_File*>( &dict.GetSynGram().GetEntries() );
+ if( entries==NULL )
+  {
+   printf( "Fuzzy index is available only for the lexicon stored in file\n" );
+   return 1;
+  }
+
+ const int id_lang = dict.GetDefaultLanguage();
+
+ //      BK-,    .
+ lem::ElapsedTime build_timer;
+ build_timer.start();
+ lem::MCollect<Word_Coord> dummy;
+ entries->FindFuzzyForms( words.front(), 1, dummy );
+ build_timer.stop();
+
+ printf( "index build: %d msec\n", build_timer.msec() );
+ printf( "query\tmode\twords_per_sec\tchecksum\n" );
+
+ lem::int64_t sum_scan=0, sum_index=0;
+
+ entries->SetFuzzyIndex(false);
+ const double fuzzy_scan = RunFuzzy( *entries, words, sum_scan );
+ entries->SetFuzzyIndex(true);
+ const double fuzzy_index = RunFuzzy( *entries, words, sum_index );
+
+ printf( "fuzzy\tscan\t%.1f\t%lld\n", fuzzy_scan, (long long)sum_scan );
+ printf( "fuzzy\tbktree\t%.1f\t%lld\n", fuzzy_index, (long long)sum_index );
+
+ if( sum_scan!=sum_index )
+  {
+   printf( "Mismatch between full scan and indexed fuzzy enumeration\n" );
+   return 1;
+  }
+
+ entries->SetFuzzyIndex(false);
+ const double miss_scan = RunMisspelled( dict.GetLexAuto(), id_lang, words, sum_scan );
+ entries->SetFuzzyIndex(true);
+ const double miss_index = RunMisspelled( dict.GetLexAuto(), id_lang, words, sum_index );
+
+ printf( "misspelled\tscan\t%.1f\t%lld\n", miss_scan, (long long)sum_scan );
+ printf( "misspelled\tbktree\t%.1f\t%lld\n", miss_index, (long long)sum_index );
+
+ if( sum_scan!=sum_index )
+  {
+   printf( "Mismatch between full scan and indexed misspelled projection\n" );
+   return 1;
+  }
+
+ return 0;
+}
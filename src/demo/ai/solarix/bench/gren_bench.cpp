@@ -0,0 +1,218 @@
+// -----------------------------------------------------------------------------
+// File GREN_BENCH.CPP
+//
+// (c) by Koziev Elijah     all rights reserved
+//
+// SOLARIX Intellectronix Project http://www.solarix.ru
+//                                http://sourceforge.net/projects/solarix
+//
+// Content:
+//    :   
+//   WrittenTextAnalysisSession,    (
+//  , CRF-,  ,    
+// ,  )   ,  
+// operator new,     p50/p99.   
+//   ,  other - ,      
+//  ( ,  ),     
+//  other    total.  -   ,  
+//  .
+//
+//        bench_corpus.txt.
+//
+// : gren_bench <dictionary.xml> <_utf8> [_] [morph|syntax]
+//         gren_bench dictionary.xml bench_corpus.txt 3 syntax
+// -----------------------------------------------------------------------------
+//
+// CD->16.10.2026
+// LC->16.10.2026
+// --------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <algorithm>
+
+#include <lem/unicode.h>
+#include <lem/date_time.h>
+#include <lem/smart_pointers.h>
+#include <lem/solarix/dictionary.h>
+#include <lem/solarix/load_options.h>
+#include <lem/solarix/TextAnalysisProfile.h>
+#include <lem/solarix/WrittenTextAnalysisSession.h>
+
+#include "alloc_counter.h"
+
+using namespace Solarix;
+
+
+static lem::int64_t CountHeapAllocations(void)
+{
+ return n_heap_alloc;
+}
+
+
+//    , q   0..100
+static lem::int64_t Percentile( const std::vector<lem::int64_t> &sorted, int q )
+{
+ if( sorted.empty() )
+  return 0;
+
+ size_t i = (sorted.size()*q)/100;
+ if( i>=sorted.size() )
+  i = sorted.size()-1;
+
+ return sorted[i];
+}
+
+
+static void PrintRow(
+                     const char *stage,
+                     std::vector<lem::int64_t> &lat,
+                     lem::int64_t n_alloc,
+                     lem::int64_t n_char
+                    )
+{
+ std::sort( lat.begin(), lat.end() );
+
+ lem::int64_t total=0;
+ for( size_t i=0; i<lat.size(); ++i )
+  total += lat[i];
+
+ const double sec = total/1000000.0;
+
+ printf( "%s\t%d\t%.3f\t%lld\t%.1f\t%.1f\t%lld\t%lld\n",
+  stage,
+  int(lat.size()),
+  total/1000.0,
+  (long long)n_alloc,
+  sec>0 ? lat.size()/sec : 0.0,
+  sec>0 ? n_char/sec : 0.0,
+  (long long)Percentile(lat,50),
+  (long long)Percentile(lat,99) );
+
+ return;
+}
+
+
+int main( int argc, char *argv[] )
+{
+ if( argc<3 )
+  {
+   printf( "Usage: gren_bench <dictionary.xml> <corpus file, utf8, one sentence per line> [number of passes] [morph|syntax]\n" );
+   return 1;
+  }
+
+ const int n_pass = argc>3 ? atoi(argv[3]) : 1;
+ const bool syntax = argc>4 ? strcmp(argv[4],"morph")!=0 : true;
+
+ std::vector<lem::UFString> sentences;
+ std::ifstream rdr( argv[2] );
+ std::string line;
+ while( std::getline( rdr, line ) )
+  {
+   if( !line.empty() && line[line.size()-1]=='\r' )
+    line.erase( line.size()-1 );
+
+   if( line.empty() )
+    continue;
+
+   sentences.push_back( lem::UFString( lem::from_utf8(line).c_str() ) );
+  }
+
+ if( sentences.empty() )
+  {
+   printf( "No sentences in %s\n", argv[2] );
+   return 1;
+  }
+
+ Dictionary dict;
+ Load_Options opt;
+ opt.affix_table = true;
+ opt.seeker = true;
+ opt.ngrams = true;
+ opt.lexicon = true;
+
+ lem::ElapsedTime load_timer;
+ load_timer.start();
+ if( !dict.LoadModules( lem::Path(argv[1]), opt ) )
+  {
+   printf( "Can not load dictionary %s\n", argv[1] );
+   return 1;
+  }
+ load_timer.stop();
+
+ WrittenTextAnalysisSession session( &dict, NULL );
+ session.params.SetLanguageID( dict.GetDefaultLanguage() );
+ session.params.CompleteAnalysisOnly = false;
+ session.params.UseTopDownThenSparse = true;
+ session.params.ApplyModel = true;
+ session.params.ReorderTree = true;
+
+ TextAnalysisProfile profile( CountHeapAllocations );
+ session.SetProfile(&profile);
+
+ std::vector<lem::int64_t> stage_lat[TextAnalysisProfile::STAGE_COUNT];
+ lem::int64_t stage_alloc[TextAnalysisProfile::STAGE_COUNT] = {0};
+ std::vector<lem::int64_t> total_lat, other_lat;
+ lem::int64_t total_heap=0, other_heap=0, n_char=0;
+
+ //        ,    .
+ const int n_run = n_pass>1 ? n_pass+1 : 1;
+
+ for( int ipass=0; ipass<n_run; ++ipass )
+  {
+   const bool warmup = n_run>1 && ipass==0;
+
+   for( size_t i=0; i<sentences.size(); ++i )
+    {
+     profile.Clear();
+     const lem::int64_t heap0 = n_heap_alloc;
+
+     lem::ElapsedTime timer;
+     timer.start();
+
+     if( syntax )
+      session.SyntacticAnalysis( sentences[i] );
+     else
+      session.MorphologicalAnalysis( sentences[i] );
+
+     timer.stop();
+
+     if( warmup )
+      continue;
+
+     const lem::int64_t usec = timer.elapsed().total_microseconds();
+     const lem::int64_t heap = n_heap_alloc-heap0;
+     total_lat.push_back( usec );
+     total_heap += heap;
+     n_char += sentences[i].length();
+
+     lem::int64_t other_usec=usec, other_alloc=heap;
+     for( int k=0; k<TextAnalysisProfile::STAGE_COUNT; ++k )
+      {
+       stage_lat[k].push_back( profile.usec[k] );
+       stage_alloc[k] += profile.n_alloc[k];
+       other_usec -= profile.usec[k];
+       other_alloc -= profile.n_alloc[k];
+      }
+
+     other_lat.push_back( other_usec>0 ? other_usec : 0 );
+     other_heap += other_alloc;
+    }
+  }
+
+ printf( "# dictionary load: %d msec, %d sentences, %d passes, mode=%s\n", load_timer.msec(), int(sentences.size()), n_pass, syntax ? "syntax" : "morph" );
+ printf( "stage\tcalls\ttotal_ms\tallocs\tsent_per_sec\tchars_per_sec\tp50_usec\tp99_usec\n" );
+
+ //    allocs -  operator new.
+ for( int k=0; k<TextAnalysisProfile::STAGE_COUNT; ++k )
+  PrintRow( TextAnalysisProfile::GetStageName(k), stage_lat[k], stage_alloc[k], n_char );
+
+ PrintRow( "other", other_lat, other_heap, n_char );
+ PrintRow( "total", total_lat, total_heap, n_char );
+
+ return 0;
+}
@@ -0,0 +1,146 @@
+// -----------------------------------------------------------------------------
+// File LANGID_BENCH.CPP
+//
+// (c) by Koziev Elijah     all rights reserved
+//
+// SOLARIX Intellectronix Project http://www.solarix.ru
+//                                http://sourceforge.net/projects/solarix
+//
+// Content:
+//      LexicalAutomat::GuessLanguage.
+//      ,   
+//      ,     
+// .      GraphGram::FindSymbol,
+//    LA_ScriptTable;     , 
+//       ,   .
+//
+// : langid_bench <dictionary.xml> <_utf8> [_]
+// -----------------------------------------------------------------------------
+//
+// CD->16.10.2026
+// LC->16.10.2026
+// --------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+#include <fstream>
+
+#include <lem/unicode.h>
+#include <lem/date_time.h>
+#include <lem/solarix/dictionary.h>
+#include <lem/solarix/load_options.h>
+#include <lem/solarix/la_autom.h>
+
+#include "alloc_counter.h"
+
+using namespace Solarix;
+
+
+static double Run(
+                  LexicalAutomat &la,
+                  const std::vector<lem::UFString> &lines,
+                  int n_pass,
+                  lem::int64_t &checksum,
+                  lem::int64_t &n_alloc
+                 )
+{
+ checksum=0;
+ const lem::int64_t heap0 = n_heap_alloc;
+
+ lem::ElapsedTime timer;
+ timer.start();
+
+ for( int ipass=0; ipass<n_pass; ++ipass )
+  for( size_t i=0; i<lines.size(); ++i )
+   checksum += (i+1)*( la.GuessLanguage( lines[i] )+2 );
+
+ timer.stop();
+ n_alloc = n_heap_alloc-heap0;
+
+ const double sec = timer.elapsed().total_microseconds()/1000000.0;
+ return sec>0 ? lines.size()*n_pass/sec : 0.0;
+}
+
+
+int main( int argc, char *argv[] )
+{
+ if( argc<3 )
+  {
+   printf( "Usage: langid_bench <dictionary.xml> <text file, utf8> [number of passes]\n" );
+   return 1;
+  }
+
+ const int n_pass = argc>3 ? atoi(argv[3]) : 3;
+
+ std::vector<lem::UFString> lines;
+ std::ifstream rdr( argv[2] );
+ std::string line;
+ while( std::getline( rdr, line ) )
+  {
+   if( !line.empty() && line[line.size()-1]=='\r' )
+    line.erase( line.size()-1 );
+
+   std::wstring w = lem::from_utf8(line);
+   if( !w.empty() )
+    lines.push_back( lem::UFString( w.c_str() ) );
+  }
+
+ if( lines.empty() )
+  {
+   printf( "No text in %s\n", argv[2] );
+   return 1;
+  }
+
+ //    :       .
+ std::vector<lem::UFString> mixed;
+ const size_t half = lines.size()/2;
+ for( size_t i=0; i<lines.size(); ++i )
+  {
+   lem::UFString s( lines[i] );
+   s += L' ';
+   s += lines[ (i+half) % lines.size() ];
+   mixed.push_back(s);
+  }
+
+ Dictionary dict;
+ Load_Options opt;
+ opt.lexicon=true;
+ if( !dict.LoadModules( lem::Path(argv[1]), opt ) )
+  {
+   printf( "Can not load dictionary %s\n", argv[1] );
+   return 1;
+  }
+
+ LexicalAutomat &la = dict.GetLexAuto();
+
+ printf( "# %d lines, %d passes\n", int(lines.size()), n_pass );
+ printf( "input\tmode\tlines_per_sec\tallocs_per_line\tchecksum\n" );
+
+ int rc=0;
+ for( int k=0; k<2; ++k )
+  {
+   const std::vector<lem::UFString> &input = k==0 ? lines : mixed;
+   const char *input_name = k==0 ? "lines" : "mixed";
+   const lem::int64_t n_call = lem::int64_t(input.size())*n_pass;
+
+   lem::int64_t sum_symbols=0, sum_table=0, n_alloc=0;
+
+   la.SetScriptTable(false);
+   double lps = Run( la, input, n_pass, sum_symbols, n_alloc );
+   printf( "%s\tfind_symbol\t%.1f\t%.2f\t%lld\n", input_name, lps, double(n_alloc)/n_call, (long long)sum_symbols );
+
+   la.SetScriptTable(true);
+   lps = Run( la, input, n_pass, sum_table, n_alloc );
+   printf( "%s\tscript_table\t%.1f\t%.2f\t%lld\n", input_name, lps, double(n_alloc)/n_call, (long long)sum_table );
+
+   if( sum_symbols!=sum_table )
+    {
+     printf( "Mismatch between symbol lookup and script table for %s\n", input_name );
+     rc=1;
+    }
+  }
+
+ return rc;
+}
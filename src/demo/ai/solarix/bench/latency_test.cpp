@@ -0,0 +1,196 @@
+// -----------------------------------------------------------------------------
+// File LATENCY_TEST.CPP
+//
+// (c) by Koziev Elijah     all rights reserved
+//
+// SOLARIX Intellectronix Project http://www.solarix.ru
+//                                http://sourceforge.net/projects/solarix
+//
+// Content:
+//     .
+//
+// 1.  : ElapsedTimeConstraint   20, 50  100  
+//             ,    5 
+//        100 .
+//
+// 2.  :     adversarial_sentences.txt
+//    (     )  sol_SyntaxAnalysis8
+//        Constraints.     
+//         ,      
+//      -     .
+//
+//        .
+//
+// : latency_test [<dictionary.xml> <adversarial_sentences.txt> [_ [_]]]
+// -----------------------------------------------------------------------------
+//
+// CD->16.10.2026
+// LC->16.10.2026
+// --------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+#include <fstream>
+
+#include <lem/unicode.h>
+#include <lem/date_time.h>
+#include <lem/solarix/ElapsedTimeConstraint.h>
+#include <lem/solarix/solarix_grammar_engine.h>
+
+using namespace Solarix;
+
+static int n_failed=0;
+
+
+//  :      Exceeded()  ,
+//      .
+static int SimulateParsing( const ElapsedTimeConstraint &constraint, int max_millisec )
+{
+ lem::ElapsedTime timer;
+ timer.start();
+
+ volatile int sink=0;
+ while( !constraint.Exceeded() )
+  {
+   for( int i=0; i<10000; ++i )
+    sink += i;
+
+   if( timer.msec()>max_millisec )
+    break;
+  }
+
+ return timer.msec();
+}
+
+
+static void TestTimer( int slack )
+{
+ const int budgets[3] = { 20, 50, 100 };
+ for( int i=0; i<3; ++i )
+  {
+   ElapsedTimeConstraint constraint( budgets[i] );
+   const int elapsed = SimulateParsing( constraint, budgets[i]+slack+1000 );
+
+   const bool ok = constraint.Exceeded() && elapsed>=budgets[i]-1 && elapsed<=budgets[i]+slack;
+   printf( "timer budget=%d ms elapsed=%d ms %s\n", budgets[i], elapsed, ok ? "ok" : "FAILED" );
+   if( !ok )
+    n_failed++;
+  }
+
+ ElapsedTimeConstraint long_constraint(5000);
+ SimulateParsing( long_constraint, 100 );
+ if( long_constraint.Exceeded() )
+  {
+   printf( "timer budget=5000 ms FAILED: exceeded after 100 ms\n" );
+   n_failed++;
+  }
+
+ return;
+}
+
+
+static void TestSentences( const char *dictionary_xml, const char *sentences_path, int budget, int slack )
+{
+ std::vector<std::string> sentences;
+ std::ifstream rdr( sentences_path );
+ std::string line;
+ while( std::getline( rdr, line ) )
+  {
+   if( !line.empty() && line[line.size()-1]=='\r' )
+    line.erase( line.size()-1 );
+
+   if( !line.empty() )
+    sentences.push_back(line);
+  }
+
+ if( sentences.empty() )
+  {
+   printf( "No sentences in %s\n", sentences_path );
+   n_failed++;
+   return;
+  }
+
+ HGREN hEngine = sol_CreateGrammarEngineW( lem::from_utf8(dictionary_xml).c_str() );
+ if( hEngine==NULL )
+  {
+   printf( "Can not load dictionary %s\n", dictionary_xml );
+   n_failed++;
+   return;
+  }
+
+ // :        .
+ HGREN_RESPACK warmup = sol_SyntaxAnalysis8( hEngine, sentences[0].c_str(), 0, 0, 0, -1 );
+ if( warmup!=NULL )
+  sol_DeleteResPack(warmup);
+
+ //      Constraints,    .
+ const int constraints = budget & 0x002fffff;
+
+ int n_cutoff=0, max_elapsed=0;
+
+ printf( "# budget=%d ms, slack=%d ms, %d sentences\n", budget, slack, int(sentences.size()) );
+ printf( "n\tms\troots\tstatus\n" );
+
+ for( size_t i=0; i<sentences.size(); ++i )
+  {
+   lem::ElapsedTime timer;
+   timer.start();
+
+   HGREN_RESPACK hPack = sol_SyntaxAnalysis8( hEngine, sentences[i].c_str(), SOL_GREN_ALLOW_FUZZY, 0, constraints, -1 );
+
+   const int elapsed = timer.msec();
+   max_elapsed = std::max( max_elapsed, elapsed );
+
+   if( elapsed>=budget )
+    n_cutoff++;
+
+   const int n_root = hPack==NULL ? -1 : sol_CountRoots( hPack, 0 );
+   const bool ok = hPack!=NULL && elapsed<=budget+slack;
+   if( !ok )
+    n_failed++;
+
+   printf( "%d\t%d\t%d\t%s\n", int(i), elapsed, n_root, ok ? "ok" : "FAILED" );
+
+   if( hPack!=NULL )
+    sol_DeleteResPack(hPack);
+  }
+
+ sol_DeleteGrammarEngine(hEngine);
+
+ printf( "max=%d ms, %d of %d sentences reached the budget\n", max_elapsed, n_cutoff, int(sentences.size()) );
+
+ if( n_cutoff==0 )
+  {
+   printf( "FAILED: no sentence reached the budget, the cutoff was not exercised\n" );
+   n_failed++;
+  }
+
+ return;
+}
+
+
+int main( int argc, char *argv[] )
+{
+ if( argc==2 || argc>6 )
+  {
+   printf( "Usage: latency_test [<dictionary.xml> <sentences file, utf8, one sentence per line> [budget ms [slack ms]]]\n" );
+   return 1;
+  }
+
+ const int budget = argc>3 ? atoi(argv[3]) : 100;
+ const int slack = argc>4 ? atoi(argv[4]) : 250;
+
+ TestTimer(20);
+
+ if( argc>=3 )
+  TestSentences( argv[1], argv[2], budget, slack );
+
+ if( n_failed==0 )
+  printf( "All tests passed\n" );
+ else
+  printf( "%d check(s) failed\n", n_failed );
+
+ return n_failed==0 ? 0 : 1;
+}
@@ -0,0 +1,140 @@
+// -----------------------------------------------------------------------------
+// File LEMMATIZATOR_BENCH.CPP
+//
+// (c) by Koziev Elijah     all rights reserved
+//
+// SOLARIX Intellectronix Project http://www.solarix.ru
+//                                http://sourceforge.net/projects/solarix
+//
+// Content:
+//     :  
+// (LEME_DEFAULT,    )     
+// (LEME_FASTER,   ).    1, 8  32 .
+//
+// : lemmatizator_bench <lemmatizer.db> <__utf8> [__]
+// -----------------------------------------------------------------------------
+//
+// CD->16.10.2026
+// LC->16.10.2026
+// --------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+#include <fstream>
+
+#include <boost/thread/thread.hpp>
+#include <boost/bind.hpp>
+
+#include <lem/unicode.h>
+#include <lem/date_time.h>
+#include <lem/solarix/Lemmatizator.h>
+#include <lem/solarix/LemmatizatorFlags.h>
+
+using namespace Solarix;
+
+
+static void Worker(
+                   Lemmatizator *lemm,
+                   const std::vector<lem::UCString> *words,
+                   int n_word,
+                   int seed,
+                   int *checksum
+                  )
+{
+ int sum=0;
+ lem::UCString lemma;
+
+ for( int i=0; i<n_word; ++i )
+  {
+   const lem::UCString &w = (*words)[ (seed+i) % words->size() ];
+   lemm->Lemmatize( w, lemma );
+   sum += lemma.length();
+  }
+
+ *checksum = sum;
+ return;
+}
+
+
+static double Run( Lemmatizator &lemm, const std::vector<lem::UCString> &words, int n_thread, int n_word, int &checksum )
+{
+ std::vector<int> sums( n_thread, 0 );
+
+ lem::ElapsedTime timer;
+ timer.start();
+
+ boost::thread_group threads;
+ for( int i=0; i<n_thread; ++i )
+  threads.create_thread( boost::bind( &Worker, &lemm, &words, n_word, i*7919, &sums[i] ) );
+
+ threads.join_all();
+ timer.stop();
+
+ checksum=0;
+ for( int i=0; i<n_thread; ++i )
+  checksum += sums[i];
+
+ const double sec = timer.elapsed().total_microseconds()/1000000.0;
+ return sec>0 ? double(n_thread)*n_word/sec : 0.0;
+}
+
+
+int main( int argc, char *argv[] )
+{
+ if( argc<3 )
+  {
+   printf( "Usage: lemmatizator_bench <lemmatizer.db> <words file, utf8> [words per thread]\n" );
+   return 1;
+  }
+
+ const int n_word = argc>3 ? atoi(argv[3]) : 200000;
+
+ std::vector<lem::UCString> words;
+ std::ifstream rdr( argv[2] );
+ std::string line;
+ while( std::getline( rdr, line ) )
+  {
+   if( !line.empty() && line[line.size()-1]=='\r' )
+    line.erase( line.size()-1 );
+
+   if( line.empty() )
+    continue;
+
+   const std::wstring w = lem::from_utf8(line);
+   if( w.length()<lem::UCString::max_len )
+    words.push_back( lem::UCString( w.c_str() ) );
+  }
+
+ if( words.empty() )
+  {
+   printf( "No words in %s\n", argv[2] );
+   return 1;
+  }
+
+ Lemmatizator stream_lemm, mapped_lemm;
+ stream_lemm.Load( lem::Path(argv[1]), LEME_DEFAULT );
+ mapped_lemm.Load( lem::Path(argv[1]), LEME_FASTER );
+
+ printf( "threads\tmode\twords_per_sec\tchecksum\n" );
+
+ const int n_threads[3] = { 1, 8, 32 };
+ for( int i=0; i<3; ++i )
+  {
+   int sum_stream=0, sum_mapped=0;
+   const double stream = Run( stream_lemm, words, n_threads[i], n_word, sum_stream );
+   const double mapped = Run( mapped_lemm, words, n_threads[i], n_word, sum_mapped );
+
+   printf( "%d\tstream\t%.0f\t%d\n", n_threads[i], stream, sum_stream );
+   printf( "%d\tmmap\t%.0f\t%d\n", n_threads[i], mapped, sum_mapped );
+
+   if( sum_stream!=sum_mapped )
+    {
+     printf( "Mismatch between stream and mmap lemmatization\n" );
+     return 1;
+    }
+  }
+
+ return 0;
+}
@@ -0,0 +1,243 @@
+// -----------------------------------------------------------------------------
+// File LEXEM_DICTIONARY_TEST.CPP
+//
+// (c) by Koziev Elijah     all rights reserved
+//
+// SOLARIX Intellectronix Project http://www.solarix.ru
+//                                http://sourceforge.net/projects/solarix
+//
+// Content:
+//    LexemDictionary    
+// Lexem.     FindId   GetString 
+//  ,       , 
+//      items+, GetId  
+//    ,  reattach -     
+// ,         .
+//         
+//     .   .   
+//     .
+//
+// : lexem_dictionary_test [_]
+// -----------------------------------------------------------------------------
+//
+// CD->16.10.2026
+// LC->16.10.2026
+// --------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include <lem/path.h>
+#include <lem/streams.h>
+#include <lem/solarix/LexemDictionary.h>
+
+#include "lexeme_gen.h"
+
+#if defined LEM_THREADS
+#include <boost/thread/thread.hpp>
+#endif
+
+using namespace Solarix;
+
+static int n_failed=0;
+
+#define TEST_CHECK(x) \
+ if( !(x) ) { printf( "FAILED line %d: %s\n", __LINE__, #x ); n_failed++; }
+
+
+static void TestLoad( const std::vector<Lexem> &lexems, const lem::Path &path )
+{
+ const int n = CastSizeToInt(lexems.size());
+
+ LexemDictionary dict( n+100 );
+ {
+  lem::BinaryReader bin( path );
+  dict.LoadBin( bin );
+ }
+
+ TEST_CHECK( CastSizeToInt(dict.size())==n );
+ TEST_CHECK( dict.CountMaterialized()==0 );
+
+ //           Lexem.
+ int n_bad=0;
+ for( int i=0; i<n; ++i )
+  {
+   if( dict.FindId(lexems[i])!=i || dict.GetString(i)!=lexems[i] )
+    n_bad++;
+
+   lem::UCString miss( lexems[i] );
+   miss += L'#';
+   if( dict.FindId(miss)!=UNKNOWN )
+    n_bad++;
+  }
+
+ TEST_CHECK( n_bad==0 );
+ TEST_CHECK( dict.CountMaterialized()==0 );
+
+ //        ,   
+ //        .
+ const int i_mid = n/2;
+ const Lexem *p_mid = &dict[i_mid];
+ TEST_CHECK( *p_mid==lexems[i_mid] );
+ TEST_CHECK( dict.CountMaterialized()>0 && dict.CountMaterialized()<n/4 );
+ TEST_CHECK( &dict[i_mid]==p_mid );
+ TEST_CHECK( &dict[i_mid+1]==p_mid+1 );
+ TEST_CHECK( &dict[0]+i_mid==p_mid );
+
+ TEST_CHECK( dict.GetId(p_mid)==i_mid );
+ TEST_CHECK( dict.GetId(NULL)==UNKNOWN );
+ TEST_CHECK( dict.GetId(&lexems[i_mid])==UNKNOWN );
+ TEST_CHECK( dict.GetId(&dict[n-1]+1)==UNKNOWN );
+
+ TEST_CHECK( dict.Find(lexems[i_mid])==p_mid );
+ lem::UCString miss( lexems[i_mid] );
+ miss += L'#';
+ TEST_CHECK( dict.Find( Lexem(miss) )==NULL );
+
+ //       .
+ n_bad=0;
+ for( int i=0; i<n; ++i )
+  {
+   const Lexem *p = dict.reattach( &lexems[i] );
+   if( p!=&dict[i] || *p!=lexems[i] || dict.GetId(p)!=i )
+    n_bad++;
+  }
+
+ TEST_CHECK( n_bad==0 );
+ TEST_CHECK( dict.CountMaterialized()==n );
+
+ //        ,
+ //    .
+ const Lexem *p_null = dict.reattach(NULL);
+ TEST_CHECK( p_null!=NULL && dict.GetId(p_null)==UNKNOWN );
+
+ //        :  
+ //       .
+ const lem::Path path2( lem::Path::GetTmpFilename("bin") );
+ {
+  lem::BinaryWriter bin( path2 );
+  dict.SaveBin(bin);
+ }
+
+ LexemDictionary dict2( n );
+ {
+  lem::BinaryReader bin( path2 );
+  dict2.LoadBin(bin);
+ }
+
+ path2.DoRemove();
+
+ TEST_CHECK( CastSizeToInt(dict2.size())==n );
+ TEST_CHECK( dict2.CountMaterialized()==0 );
+
+ n_bad=0;
+ for( int i=0; i<n; i+=7 )
+  {
+   const Lexem *p = dict2.reattach( &dict[i] );
+   if( p!=&dict2[i] || *p!=lexems[i] || dict2.GetId(p)!=i || dict2.FindId(lexems[i])!=i )
+    n_bad++;
+  }
+
+ TEST_CHECK( n_bad==0 );
+
+ printf( "lexemes=%d materialized=%d memory=%llu\n", n, dict.CountMaterialized(), (unsigned long long)dict.GetMemoryUsage() );
+ return;
+}
+
+
+#if defined LEM_THREADS
+namespace
+{
+ //         ,  
+ //         .
+ struct MaterializeWorker
+ {
+  const LexemDictionary *dict;
+  const std::vector<Lexem> *lexems;
+  int step;
+  int n_bad;
+
+  MaterializeWorker( const LexemDictionary *_dict, const std::vector<Lexem> *_lexems, int _step )
+   : dict(_dict), lexems(_lexems), step(_step), n_bad(0) {}
+
+  void operator()()
+  {
+   const int n = CastSizeToInt(lexems->size());
+   for( int k=0, i=0; k<n; ++k, i=(i+step)%n )
+    {
+     const Lexem *p = &(*dict)[i];
+     if( p!=&(*dict)[0]+i || *p!=(*lexems)[i] || dict->GetId(p)!=i )
+      n_bad++;
+    }
+  }
+ };
+}
+
+
+static void TestConcurrency( const std::vector<Lexem> &lexems, const lem::Path &path, int n_thread )
+{
+ const int n = CastSizeToInt(lexems.size());
+
+ LexemDictionary dict( n );
+ {
+  lem::BinaryReader bin( path );
+  dict.LoadBin( bin );
+ }
+
+ //      ,    .
+ std::vector<MaterializeWorker> workers;
+ for( int i=0; i<n_thread; ++i )
+  {
+   int step = 1 + 2*i;
+   while( n%step==0 )
+    step += 2;
+
+   workers.push_back( MaterializeWorker( &dict, &lexems, step ) );
+  }
+
+ boost::thread_group group;
+ for( int i=0; i<n_thread; ++i )
+  group.create_thread( boost::ref(workers[i]) );
+ group.join_all();
+
+ int n_bad=0;
+ for( int i=0; i<n_thread; ++i )
+  n_bad += workers[i].n_bad;
+
+ TEST_CHECK( n_bad==0 );
+ TEST_CHECK( dict.CountMaterialized()==n );
+
+ printf( "threads=%d lexemes=%d\n", n_thread, n );
+ return;
+}
+#endif
+
+
+int main( int argc, char *argv[] )
+{
+ const int n_thread = argc>1 ? atoi(argv[1]) : 8;
+
+ std::vector<Lexem> lexems;
+ GenerateLexemes( 5000, 6, lexems );
+
+ const lem::Path path( lem::Path::GetTmpFilename("bin") );
+ //        
+ // lexems,   reattach      .
+ WriteRawLexemes( path, lexems, &lexems.front() );
+
+ TestLoad( lexems, path );
+
+ #if defined LEM_THREADS
+ TestConcurrency( lexems, path, n_thread>0 ? n_thread : 1 );
+ #endif
+
+ path.DoRemove();
+
+ if( n_failed==0 )
+  printf( "All tests passed\n" );
+ else
+  printf( "%d check(s) failed\n", n_failed );
+
+ return n_failed==0 ? 0 : 1;
+}
@@ -0,0 +1,115 @@
+// -----------------------------------------------------------------------------
+// File LEXEME_GEN.H
+//
+// (c) by Koziev Elijah     all rights reserved
+//
+// SOLARIX Intellectronix Project http://www.solarix.ru
+//                                http://sourceforge.net/projects/solarix
+//
+// Content:
+//       LexemDictionary, 
+//   . GenerateLexemes     
+//     -     ,  
+//  . WriteLexemes   ,   
+// ,  LexemDictionary::SaveBin  .
+//
+//   SOL_LOADTXT    ,  
+//      (WriteRawLexemes).    
+// reattach,        .
+// -----------------------------------------------------------------------------
+//
+// CD->16.10.2026
+// LC->16.10.2026
+// --------------
+
+#if !defined BENCH_LEXEME_GEN__H
+ #define BENCH_LEXEME_GEN__H
+
+ #include <vector>
+ #include <set>
+ #include <lem/path.h>
+ #include <lem/streams.h>
+ #include <lem/solarix/LexemDictionary.h>
+
+ //   BENCH_MAX_FORMS   ,  .
+ const int BENCH_MAX_FORMS=12;
+
+ inline void GenerateLexemes( int n_stem, int n_forms, std::vector<Solarix::Lexem> &lexems )
+ {
+  // : -, , , , , , , , , , , 
+  const wchar_t *endings[BENCH_MAX_FORMS] = {
+   L"", L"\x0410", L"\x042b", L"\x0415", L"\x0423", L"\x041e\x0419",
+   L"\x041e\x042e", L"\x0410\x041c\x0418", L"\x0410\x0425", L"\x0410\x041c", L"\x041e\x0412", L"\x0415\x0419"
+  };
+
+  std::set<Solarix::Lexem> seen;
+  unsigned int r=12345u;
+  for( int i=0; i<n_stem; ++i )
+   {
+    lem::UCString stem;
+    const int len = 3 + int((r>>7)%7);
+    for( int k=0; k<len; ++k )
+     {
+      r = r*1103515245u + 12345u;
+      stem += wchar_t( 0x0410 + (r>>9)%32 );
+     }
+
+    for( int j=0; j<n_forms && j<BENCH_MAX_FORMS; ++j )
+     {
+      Solarix::Lexem s( stem );
+      s += endings[j];
+      if( seen.insert(s).second )
+       lexems.push_back(s);
+     }
+   }
+
+  return;
+ }
+
+
+ //  LexemDictionary::LoadBin  . first   
+ //    ,   reattach  .
+ inline void WriteRawLexemes( const lem::Path &path, const std::vector<Solarix::Lexem> &lexems, const Solarix::Lexem *first )
+ {
+  lem::BinaryWriter bin( path );
+  bin.write( &first, sizeof(first) );
+  const int n = CastSizeToInt(lexems.size());
+  bin.write( &n, sizeof(n) );
+  for( int i=0; i<n; ++i )
+   {
+    const lem::uint8_t packed=0;
+    bin.write( &packed, sizeof(packed) );
+    lexems[i].SaveBin(bin);
+   }
+
+  lem::Stream::pos_type pos = bin.tellp();
+  bin.write( &pos, sizeof(pos) );
+  return;
+ }
+
+
+ //     .    
+ // ,    lexems .
+ inline void WriteLexemes( const lem::Path &path, std::vector<Solarix::Lexem> &lexems )
+ {
+  std::set<Solarix::Lexem> seen;
+  std::vector<Solarix::Lexem> unique;
+  for( std::size_t i=0; i<lexems.size(); ++i )
+   if( seen.insert( lexems[i] ).second )
+    unique.push_back( lexems[i] );
+
+  lexems.swap( unique );
+
+  Solarix::LexemDictionary dict( CastSizeToInt(lexems.size()) );
+  WriteRawLexemes( path, lexems, NULL );
+  {
+   lem::BinaryReader bin( path );
+   dict.LoadBin( bin );
+  }
+
+  lem::BinaryWriter bin( path );
+  dict.SaveBin( bin );
+  return;
+ }
+
+#endif
@@ -0,0 +1,201 @@
+// -----------------------------------------------------------------------------
+// File LEXEME_POOL_BENCH.CPP
+//
+// (c) by Koziev Elijah     all rights reserved
+//
+// SOLARIX Intellectronix Project http://www.solarix.ru
+//                                http://sourceforge.net/projects/solarix
+//
+// Content:
+//      LexemDictionary.  
+//   Lexem (  UCString)   ,
+//     LexemePool,   Lexem   
+//   . :
+//  -    Lexem      ;
+//  -      1%, 10%  100%  -  
+//       ,     12 ;
+//  -   :     
+//    (   WordEntries_LookUp)   - .  
+//         ,   
+//    .
+//    ,      - : 
+//        .
+//
+// : lexeme_pool_bench [<dictionary.xml> [_]]
+// -----------------------------------------------------------------------------
+//
+// CD->16.10.2026
+// LC->16.10.2026
+// --------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+#include <algorithm>
+
+#include <lem/date_time.h>
+#include <lem/path.h>
+#include <lem/smart_pointers.h>
+#include <lem/solarix/dictionary.h>
+#include <lem/solarix/load_options.h>
+#include <lem/solarix/sg_autom.h>
+#include <lem/solarix/WordEntries.h>
+#include <lem/solarix/LexemeEnumerator.h>
+#include <lem/solarix/LexemDictionary.h>
+
+#include "lexeme_gen.h"
+
+using namespace Solarix;
+
+static const int FORMS_PER_ENTRY=12;
+
+
+static void LoadLexemes( const char *dictionary_xml, std::vector<Lexem> &lexems )
+{
+ Dictionary dict;
+ Load_Options opt;
+ opt.lexicon=true;
+ if( !dict.LoadModules( lem::Path(dictionary_xml), opt ) )
+  {
+   printf( "Can not load dictionary %s\n", dictionary_xml );
+   exit(1);
+  }
+
+ lem::Ptr<LexemeEnumerator> lenum( dict.GetSynGram().GetEntries().ListLexemes() );
+ Lexem buf;
+ while( lenum->Fetch() )
+  lexems.push_back( *lenum->Get(buf) );
+
+ return;
+}
+
+
+static void PrintUsage( const char *storage, const char *touched, int n_objects, lem::uint64_t bytes, int n_lexem )
+{
+ printf( "%s\t%s\t%d\t%llu\t%.1f\n", storage, touched, n_objects, (unsigned long long)bytes, double(bytes)/n_lexem );
+ return;
+}
+
+
+static int SortedFind( const std::vector<Lexem> &sorted, const lem::UCString &s )
+{
+ std::vector<Lexem>::const_iterator it = std::lower_bound( sorted.begin(), sorted.end(), s );
+ return it!=sorted.end() && *it==s ? CastSizeToInt(it-sorted.begin()) : -1;
+}
+
+
+int main( int argc, char *argv[] )
+{
+ const int n_pass = argc>2 ? atoi(argv[2]) : 3;
+
+ std::vector<Lexem> lexems;
+ if( argc>1 )
+  LoadLexemes( argv[1], lexems );
+ else
+  GenerateLexemes( 30000, FORMS_PER_ENTRY, lexems );
+
+ const lem::Path path( lem::Path::GetTmpFilename("bin") );
+ WriteLexemes( path, lexems );
+
+ const int n_lexem = CastSizeToInt(lexems.size());
+ if( n_lexem==0 )
+  {
+   printf( "No lexemes\n" );
+   return 1;
+  }
+
+ printf( "# %d lexemes, sizeof(Lexem)=%d, %s\n", n_lexem, int(sizeof(Lexem)), argc>1 ? argv[1] : "generated" );
+ printf( "storage\ttouched_entries\tlexem_objects\tbytes\tbytes_per_lexeme\n" );
+
+ //  :  Lexem   .
+ PrintUsage( "lexem_array", "-", n_lexem, lem::uint64_t(n_lexem)*sizeof(Lexem), n_lexem );
+
+ const int percents[4] = { 0, 1, 10, 100 };
+ for( int ip=0; ip<4; ++ip )
+  {
+   LexemDictionary dict( n_lexem );
+   lem::BinaryReader bin( path );
+   dict.LoadBin( bin );
+
+   const int n_group = (n_lexem+FORMS_PER_ENTRY-1)/FORMS_PER_ENTRY;
+   if( percents[ip]==100 )
+    {
+     for( int i=0; i<n_lexem; ++i )
+      dict[i];
+    }
+   else
+    {
+     unsigned int r=7u;
+     for( int k=0; k<n_group*percents[ip]/100; ++k )
+      {
+       r = r*1103515245u + 12345u;
+       const int i0 = int( (r>>4) % unsigned(n_group) ) * FORMS_PER_ENTRY;
+       for( int i=i0; i<i0+FORMS_PER_ENTRY && i<n_lexem; ++i )
+        dict[i];
+      }
+    }
+
+   char touched[16];
+   sprintf( touched, "%d%%", percents[ip] );
+   PrintUsage( "lexem_dictionary", touched, dict.CountMaterialized(), dict.GetMemoryUsage(), n_lexem );
+  }
+
+ // :        ,   .
+ std::vector<lem::UCString> queries;
+ for( int i=0; i<n_lexem; ++i )
+  {
+   queries.push_back( lexems[i] );
+   if( lexems[i].length()<lem::UCString::max_len )
+    {
+     lem::UCString miss( lexems[i] );
+     miss += L'#';
+     queries.push_back( miss );
+    }
+  }
+
+ std::random_shuffle( queries.begin(), queries.end() );
+
+ std::vector<Lexem> sorted( lexems );
+ std::sort( sorted.begin(), sorted.end() );
+
+ LexemDictionary dict( n_lexem );
+ {
+  lem::BinaryReader bin( path );
+  dict.LoadBin( bin );
+ }
+
+ path.DoRemove();
+
+ printf( "lookup\tlookups_per_sec\tfound\n" );
+
+ lem::ElapsedTime timer;
+ int found_sorted=0, found_pool=0;
+
+ timer.start();
+ for( int ipass=0; ipass<n_pass; ++ipass )
+  for( std::size_t i=0; i<queries.size(); ++i )
+   if( SortedFind( sorted, queries[i] )!=-1 )
+    found_sorted++;
+ timer.stop();
+
+ double sec = timer.elapsed().total_microseconds()/1000000.0;
+ printf( "sorted_array\t%.1f\t%d\n", sec>0 ? double(queries.size())*n_pass/sec : 0.0, found_sorted );
+
+ timer.start();
+ for( int ipass=0; ipass<n_pass; ++ipass )
+  for( std::size_t i=0; i<queries.size(); ++i )
+   if( dict.FindId( queries[i] )!=UNKNOWN )
+    found_pool++;
+ timer.stop();
+
+ sec = timer.elapsed().total_microseconds()/1000000.0;
+ printf( "lexeme_pool\t%.1f\t%d\n", sec>0 ? double(queries.size())*n_pass/sec : 0.0, found_pool );
+
+ if( found_sorted!=found_pool )
+  {
+   printf( "Mismatch between sorted array and lexeme pool\n" );
+   return 1;
+  }
+
+ return 0;
+}
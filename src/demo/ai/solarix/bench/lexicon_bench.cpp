@@ -0,0 +1,152 @@
+// -----------------------------------------------------------------------------
+// File LEXICON_BENCH.CPP
+//
+// (c) by Koziev Elijah     all rights reserved
+//
+// SOLARIX Intellectronix Project http://www.solarix.ru
+//                                http://sourceforge.net/projects/solarix
+//
+// Content:
+//       SQLite:   
+// , ,       .
+//         
+// ,     ,    
+//  ,      .
+//
+// : lexicon_bench <lexicon.db> [_]
+// -----------------------------------------------------------------------------
+//
+// CD->16.10.2026
+// LC->16.10.2026
+// --------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include <lem/unicode.h>
+#include <lem/date_time.h>
+#include <lem/smart_pointers.h>
+#include <lem/solarix/LS_ResultSet.h>
+#include <lem/solarix/WordEntrySetItem.h>
+#include <lem/solarix/KnowledgeBase.h>
+#include <lem/solarix/TreeScorer.h>
+#include <lem/solarix/MetaEntry.h>
+#include <lem/solarix/LexiconStorage_SQLITE.h>
+
+using namespace Solarix;
+
+
+enum { WordEntrySetQuery, MetaEntryQuery, FactQuery, TreeScorerQuery, QUERY_COUNT };
+
+static const char* query_names[QUERY_COUNT] = { "word_entry_set", "metaentry", "fact", "ts_point" };
+
+
+static void ListIds( LS_ResultSet *rs_arg, std::vector<int> &ids )
+{
+ lem::Ptr<LS_ResultSet> rs(rs_arg);
+ while( rs->Fetch() )
+  ids.push_back( rs->GetInt(0) );
+
+ return;
+}
+
+
+static lem::int64_t LoadOne( LexiconStorage_SQLITE &storage, int query, int id )
+{
+ switch( query )
+ {
+  case WordEntrySetQuery:
+   {
+    lem::Ptr<WordEntrySetItem> x( storage.GetWordEntrySet(id) );
+    return CastSizeToInt(x->ies.size());
+   }
+
+  case MetaEntryQuery:
+   {
+    lem::Ptr<MetaEntry> x( storage.LoadMetaEntry(id) );
+    return 1;
+   }
+
+  case FactQuery:
+   {
+    lem::Ptr<KB_Fact> x( storage.LoadFact(id) );
+    return CastSizeToInt(x->args.size());
+   }
+
+  case TreeScorerQuery:
+   {
+    lem::Ptr<TreeScorerPoint> x( storage.LoadTreeScorerPoint(id) );
+    return x->id_entry;
+   }
+ }
+
+ return 0;
+}
+
+
+static double Run( LexiconStorage_SQLITE &storage, int query, const std::vector<int> &ids, int n_pass, lem::int64_t &checksum )
+{
+ lem::ElapsedTime timer;
+ timer.start();
+
+ checksum=0;
+ for( int ipass=0; ipass<n_pass; ++ipass )
+  for( size_t i=0; i<ids.size(); ++i )
+   checksum += (i+1)*LoadOne( storage, query, ids[i] );
+
+ timer.stop();
+ const double sec = timer.elapsed().total_microseconds()/1000000.0;
+ return sec>0 ? ids.size()*n_pass/sec : 0.0;
+}
+
+
+int main( int argc, char *argv[] )
+{
+ if( argc<2 )
+  {
+   printf( "Usage: lexicon_bench <lexicon.db> [number of passes]\n" );
+   return 1;
+  }
+
+ const int n_pass = argc>2 ? atoi(argv[2]) : 3;
+
+ LexiconStorage_SQLITE storage( lem::UFString( lem::from_utf8(argv[1]).c_str() ) );
+
+ std::vector<int> ids[QUERY_COUNT];
+ ListIds( storage.ListWordEntrySet(), ids[WordEntrySetQuery] );
+ ListIds( storage.ListMetaEntries(), ids[MetaEntryQuery] );
+ ListIds( storage.ListFacts(), ids[FactQuery] );
+ ListIds( storage.ListTreeScorerPoints(), ids[TreeScorerQuery] );
+
+ printf( "query\tcache\tids\tqueries_per_sec\thits\tmisses\tchecksum\n" );
+
+ int rc=0;
+ for( int q=0; q<QUERY_COUNT; ++q )
+  {
+   if( ids[q].empty() )
+    continue;
+
+   lem::int64_t sum_nocache=0, sum_cache=0;
+
+   storage.EnableStatementCache(false);
+   const int hits0 = storage.CountStatementCacheHits(), misses0 = storage.CountStatementCacheMisses();
+   const double qps_nocache = Run( storage, q, ids[q], n_pass, sum_nocache );
+   printf( "%s\toff\t%d\t%.1f\t%d\t%d\t%lld\n", query_names[q], int(ids[q].size()), qps_nocache,
+    storage.CountStatementCacheHits()-hits0, storage.CountStatementCacheMisses()-misses0, (long long)sum_nocache );
+
+   storage.EnableStatementCache(true);
+   const int hits1 = storage.CountStatementCacheHits(), misses1 = storage.CountStatementCacheMisses();
+   const double qps_cache = Run( storage, q, ids[q], n_pass, sum_cache );
+   printf( "%s\ton\t%d\t%.1f\t%d\t%d\t%lld\n", query_names[q], int(ids[q].size()), qps_cache,
+    storage.CountStatementCacheHits()-hits1, storage.CountStatementCacheMisses()-misses1, (long long)sum_cache );
+
+   if( sum_nocache!=sum_cache )
+    {
+     printf( "Mismatch between cached and uncached results for %s\n", query_names[q] );
+     rc=1;
+    }
+  }
+
+ return rc;
+}
@@ -0,0 +1,220 @@
+// -----------------------------------------------------------------------------
+// File MEM_ARENA_TEST.CPP
+//
+// (c) by Koziev Elijah     all rights reserved
+//
+// SOLARIX Intellectronix Project http://www.solarix.ru
+//                                http://sourceforge.net/projects/solarix
+//
+// Content:
+//   MemArena:  ,     -,
+//      Delete.    
+//           
+// ,      BestResults  
+//  ,    Reset()  .
+//   .      
+//  .
+//
+// : mem_arena_test
+// -----------------------------------------------------------------------------
+//
+// CD->16.10.2026
+// LC->16.10.2026
+// --------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <set>
+
+#include <lem/mem_arena.h>
+#include <lem/solarix/SynPatternBestResults.h>
+
+using namespace Solarix;
+
+static int n_failed=0;
+
+#define TEST_CHECK(x) \
+ if( !(x) ) { printf( "FAILED line %d: %s\n", __LINE__, #x ); n_failed++; }
+
+
+static int n_child_alive=0;
+static int n_child_destroyed=0;
+
+struct Child
+{
+ int value;
+
+ Child( int _value ) : value(_value) { n_child_alive++; }
+ ~Child(void) { n_child_alive--; n_child_destroyed++; value=-1; }
+};
+
+
+//      ,  BestResults::Clear.
+struct Owner
+{
+ lem::MemArena *arena;
+ lem::MemArenaVector<Child*> children;
+
+ Owner( lem::MemArena *_arena ) : arena(_arena), children(_arena) {}
+
+ ~Owner(void)
+ {
+  for( int i=0; i<children.size(); ++i )
+   arena->Delete( children[i] );
+
+  children.clear();
+ }
+};
+
+
+//     :  Reset()  
+// ,         Delete.
+static void TestChildrenAfterOwner(void)
+{
+ n_child_alive = n_child_destroyed = 0;
+
+ lem::MemArena arena;
+ Owner *owner = arena.New<Owner>(&arena);
+ for( int i=0; i<100; ++i )
+  owner->children.push_back( arena.New<Child>(i) );
+
+ //     ,    .
+ for( int i=0; i<10; ++i )
+  {
+   arena.Delete( owner->children[i] );
+   owner->children[i] = arena.New<Child>(1000+i);
+  }
+
+ TEST_CHECK( n_child_alive==100 );
+ TEST_CHECK( n_child_destroyed==10 );
+
+ arena.Reset();
+
+ TEST_CHECK( n_child_alive==0 );
+ TEST_CHECK( n_child_destroyed==110 );
+ return;
+}
+
+
+//     :    
+//   ,  Reset()    .
+static void TestChildrenBeforeOwner(void)
+{
+ n_child_alive = n_child_destroyed = 0;
+
+ lem::MemArena arena;
+ Child *first[50];
+ for( int i=0; i<50; ++i )
+  first[i] = arena.New<Child>(i);
+
+ Owner *owner = arena.New<Owner>(&arena);
+ for( int i=0; i<50; ++i )
+  owner->children.push_back( first[i] );
+
+ arena.Reset();
+
+ TEST_CHECK( n_child_alive==0 );
+ TEST_CHECK( n_child_destroyed==50 );
+ return;
+}
+
+
+//    "" Delete     
+//  :      .
+static void TestReuseAfterReset(void)
+{
+ n_child_alive = n_child_destroyed = 0;
+
+ lem::MemArena arena;
+ for( int pass=0; pass<3; ++pass )
+  {
+   Owner *owner = arena.New<Owner>(&arena);
+   for( int i=0; i<200; ++i )
+    owner->children.push_back( arena.New<Child>(i) );
+
+   arena.Reset();
+   TEST_CHECK( n_child_alive==0 );
+
+   std::set<Child*> seen;
+   for( int i=0; i<400; ++i )
+    {
+     Child *c = arena.New<Child>(i);
+     TEST_CHECK( seen.insert(c).second );
+     arena.Delete(c);
+     seen.erase(c);
+     c = arena.New<Child>(i);
+     TEST_CHECK( seen.insert(c).second );
+    }
+
+   arena.Reset();
+   TEST_CHECK( n_child_alive==0 );
+  }
+
+ return;
+}
+
+
+//   BestResults      .
+static void TestLiveBestResults(void)
+{
+ lem::MemArena arena;
+
+ for( int pass=0; pass<3; ++pass )
+  {
+   BestResults *best = BestResults::Create(&arena);
+   for( int i=0; i<64; ++i )
+    {
+     EXPORTED_COORDS *coords = best->New<EXPORTED_COORDS>();
+     MATCHING_ALTS *alts = best->New<MATCHING_ALTS>();
+     EXPORTED_NODES *nodes = best->New<EXPORTED_NODES>();
+     for( int k=0; k<16; ++k )
+      {
+       coords->insert( std::make_pair(k,i) );
+       alts->insert( std::make_pair( (const Word_Form*)NULL, k ) );
+       nodes->push_back( std::make_pair( (const lem::UCString*)NULL, (const Word_Form*)NULL ) );
+      }
+
+     best->best_exported_coords.push_back(coords);
+     best->best_matching_alts.push_back(alts);
+     best->best_exported_nodes.push_back( best->Copy(*nodes) );
+     arena.Delete(nodes);
+     best->matching_len.push_back(i);
+    }
+
+   //   ,  Match   
+   // ,   .
+   best->Clear();
+   for( int i=0; i<32; ++i )
+    {
+     MATCHING_ALTS *alts = best->New<MATCHING_ALTS>();
+     alts->insert( std::make_pair( (const Word_Form*)NULL, i ) );
+     best->best_matching_alts.push_back(alts);
+    }
+
+   TEST_CHECK( best->best_matching_alts.size()==32 );
+
+   //  ,    -   .
+   arena.Reset();
+   TEST_CHECK( arena.CountAllocations()==0 );
+  }
+
+ return;
+}
+
+
+int main( int argc, char *argv[] )
+{
+ TestChildrenAfterOwner();
+ TestChildrenBeforeOwner();
+ TestReuseAfterReset();
+ TestLiveBestResults();
+
+ if( n_failed )
+  {
+   printf( "%d check(s) FAILED\n", n_failed );
+   return 1;
+  }
+
+ printf( "OK\n" );
+ return 0;
+}
@@ -0,0 +1,483 @@
+// -----------------------------------------------------------------------------
+// File NGRAMS_BENCH.CPP
+//
+// (c) by Koziev Elijah     all rights reserved
+//
+// SOLARIX Intellectronix Project http://www.solarix.ru
+//                                http://sourceforge.net/projects/solarix
+//
+// Content:
+//   N-  2..5   : 
+//     (seek+read      
+// ),   ,   ,  , 
+//   NGramsSuccinctStore (.ef)   N-  
+// SQLite  NGramsDBMS.  .ef   ,   
+// .  NGRAMS    ,    
+//   ;   ,  SQLite . 
+//         ,  
+// 1, 8  32  -      . 
+//  SQLite   ,       
+//   SQL_LOOKUP_DIVISOR .
+//
+// : ngrams_bench <__NGRAMn> [] [___] [q_bits]
+//    2, 1000000 , q_bits=16.
+// -----------------------------------------------------------------------------
+//
+// CD->16.10.2026
+// LC->16.10.2026
+// --------------
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#if defined LEM_LINUX
+ #include <unistd.h>
+#endif
+#include <vector>
+
+#include <boost/thread/thread.hpp>
+#include <boost/bind.hpp>
+
+#include <lem/smart_pointers.h>
+#include <lem/streams.h>
+#include <lem/process.h>
+#include <lem/date_time.h>
+#include <lem/mapped_file.h>
+#include <lem/tuple.h>
+#include <lem/unicode.h>
+#include <lem/solarix/ngrams_hashing.h>
+#include <lem/solarix/ngrams_block_search.h>
+#include <lem/solarix/NGramsSuccinctStore.h>
+#include <lem/solarix/NGramsStorage_SQLITE.h>
+
+using namespace Solarix;
+
+static const int SQL_LOOKUP_DIVISOR=100;
+static const int SQL_CHECKED_KEYS=1000;
+
+
+//      (0,   ).
+static long ResidentKb(void)
+{
+ #if defined LEM_LINUX
+ FILE *f = fopen( "/proc/self/statm", "r" );
+ if( f==NULL )
+  return 0;
+
+ long size=0, resident=0;
+ const int nf = fscanf( f, "%ld %ld", &size, &resident );
+ fclose(f);
+ return nf==2 ? resident*(sysconf(_SC_PAGESIZE)/1024) : 0;
+ #else
+ return 0;
+ #endif
+}
+
+
+//  ,    Ngrams::Cached2Gram ... Cached5Gram
+struct Rec2
+{
+ typedef std::pair<int,int> ngram_type;
+ ngram_type ngram;
+ lem::int32_t id;
+ lem::int32_t w;
+
+ static ngram_type Key( const int *ie ) { return ngram_type(ie[0],ie[1]); }
+};
+
+struct Rec3
+{
+ typedef lem::triple<int,int,int> ngram_type;
+ ngram_type ngram;
+ lem::int32_t id;
+ lem::int32_t w;
+
+ static ngram_type Key( const int *ie ) { return ngram_type(ie[0],ie[1],ie[2]); }
+};
+
+struct Rec4
+{
+ typedef lem::foursome<int,int,int,int> ngram_type;
+ ngram_type ngram;
+ lem::int32_t id;
+ lem::int32_t w;
+
+ static ngram_type Key( const int *ie ) { return ngram_type(ie[0],ie[1],ie[2],ie[3]); }
+};
+
+struct Rec5
+{
+ typedef lem::tuple5<int,int,int,int,int> ngram_type;
+ ngram_type ngram;
+ lem::int32_t id;
+ lem::int32_t w;
+
+ static ngram_type Key( const int *ie ) { return ngram_type(ie[0],ie[1],ie[2],ie[3],ie[4]); }
+};
+
+
+template < class REC >
+static std::pair<int,int> FindInBlock( const void *block, lem::uint32_t n, const int *ie )
+{
+ return ngram_find_in_block( (const REC*)block, n, REC::Key(ie) );
+}
+
+
+struct Key
+{
+ int ie[NGramsSuccinctStore::MAX_ORDER];
+};
+
+
+class CacheBench
+{
+ private:
+  int order;
+  int rec_len; //  int32: id , id N-, 
+  lem::Ptr<lem::BinaryReader> bin;
+  lem::MappedFile mapped;
+  std::vector<lem::uint64_t> marks_filepos;
+  std::vector<lem::uint32_t> marks_n;
+  std::vector<lem::int32_t> search_buffer;
+
+  #if defined LEM_THREADS
+  lem::Process::CriticalSection cs;
+  #endif
+
+  std::vector<Key> keys;
+
+  lem::uint32_t Hash( const int *ie ) const
+  {
+   switch(order)
+   {
+    case 2:  return ngram2hash( ie[0], ie[1] );
+    case 3:  return ngram3hash( ie[0], ie[1], ie[2] );
+    case 4:  return ngram4hash( ie[0], ie[1], ie[2], ie[3] );
+    default: return ngram5hash( ie[0], ie[1], ie[2], ie[3], ie[4] );
+   }
+  }
+
+  std::pair<int,int> FindInBlock( const void *block, lem::uint32_t n, const int *ie ) const
+  {
+   switch(order)
+   {
+    case 2:  return ::FindInBlock<Rec2>( block, n, ie );
+    case 3:  return ::FindInBlock<Rec3>( block, n, ie );
+    case 4:  return ::FindInBlock<Rec4>( block, n, ie );
+    default: return ::FindInBlock<Rec5>( block, n, ie );
+   }
+  }
+
+ public:
+  enum { STREAM, MAPPED, SUCCINCT, SQL, N_MODE };
+
+  lem::int64_t n;
+  NGramsSuccinctStore succinct;
+  lem::Ptr<NGramsDBMS> db;
+  lem::FString table_suffix; // NGRAMn<table_suffix> -   
+
+ public:
+  CacheBench( int _order ) : order(_order), rec_len(_order+2), n(0) {}
+
+  int GetOrder(void) const { return order; }
+
+  //     ,  .
+  bool Open( const lem::Path &filename )
+  {
+   if( !filename.DoesExist() )
+    return false;
+
+   bin = new lem::BinaryReader(filename);
+
+   lem::int64_t handler_flags, marks_pos;
+   lem::int32_t max_freq;
+   int n_marks=0;
+   bin->read( &handler_flags, sizeof(handler_flags) );
+   bin->read( &marks_pos, sizeof(marks_pos) );
+   bin->read( &n, sizeof(n) );
+   bin->read( &max_freq, sizeof(max_freq) );
+   bin->read( &n_marks, sizeof(n_marks) );
+
+   if( n_marks<=0 )
+    return false;
+
+   bin->seekp64( marks_pos );
+   marks_filepos.resize(n_marks);
+   marks_n.resize(n_marks);
+   bin->read( &marks_filepos[0], sizeof(lem::uint64_t)*n_marks );
+   bin->read( &marks_n[0], sizeof(lem::uint32_t)*n_marks );
+
+   lem::uint32_t max_n=0;
+   for( int i=0; i<n_marks; ++i )
+    max_n = std::max( max_n, marks_n[i] );
+
+   search_buffer.resize( (max_n+1)*rec_len );
+   return true;
+  }
+
+  bool Map( const lem::Path &filename )
+  {
+   return mapped.Open(filename);
+  }
+
+  //   -  N-,  -  .
+  void PrepareKeys( int count )
+  {
+   keys.clear();
+   srand(1);
+
+   for( int i=0; i<count; ++i )
+    {
+     Key k;
+     for( int j=0; j<NGramsSuccinctStore::MAX_ORDER; ++j )
+      k.ie[j] = 0;
+
+     if( (i&1)==0 )
+      {
+       const int i_block = rand() % int(marks_n.size());
+       if( marks_n[i_block]==0 )
+        continue;
+
+       const lem::int32_t *block = mapped.At<lem::int32_t>( marks_filepos[i_block] );
+       const lem::int32_t *r = block + (rand() % marks_n[i_block])*rec_len;
+       for( int j=0; j<order; ++j )
+        k.ie[j] = r[j];
+      }
+     else
+      {
+       k.ie[0] = -1-rand();
+       for( int j=1; j<order; ++j )
+        k.ie[j] = rand();
+      }
+
+     keys.push_back(k);
+    }
+
+   return;
+  }
+
+  //  :     ,    .
+  std::pair<int,int> FindStream( const int *ie )
+  {
+   const int i_block = Hash(ie) % marks_n.size();
+
+   #if defined LEM_THREADS
+   lem::Process::CritSecLocker guard(&cs);
+   #endif
+
+   bin->seekp64( marks_filepos[i_block] );
+   bin->read( &search_buffer[0], sizeof(lem::int32_t)*rec_len*marks_n[i_block] );
+   return FindInBlock( &search_buffer[0], marks_n[i_block], ie );
+  }
+
+  std::pair<int,int> FindMapped( const int *ie ) const
+  {
+   const int i_block = Hash(ie) % marks_n.size();
+   return FindInBlock( mapped.At<lem::int32_t>( marks_filepos[i_block] ), marks_n[i_block], ie );
+  }
+
+  std::pair<int,int> FindSuccinct( const int *ie ) const
+  {
+   return succinct.Find(ie);
+  }
+
+  std::pair<int,int> FindSql( const int *ie ) const
+  {
+   switch(order)
+   {
+    case 2:  return db->Find2Gram( table_suffix, ie[0], ie[1] );
+    case 3:  return db->Find3Gram( table_suffix, ie[0], ie[1], ie[2] );
+    case 4:  return db->Find4Gram( table_suffix, ie[0], ie[1], ie[2], ie[3] );
+    default: return db->Find5Gram( table_suffix, ie[0], ie[1], ie[2], ie[3], ie[4] );
+   }
+  }
+
+  std::pair<int,int> Find( int mode, const int *ie )
+  {
+   switch(mode)
+   {
+    case STREAM:   return FindStream(ie);
+    case MAPPED:   return FindMapped(ie);
+    case SUCCINCT: return FindSuccinct(ie);
+    default:       return FindSql(ie);
+   }
+  }
+
+  //  count        .
+  bool CheckSame( int mode, int count )
+  {
+   for( int i=0; i<count && i<int(keys.size()); ++i )
+    {
+     const std::pair<int,int> a = FindMapped( keys[i].ie );
+     const std::pair<int,int> b = Find( mode, keys[i].ie );
+     if( (a.first==-1)!=(b.first==-1) || (a.first!=-1 && a.second!=b.second) )
+      return false;
+    }
+
+   return true;
+  }
+
+  void Worker( int mode, int n_lookup, int seed, int *hits )
+  {
+   int h=0;
+   const int nkey = int(keys.size());
+
+   for( int i=0; i<n_lookup; ++i )
+    {
+     const Key &k = keys[ (seed+i) % nkey ];
+     if( Find( mode, k.ie ).first!=-1 )
+      h++;
+    }
+
+   *hits = h;
+   return;
+  }
+
+  double Run( int mode, int n_thread, int n_lookup, int &hits )
+  {
+   std::vector<int> thread_hits( n_thread, 0 );
+
+   lem::ElapsedTime timer;
+   timer.start();
+
+   boost::thread_group threads;
+   for( int i=0; i<n_thread; ++i )
+    threads.create_thread( boost::bind( &CacheBench::Worker, this, mode, n_lookup, i*7919, &thread_hits[i] ) );
+
+   threads.join_all();
+   timer.stop();
+
+   hits=0;
+   for( int i=0; i<n_thread; ++i )
+    hits += thread_hits[i];
+
+   const double sec = timer.elapsed().total_microseconds()/1000000.0;
+   return sec>0 ? double(n_thread)*n_lookup/sec : 0.0;
+  }
+};
+
+
+static double Msec( lem::ElapsedTime &timer )
+{
+ timer.stop();
+ return timer.elapsed().total_microseconds()/1000.0;
+}
+
+
+int main( int argc, char *argv[] )
+{
+ if( argc<2 )
+  {
+   printf( "Usage: ngrams_bench <NGRAMn cache file> [order] [lookups per thread] [q_bits]\n" );
+   return 1;
+  }
+
+ const int order = argc>2 ? atoi(argv[2]) : 2;
+ const int n_lookup = argc>3 ? atoi(argv[3]) : 1000000;
+ const int q_bits = argc>4 ? atoi(argv[4]) : 16;
+
+ if( order<2 || order>NGramsSuccinctStore::MAX_ORDER )
+  {
+   printf( "Order must be in range 2..%d\n", int(NGramsSuccinctStore::MAX_ORDER) );
+   return 1;
+  }
+
+ const lem::Path block_path(argv[1]);
+ const lem::Path ef_path( std::string(argv[1])+".ef" );
+
+ CacheBench cache(order);
+ double open_ms[CacheBench::N_MODE] = { 0, 0, 0, 0 };
+ lem::int64_t disk_size[CacheBench::N_MODE] = { 0, 0, 0, 0 };
+
+ lem::ElapsedTime timer;
+ timer.start();
+ if( !cache.Open(block_path) )
+  {
+   printf( "Can not load %s\n", argv[1] );
+   return 1;
+  }
+ open_ms[CacheBench::STREAM] = Msec(timer);
+
+ timer.start();
+ if( !cache.Map(block_path) )
+  {
+   printf( "Can not map %s\n", argv[1] );
+   return 1;
+  }
+ open_ms[CacheBench::MAPPED] = Msec(timer);
+
+ disk_size[CacheBench::STREAM] = disk_size[CacheBench::MAPPED] = lem::int64_t(block_path.FileSize());
+
+ if( !ef_path.DoesExist() )
+  NGramsSuccinctStore::ConvertBlockFile( block_path, ef_path, order, q_bits );
+
+ timer.start();
+ if( !cache.succinct.Open(ef_path) || cache.succinct.size()!=cache.n || cache.succinct.GetOrder()!=order )
+  {
+   printf( "Can not open succinct store %s\n", ef_path.GetAscii().c_str() );
+   return 1;
+  }
+ open_ms[CacheBench::SUCCINCT] = Msec(timer);
+ disk_size[CacheBench::SUCCINCT] = lem::int64_t(cache.succinct.GetFileSize());
+
+ //  NGRAMn<><>    NGRAMS   .
+ lem::Path db_path( lem::Path::RemoveLeaf( block_path.GetUnicode() ) );
+ db_path.ConcateLeaf( L"NGRAMS" );
+
+ const lem::FString leaf( lem::to_utf8( block_path.GetFileName() ) );
+ bool with_sql=false;
+ if( db_path.DoesExist() && leaf.length()>=6 )
+  {
+   cache.table_suffix = lem::FString( leaf.c_str()+6 );
+
+   timer.start();
+   cache.db = new NGramsStorage_SQLITE();
+   cache.db->Connect(db_path);
+   with_sql = cache.db->TableExists( lem::format_str( "NGRAM%d%s", order, cache.table_suffix.c_str() ) );
+   open_ms[CacheBench::SQL] = Msec(timer);
+   disk_size[CacheBench::SQL] = lem::int64_t(db_path.FileSize());
+  }
+
+ const int n_mode = with_sql ? CacheBench::N_MODE : CacheBench::SQL;
+ const char* mode_names[CacheBench::N_MODE] = { "stream", "mmap", "ef", "sqlite" };
+
+ printf( "order\t%d\n", order );
+ printf( "records\t%lld\n", (long long)cache.n );
+ for( int mode=0; mode<n_mode; ++mode )
+  printf( "open\t%s\t%lld bytes\t%.2f msec\n", mode_names[mode], (long long)disk_size[mode], open_ms[mode] );
+
+ cache.PrepareKeys(100000);
+
+ if( with_sql && !cache.CheckSame( CacheBench::SQL, SQL_CHECKED_KEYS ) )
+  {
+   printf( "Mismatch between mmap and sqlite lookups\n" );
+   return 1;
+  }
+
+ printf( "threads\tmode\tlookups_per_sec\thits\trss_delta_kb\n" );
+
+ const int n_threads[3] = { 1, 8, 32 };
+ for( int i=0; i<3; ++i )
+  {
+   int hits[CacheBench::N_MODE] = { 0, 0, 0, 0 };
+   for( int mode=0; mode<n_mode; ++mode )
+    {
+     const int n = mode==CacheBench::SQL ? std::max( 1, n_lookup/SQL_LOOKUP_DIVISOR ) : n_lookup;
+
+     const long rss0 = ResidentKb();
+     const double rate = cache.Run( mode, n_threads[i], n, hits[mode] );
+     printf( "%d\t%s\t%.0f\t%d\t%ld\n", n_threads[i], mode_names[mode], rate, hits[mode], ResidentKb()-rss0 );
+    }
+
+   if( hits[0]!=hits[1] || hits[0]!=hits[2] )
+    {
+     printf( "Mismatch between stream, mmap and ef lookups\n" );
+     return 1;
+    }
+  }
+
+ if( with_sql )
+  cache.db->Disconnect();
+
+ return 0;
+}
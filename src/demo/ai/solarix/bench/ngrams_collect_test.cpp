@@ -0,0 +1,361 @@
+// -----------------------------------------------------------------------------
+// File NGRAMS_COLLECT_TEST.CPP
+//
+// (c) by Koziev Elijah     all rights reserved
+//
+// SOLARIX Intellectronix Project http://www.solarix.ru
+//                                http://sourceforge.net/projects/solarix
+//
+// Content:
+//    N-:   
+// RawNGramsCollector  -     Process  
+// NGramsCollectionDriver     
+// .   ,    
+//     .  1-, 2-  3-    
+//    (id      ). 
+//   .     NGramsCollectors,  
+// BuildKnowledgeBase:   SetThreads,    
+//  ,   Prepare.    
+//      .
+//
+// : ngrams_collect_test <dictionary.xml> [.txt] [_] [__]
+//    - bench_corpus.txt, 4 , 200 .
+// -----------------------------------------------------------------------------
+//
+// CD->16.10.2026
+// LC->16.10.2026
+// --------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <wctype.h>
+#include <vector>
+#include <string>
+#include <algorithm>
+
+#include <lem/conversions.h>
+#include <lem/date_time.h>
+#include <lem/path.h>
+#include <lem/smart_pointers.h>
+#include <lem/unicode.h>
+#include <lem/solarix/dictionary.h>
+#include <lem/solarix/load_options.h>
+#include <lem/solarix/NGramsStorage_SQLITE.h>
+#include <lem/solarix/NGramsCollectors.h>
+#include <lem/solarix/NGramsCollectionDriver.h>
+
+using namespace Solarix;
+
+static const int LINES_PER_DOCUMENT=100;
+static const int SHARD_CAPACITY=4096;
+
+
+//     ,  .
+static void LoadCorpus( const char *filename, std::vector< lem::MCollect<lem::UCString> > &lines )
+{
+ FILE *f = fopen( filename, "rb" );
+ if( f==NULL )
+  {
+   printf( "Can not open %s\n", filename );
+   exit(1);
+  }
+
+ char buf[65536];
+ while( fgets( buf, sizeof(buf), f )!=NULL )
+  {
+   const lem::UFString line = lem::from_utf8(buf);
+
+   lem::MCollect<lem::UCString> words;
+   lem::UCString word;
+   for( int i=0; i<=line.length(); ++i )
+    {
+     const wchar_t c = i<line.length() ? line[i] : L' ';
+     const bool punct = wcschr( L".,!?;:\"()", c )!=NULL;
+
+     if( iswspace(c) || punct )
+      {
+       if( !word.empty() )
+        words.push_back(word);
+
+       word.clear();
+
+       if( punct )
+        words.push_back( lem::UCString(c) );
+      }
+     else if( word.length()<lem::UCString::max_len )
+      word += c;
+    }
+
+   if( !words.empty() )
+    lines.push_back(words);
+  }
+
+ fclose(f);
+ return;
+}
+
+
+//  1-, 2-  3-       folder.
+static lem::Ptr<NGramsDBMS> CollectNGrams(
+                                          lem::Ptr<Dictionary> dict,
+                                          const lem::Path &folder,
+                                          const std::vector< lem::MCollect<lem::UCString> > &lines,
+                                          int n_repeat,
+                                          int n_thread
+                                         )
+{
+ if( folder.DoesExist() )
+  folder.PurgeFolder();
+ else
+  folder.CreateFolder(true);
+
+ lem::Ptr<NGramsDBMS> db( new NGramsStorage_SQLITE() );
+ lem::Path ngrams_path( folder );
+ ngrams_path.ConcateLeaf( L"NGRAMS" );
+ db->Connect(ngrams_path);
+ db->BeginTx();
+ db->CreateTable_Segments();
+
+ RawNGramsCollector collector;
+ collector.accum_1grams = collector.accum_2grams = collector.accum_3grams = true;
+ collector.needs_NGRAM1 = collector.needs_NGRAM2 = collector.needs_NGRAM3 = true;
+ collector.needs_NGRAM4 = collector.needs_NGRAM5 = false;
+ collector.segmentation = false;
+ collector.lemmatization = false;
+ collector.db = db;
+ collector.use_disk_cache = false;
+ collector.upload_to_db = true;
+ collector.clean_database = true;
+ collector.Prepare( dict, folder, Solarix::Russian );
+
+ if( n_thread>1 )
+  collector.SetShardedCounters( n_thread, SHARD_CAPACITY );
+
+ NGramsCollectionDriver driver( n_thread );
+ driver.Add( &collector );
+
+ lem::ElapsedTime timer;
+ timer.start();
+
+ int n_line=0;
+ for( int irepeat=0; irepeat<n_repeat; ++irepeat )
+  for( std::size_t i=0; i<lines.size(); ++i, ++n_line )
+   {
+    if( (n_line%LINES_PER_DOCUMENT)==0 )
+     collector.BeginDocument(false);
+
+    for( lem::Container::size_type j=0; j<lines[i].size(); ++j )
+     driver.Process( lines[i][j] );
+
+    if( (n_line%LINES_PER_DOCUMENT)==LINES_PER_DOCUMENT-1 )
+     {
+      driver.Flush();
+      collector.EndDocument(false);
+     }
+   }
+
+ if( (n_line%LINES_PER_DOCUMENT)!=0 )
+  {
+   driver.Flush();
+   collector.EndDocument(false);
+  }
+
+ collector.EndAll(false);
+ db->CommitTx();
+
+ timer.stop();
+ printf( "threads=%d: %d msec\n", n_thread, timer.msec() );
+
+ return db;
+}
+
+
+//    NGramsCollectors:     Prepare.
+static lem::Ptr<NGramsDBMS> CollectNGramsByCollectors(
+                                                      lem::Ptr<Dictionary> dict,
+                                                      const lem::Path &folder,
+                                                      const std::vector< lem::MCollect<lem::UCString> > &lines,
+                                                      int n_repeat,
+                                                      int n_thread,
+                                                      bool &sharded
+                                                     )
+{
+ if( folder.DoesExist() )
+  folder.PurgeFolder();
+ else
+  folder.CreateFolder(true);
+
+ lem::Ptr<NGramsDBMS> db( new NGramsStorage_SQLITE() );
+
+ NGramsCollectors collectors( dict, lem::Ptr<LemmatizatorStorage>() );
+ collectors.SetStorage(db);
+ collectors.SetThreads(n_thread);
+ collectors.Prepare(
+                    folder,
+                    Solarix::Russian,
+                    NGramsCollectorFlags::Words | NGramsCollectorFlags::Raw2Grams | NGramsCollectorFlags::Raw3Grams,
+                    false, false, false, false, true, "", true
+                   );
+
+ sharded = n_thread==1 || collectors.CountShards()==n_thread;
+
+ NGramsCollectionDriver driver( n_thread );
+ collectors.AddTo(driver);
+
+ lem::ElapsedTime timer;
+ timer.start();
+
+ int n_line=0;
+ for( int irepeat=0; irepeat<n_repeat; ++irepeat )
+  for( std::size_t i=0; i<lines.size(); ++i, ++n_line )
+   {
+    if( (n_line%LINES_PER_DOCUMENT)==0 )
+     collectors.BeginDocument(false);
+
+    for( lem::Container::size_type j=0; j<lines[i].size(); ++j )
+     driver.Process( lines[i][j] );
+
+    if( (n_line%LINES_PER_DOCUMENT)==LINES_PER_DOCUMENT-1 )
+     {
+      driver.Flush();
+      collectors.EndDocument(false);
+     }
+   }
+
+ if( (n_line%LINES_PER_DOCUMENT)!=0 )
+  {
+   driver.Flush();
+   collectors.EndDocument(false);
+  }
+
+ collectors.EndAll(false);
+
+ timer.stop();
+ printf( "NGramsCollectors, threads=%d, shards=%d: %d msec\n", n_thread, collectors.CountShards(), timer.msec() );
+
+ return db;
+}
+
+
+// N-  order    "1 2 ... ".
+static void ListNGrams( NGramsDBMS &db, int order, std::vector<std::string> &list )
+{
+ lem::FString what( "w1.word" ), from, where;
+ for( int i=2; i<=order; ++i )
+  what += lem::format_str( "||' '||w%d.word", i );
+
+ for( int i=1; i<=order; ++i )
+  {
+   from += lem::format_str( ", NGRAM_WORDS_literal w%d", i );
+   where += lem::format_str( "%sw%d.id=n.iword%d", i==1 ? "" : " AND ", i, i );
+  }
+
+ const lem::FString sql = lem::format_str( "SELECT %s||' '||n.w FROM NGRAM%d_literal n%s WHERE %s",
+  what.c_str(), order, from.c_str(), where.c_str() );
+
+ lem::Collect<lem::FString> rows;
+ db.SelectFStrings( sql, rows );
+
+ list.clear();
+ for( lem::Container::size_type i=0; i<rows.size(); ++i )
+  list.push_back( std::string( rows[i].c_str() ) );
+
+ std::sort( list.begin(), list.end() );
+ return;
+}
+
+
+// 0 -  ,    .
+static int CompareLists( const std::vector<std::string> &list1, const std::vector<std::string> &list2, const char *what )
+{
+ if( list1==list2 )
+  return 0;
+
+ int n_shown=0;
+ for( std::size_t i=0; i<std::max(list1.size(),list2.size()) && n_shown<5; ++i )
+  {
+   const char *a = i<list1.size() ? list1[i].c_str() : "";
+   const char *b = i<list2.size() ? list2[i].c_str() : "";
+   if( strcmp(a,b)!=0 )
+    {
+     printf( "  [%d] single: %s | %s: %s\n", CastSizeToInt(i), a, what, b );
+     n_shown++;
+    }
+  }
+
+ return 1;
+}
+
+
+int main( int argc, char *argv[] )
+{
+ if( argc<2 )
+  {
+   printf( "Usage: ngrams_collect_test <dictionary.xml> [corpus.txt] [number of threads] [corpus repeat count]\n" );
+   return 1;
+  }
+
+ const char *corpus = argc>2 ? argv[2] : "bench_corpus.txt";
+ const int n_thread = argc>3 ? atoi(argv[3]) : 4;
+ const int n_repeat = argc>4 ? atoi(argv[4]) : 200;
+
+ lem::Ptr<Dictionary> dict( new Dictionary() );
+ Load_Options opt;
+ if( !dict->LoadModules( lem::Path(argv[1]), opt ) )
+  {
+   printf( "Can not load dictionary %s\n", argv[1] );
+   return 1;
+  }
+
+ std::vector< lem::MCollect<lem::UCString> > lines;
+ LoadCorpus( corpus, lines );
+
+ lem::Path folder1( lem::Path::GetTmpFolder() );
+ folder1.ConcateLeaf( L"ngrams_collect_test_1" );
+ lem::Path folderN( lem::Path::GetTmpFolder() );
+ folderN.ConcateLeaf( L"ngrams_collect_test_n" );
+ lem::Path folderC( lem::Path::GetTmpFolder() );
+ folderC.ConcateLeaf( L"ngrams_collect_test_c" );
+
+ lem::Ptr<NGramsDBMS> db1 = CollectNGrams( dict, folder1, lines, n_repeat, 1 );
+ lem::Ptr<NGramsDBMS> dbN = CollectNGrams( dict, folderN, lines, n_repeat, n_thread );
+
+ bool sharded=false;
+ lem::Ptr<NGramsDBMS> dbC = CollectNGramsByCollectors( dict, folderC, lines, n_repeat, n_thread, sharded );
+
+ int n_failed=0;
+
+ if( !sharded )
+  {
+   printf( "NGramsCollectors::SetThreads(%d) did not enable sharded counters\n", n_thread );
+   n_failed++;
+  }
+
+ for( int order=1; order<=3; ++order )
+  {
+   std::vector<std::string> list1, listN, listC;
+   ListNGrams( *db1, order, list1 );
+   ListNGrams( *dbN, order, listN );
+   ListNGrams( *dbC, order, listC );
+
+   printf( "%d-grams: %d single-threaded, %d threaded, %d by collectors\n", order,
+    CastSizeToInt(list1.size()), CastSizeToInt(listN.size()), CastSizeToInt(listC.size()) );
+
+   n_failed += CompareLists( list1, listN, "threaded" );
+   n_failed += CompareLists( list1, listC, "collectors" );
+  }
+
+ db1->Disconnect();
+ dbN->Disconnect();
+ dbC->Disconnect();
+
+ if( n_failed )
+  {
+   printf( "FAILED: threaded collection differs from single-threaded\n" );
+   return 1;
+  }
+
+ printf( "OK\n" );
+ return 0;
+}
@@ -0,0 +1,251 @@
+// -----------------------------------------------------------------------------
+// File NGRAMS_SUCCINCT_TEST.CPP
+//
+// (c) by Koziev Elijah     all rights reserved
+//
+// SOLARIX Intellectronix Project http://www.solarix.ru
+//                                http://sourceforge.net/projects/solarix
+//
+// Content:
+//    N- NGramsSuccinctStore  
+// 2-  5-.       N- 
+//   Find   id    ( 
+// ,   ),   Get -  N- 
+//  .  N-,     
+//   ,  id      
+//  id,   .   
+//    ,     
+//  id N-  .     
+//   .   .    
+//  N-    .
+//
+// : ngrams_succinct_test [_N-]
+//   20000 N-  .
+// -----------------------------------------------------------------------------
+//
+// CD->16.10.2026
+// LC->16.10.2026
+// --------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <set>
+#include <vector>
+#include <algorithm>
+
+#include <lem/path.h>
+#include <lem/streams.h>
+#include <lem/solarix/NGramsSuccinctStore.h>
+
+using namespace Solarix;
+
+static const int VOCAB=300;
+static const int N_FREQ=200; //  ,   8  
+
+typedef std::vector<int> NGramKey;
+
+
+static NGramKey KeyOf( const NGramsSuccinctStore::Entry &e, int order )
+{
+ return NGramKey( e.ie, e.ie+order );
+}
+
+
+static void PrintKey( const int *ie, int order )
+{
+ for( int j=0; j<order; ++j )
+  printf( "%s%d", j==0 ? "" : " ", ie[j] );
+
+ return;
+}
+
+
+// n  N-     VOCAB id.   
+//    ,      
+// .
+static void Generate( int order, int n, int n_freq, std::vector<NGramsSuccinctStore::Entry> &entries, std::set<NGramKey> &keys )
+{
+ entries.clear();
+ keys.clear();
+
+ while( int(entries.size())<n )
+  {
+   NGramsSuccinctStore::Entry e;
+   for( int j=0; j<NGramsSuccinctStore::MAX_ORDER; ++j )
+    e.ie[j] = j<order ? rand() % ( j<order-1 ? VOCAB/(order-j) : VOCAB ) : 0;
+
+   if( !keys.insert( KeyOf(e,order) ).second )
+    continue;
+
+   e.id = int(entries.size())*3+1;
+   e.w = 1 + rand() % n_freq;
+   entries.push_back(e);
+  }
+
+ return;
+}
+
+
+// Open   ,    ,   
+//     .
+static int CheckTruncated( const lem::Path &path, int order )
+{
+ std::vector<char> image;
+ {
+  lem::BinaryReader rdr(path);
+  image.resize( rdr.fsize() );
+  rdr.read( &image[0], CastSizeToInt(image.size()) );
+ }
+
+ const lem::Path cut_path( lem::Path::GetTmpFilename("ef") );
+
+ int n_failed=0;
+ for( int j=1; j<=64 && n_failed==0; ++j )
+  {
+   const std::size_t len = j==64 ? image.size()-8 : image.size()*(j-1)/64;
+
+   {
+    lem::BinaryWriter wrt(cut_path);
+    if( len>0 )
+     wrt.write( &image[0], len );
+   }
+
+   NGramsSuccinctStore store;
+   if( store.Open(cut_path) )
+    {
+     printf( "order=%d: the store truncated to %d of %d bytes was opened\n", order, int(len), int(image.size()) );
+     n_failed++;
+    }
+  }
+
+ cut_path.DoRemove();
+ return n_failed;
+}
+
+
+static int Check( int order, int n, int q_bits, int n_freq, bool exact_freq )
+{
+ std::vector<NGramsSuccinctStore::Entry> entries;
+ std::set<NGramKey> keys;
+ Generate( order, n, n_freq, entries, keys );
+
+ // Write  ,        .
+ const lem::Path path( lem::Path::GetTmpFilename("ef") );
+ NGramsSuccinctStore::Write( path, order, entries, q_bits );
+
+ NGramsSuccinctStore store;
+ if( !store.Open(path) )
+  {
+   printf( "order=%d: can not open the store\n", order );
+   path.DoRemove();
+   return 1;
+  }
+
+ int n_failed=0;
+
+ if( store.GetOrder()!=order || store.size()!=lem::int64_t(entries.size()) )
+  {
+   printf( "order=%d: header mismatch, order=%d size=%d\n", order, store.GetOrder(), int(store.size()) );
+   n_failed++;
+  }
+
+ //  -> id,      .
+ for( std::size_t i=0; i<entries.size() && n_failed==0; ++i )
+  {
+   const NGramsSuccinctStore::Entry &e = entries[i];
+   const std::pair<int,int> r = store.Find(e.ie);
+
+   if( r.first!=e.id || (exact_freq && r.second!=e.w) )
+    {
+     printf( "order=%d: Find(" , order );
+     PrintKey( e.ie, order );
+     printf( ") returned id=%d w=%d, expected id=%d w=%d\n", r.first, r.second, e.id, e.w );
+     n_failed++;
+     break;
+    }
+
+   int ie[NGramsSuccinctStore::MAX_ORDER], id=0, w=0;
+   store.Get( lem::int64_t(i), ie, id, w );
+   if( KeyOf(e,order)!=NGramKey(ie,ie+order) || id!=e.id || (exact_freq && w!=e.w) )
+    {
+     printf( "order=%d: Get(%d) returned ", order, int(i) );
+     PrintKey( ie, order );
+     printf( " id=%d w=%d, expected ", id, w );
+     PrintKey( e.ie, order );
+     printf( " id=%d w=%d\n", e.id, e.w );
+     n_failed++;
+    }
+  }
+
+ // :      , 
+ // ,       id.
+ int n_miss=0;
+ for( std::size_t i=0; i<entries.size() && n_failed==0; i+=7 )
+  {
+   for( int variant=0; variant<4; ++variant )
+    {
+     int ie[NGramsSuccinctStore::MAX_ORDER];
+     for( int j=0; j<order; ++j )
+      ie[j] = entries[i].ie[j];
+
+     const int jpos = rand() % order;
+     switch(variant)
+     {
+      case 0: ie[order-1] = rand() % VOCAB; break;
+      case 1: ie[jpos] = rand() % VOCAB; break;
+      case 2: ie[jpos] = VOCAB + rand() % VOCAB; break;
+      case 3: ie[jpos] = -1-rand() % VOCAB; break;
+     }
+
+     if( keys.find( NGramKey(ie,ie+order) )!=keys.end() )
+      continue;
+
+     n_miss++;
+     const std::pair<int,int> r = store.Find(ie);
+     if( r.first!=-1 || r.second!=-1 )
+      {
+       printf( "order=%d: absent n-gram ", order );
+       PrintKey( ie, order );
+       printf( " found with id=%d w=%d\n", r.first, r.second );
+       n_failed++;
+       break;
+      }
+    }
+  }
+
+ printf( "order=%d q_bits=%d: %d n-grams, %d misses, %lld bytes%s\n", order, q_bits, int(entries.size()), n_miss,
+  (long long)store.GetFileSize(), n_failed ? " - FAILED" : "" );
+
+ store.Close();
+
+ if( n_failed==0 )
+  n_failed += CheckTruncated( path, order );
+
+ path.DoRemove();
+ return n_failed;
+}
+
+
+int main( int argc, char *argv[] )
+{
+ const int n = argc>1 ? atoi(argv[1]) : 20000;
+
+ srand(1);
+
+ int n_failed=0;
+ n_failed += Check( 2, n, 8, N_FREQ, true );
+ n_failed += Check( 5, n, 8, N_FREQ, true );
+
+ //  ,  :  , id .
+ n_failed += Check( 2, n, 2, 10000, false );
+ n_failed += Check( 5, n, 2, 10000, false );
+
+ if( n_failed )
+  {
+   printf( "FAILED\n" );
+   return 1;
+  }
+
+ printf( "OK\n" );
+ return 0;
+}
@@ -0,0 +1,268 @@
+// -----------------------------------------------------------------------------
+// File PARADIGM_AUTOMATON_TEST.CPP
+//
+// (c) by Koziev Elijah     all rights reserved
+//
+// SOLARIX Intellectronix Project http://www.solarix.ru
+//                                http://sourceforge.net/projects/solarix
+//
+// Content:
+//     ParadigmaAutomaton  
+//  :    ,   
+//  (GetFallback),     -  (.+) 
+// (.*),  ,  [...]  [^...],  (...|...), ,
+//  ^  $,    .    
+//         
+// ParadigmaMatcher::Match.   .   
+//     .
+//
+// : paradigm_automaton_test [__]
+// -----------------------------------------------------------------------------
+//
+// CD->16.10.2026
+// LC->16.10.2026
+// --------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <wchar.h>
+#include <algorithm>
+
+#include <lem/conversions.h>
+#include <lem/unicode.h>
+#include <lem/solarix/ParadigmaMatcher.h>
+#include <lem/solarix/ParadigmaAutomaton.h>
+
+using namespace Solarix;
+
+static int n_failed=0;
+
+#define TEST_CHECK(x) \
+ if( !(x) ) { printf( "FAILED line %d: %s\n", __LINE__, #x ); n_failed++; }
+
+
+//      .   ,   
+//    .
+enum {
+      C_IJ,        // (.+)
+      C_AJA,       // (.*)[]
+      C_OJ_YJ,     // (.+)(|)
+      C_KOT,       // 
+      C_DOT_T,     // ^.+$
+      C_NOT_AE,    // (.+)[^]
+      C_DASH_KA,   // (.+)\-
+      C_ING,       // (.*)ing
+      C_EMPTY,     //     
+      C_QUANT,     // (.+)+     - , 
+      C_TOP_ALT,   // |    -   , 
+      C_DIGIT,     // (.+)\d     - \d  , 
+      C_POSIX,     // (.+)[[:alpha:]] - 
+      N_COND
+     };
+
+static const wchar_t* conditions[N_COND] = {
+ L"(.+)\x0418\x0419",
+ L"(.*)[\x0410\x042f]\x042f",
+ L"(.+)(\x041e\x0419|\x042b\x0419)",
+ L"\x041a\x041e\x0422",
+ L"^.+\x0422$",
+ L"(.+)[^\x0410\x0415]\x042c",
+ L"(.+)\\-\x041a\x0410",
+ L"(.*)ing",
+ L"",
+ L"(.+)\x0419+",
+ L"\x041a\x041e\x0422|\x041a\x0418\x0422",
+ L"(.+)\\d",
+ L"(.+)[[:alpha:]]"
+};
+
+
+static void BuildMatchers( lem::MCollect<ParadigmaMatcher*> &matchers )
+{
+ for( int i=0; i<N_COND; ++i )
+  matchers.push_back( new ParadigmaMatcher( lem::UFString(conditions[i]) ) );
+
+ return;
+}
+
+
+static bool Has( const lem::MCollect<int> &list, int x )
+{
+ return std::find( list.begin(), list.end(), x )!=list.end();
+}
+
+
+//    :  ,   
+//   ,  -1.
+static void CheckWord( const ParadigmaAutomaton &automaton, const wchar_t *word, const int *expected )
+{
+ lem::MCollect<int> hits;
+ automaton.Match( lem::UCString(word), hits );
+
+ lem::MCollect<int> want;
+ for( int k=0; expected[k]!=-1; ++k )
+  want.push_back( expected[k] );
+
+ std::sort( want.begin(), want.end() );
+
+ bool ok = hits.size()==want.size();
+ for( lem::Container::size_type k=0; ok && k<hits.size(); ++k )
+  ok = hits[k]==want[k];
+
+ if( !ok )
+  {
+   printf( "FAILED word %s: got", lem::to_utf8(word).c_str() );
+   for( lem::Container::size_type k=0; k<hits.size(); ++k )
+    printf( " %d", hits[k] );
+
+   printf( ", expected" );
+   for( lem::Container::size_type k=0; k<want.size(); ++k )
+    printf( " %d", want[k] );
+
+   printf( "\n" );
+   n_failed++;
+  }
+
+ return;
+}
+
+
+static void TestConditions( const ParadigmaAutomaton &automaton )
+{
+ //     .
+ const lem::MCollect<int> &fallback = automaton.GetFallback();
+ TEST_CHECK( fallback.size()==4 );
+ TEST_CHECK( Has(fallback,C_QUANT) && Has(fallback,C_TOP_ALT) && Has(fallback,C_DIGIT) && Has(fallback,C_POSIX) );
+ TEST_CHECK( !Has(fallback,C_EMPTY) );
+
+ TEST_CHECK( automaton.CountStates()>1 );
+ TEST_CHECK( automaton.CountClasses()>1 );
+
+ const int none[] = { -1 };
+
+ // , :   (.+)     .
+ const int sinij[] = { C_IJ, -1 };
+ CheckWord( automaton, L"\x0421\x0418\x041d\x0418\x0419", sinij );
+ CheckWord( automaton, L"\x0418\x0419", none );
+
+ //    : .
+ CheckWord( automaton, L"\x0441\x0438\x043d\x0438\x0439", sinij );
+
+ //   : (.*)   ,  - .
+ const int aja[] = { C_AJA, -1 };
+ CheckWord( automaton, L"\x042f\x042f", aja );
+ CheckWord( automaton, L"\x0410\x042f", aja );
+ CheckWord( automaton, L"\x0421\x0418\x041d\x042f\x042f", aja );
+ CheckWord( automaton, L"\x0415\x042f", none );
+
+ // ,  -   ,     .
+ const int oj[] = { C_OJ_YJ, -1 };
+ CheckWord( automaton, L"\x0417\x041b\x041e\x0419", oj );
+ CheckWord( automaton, L"\x0417\x041b\x042b\x0419", oj );
+ CheckWord( automaton, L"\x041e\x0419", none );
+
+ //  -     ^.+$;    -  .+.
+ const int kot[] = { C_KOT, C_DOT_T, -1 };
+ const int dot_t[] = { C_DOT_T, -1 };
+ CheckWord( automaton, L"\x041a\x041e\x0422", kot );
+ CheckWord( automaton, L"\x0421\x041a\x041e\x0422", dot_t );
+ CheckWord( automaton, L"\x041a\x0422", dot_t );
+ CheckWord( automaton, L"\x0422", none );
+
+ // [^]:  ,    .
+ const int not_ae[] = { C_NOT_AE, -1 };
+ CheckWord( automaton, L"\x041a\x041e\x041d\x042c", not_ae );
+ CheckWord( automaton, L"\x0414\x0410\x042c", none );
+ CheckWord( automaton, L"\x0414\x0415\x042c", none );
+
+ //  .
+ const int dash[] = { C_DASH_KA, -1 };
+ CheckWord( automaton, L"\x041a\x041e\x0422-\x041a\x0410", dash );
+ CheckWord( automaton, L"\x041a\x041e\x0422\x041a\x0410", none );
+
+ //    .
+ const int ing[] = { C_ING, -1 };
+ CheckWord( automaton, L"RUNNING", ing );
+ CheckWord( automaton, L"running", ing );
+ CheckWord( automaton, L"ING", ing );
+ CheckWord( automaton, L"INK", none );
+
+ CheckWord( automaton, L"", none );
+
+ return;
+}
+
+
+//          
+// .  ,  ,    
+// .
+static void TestRandom( const lem::MCollect<ParadigmaMatcher*> &matchers, const ParadigmaAutomaton &automaton, int n_word )
+{
+ const wchar_t alphabet[] = L"\x0410\x042f\x0418\x0419\x041e\x042b\x041a\x0422\x0415\x042c\x041d\x0414-INGKX";
+ const int n_alpha = CastSizeToInt( wcslen(alphabet) );
+
+ const lem::MCollect<int> &fallback = automaton.GetFallback();
+
+ int n_hit=0, n_bad=0;
+ unsigned int r=12345u;
+ lem::MCollect<int> hits, want;
+
+ for( int i=0; i<n_word; ++i )
+  {
+   r = r*1103515245u + 12345u;
+   const int len = int((r>>8)%7);
+
+   lem::UCString word;
+   for( int k=0; k<len; ++k )
+    {
+     r = r*1103515245u + 12345u;
+     word += alphabet[ (r>>9)%n_alpha ];
+    }
+
+   automaton.Match( word, hits );
+
+   want.clear();
+   for( int icond=0; icond<N_COND; ++icond )
+    if( !Has(fallback,icond) && matchers[icond]->Match(word) )
+     want.push_back(icond);
+
+   bool ok = hits.size()==want.size();
+   for( lem::Container::size_type k=0; ok && k<hits.size(); ++k )
+    ok = hits[k]==want[k];
+
+   n_hit += CastSizeToInt(hits.size());
+
+   if( !ok && n_bad++<10 )
+    printf( "FAILED random word %s: %d hits, regex gives %d\n", lem::to_utf8(word.c_str()).c_str(), CastSizeToInt(hits.size()), CastSizeToInt(want.size()) );
+  }
+
+ TEST_CHECK( n_bad==0 );
+ TEST_CHECK( n_hit>0 );
+
+ printf( "words=%d hits=%d states=%d classes=%d\n", n_word, n_hit, automaton.CountStates(), automaton.CountClasses() );
+ return;
+}
+
+
+int main( int argc, char *argv[] )
+{
+ const int n_word = argc>1 ? atoi(argv[1]) : 200000;
+
+ lem::MCollect<ParadigmaMatcher*> matchers;
+ BuildMatchers(matchers);
+
+ ParadigmaAutomaton automaton(matchers);
+
+ TestConditions(automaton);
+ TestRandom( matchers, automaton, n_word );
+
+ for( lem::Container::size_type i=0; i<matchers.size(); ++i )
+  delete matchers[i];
+
+ if( n_failed==0 )
+  printf( "All tests passed\n" );
+ else
+  printf( "%d check(s) failed\n", n_failed );
+
+ return n_failed==0 ? 0 : 1;
+}
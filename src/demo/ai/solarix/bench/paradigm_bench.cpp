@@ -0,0 +1,173 @@
+// -----------------------------------------------------------------------------
+// File PARADIGM_BENCH.CPP
+//
+// (c) by Koziev Elijah     all rights reserved
+//
+// SOLARIX Intellectronix Project http://www.solarix.ru
+//                                http://sourceforge.net/projects/solarix
+//
+// Content:
+//      (ParadigmaFinder).   
+//        
+// (FindLinear)    (Find) -    , 
+//    .  id   , 
+//       1.
+//
+// : paradigm_bench <dictionary.xml> [_]
+// -----------------------------------------------------------------------------
+//
+// CD->16.10.2026
+// LC->16.10.2026
+// --------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include <lem/date_time.h>
+#include <lem/smart_pointers.h>
+#include <lem/solarix/dictionary.h>
+#include <lem/solarix/load_options.h>
+#include <lem/solarix/sg_autom.h>
+#include <lem/solarix/WordEntry.h>
+#include <lem/solarix/WordEntries.h>
+#include <lem/solarix/WordEntryEnumerator.h>
+#include <lem/solarix/ParadigmaFinder.h>
+
+using namespace Solarix;
+
+
+struct Query
+{
+ lem::UCString name;
+ int id_class;
+};
+
+
+template < class FIND >
+static double Run(
+                  const FIND &find,
+                  const std::vector<Query> &queries,
+                  int n_pass,
+                  lem::int64_t &checksum
+                 )
+{
+ checksum=0;
+ lem::MCollect<int> ids;
+
+ lem::ElapsedTime timer;
+ timer.start();
+
+ for( int ipass=0; ipass<n_pass; ++ipass )
+  for( std::size_t i=0; i<queries.size(); ++i )
+   {
+    ids.clear();
+    find( queries[i], ids );
+    for( lem::Container::size_type k=0; k<ids.size(); ++k )
+     checksum = checksum*31 + ids[k];
+
+    checksum = checksum*31 + 1;
+   }
+
+ timer.stop();
+
+ const double sec = timer.elapsed().total_microseconds()/1000000.0;
+ return sec>0 ? double(queries.size())*n_pass/sec : 0.0;
+}
+
+
+struct LinearFind
+{
+ ParadigmaFinder &finder;
+ LinearFind( ParadigmaFinder &f ) : finder(f) {}
+ void operator()( const Query &q, lem::MCollect<int> &ids ) const { finder.FindLinear( q.id_class, q.name, ids ); }
+};
+
+struct AutomatonFind
+{
+ ParadigmaFinder &finder;
+ AutomatonFind( ParadigmaFinder &f ) : finder(f) {}
+ void operator()( const Query &q, lem::MCollect<int> &ids ) const { finder.Find( q.id_class, q.name, ids ); }
+};
+
+
+int main( int argc, char *argv[] )
+{
+ if( argc<2 )
+  {
+   printf( "Usage: paradigm_bench <dictionary.xml> [number of passes]\n" );
+   return 1;
+  }
+
+ const int n_pass = argc>2 ? atoi(argv[2]) : 3;
+
+ Dictionary dict;
+ Load_Options opt;
+ opt.lexicon=true;
+ if( !dict.LoadModules( lem::Path(argv[1]), opt ) )
+  {
+   printf( "Can not load dictionary %s\n", argv[1] );
+   return 1;
+  }
+
+ SynGram &sg = dict.GetSynGram();
+
+ //    -         .
+ std::vector<Query> queries;
+ lem::Ptr<WordEntryEnumerator> wenum( sg.GetEntries().ListEntries() );
+ while( wenum->Fetch() )
+  {
+   const SG_Entry &e = wenum->GetItem();
+   if( !e.IsTerminal() )
+    continue;
+
+   Query q;
+   q.name = e.GetName();
+   q.id_class = e.GetClass();
+   queries.push_back(q);
+
+   q.id_class = ANY_STATE;
+   queries.push_back(q);
+  }
+
+ ParadigmaFinder finder( &sg.GetStorage() );
+
+ int rc=0;
+ lem::MCollect<int> ids1, ids2;
+ for( std::size_t i=0; i<queries.size(); ++i )
+  {
+   ids1.clear();
+   ids2.clear();
+   finder.FindLinear( queries[i].id_class, queries[i].name, ids1 );
+   finder.Find( queries[i].id_class, queries[i].name, ids2 );
+
+   bool same = ids1.size()==ids2.size();
+   for( lem::Container::size_type k=0; same && k<ids1.size(); ++k )
+    same = ids1[k]==ids2[k];
+
+   if( !same )
+    {
+     lem::mout->printf( "Mismatch for %us class=%d: %d linear, %d automaton\n", queries[i].name.c_str(), queries[i].id_class, CastSizeToInt(ids1.size()), CastSizeToInt(ids2.size()) );
+     rc=1;
+    }
+  }
+
+ printf( "# %d queries, %d passes\n", CastSizeToInt(queries.size()), n_pass );
+ printf( "mode\tqueries_per_sec\tchecksum\n" );
+
+ lem::int64_t sum_linear=0, sum_automaton=0;
+
+ double qps = Run( LinearFind(finder), queries, n_pass, sum_linear );
+ printf( "linear\t%.1f\t%lld\n", qps, (long long)sum_linear );
+
+ qps = Run( AutomatonFind(finder), queries, n_pass, sum_automaton );
+ printf( "automaton\t%.1f\t%lld\n", qps, (long long)sum_automaton );
+
+ if( sum_linear!=sum_automaton )
+  {
+   printf( "Checksum mismatch between linear and automaton search\n" );
+   rc=1;
+  }
+
+ return rc;
+}
@@ -0,0 +1,157 @@
+// -----------------------------------------------------------------------------
+// File PREFIX_BENCH.CPP
+//
+// (c) by Koziev Elijah     all rights reserved
+//
+// SOLARIX Intellectronix Project http://www.solarix.ru
+//                                http://sourceforge.net/projects/solarix
+//
+// Content:
+//      (PrefixEntrySearcher)  
+// :  SQLite- charpos2entry   
+// Charpos2EntryStorage_Postings.      
+// Search  FindMaxPrefixLen,     
+//  .   .postings    ,  
+//  SQLite-.
+//
+// : prefix_bench <prefix_entry_searcher.db> <_utf8> [_]
+// -----------------------------------------------------------------------------
+//
+// CD->16.10.2026
+// LC->16.10.2026
+// --------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+#include <set>
+#include <fstream>
+
+#include <lem/unicode.h>
+#include <lem/date_time.h>
+#include <lem/streams.h>
+#include <lem/smart_pointers.h>
+#include <lem/solarix/sql_production.h>
+#include <lem/solarix/PrefixEntrySearcher.h>
+#include <lem/solarix/Charpos2EntryEnumerator.h>
+#include <lem/solarix/Charpos2EntryStorage_SQLITE.h>
+#include <lem/solarix/Charpos2EntryStorage_Postings.h>
+
+using namespace Solarix;
+
+
+static double Run(
+                  const PrefixEntrySearcher &pes,
+                  const std::vector<std::wstring> &words,
+                  int n_pass,
+                  lem::int64_t &checksum
+                 )
+{
+ checksum=0;
+ lem::MCollect<int> ies;
+
+ lem::ElapsedTime timer;
+ timer.start();
+
+ for( int ipass=0; ipass<n_pass; ++ipass )
+  for( std::size_t i=0; i<words.size(); ++i )
+   {
+    pes.Search( words[i].c_str(), ies );
+    for( lem::Container::size_type k=0; k<ies.size(); ++k )
+     checksum = checksum*31 + ies[k];
+
+    checksum = checksum*31 + pes.FindMaxPrefixLen( words[i].c_str() );
+   }
+
+ timer.stop();
+
+ const double sec = timer.elapsed().total_microseconds()/1000000.0;
+ return sec>0 ? double(words.size())*n_pass/sec : 0.0;
+}
+
+
+int main( int argc, char *argv[] )
+{
+ if( argc<3 )
+  {
+   printf( "Usage: prefix_bench <prefix_entry_searcher.db> <word list, utf8> [number of passes]\n" );
+   return 1;
+  }
+
+ const int n_pass = argc>3 ? atoi(argv[3]) : 3;
+
+ std::vector<std::wstring> words;
+ std::ifstream rdr( argv[2] );
+ std::string line;
+ while( std::getline( rdr, line ) )
+  {
+   std::wstring w = lem::from_utf8(line);
+   while( !w.empty() && (lem::is_uspace(w[w.length()-1]) || w[w.length()-1]==L'\r') )
+    w.erase( w.length()-1 );
+
+   if( !w.empty() )
+    words.push_back(w);
+  }
+
+ if( words.empty() )
+  {
+   printf( "No words in %s\n", argv[2] );
+   return 1;
+  }
+
+ const lem::Path db_path( argv[1] );
+ const lem::Path postings_path( db_path.GetUnicode()+L".postings" );
+
+ Charpos2EntryStorage_SQLITE *sqlite_stg = new Charpos2EntryStorage_SQLITE( db_path.GetUnicode() );
+ PrefixEntrySearcher sqlite_pes( sqlite_stg, lem::int_max );
+
+ lem::ElapsedTime build_timer;
+ build_timer.start();
+
+ if( !postings_path.DoesExist() )
+  {
+   Charpos2EntryStorage_Postings postings( postings_path );
+   postings.BeginTx();
+
+   std::set<int> ies;
+   lem::Ptr<Charpos2EntryEnumerator> cenum( sqlite_stg->Enumerate() );
+   while( cenum->Fetch() )
+    {
+     ies.clear();
+     sqlite_stg->Get( cenum->GetChar(), cenum->GetPos(), ies );
+     postings.Store( cenum->GetChar(), cenum->GetPos(), ies );
+    }
+
+   postings.CommitTx();
+  }
+
+ build_timer.stop();
+
+ Charpos2EntryStorage_Postings *postings_stg = new Charpos2EntryStorage_Postings( postings_path );
+ PrefixEntrySearcher postings_pes( postings_stg, lem::int_max );
+
+ lem::BinaryReader db_rdr( db_path );
+ const lem::int64_t db_size = (lem::int64_t)db_rdr.fsize();
+
+ printf( "# %d words, %d passes, postings build %d msec, %d lists, sqlite %lld bytes, postings %lld bytes, %s\n",
+  CastSizeToInt(words.size()), n_pass, build_timer.msec(), postings_stg->CountLists(),
+  (long long)db_size, (long long)postings_stg->GetImageSize(), postings_stg->IsMapped() ? "mapped" : "loaded" );
+ printf( "storage\twords_per_sec\tchecksum\n" );
+
+ lem::int64_t sum_sqlite=0, sum_postings=0;
+
+ double wps = Run( sqlite_pes, words, n_pass, sum_sqlite );
+ printf( "sqlite\t%.1f\t%lld\n", wps, (long long)sum_sqlite );
+
+ wps = Run( postings_pes, words, n_pass, sum_postings );
+ printf( "postings\t%.1f\t%lld\n", wps, (long long)sum_postings );
+
+ if( sum_sqlite!=sum_postings )
+  {
+   printf( "Mismatch between SQLite and postings storage\n" );
+   return 1;
+  }
+
+ return 0;
+}
@@ -0,0 +1,262 @@
+// -----------------------------------------------------------------------------
+// File RECOGNITION_CACHE_TEST.CPP
+//
+// (c) by Koziev Elijah     all rights reserved
+//
+// SOLARIX Intellectronix Project http://www.solarix.ru
+//                                http://sourceforge.net/projects/solarix
+//
+// Content:
+//      WordRecognitionCache:  
+// ,  ,    ,  
+//   (    ,  
+// )     .   .
+//        .
+//
+// : recognition_cache_test [_]
+// -----------------------------------------------------------------------------
+//
+// CD->16.10.2026
+// LC->16.10.2026
+// --------------
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <lem/conversions.h>
+#include <lem/solarix/word_form.h>
+#include <lem/solarix/WordRecognitionCache.h>
+
+#if defined LEM_THREADS
+#include <boost/thread/thread.hpp>
+#endif
+
+using namespace Solarix;
+
+static int n_failed=0;
+
+#define TEST_CHECK(x) \
+ if( !(x) ) { printf( "FAILED line %d: %s\n", __LINE__, #x ); n_failed++; }
+
+
+static WordRecognitionCache::Key MakeKey( const wchar_t *word, int case_flags )
+{
+ WordRecognitionCache::Key key;
+ key.word = word;
+ key.id_language = 1;
+ key.case_flags = case_flags;
+ key.word_parts = 1;
+ return key;
+}
+
+
+static Word_Form* MakeWordform( const lem::UCString &word, int ekey )
+{
+ RC_Lexem rc_word( new Solarix::Lexem(word) );
+ RC_Lexem rc_normalized( new Solarix::Lexem( lem::to_upper(word) ) );
+ return new Word_Form( rc_word, rc_normalized, ekey, Real1(100) );
+}
+
+
+static lem::UCString NumberedWord( int i )
+{
+ lem::UCString s(L"w");
+ s += lem::int_to_ustr(i);
+ return s;
+}
+
+
+static void TestHitMiss(void)
+{
+ WordRecognitionCache cache;
+
+ const WordRecognitionCache::Key key = MakeKey(L"cat",0);
+ TEST_CHECK( cache.Find(key)==NULL );
+
+ lem::Ptr<Word_Form> wf( MakeWordform(L"cat",7) );
+ cache.Store( key, *wf, cache.GetGeneration() );
+ TEST_CHECK( cache.Count()==1 );
+
+ lem::Ptr<Word_Form> hit( cache.Find(key) );
+ TEST_CHECK( hit.NotNull() );
+ if( hit.NotNull() )
+  {
+   //     .
+   TEST_CHECK( hit.get()!=wf.get() );
+   TEST_CHECK( hit->GetEntryKey()==7 );
+   TEST_CHECK( *hit->GetName()==L"cat" );
+  }
+
+ //   -  .
+ TEST_CHECK( cache.Find( MakeKey(L"cat",1) )==NULL );
+
+ TEST_CHECK( cache.CountHits()==1 );
+ TEST_CHECK( cache.CountMisses()==2 );
+
+ //         .
+ cache.Store( key, *wf, cache.GetGeneration() );
+ TEST_CHECK( cache.Count()==1 );
+
+ cache.SetMaxSize(0);
+ TEST_CHECK( !cache.IsEnabled() );
+ TEST_CHECK( cache.Count()==0 );
+ TEST_CHECK( cache.Find(key)==NULL );
+
+ return;
+}
+
+
+static void TestEviction(void)
+{
+ const int max_size=64;
+ WordRecognitionCache cache(max_size);
+
+ lem::Ptr<Word_Form> wf( MakeWordform(L"x",1) );
+
+ const int n=1000;
+ for( int i=0; i<n; ++i )
+  cache.Store( MakeKey( NumberedWord(i).c_str(), 0 ), *wf, cache.GetGeneration() );
+
+ TEST_CHECK( cache.Count()<=max_size );
+ TEST_CHECK( cache.Count()>0 );
+
+ //    ,   .
+ lem::Ptr<Word_Form> last( cache.Find( MakeKey( NumberedWord(n-1).c_str(), 0 ) ) );
+ TEST_CHECK( last.NotNull() );
+ TEST_CHECK( cache.Find( MakeKey( NumberedWord(0).c_str(), 0 ) )==NULL );
+
+ cache.SetMaxSize(16);
+ TEST_CHECK( cache.Count()<=16 );
+
+ return;
+}
+
+
+static void TestInvalidate(void)
+{
+ WordRecognitionCache cache;
+ const WordRecognitionCache::Key key = MakeKey(L"dog",0);
+ lem::Ptr<Word_Form> wf( MakeWordform(L"dog",3) );
+
+ cache.Store( key, *wf, cache.GetGeneration() );
+ TEST_CHECK( cache.Count()==1 );
+
+ //     ...
+ const int generation = cache.GetGeneration();
+
+ cache.Invalidate();
+ TEST_CHECK( cache.Count()==0 );
+ TEST_CHECK( cache.Find(key)==NULL );
+
+ // ...        .
+ cache.Store( key, *wf, generation );
+ TEST_CHECK( cache.Count()==0 );
+
+ cache.Store( key, *wf, cache.GetGeneration() );
+ TEST_CHECK( cache.Count()==1 );
+
+ return;
+}
+
+
+#if defined LEM_THREADS
+namespace
+{
+ struct CacheWorker
+ {
+  WordRecognitionCache *cache;
+  int seed;
+  int n_iter;
+  int n_find, n_bad;
+
+  CacheWorker( WordRecognitionCache *_cache, int _seed, int _n_iter )
+   : cache(_cache), seed(_seed), n_iter(_n_iter), n_find(0), n_bad(0) {}
+
+  void operator()(void)
+  {
+   unsigned int r = unsigned(seed);
+   for( int i=0; i<n_iter; ++i )
+    {
+     r = r*1103515245u + 12345u;
+     const int iword = int((r>>8)%500);
+     const lem::UCString word( NumberedWord(iword) );
+     const WordRecognitionCache::Key key = MakeKey( word.c_str(), 0 );
+
+     const int generation = cache->GetGeneration();
+     Word_Form *wf = cache->Find(key);
+     n_find++;
+
+     if( wf==NULL )
+      {
+       wf = MakeWordform(word,iword);
+       cache->Store( key, *wf, generation );
+      }
+     else if( wf->GetEntryKey()!=iword || *wf->GetName()!=word )
+      {
+       //      .
+       n_bad++;
+      }
+
+     delete wf;
+
+     //     "".
+     if( seed==1 && (i%5000)==2499 )
+      cache->Invalidate();
+    }
+  }
+ };
+}
+
+
+static void TestConcurrency( int n_thread )
+{
+ const int max_size=256;
+ WordRecognitionCache cache(max_size);
+
+ const int n_iter=20000;
+ std::vector<CacheWorker> workers;
+ for( int i=0; i<n_thread; ++i )
+  workers.push_back( CacheWorker( &cache, i+1, n_iter ) );
+
+ boost::thread_group group;
+ for( int i=0; i<n_thread; ++i )
+  group.create_thread( boost::ref(workers[i]) );
+ group.join_all();
+
+ int n_find=0, n_bad=0;
+ for( int i=0; i<n_thread; ++i )
+  {
+   n_find += workers[i].n_find;
+   n_bad += workers[i].n_bad;
+  }
+
+ TEST_CHECK( n_bad==0 );
+ TEST_CHECK( n_find==n_thread*n_iter );
+ TEST_CHECK( cache.Count()<=max_size );
+
+ printf( "threads=%d finds=%d hits=%d misses=%d cached=%d\n", n_thread, n_find, cache.CountHits(), cache.CountMisses(), cache.Count() );
+
+ return;
+}
+#endif
+
+
+int main( int argc, char *argv[] )
+{
+ const int n_thread = argc>1 ? atoi(argv[1]) : 8;
+
+ TestHitMiss();
+ TestEviction();
+ TestInvalidate();
+
+ #if defined LEM_THREADS
+ TestConcurrency( n_thread>0 ? n_thread : 1 );
+ #endif
+
+ if( n_failed==0 )
+  printf( "All tests passed\n" );
+ else
+  printf( "%d check(s) failed\n", n_failed );
+
+ return n_failed==0 ? 0 : 1;
+}
@@ -0,0 +1,154 @@
+// -----------------------------------------------------------------------------
+// File RECOGNIZER_BENCH.CPP
+//
+// (c) by Koziev Elijah     all rights reserved
+//
+// SOLARIX Intellectronix Project http://www.solarix.ru
+//                                http://sourceforge.net/projects/solarix
+//
+// Content:
+//        (, ,
+// , ).     LA_Recognizer  
+//    ,    , 
+//     ,      
+//    ,   .
+//
+// : recognizer_bench <dictionary.xml> <_utf8> [_]
+// -----------------------------------------------------------------------------
+//
+// CD->16.10.2026
+// LC->16.10.2026
+// --------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+#include <fstream>
+
+#include <lem/unicode.h>
+#include <lem/date_time.h>
+#include <lem/smart_pointers.h>
+#include <lem/solarix/dictionary.h>
+#include <lem/solarix/load_options.h>
+#include <lem/solarix/la_autom.h>
+#include <lem/solarix/LA_Recognizer.h>
+
+#include "alloc_counter.h"
+
+using namespace Solarix;
+
+
+static double Run(
+                  LA_Recognizer &recognizer,
+                  int id_lang,
+                  const std::vector<lem::UCString> &words,
+                  int n_pass,
+                  lem::int64_t &checksum,
+                  lem::int64_t &n_hit,
+                  lem::int64_t &n_alloc
+                 )
+{
+ checksum=0;
+ n_hit=0;
+ const lem::int64_t heap0 = n_heap_alloc;
+
+ lem::ElapsedTime timer;
+ timer.start();
+
+ for( int ipass=0; ipass<n_pass; ++ipass )
+  for( size_t i=0; i<words.size(); ++i )
+   {
+    lem::UCString normalized( words[i] );
+    normalized.to_upper();
+
+    MCollect<Word_Coord> found_list;
+    MCollect<ProjScore> val_list;
+    lem::PtrCollect<LA_ProjectInfo> inf_list;
+    if( recognizer.Apply( normalized, words[i], lem::Real1(100), lem::Real1(100), found_list, val_list, inf_list, id_lang, NULL ) )
+     n_hit++;
+
+    for( lem::Container::size_type j=0; j<found_list.size(); ++j )
+     checksum += (j+1)*( lem::int64_t(found_list[j].GetEntry())*31 + inf_list[j]->coords.size() );
+   }
+
+ timer.stop();
+ n_alloc = n_heap_alloc-heap0;
+
+ const double sec = timer.elapsed().total_microseconds()/1000000.0;
+ return sec>0 ? words.size()*n_pass/sec : 0.0;
+}
+
+
+int main( int argc, char *argv[] )
+{
+ if( argc<3 )
+  {
+   printf( "Usage: recognizer_bench <dictionary.xml> <words file, utf8> [number of passes]\n" );
+   return 1;
+  }
+
+ const int n_pass = argc>3 ? atoi(argv[3]) : 3;
+
+ std::vector<lem::UCString> words;
+ std::ifstream rdr( argv[2] );
+ std::string line;
+ while( std::getline( rdr, line ) )
+  {
+   if( !line.empty() && line[line.size()-1]=='\r' )
+    line.erase( line.size()-1 );
+
+   std::wstring w = lem::from_utf8(line);
+   if( w.empty() || w.length()>=lem::UCString::max_len )
+    continue;
+
+   words.push_back( lem::UCString( w.c_str() ) );
+  }
+
+ if( words.empty() )
+  {
+   printf( "No words in %s\n", argv[2] );
+   return 1;
+  }
+
+ Dictionary dict;
+ Load_Options opt;
+ opt.lexicon=true;
+ if( !dict.LoadModules( lem::Path(argv[1]), opt ) )
+  {
+   printf( "Can not load dictionary %s\n", argv[1] );
+   return 1;
+  }
+
+ const int id_lang = dict.GetDefaultLanguage();
+ LA_Recognizer &recognizer = dict.GetLexAuto().GetRecognizer();
+
+ //    ,     .
+ lem::ElapsedTime load_timer;
+ load_timer.start();
+ lem::int64_t checksum=0, n_hit=0, n_alloc=0;
+ Run( recognizer, id_lang, std::vector<lem::UCString>( 1, words.front() ), 1, checksum, n_hit, n_alloc );
+ load_timer.stop();
+
+ printf( "# rules load: %d msec, %d words, %d passes\n", load_timer.msec(), int(words.size()), n_pass );
+ printf( "mode\twords_per_sec\trecognized\tallocs_per_word\tchecksum\n" );
+
+ lem::int64_t sum_loop=0, sum_set=0;
+ const lem::int64_t n_call = lem::int64_t(words.size())*n_pass;
+
+ recognizer.SetRegexAutomaton(false);
+ double wps = Run( recognizer, id_lang, words, n_pass, sum_loop, n_hit, n_alloc );
+ printf( "regex_loop\t%.1f\t%lld\t%.2f\t%lld\n", wps, (long long)n_hit, double(n_alloc)/n_call, (long long)sum_loop );
+
+ recognizer.SetRegexAutomaton(true);
+ wps = Run( recognizer, id_lang, words, n_pass, sum_set, n_hit, n_alloc );
+ printf( "regex_set\t%.1f\t%lld\t%.2f\t%lld\n", wps, (long long)n_hit, double(n_alloc)/n_call, (long long)sum_set );
+
+ if( sum_loop!=sum_set )
+  {
+   printf( "Mismatch between per-rule and automaton regex matching\n" );
+   return 1;
+  }
+
+ return 0;
+}
@@ -0,0 +1,144 @@
+// -----------------------------------------------------------------------------
+// File REGEX_SET_TEST.CPP
+//
+// (c) by Koziev Elijah     all rights reserved
+//
+// SOLARIX Intellectronix Project http://www.solarix.ru
+//                                http://sourceforge.net/projects/solarix
+//
+// Content:
+//   LA_RegexSet  boost::wregex,  
+//    .   , 
+// ,          
+//   ,     boost::regex_match.
+//        ,  \w \d \s,
+//   .   .   
+//       .
+//
+// : regex_set_test
+// -----------------------------------------------------------------------------
+//
+// CD->16.10.2026
+// LC->16.10.2026
+// --------------
+
+#include <stdio.h>
+#include <boost/regex.hpp>
+
+#include <lem/conversions.h>
+#include <lem/solarix/LA_RegexSet.h>
+
+using namespace Solarix;
+
+static const wchar_t* patterns[] =
+{
+ L"\\w+",
+ L"\\w*\u041e\u0412",
+ L"\\w*\u043e\u0432",
+ L"\u041f\u041e\\w+",
+ L"\u043f\u043e\\w+",
+ L"[\u0410-\u042f]+",
+ L"[\u0430-\u044f]+",
+ L"[\u0410-\u042f\u0401][\u0430-\u044f\u0451]+",
+ L"[^\u0430-\u044f]+",
+ L"[^\\w]+",
+ L"\\W",
+ L"[\\w\u0416]+",
+ L"\\d+-\\w+",
+ L"\\d+-(\u042b\u0419|\u0418\u0419|\u041e\u0419)",
+ L".*(\u0415\u0419|\u0418\u0419)",
+ L"^\u0436.?\u0436$",
+ L"(?:\u041f\u0420\u041e|\u043f\u0440\u043e)\\w{2,4}",
+ L"[a-z]+",
+ L"[A-Z][a-z]*",
+ L"[A-Za-z\u0410-\u042f\u0430-\u044f]+",
+ L"\\s*\\w+\\s*",
+ L"\\S+",
+ L"\u0401\\w*",
+ L".+",
+ NULL
+};
+
+static const wchar_t* words[] =
+{
+ L"\u041a\u041e\u0422\u041e\u0412",
+ L"\u043a\u043e\u0442\u043e\u0432",
+ L"\u041a\u043e\u0442\u043e\u0432",
+ L"\u041f\u041e\u0425\u041e\u0414",
+ L"\u043f\u043e\u0445\u043e\u0434",
+ L"\u041f\u043e\u0445\u043e\u0434",
+ L"\u0401\u0416",
+ L"\u0451\u0436",
+ L"\u0416\u0423\u0416",
+ L"\u0436\u0443\u0436",
+ L"\u0416\u0443\u0416",
+ L"\u041f\u0420\u041e\u0411\u0410",
+ L"\u043f\u0440\u043e\u0431\u0430",
+ L"\u041f\u0440\u043e\u0431\u0430",
+ L"12-\u042b\u0419",
+ L"12-\u044b\u0439",
+ L"\u0421\u0418\u041d\u0415\u0419",
+ L"\u0441\u0438\u043d\u0435\u0439",
+ L"word",
+ L"WORD",
+ L"Word",
+ L"word_2",
+ L"\u0441\u043b\u043e \u0432\u043e",
+ L" \u0441\u043b\u043e\u0432\u043e ",
+ L"mix\u0421\u043b\u043e\u0432\u043e",
+ L"+-*",
+ L"123",
+ L"\u041e\u0412",
+ L"\u043e\u0432",
+ NULL
+};
+
+
+int main( int argc, char *argv[] )
+{
+ int n_failed=0, n_compared=0, n_fallback=0;
+
+ for( int icase=0; icase<2; ++icase )
+  for( int ip=0; patterns[ip]!=NULL; ++ip )
+   {
+    LA_RegexSet rx_set( icase==1 );
+    if( !rx_set.Add( patterns[ip], ip ) )
+     {
+      n_fallback++;
+      continue;
+     }
+
+    const boost::wregex rx = icase==1 ?
+     boost::wregex( patterns[ip], boost::basic_regex<wchar_t>::icase ) :
+     boost::wregex( patterns[ip] );
+
+    for( int iw=0; words[iw]!=NULL; ++iw )
+     {
+      lem::MCollect<int> hits;
+      rx_set.Match( words[iw], hits );
+
+      const bool set_match = !hits.empty();
+      const bool boost_match = boost::regex_match( words[iw], rx );
+      n_compared++;
+
+      if( set_match!=boost_match )
+       {
+        n_failed++;
+        printf( "Mismatch: pattern %s%s word %s: automaton=%d boost=%d\n",
+         lem::to_utf8(patterns[ip]).c_str(), icase ? " (icase)" : "",
+         lem::to_utf8(words[iw]).c_str(), int(set_match), int(boost_match) );
+       }
+     }
+   }
+
+ printf( "%d comparisons, %d patterns left to boost\n", n_compared, n_fallback );
+
+ if( n_failed )
+  {
+   printf( "%d mismatch(es), FAILED\n", n_failed );
+   return 1;
+  }
+
+ printf( "OK\n" );
+ return 0;
+}
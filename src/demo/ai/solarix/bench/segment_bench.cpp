@@ -0,0 +1,162 @@
+// -----------------------------------------------------------------------------
+// File SEGMENT_BENCH.CPP
+//
+// (c) by Koziev Elijah     all rights reserved
+//
+// SOLARIX Intellectronix Project http://www.solarix.ru
+//                                http://sourceforge.net/projects/solarix
+//
+// Content:
+//      (   
+// ).         ,
+//       :   
+//  CharNode (std::map   ),    
+// CharTrie,   SegmentingSentenceTokenizer.  
+//          .
+//      .
+//
+// : segment_bench <dictionary.xml> <_utf8> [_]
+// -----------------------------------------------------------------------------
+//
+// CD->16.10.2026
+// LC->16.10.2026
+// --------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+#include <fstream>
+
+#include <lem/unicode.h>
+#include <lem/date_time.h>
+#include <lem/solarix/dictionary.h>
+#include <lem/solarix/load_options.h>
+#include <lem/solarix/sg_autom.h>
+#include <lem/solarix/prefix_tree.h>
+#include <lem/solarix/CharTrie.h>
+
+using namespace Solarix;
+
+
+template < class LOOKUP >
+static double Run(
+                  const LOOKUP &lookup,
+                  const std::wstring &text,
+                  bool greedy,
+                  int n_pass,
+                  lem::int64_t &checksum
+                 )
+{
+ checksum=0;
+ const int n = CastSizeToInt(text.length());
+
+ lem::ElapsedTime timer;
+ timer.start();
+
+ for( int ipass=0; ipass<n_pass; ++ipass )
+  for( int i=0; i<n; )
+   {
+    const int len = lookup( text.c_str()+i );
+    checksum = checksum*31 + len;
+    i += greedy && len>0 ? len : 1;
+   }
+
+ timer.stop();
+
+ const double sec = timer.elapsed().total_microseconds()/1000000.0;
+ return sec>0 ? double(n)*n_pass/sec : 0.0;
+}
+
+
+struct TreeLookup
+{
+ const CharNode &tree;
+ TreeLookup( const CharNode &t ) : tree(t) {}
+ int operator()( const wchar_t *s ) const { return tree.match_len(s); }
+};
+
+struct TrieLookup
+{
+ const CharTrie &trie;
+ TrieLookup( const CharTrie &t ) : trie(t) {}
+ int operator()( const wchar_t *s ) const { return trie.MatchLen(s); }
+};
+
+
+int main( int argc, char *argv[] )
+{
+ if( argc<3 )
+  {
+   printf( "Usage: segment_bench <dictionary.xml> <text file, utf8> [number of passes]\n" );
+   return 1;
+  }
+
+ const int n_pass = argc>3 ? atoi(argv[3]) : 3;
+
+ //   -   ,     .
+ std::wstring text;
+ std::ifstream rdr( argv[2] );
+ std::string line;
+ while( std::getline( rdr, line ) )
+  {
+   std::wstring w = lem::from_utf8(line);
+   for( std::size_t i=0; i<w.length(); ++i )
+    if( !lem::is_uspace(w[i]) && w[i]!=L'\r' )
+     text += w[i];
+  }
+
+ if( text.empty() )
+  {
+   printf( "No text in %s\n", argv[2] );
+   return 1;
+  }
+
+ Dictionary dict;
+ Load_Options opt;
+ opt.lexicon=true;
+ if( !dict.LoadModules( lem::Path(argv[1]), opt ) )
+  {
+   printf( "Can not load dictionary %s\n", argv[1] );
+   return 1;
+  }
+
+ SynGram &sg = dict.GetSynGram();
+
+ lem::ElapsedTime build_timer;
+ build_timer.start();
+ const CharNode &tree = sg.GetPrefixTree();
+ build_timer.stop();
+ const int tree_msec = build_timer.msec();
+
+ build_timer.start();
+ const CharTrie &trie = sg.GetPrefixTrie();
+ build_timer.stop();
+
+ printf( "# %d chars, %d passes, tree build %d msec, trie build %d msec, %d states in %d cells\n",
+  CastSizeToInt(text.length()), n_pass, tree_msec, build_timer.msec(), trie.CountStates(), trie.CountCells() );
+ printf( "scan\tmode\tchars_per_sec\tchecksum\n" );
+
+ int rc=0;
+ for( int k=0; k<2; ++k )
+  {
+   const bool greedy = k==0;
+   const char *scan_name = greedy ? "greedy" : "every_pos";
+
+   lem::int64_t sum_tree=0, sum_trie=0;
+
+   double cps = Run( TreeLookup(tree), text, greedy, n_pass, sum_tree );
+   printf( "%s\tchar_node\t%.1f\t%lld\n", scan_name, cps, (long long)sum_tree );
+
+   cps = Run( TrieLookup(trie), text, greedy, n_pass, sum_trie );
+   printf( "%s\tdouble_array\t%.1f\t%lld\n", scan_name, cps, (long long)sum_trie );
+
+   if( sum_tree!=sum_trie )
+    {
+     printf( "Mismatch between CharNode and CharTrie for %s scan\n", scan_name );
+     rc=1;
+    }
+  }
+
+ return rc;
+}
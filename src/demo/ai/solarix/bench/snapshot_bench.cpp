@@ -0,0 +1,238 @@
+// -----------------------------------------------------------------------------
+// File SNAPSHOT_BENCH.CPP
+//
+// (c) by Koziev Elijah     all rights reserved
+//
+// SOLARIX Intellectronix Project http://www.solarix.ru
+//                                http://sourceforge.net/projects/solarix
+//
+// Content:
+//        .
+//
+//  :         
+//  (    - )    ,
+//        . ,
+//           
+//      .   
+// ,      - .
+//
+//   ,     
+// LoadModules     .   
+//   lexicon -dictdir dictionary.xml -snapshot <> 
+//    <snapshot>.
+//
+// : snapshot_bench [<dictionary.xml> [_]]
+// -----------------------------------------------------------------------------
+//
+// CD->16.10.2026
+// LC->16.10.2026
+// --------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include <lem/date_time.h>
+#include <lem/path.h>
+#include <lem/smart_pointers.h>
+#include <lem/solarix/dictionary.h>
+#include <lem/solarix/load_options.h>
+#include <lem/solarix/sg_autom.h>
+#include <lem/solarix/WordEntries.h>
+#include <lem/solarix/LexemeEnumerator.h>
+#include <lem/solarix/LexemDictionary.h>
+#include <lem/solarix/DictionarySnapshot.h>
+
+#include "lexeme_gen.h"
+
+using namespace Solarix;
+
+
+static void LoadLexemes( const char *dictionary_xml, std::vector<Lexem> &lexems )
+{
+ Dictionary dict;
+ Load_Options opt;
+ opt.lexicon=true;
+ opt.snapshot=false;
+ if( !dict.LoadModules( lem::Path(dictionary_xml), opt ) )
+  {
+   printf( "Can not load dictionary %s\n", dictionary_xml );
+   exit(1);
+  }
+
+ lem::Ptr<LexemeEnumerator> lenum( dict.GetSynGram().GetEntries().ListLexemes() );
+ Lexem buf;
+ while( lenum->Fetch() )
+  lexems.push_back( *lenum->Get(buf) );
+
+ return;
+}
+
+
+static double Msec( const lem::ElapsedTime &timer, int n_pass )
+{
+ return timer.elapsed().total_microseconds()/1000.0/n_pass;
+}
+
+
+//   ,   .
+static double LoadDictionary( const char *dictionary_xml, bool use_snapshot, int n_pass, bool &snapshot_used )
+{
+ lem::ElapsedTime timer;
+ timer.start();
+
+ for( int ipass=0; ipass<n_pass; ++ipass )
+  {
+   Dictionary dict;
+   Load_Options opt;
+   opt.snapshot = use_snapshot;
+   if( !dict.LoadModules( lem::Path(dictionary_xml), opt ) )
+    {
+     printf( "Can not load dictionary %s\n", dictionary_xml );
+     exit(1);
+    }
+
+   snapshot_used = dict.UsesSnapshot();
+  }
+
+ timer.stop();
+ return Msec( timer, n_pass );
+}
+
+
+int main( int argc, char *argv[] )
+{
+ const int n_pass = argc>2 ? atoi(argv[2]) : 5;
+
+ std::vector<Lexem> lexems;
+ if( argc>1 )
+  LoadLexemes( argv[1], lexems );
+ else
+  GenerateLexemes( 30000, BENCH_MAX_FORMS, lexems );
+
+ const lem::Path lexicon_path( lem::Path::GetTmpFilename("bin") );
+ WriteLexemes( lexicon_path, lexems );
+ const int n_lexem = CastSizeToInt(lexems.size());
+
+ printf( "# %d lexemes, %s\n", n_lexem, argc>1 ? argv[1] : "generated" );
+
+ // :          .
+ const lem::Path snapshot_path( lem::Path::GetTmpFilename("snapshot") );
+ {
+  LexemDictionary dict( n_lexem );
+  lem::BinaryReader bin( lexicon_path );
+  dict.LoadBin( bin );
+
+  DictionarySnapshot::Writer wr( snapshot_path );
+  dict.SetSavePoolImage(true);
+  dict.SaveBin( wr.BeginSection( DictionarySnapshot::Morphology, lexicon_path ) );
+  wr.EndSection();
+  dict.SavePoolImage( wr.BeginSection( DictionarySnapshot::Lexemes, lexicon_path ) );
+  wr.EndSection();
+  wr.Finish();
+ }
+
+ DictionarySnapshot snapshot;
+ if( !snapshot.Open( snapshot_path ) ||
+     !snapshot.HasSection( DictionarySnapshot::Morphology, lexicon_path ) ||
+     !snapshot.HasSection( DictionarySnapshot::Lexemes, lexicon_path ) )
+  {
+   printf( "Can not open snapshot\n" );
+   return 1;
+  }
+
+ printf( "load\tmsec\theap_bytes\tmapped_bytes\n" );
+
+ lem::ElapsedTime timer;
+ lem::uint64_t heap=0;
+
+ timer.start();
+ for( int ipass=0; ipass<n_pass; ++ipass )
+  {
+   LexemDictionary dict( n_lexem );
+   lem::BinaryReader bin( lexicon_path );
+   dict.LoadBin( bin );
+   heap = dict.GetMemoryUsage();
+  }
+ timer.stop();
+ printf( "stream\t%.2f\t%llu\t0\n", Msec(timer,n_pass), (unsigned long long)heap );
+
+ timer.start();
+ for( int ipass=0; ipass<n_pass; ++ipass )
+  {
+   LexemDictionary dict( n_lexem );
+   dict.SetPoolImage( snapshot.GetSectionData(DictionarySnapshot::Lexemes), snapshot.GetSectionSize(DictionarySnapshot::Lexemes) );
+   lem::Ptr<lem::Stream> bin( snapshot.OpenSection(DictionarySnapshot::Morphology) );
+   dict.LoadBin( *bin );
+   heap = dict.GetMemoryUsage();
+  }
+ timer.stop();
+ printf( "snapshot\t%.2f\t%llu\t%llu\n", Msec(timer,n_pass), (unsigned long long)heap, (unsigned long long)snapshot.GetSectionSize(DictionarySnapshot::Lexemes) );
+
+ //            .
+ int n_failed=0;
+ {
+  LexemDictionary dict1( n_lexem ), dict2( n_lexem );
+  lem::BinaryReader bin1( lexicon_path );
+  dict1.LoadBin( bin1 );
+
+  dict2.SetPoolImage( snapshot.GetSectionData(DictionarySnapshot::Lexemes), snapshot.GetSectionSize(DictionarySnapshot::Lexemes) );
+  lem::Ptr<lem::Stream> bin2( snapshot.OpenSection(DictionarySnapshot::Morphology) );
+  dict2.LoadBin( *bin2 );
+
+  if( !dict2.IsPoolImageAttached() || dict1.size()!=dict2.size() )
+   n_failed++;
+
+  for( int i=0; i<n_lexem && n_failed<10; ++i )
+   {
+    lem::UCString miss( lexems[i] );
+    if( miss.length()<lem::UCString::max_len )
+     miss += L'#';
+
+    if(
+       dict2.FindId( lexems[i] )!=dict1.FindId( lexems[i] ) ||
+       dict2.FindId( miss )!=dict1.FindId( miss ) ||
+       dict2.GetString(i)!=dict1.GetString(i) ||
+       !( dict2[i]==lexems[i] )
+      )
+     {
+      printf( "Mismatch for lexeme #%d\n", i );
+      n_failed++;
+     }
+   }
+ }
+
+ //       .
+ {
+  lem::BinaryWriter touch( lexicon_path );
+  const int n=0;
+  touch.write( &n, sizeof(n) );
+ }
+
+ if( snapshot.HasSection( DictionarySnapshot::Lexemes, lexicon_path ) )
+  {
+   printf( "Outdated section is not detected\n" );
+   n_failed++;
+  }
+
+ snapshot.Close();
+ snapshot_path.DoRemove();
+ lexicon_path.DoRemove();
+
+ if( argc>1 )
+  {
+   bool used=false;
+   const double msec_files = LoadDictionary( argv[1], false, n_pass, used );
+   const double msec_snapshot = LoadDictionary( argv[1], true, n_pass, used );
+   printf( "LoadModules\tfiles %.1f msec\tsnapshot %.1f msec\tsnapshot %s\n", msec_files, msec_snapshot, used ? "used" : "NOT used" );
+  }
+
+ if( n_failed )
+  {
+   printf( "FAILED\n" );
+   return 1;
+  }
+
+ printf( "OK\n" );
+ return 0;
+}
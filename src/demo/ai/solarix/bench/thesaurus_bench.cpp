@@ -0,0 +1,127 @@
+// -----------------------------------------------------------------------------
+// File THESAURUS_BENCH.CPP
+//
+// (c) by Koziev Elijah     all rights reserved
+//
+// SOLARIX Intellectronix Project http://www.solarix.ru
+//                                http://sourceforge.net/projects/solarix
+//
+// Content:
+//     SG_Net::Find_Linked_Entries   ,
+//     .     SQL-
+//  ,       (SG_NetGraph);  
+//  ,       ,  
+//    .
+//
+// : thesaurus_bench <dictionary.xml> [] [_]
+// -----------------------------------------------------------------------------
+//
+// CD->16.10.2026
+// LC->16.10.2026
+// --------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <set>
+#include <vector>
+
+#include <lem/date_time.h>
+#include <lem/smart_pointers.h>
+#include <lem/solarix/dictionary.h>
+#include <lem/solarix/load_options.h>
+#include <lem/solarix/sg_autom.h>
+#include <lem/solarix/Thesaurus.h>
+#include <lem/solarix/ThesaurusStorage.h>
+#include <lem/solarix/LS_ResultSet.h>
+
+using namespace Solarix;
+
+
+static double Run( SG_Net &net, const std::vector<int> &ekeys, float depth, int n_pass, lem::int64_t &checksum )
+{
+ checksum=0;
+
+ lem::ElapsedTime timer;
+ timer.start();
+
+ for( int ipass=0; ipass<n_pass; ++ipass )
+  for( size_t i=0; i<ekeys.size(); ++i )
+   {
+    std::set<int> linked;
+    net.Find_Linked_Entries( ekeys[i], depth, linked );
+
+    lem::int64_t h = CastSizeToInt(linked.size());
+    for( std::set<int>::const_iterator it=linked.begin(); it!=linked.end(); ++it )
+     h = h*31 + *it;
+
+    checksum += (i+1)*h;
+   }
+
+ timer.stop();
+ const double sec = timer.elapsed().total_microseconds()/1000000.0;
+ return sec>0 ? ekeys.size()*n_pass/sec : 0.0;
+}
+
+
+int main( int argc, char *argv[] )
+{
+ if( argc<2 )
+  {
+   printf( "Usage: thesaurus_bench <dictionary.xml> [depth] [number of passes]\n" );
+   return 1;
+  }
+
+ const float depth = argc>2 ? float(atof(argv[2])) : 1.0F;
+ const int n_pass = argc>3 ? atoi(argv[3]) : 3;
+
+ Dictionary dict;
+ Load_Options opt;
+ opt.load_semnet=true;
+ if( !dict.LoadModules( lem::Path(argv[1]), opt ) )
+  {
+   printf( "Can not load dictionary %s\n", argv[1] );
+   return 1;
+  }
+
+ SG_Net &net = dict.GetSynGram().Get_Net();
+
+ std::vector<int> ekeys;
+ {
+  std::set<int> uniq;
+  lem::Ptr<LS_ResultSet> rs( net.GetStorage().ListAllWordLinks() );
+  while( rs->Fetch() )
+   if( uniq.insert( rs->GetInt(1) ).second )
+    ekeys.push_back( rs->GetInt(1) );
+ }
+
+ if( ekeys.empty() )
+  {
+   printf( "Thesaurus in %s has no word links\n", argv[1] );
+   return 1;
+  }
+
+ lem::int64_t sum_sql=0, sum_graph=0;
+
+ net.DropGraph();
+ double eps = Run( net, ekeys, depth, n_pass, sum_sql );
+
+ lem::ElapsedTime load_timer;
+ load_timer.start();
+ net.LoadGraph();
+ load_timer.stop();
+
+ printf( "# %d entries, depth=%g, %d passes, graph load: %d msec\n", int(ekeys.size()), depth, n_pass, load_timer.msec() );
+ printf( "mode\tentries_per_sec\tchecksum\n" );
+ printf( "sql\t%.1f\t%lld\n", eps, (long long)sum_sql );
+
+ eps = Run( net, ekeys, depth, n_pass, sum_graph );
+ printf( "graph\t%.1f\t%lld\n", eps, (long long)sum_graph );
+
+ if( sum_sql!=sum_graph )
+  {
+   printf( "Mismatch between SQL and in-memory thesaurus traversal\n" );
+   return 1;
+  }
+
+ return 0;
+}
@@ -0,0 +1,157 @@
+// -----------------------------------------------------------------------------
+// File TRFUN_BENCH.CPP
+//
+// (c) by Koziev Elijah     all rights reserved
+//
+// SOLARIX Intellectronix Project http://www.solarix.ru
+//                                http://sourceforge.net/projects/solarix
+//
+// Content:
+//     (TrFunctions):  
+//    ,    
+//      .   
+//   (- ),  - 
+// -.      , 
+//       ;  
+// .
+//
+// : trfun_bench <dictionary.xml> <_utf8> [_]
+// -----------------------------------------------------------------------------
+//
+// CD->16.10.2026
+// LC->16.10.2026
+// --------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+#include <fstream>
+
+#include <lem/unicode.h>
+#include <lem/date_time.h>
+#include <lem/oformatter.h>
+#include <lem/solarix/dictionary.h>
+#include <lem/solarix/load_options.h>
+#include <lem/solarix/la_autom.h>
+#include <lem/solarix/res_pack.h>
+#include <lem/solarix/translation.h>
+#include <lem/solarix/PM_FunctionLoader.h>
+#include <lem/solarix/WrittenTextAnalysisSession.h>
+
+#include "alloc_counter.h"
+
+using namespace Solarix;
+
+
+static double Run(
+                  Dictionary &dict,
+                  WrittenTextAnalysisSession &session,
+                  const std::vector<lem::UFString> &sentences,
+                  int n_pass,
+                  lem::int64_t &checksum,
+                  lem::int64_t &n_alloc
+                 )
+{
+ checksum=0;
+ const lem::int64_t heap0 = n_heap_alloc;
+
+ lem::ElapsedTime timer;
+ timer.start();
+
+ for( int ipass=0; ipass<n_pass; ++ipass )
+  for( size_t i=0; i<sentences.size(); ++i )
+   {
+    session.SyntacticAnalysis( sentences[i] );
+
+    //    ,    
+    //      .
+    lem::MemFormatter mem;
+    session.GetPack().Print( mem, dict.GetSynGram() );
+    const lem::UFString s( mem.string() );
+    for( int k=0; k<s.length(); ++k )
+     checksum = checksum*31 + s[k];
+   }
+
+ timer.stop();
+ n_alloc = n_heap_alloc-heap0;
+
+ const double sec = timer.elapsed().total_microseconds()/1000000.0;
+ return sec>0 ? sentences.size()*n_pass/sec : 0.0;
+}
+
+
+int main( int argc, char *argv[] )
+{
+ if( argc<3 )
+  {
+   printf( "Usage: trfun_bench <dictionary.xml> <corpus file, utf8> [number of passes]\n" );
+   return 1;
+  }
+
+ const int n_pass = argc>3 ? atoi(argv[3]) : 3;
+
+ std::vector<lem::UFString> sentences;
+ std::ifstream rdr( argv[2] );
+ std::string line;
+ while( std::getline( rdr, line ) )
+  {
+   if( !line.empty() && line[line.size()-1]=='\r' )
+    line.erase( line.size()-1 );
+
+   if( line.empty() )
+    continue;
+
+   sentences.push_back( lem::UFString( lem::from_utf8(line).c_str() ) );
+  }
+
+ if( sentences.empty() )
+  {
+   printf( "No sentences in %s\n", argv[2] );
+   return 1;
+  }
+
+ Dictionary dict;
+ Load_Options opt;
+ opt.affix_table = true;
+ opt.seeker = true;
+ opt.ngrams = true;
+ opt.lexicon = true;
+ if( !dict.LoadModules( lem::Path(argv[1]), opt ) )
+  {
+   printf( "Can not load dictionary %s\n", argv[1] );
+   return 1;
+  }
+
+ WrittenTextAnalysisSession session( &dict, NULL );
+ session.params.SetLanguageID( dict.GetDefaultLanguage() );
+ session.params.CompleteAnalysisOnly = false;
+ session.params.UseTopDownThenSparse = true;
+
+ TrFunctions &funs = dict.GetLexAuto().GetFunctions().Get();
+
+ // :         .
+ session.SyntacticAnalysis( sentences.front() );
+
+ printf( "# %d sentences, %d passes, %d of %d functions compiled\n", int(sentences.size()), n_pass, funs.CountBytecodeFuns(), funs.CountUserFuns() );
+ printf( "mode\tsent_per_sec\tallocs_per_sent\tchecksum\n" );
+
+ const lem::int64_t n_call = lem::int64_t(sentences.size())*n_pass;
+ lem::int64_t sum_tree=0, sum_code=0, n_alloc=0;
+
+ funs.DropBytecode();
+ double sps = Run( dict, session, sentences, n_pass, sum_tree, n_alloc );
+ printf( "tree\t%.1f\t%.2f\t%lld\n", sps, double(n_alloc)/n_call, (long long)sum_tree );
+
+ funs.CompileBytecode();
+ sps = Run( dict, session, sentences, n_pass, sum_code, n_alloc );
+ printf( "bytecode\t%.1f\t%.2f\t%lld\n", sps, double(n_alloc)/n_call, (long long)sum_code );
+
+ if( sum_tree!=sum_code )
+  {
+   printf( "Mismatch between tree interpreter and bytecode\n" );
+   return 1;
+  }
+
+ return 0;
+}
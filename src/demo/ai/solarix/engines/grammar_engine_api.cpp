@@ -135,6 +135,14 @@
 #include <lem/logfile.h>
 #include <lem/sqlite_helpers.h>
 #include <lem/solarix/WrittenTextAnalysisSession.h>
+#include <lem/solarix/WordRecognitionCache.h>
+
+#if defined LEM_THREADS
+#include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition.hpp>
+#include <boost/bind.hpp>
+#endif
 
 #define HFLEXIONTABLE void*
 #define HFLEXIONS void*
@@ -454,6 +462,7 @@ FAIND_API(int) sol_DeleteStrings( HGREN_STR hStrings )
 using namespace lem;
 using namespace Solarix;
 
+static void DeleteSyntaxAnalysisPool( Solarix::Faind_Engine *engine );
 
 
 #if defined SOLARIX_GRAMMAR_ENGINE || defined SOLARIX_SYNONYMIZER_ENGINE
@@ -470,6 +479,7 @@ FAIND_API(int) sol_DeleteGrammarEngine( HGREN hEngine )
    if( hEngine!=NULL )
     {
      Faind_Engine * ptr = (Faind_Engine*)hEngine;
+     DeleteSyntaxAnalysisPool(ptr);
      delete ptr;
     }
    return 1;
@@ -2735,6 +2745,74 @@ FAIND_API(HGREN_RESPACK) sol_MorphologyAnalysisA(
 //    -   ,   
 // ,      .
 // ****************************************************************************
+static Solarix::Res_Pack* RunSyntaxAnalysis(
+                                           HGREN hEngine,
+                                           const wchar_t *Sentence,
+                                           int MorphologicalFlags,
+                                           int SyntacticFlags,
+                                           int Constraints,
+                                           int LanguageID
+                                          )
+{
+ const bool Allow_Fuzzy = (MorphologicalFlags & SOL_GREN_ALLOW_FUZZY) == SOL_GREN_ALLOW_FUZZY;
+ const bool CompleteAnalysisOnly = (MorphologicalFlags & SOL_GREN_COMPLETE_ONLY) == SOL_GREN_COMPLETE_ONLY;
+ const bool Pretokenized = (MorphologicalFlags & SOL_GREN_PRETOKENIZED) == SOL_GREN_PRETOKENIZED;
+ const int UseLanguageID = LanguageID==-1 ? HandleEngine(hEngine)->DefaultLanguage : LanguageID;
+ const bool ApplyModel = (MorphologicalFlags & SOL_GREN_MODEL) == SOL_GREN_MODEL;
+
+ const bool ReorderTree = (SyntacticFlags&SOL_GREN_REORDER_TREE)==SOL_GREN_REORDER_TREE;
+ const bool FindFacts = (SyntacticFlags&SOL_GREN_FINDFACTS)==SOL_GREN_FINDFACTS;
+ const bool Schedule1 = (SyntacticFlags & ~SOL_GREN_REORDER_TREE)==0;
+
+ WrittenTextAnalysisSession current_analysis( HandleEngine(hEngine)->dict.get(), NULL );
+ current_analysis.params.SetLanguageID(UseLanguageID);
+
+ current_analysis.params.Pretokenized = Pretokenized;
+ current_analysis.params.AllowPrimaryFuzzyWordRecog = Allow_Fuzzy;
+ current_analysis.params.ApplyModel = ApplyModel;
+
+ //       
+ const int MaxMillisecTimeout = 0x002fffff & Constraints;
+ //lem::mout->printf( "Constraints=%d MaxMillisecTimeout=%d\n", Constraints, MaxMillisecTimeout );
+ current_analysis.params.timeout.max_elapsed_millisecs = MaxMillisecTimeout>0 ? MaxMillisecTimeout : lem::int_max;
+
+ //   .        .
+ //     10 
+ const int MaxAlt = ((0xffC00000 & Constraints)>>22) & 0x000002ff;
+ current_analysis.params.timeout.max_alt = MaxAlt;
+ current_analysis.params.timeout.max_bottomup_trees = MaxAlt;
+
+ if( /*(SyntacticFlags & SOL_GREN_SKIPTOKENS)==SOL_GREN_SKIPTOKENS &&*/ !CompleteAnalysisOnly )
+  {
+   current_analysis.params.CompleteAnalysisOnly = false;
+   current_analysis.params.ConfigureSkipToken();
+  }
+
+ if( Schedule1 )
+  {
+   current_analysis.params.UseTopDownThenSparse = true;
+   current_analysis.params.CompleteAnalysisOnly = true;
+  }
+ else
+  {
+   current_analysis.params.CompleteAnalysisOnly = CompleteAnalysisOnly;
+  }
+
+ if( (MorphologicalFlags&SOL_GREN_DISABLE_FILTERS)==SOL_GREN_DISABLE_FILTERS )
+  {
+   current_analysis.params.max_filter_len=0; //   
+   current_analysis.params.ApplyCollocFilters=false;
+  }
+
+ current_analysis.params.ReorderTree = ReorderTree;
+ current_analysis.FindFacts = FindFacts;
+
+ current_analysis.SyntacticAnalysis(Sentence);
+ 
+ return current_analysis.PickPack();
+}
+
+
 FAIND_API(HGREN_RESPACK) sol_SyntaxAnalysis(
                                             HGREN hEngine,
                                             const wchar_t *Sentence,
@@ -2751,62 +2829,7 @@ FAIND_API(HGREN_RESPACK) sol_SyntaxAnalysis(
 
  try
   {
-   const bool Allow_Fuzzy = (MorphologicalFlags & SOL_GREN_ALLOW_FUZZY) == SOL_GREN_ALLOW_FUZZY;
-   const bool CompleteAnalysisOnly = (MorphologicalFlags & SOL_GREN_COMPLETE_ONLY) == SOL_GREN_COMPLETE_ONLY;
-   const bool Pretokenized = (MorphologicalFlags & SOL_GREN_PRETOKENIZED) == SOL_GREN_PRETOKENIZED;
-   const int UseLanguageID = LanguageID==-1 ? HandleEngine(hEngine)->DefaultLanguage : LanguageID;
-   const bool ApplyModel = (MorphologicalFlags & SOL_GREN_MODEL) == SOL_GREN_MODEL;
-
-   const bool ReorderTree = (SyntacticFlags&SOL_GREN_REORDER_TREE)==SOL_GREN_REORDER_TREE;
-   const bool FindFacts = (SyntacticFlags&SOL_GREN_FINDFACTS)==SOL_GREN_FINDFACTS;
-   const bool Schedule1 = (SyntacticFlags & ~SOL_GREN_REORDER_TREE)==0;
-
-   WrittenTextAnalysisSession current_analysis( HandleEngine(hEngine)->dict.get(), NULL );
-   current_analysis.params.SetLanguageID(UseLanguageID);
-
-   current_analysis.params.Pretokenized = Pretokenized;
-   current_analysis.params.AllowPrimaryFuzzyWordRecog = Allow_Fuzzy;
-   current_analysis.params.ApplyModel = ApplyModel;
-
-   //       
-   const int MaxMillisecTimeout = 0x002fffff & Constraints;
-   //lem::mout->printf( "Constraints=%d MaxMillisecTimeout=%d\n", Constraints, MaxMillisecTimeout );
-   current_analysis.params.timeout.max_elapsed_millisecs = MaxMillisecTimeout>0 ? MaxMillisecTimeout : lem::int_max;
-
-   //   .        .
-   //     10 
-   const int MaxAlt = ((0xffC00000 & Constraints)>>22) & 0x000002ff;
-   current_analysis.params.timeout.max_alt = MaxAlt;
-   current_analysis.params.timeout.max_bottomup_trees = MaxAlt;
-
-   if( /*(SyntacticFlags & SOL_GREN_SKIPTOKENS)==SOL_GREN_SKIPTOKENS &&*/ !CompleteAnalysisOnly )
-    {
-     current_analysis.params.CompleteAnalysisOnly = false;
-     current_analysis.params.ConfigureSkipToken();
-    }
-
-   if( Schedule1 )
-    {
-     current_analysis.params.UseTopDownThenSparse = true;
-     current_analysis.params.CompleteAnalysisOnly = true;
-    }
-   else
-    {
-     current_analysis.params.CompleteAnalysisOnly = CompleteAnalysisOnly;
-    }
-
-   if( (MorphologicalFlags&SOL_GREN_DISABLE_FILTERS)==SOL_GREN_DISABLE_FILTERS )
-    {
-     current_analysis.params.max_filter_len=0; //   
-     current_analysis.params.ApplyCollocFilters=false;
-    }
-
-   current_analysis.params.ReorderTree = ReorderTree;
-   current_analysis.FindFacts = FindFacts;
-
-   current_analysis.SyntacticAnalysis(Sentence);
-   
-   return current_analysis.PickPack();
+   return RunSyntaxAnalysis( hEngine, Sentence, MorphologicalFlags, SyntacticFlags, Constraints, LanguageID );
   }
  CATCH_API(hEngine)
  {
@@ -2857,6 +2880,365 @@ FAIND_API(HGREN_RESPACK) sol_SyntaxAnalysisA(
 }
 
 
+// ****************************************************************************
+//   .    ,
+//     ;  
+//    WrittenTextAnalysisSession.   i-
+//    i-   ,   
+// .
+//
+//     ,    : 
+//     ,    
+//  ,        .
+//    sol_DeleteGrammarEngine.
+// ****************************************************************************
+
+static void AnalyzeBatchItem(
+                             HGREN hEngine,
+                             const wchar_t *Sentence,
+                             int MorphologicalFlags,
+                             int SyntacticFlags,
+                             int Constraints,
+                             int LanguageID,
+                             HGREN_RESPACK *Result
+                            )
+{
+ *Result = NULL;
+
+ try
+  {
+   *Result = RunSyntaxAnalysis( hEngine, Sentence, MorphologicalFlags, SyntacticFlags, Constraints, LanguageID );
+  }
+ CATCH_API(hEngine)
+
+ return;
+}
+
+
+#if defined LEM_THREADS && !defined SOLARIX_DEMO
+namespace Solarix
+{
+ class SyntaxAnalysisPool : lem::NonCopyable
+ {
+  private:
+   boost::mutex run_cs; //       
+   boost::mutex cs;
+   boost::condition job_ready; //   :     
+   boost::condition job_done;  //   :    
+   boost::thread_group threads;
+   int n_thread;
+   bool stop;
+
+   //  
+   HGREN hEngine;
+   const wchar_t * const * sentences;
+   int n;
+   int next;   //    
+   int n_done; //    
+   int n_active; //      n_active   
+   int MorphologicalFlags, SyntacticFlags, Constraints, LanguageID;
+   HGREN_RESPACK *results;
+
+   //    .    cs,
+   //     .
+   void AnalyzeNext( boost::mutex::scoped_lock &lock )
+   {
+    const int i = next++;
+    lock.unlock();
+
+    HGREN_RESPACK pack = NULL;
+    AnalyzeBatchItem( hEngine, sentences[i], MorphologicalFlags, SyntacticFlags, Constraints, LanguageID, &pack );
+
+    lock.lock();
+    results[i] = pack;
+    if( ++n_done==n )
+     job_done.notify_all();
+
+    return;
+   }
+
+   void Worker( int index )
+   {
+    boost::mutex::scoped_lock lock(cs);
+
+    while(true)
+     {
+      while( !stop && (index>=n_active || next>=n) )
+       job_ready.wait(lock);
+
+      if( stop )
+       break;
+
+      AnalyzeNext(lock);
+     }
+
+    return;
+   }
+
+  public:
+   SyntaxAnalysisPool(void) : n_thread(0), stop(false), hEngine(NULL), sentences(NULL), n(0), next(0), n_done(0),
+    n_active(0), MorphologicalFlags(0), SyntacticFlags(0), Constraints(0), LanguageID(-1), results(NULL) {}
+
+   ~SyntaxAnalysisPool(void)
+   {
+    {
+     boost::mutex::scoped_lock lock(cs);
+     stop = true;
+     job_ready.notify_all();
+    }
+
+    threads.join_all();
+    return;
+   }
+
+   int CountThreads(void) const { return n_thread; }
+
+   //    ThreadCount :    ThreadCount-1
+   //   .
+   void Run(
+            HGREN _hEngine,
+            const wchar_t * const * _sentences,
+            int _n,
+            int _MorphologicalFlags,
+            int _SyntacticFlags,
+            int _Constraints,
+            int _LanguageID,
+            int ThreadCount,
+            HGREN_RESPACK *_results
+           )
+   {
+    boost::mutex::scoped_lock run_guard(run_cs);
+
+    boost::mutex::scoped_lock lock(cs);
+
+    while( n_thread<ThreadCount-1 )
+     {
+      threads.create_thread( boost::bind( &SyntaxAnalysisPool::Worker, this, n_thread ) );
+      n_thread++;
+     }
+
+    hEngine = _hEngine;
+    sentences = _sentences;
+    n = _n;
+    MorphologicalFlags = _MorphologicalFlags;
+    SyntacticFlags = _SyntacticFlags;
+    Constraints = _Constraints;
+    LanguageID = _LanguageID;
+    results = _results;
+    next = 0;
+    n_done = 0;
+    n_active = ThreadCount-1;
+    job_ready.notify_all();
+
+    while( next<n )
+     AnalyzeNext(lock);
+
+    while( n_done<n )
+     job_done.wait(lock);
+
+    n_active = 0;
+    n = 0;
+    sentences = NULL;
+    results = NULL;
+
+    return;
+   }
+ };
+}
+
+
+static Solarix::SyntaxAnalysisPool* GetSyntaxAnalysisPool( HGREN hEngine )
+{
+ Solarix::Faind_Engine *engine = HandleEngine(hEngine);
+
+ lem::Process::CritSecLocker guard( &engine->cs );
+ if( engine->batch_pool==NULL )
+  engine->batch_pool = new Solarix::SyntaxAnalysisPool();
+
+ return engine->batch_pool;
+}
+#endif
+
+
+static void DeleteSyntaxAnalysisPool( Solarix::Faind_Engine *engine )
+{
+ #if defined LEM_THREADS && !defined SOLARIX_DEMO
+ delete engine->batch_pool;
+ engine->batch_pool = NULL;
+ #endif
+ return;
+}
+
+
+FAIND_API(int) sol_SyntaxAnalysisBatch(
+                                       HGREN hEngine,
+                                       const wchar_t **Sentences,
+                                       int nSentence,
+                                       int MorphologicalFlags,
+                                       int SyntacticFlags,
+                                       int Constraints,
+                                       int LanguageID,
+                                       int ThreadCount,
+                                       HGREN_RESPACK *Results
+                                      )
+{
+ if( !hEngine || !HandleEngine(hEngine)->dict || Sentences==NULL || nSentence<0 || Results==NULL )
+  return -1;
+
+ //  -       .
+ DEMO_SINGLE_THREAD(hEngine)
+
+ try
+  {
+   for( int i=0; i<nSentence; ++i )
+    if( Sentences[i]==NULL )
+     return -1;
+
+   for( int i=0; i<nSentence; ++i )
+    Results[i] = NULL;
+
+   #if defined LEM_THREADS && !defined SOLARIX_DEMO
+   if( ThreadCount<=0 )
+    ThreadCount = CastSizeToInt(boost::thread::hardware_concurrency());
+
+   ThreadCount = std::min( ThreadCount, nSentence );
+
+   if( ThreadCount>1 )
+    {
+     GetSyntaxAnalysisPool(hEngine)->Run(
+                                         hEngine,
+                                         Sentences,
+                                         nSentence,
+                                         MorphologicalFlags,
+                                         SyntacticFlags,
+                                         Constraints,
+                                         LanguageID,
+                                         ThreadCount,
+                                         Results
+                                        );
+    }
+   else
+   #endif
+    {
+     for( int i=0; i<nSentence; ++i )
+      AnalyzeBatchItem( hEngine, Sentences[i], MorphologicalFlags, SyntacticFlags, Constraints, LanguageID, Results+i );
+    }
+
+   int nok=0;
+   for( int i=0; i<nSentence; ++i )
+    if( Results[i]!=NULL )
+     nok++;
+
+   return nok;
+  }
+ CATCH_API(hEngine)
+
+ return -1;
+}
+
+
+FAIND_API(int) sol_SyntaxAnalysisBatch8(
+                                        HGREN hEngine,
+                                        const char **SentencesUtf8,
+                                        int nSentence,
+                                        int MorphologicalFlags,
+                                        int SyntacticFlags,
+                                        int Constraints,
+                                        int LanguageID,
+                                        int ThreadCount,
+                                        HGREN_RESPACK *Results
+                                       )
+{
+ if( !hEngine || SentencesUtf8==NULL || nSentence<0 )
+  return -1;
+
+ try
+  {
+   lem::PtrCollect<lem::UFString> sentences;
+   sentences.reserve(nSentence);
+   lem::MCollect<const wchar_t*> ptrs;
+   ptrs.reserve(nSentence);
+
+   for( int i=0; i<nSentence; ++i )
+    {
+     if( SentencesUtf8[i]==NULL )
+      return -1;
+
+     sentences.push_back( new lem::UFString( lem::from_utf8(SentencesUtf8[i]) ) );
+     ptrs.push_back( sentences.back()->c_str() );
+    }
+
+   return sol_SyntaxAnalysisBatch(
+                                  hEngine,
+                                  nSentence==0 ? NULL : (const wchar_t**)&ptrs.front(),
+                                  nSentence,
+                                  MorphologicalFlags,
+                                  SyntacticFlags,
+                                  Constraints,
+                                  LanguageID,
+                                  ThreadCount,
+                                  Results
+                                 );
+  }
+ CATCH_API(hEngine)
+
+ return -1;
+}
+
+
+FAIND_API(int) sol_SyntaxAnalysisBrokerBatch(
+                                             HGREN hEngine,
+                                             HGREN_SBROKER hBroker,
+                                             int MaxSentences,
+                                             int MorphologicalFlags,
+                                             int SyntacticFlags,
+                                             int Constraints,
+                                             int LanguageID,
+                                             int ThreadCount,
+                                             HGREN_RESPACK *Results
+                                            )
+{
+ if( !hEngine || !HandleEngine(hEngine)->dict || hBroker==NULL || MaxSentences<=0 || Results==NULL )
+  return -1;
+
+ try
+  {
+   //      ,   .
+   SentenceBroker *broker = (SentenceBroker*)hBroker;
+   lem::PtrCollect<lem::UFString> sentences;
+   lem::MCollect<const wchar_t*> ptrs;
+
+   while( CastSizeToInt(sentences.size())<MaxSentences && broker->Fetch() )
+    {
+     sentences.push_back( new lem::UFString( broker->GetFetchedSentence() ) );
+     ptrs.push_back( sentences.back()->c_str() );
+    }
+
+   const int n = CastSizeToInt(sentences.size());
+   if( n==0 )
+    return 0;
+
+   if( sol_SyntaxAnalysisBatch(
+                               hEngine,
+                               (const wchar_t**)&ptrs.front(),
+                               n,
+                               MorphologicalFlags,
+                               SyntacticFlags,
+                               Constraints,
+                               LanguageID,
+                               ThreadCount,
+                               Results
+                              )==-1 )
+    return -1;
+
+   return n;
+  }
+ CATCH_API(hEngine)
+
+ return -1;
+}
+
+
 FAIND_API(void) sol_DeleteResPack( HGREN_RESPACK hPack )
 {
  try
@@ -5915,6 +6297,7 @@ FAIND_API(int) sol_DeleteLink( HGREN hEngine, int LinkID, int LinkType )
     }
 
    tx->Commit();
+   HandleEngine(hEngine)->dict->GetRecognitionCache().Invalidate();
 
    return 0;
   }
@@ -5965,6 +6348,7 @@ FAIND_API(int) sol_AddLink(
     }
 
    tx->Commit();
+   HandleEngine(hEngine)->dict->GetRecognitionCache().Invalidate();
 
    return id_link;
   }
@@ -6029,6 +6413,7 @@ FAIND_API(int) sol_SetLinkFlags(
     }
 
    tx->Commit();
+   HandleEngine(hEngine)->dict->GetRecognitionCache().Invalidate();
 
    return 0;
   }
@@ -6081,6 +6466,7 @@ FAIND_API(int) sol_SetLinkTags(
     }
 
    tx->Commit();
+   HandleEngine(hEngine)->dict->GetRecognitionCache().Invalidate();
 
    return 0;
   }
@@ -6238,6 +6624,7 @@ FAIND_API(int) sol_AddPhrase( HGREN hEngine, const wchar_t *Phrase, int Language
    int id = sg.GetStorage().AddPhrase(frz);
    
    tx->Commit();
+   HandleEngine(hEngine)->dict->GetRecognitionCache().Invalidate();
 
    return frz.GetId();
   }
@@ -6271,6 +6658,7 @@ FAIND_API(int) sol_DeletePhrase( HGREN hEngine, int PhraseId )
    sg.GetStorage().DeletePhrase(PhraseId);
 
    tx->Commit();
+   HandleEngine(hEngine)->dict->GetRecognitionCache().Invalidate();
 
    res=0;
   }
@@ -6324,6 +6712,7 @@ FAIND_API(int) sol_SetPhraseNote(
     }
 
    tx->Commit();
+   HandleEngine(hEngine)->dict->GetRecognitionCache().Invalidate();
 
    return tn_id;
   }
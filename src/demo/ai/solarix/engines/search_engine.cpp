@@ -88,6 +88,7 @@ Faind_Engine::Faind_Engine(void)
 
  sg = NULL;
  n_lexicon_reserve = 0;
+ batch_pool = NULL;
 
  if( lem::UI::get_UI().IsRussian() )
   DefaultLanguage = RUSSIAN_LANGUAGE;
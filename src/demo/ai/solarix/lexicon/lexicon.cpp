@@ -17,15 +17,19 @@
 // 23.02.2009 -     N-    - 
 //               .
 // 09.03.2013 -     .
+// 16.10.2026 -  -snapshot    .
+// 16.10.2026 -  -succinct   N-   .
 // -----------------------------------------------------------------------------
 //
 // CD->25.02.2003
-// LC->09.03.2013
+// LC->16.10.2026
 // --------------
 
 #include <lem/keyboard.h>
 #include <lem/startup.h>
 #include <lem/solarix/version.h>
+#include <lem/solarix/load_options.h>
+#include <lem/solarix/ngrams.h>
 #include "lexicon.h"
 
 using namespace lem;
@@ -49,7 +53,8 @@ int main( int argc, char *argv[] )
 
  mout->printf( "%vf9Solarix %vfELexicon%vn // %s //\n\n", sol_get_version().c_str() );
 
- lem::Path dictionary_path;
+ lem::Path dictionary_path, snapshot_path, succinct_path;
+ int q_bits=16;
  lem::MCollect<int> imenu;
  bool show_menu=false;
 
@@ -73,11 +78,117 @@ int main( int argc, char *argv[] )
    {
     show_menu=true;
    }
+   else if( lem_eq(argv[i]+1,"snapshot") )
+    {
+     snapshot_path = lem::Path( argv[++i] );
+    }
+   else if( lem_eq(argv[i]+1,"succinct") )
+    {
+     succinct_path = lem::Path( argv[++i] );
+    }
+   else if( lem_eq(argv[i]+1,"qbits") )
+    {
+     q_bits = lem::to_int( argv[++i] );
+     if( q_bits<1 || q_bits>24 )
+      {
+       mout->printf( "%vfE-qbits%vn must be in range 1..24\n" );
+       exit(1);
+      }
+    }
    else
     {
      mout->printf( "Unknown option [%vfC%s%vn]\n", argv[i] );
      exit(1);
     }
+  }
+
+ if( !snapshot_path.empty() )
+  {
+   //  :       
+   //    , .  <snapshot>  dictionary.xml.
+   if( dictionary_path.empty() )
+    {
+     mout->printf( "Use %vfE-dictdir%vn to specify dictionary.xml for %vfE-snapshot%vn\n" );
+     exit(1);
+    }
+
+   Load_Options opt;
+   opt.affix_table=true;
+   opt.seeker=true;
+   opt.lexicon=true;
+   opt.ngrams=false;
+   opt.snapshot=false;
+
+   try
+    {
+     Dictionary dict;
+     if( !dict.LoadModules( dictionary_path, opt ) )
+      {
+       mout->printf( "%vfCCan not load dictionary%vn\n" );
+       exit(1);
+      }
+
+     const lem::uint64_t size = dict.SaveSnapshot( snapshot_path );
+     mout->printf( "Snapshot %vfE%us%vn has been written, %qd bytes\n", snapshot_path.GetUnicode().c_str(), size );
+     mout->printf( "Add <snapshot>%us</snapshot> to dictionary.xml to use it\n", snapshot_path.GetFileName().c_str() );
+    }
+   catch( const E_BaseException &e )
+    {
+     merr->printf( "%vfDError:%vn %us\n", e.what() );
+     exit(1);
+    }
+
+   lem::Leave();
+   return 0;
+  }
+
+ if( !succinct_path.empty() )
+  {
+   //  :  N-   
+   //   .ef   succinct_path.   ,
+   //     N- .
+   if( dictionary_path.empty() )
+    {
+     mout->printf( "Use %vfE-dictdir%vn to specify dictionary.xml for %vfE-succinct%vn\n" );
+     exit(1);
+    }
+
+   Load_Options opt;
+   opt.affix_table=false;
+   opt.seeker=false;
+   opt.lexicon=false;
+   opt.ngrams=true;
+   opt.snapshot=false;
+
+   try
+    {
+     Dictionary dict;
+     if( !dict.LoadModules( dictionary_path, opt ) )
+      {
+       mout->printf( "%vfCCan not load dictionary%vn\n" );
+       exit(1);
+      }
+
+     if( dict.GetNgrams().IsNull() )
+      {
+       mout->printf( "%vfCThe dictionary has no N-grams%vn\n" );
+       exit(1);
+      }
+
+     if( !succinct_path.DoesExist() )
+      succinct_path.CreateFolder(true);
+
+     const lem::int64_t n = dict.GetNgrams()->BuildSuccinctStores( succinct_path, q_bits, true );
+     mout->printf( "%vfE%qd%vn N-grams have been written to %vfE%us%vn\n", n, succinct_path.GetUnicode().c_str() );
+    }
+   catch( const E_BaseException &e )
+    {
+     merr->printf( "%vfDError:%vn %us\n", e.what() );
+     exit(1);
+    }
+
+   lem::Leave();
+   return 0;
   }
 
  //        .
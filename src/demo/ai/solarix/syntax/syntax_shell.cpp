@@ -68,6 +68,7 @@
 #include <lem/solarix/LemmatizatorStorage.h>
 #include <lem/solarix/ElapsedTimeConstraint.h>
 #include <lem/solarix/MorphologyModels.h>
+#include <lem/solarix/WordRecognitionCache.h>
 #include <map>
 
 #include "syntax.h"
@@ -386,7 +387,19 @@ void SyntaxShell::main_loop(void)
      const int msec_elapsed = total_et.msec();
 
      if( traceon )
-      lem::mout->printf( "Elapsed time: %d millisec\n", msec_elapsed );
+      {
+       lem::mout->printf( "Elapsed time: %d millisec\n", msec_elapsed );
+
+       if( current_analysis.NotNull() )
+        {
+         const lem::MemArena & arena = current_analysis->GetArena();
+         lem::mout->printf( "Arena: %d allocations (%d reused, %d released), %d bytes, %d system blocks\n", arena.CountAllocations(), arena.CountReusedAllocations(), arena.CountReleased(), int(arena.CountBytes()), arena.CountSystemAllocations() );
+         lem::mout->printf( "Pattern points: %d checked, %d skipped by dispatch index\n", current_analysis->CountCheckedPatternPoints(), current_analysis->CountSkippedPatternPoints() );
+        }
+
+       WordRecognitionCache & cache = sol_id->GetRecognitionCache();
+       lem::mout->printf( "Recognition cache: %d words, %d hits, %d misses\n", cache.Count(), cache.CountHits(), cache.CountMisses() );
+      }
     }
   }
 
@@ -876,6 +876,7 @@ void Save_Results( Compiler *C )
        lem::Path tmp_pes( lem::Path::GetTmpFilename("tmp") );
        C->SavePrefixEntrySearcher(tmp_pes);
        lem::Path::CopyFile( tmp_pes, pes_path );
+       lem::Path::CopyFile( lem::Path(tmp_pes.GetUnicode()+L".postings"), lem::Path(pes_path.GetUnicode()+L".postings") );
        
 
        if( !silence )
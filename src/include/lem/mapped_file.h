@@ -0,0 +1,63 @@
+#ifndef LEM_MAPPED_FILE__H
+#define LEM_MAPPED_FILE__H
+#pragma once
+
+// CD->16.10.2026
+// LC->16.10.2026
+
+ #include <lem/config.h>
+
+ #if defined LEM_WINDOWS
+  #if defined LEM_MFC
+   #include <afxwin.h>
+  #else
+   #include <windows.h>
+  #endif
+ #endif
+
+ #include <lem/integer.h>
+ #include <lem/noncopyable.h>
+ #include <lem/path.h>
+
+ namespace lem
+ {
+  // ***************************************************************************
+  // Read-only memory mapped file. Unlike FastFileReader it has no read cursor:
+  // the mapped image is immutable, so any number of threads can access it
+  // simultaneously without locks, and the pages are shared between processes
+  // through the OS page cache.
+  // ***************************************************************************
+  class MappedFile : lem::NonCopyable
+  {
+   private:
+    #if defined LEM_WINDOWS
+    HANDLE hFile;
+    HANDLE hFileMap;
+    #else
+    int fd;
+    #endif
+
+    const lem::uint8_t *base; //   
+    lem::uint64_t size; //    
+
+   public:
+    MappedFile(void);
+    MappedFile( const lem::Path &filename );
+    ~MappedFile(void);
+
+    // Returns false if the file can not be mapped (missing, empty, no mmap support)
+    bool Open( const lem::Path &filename );
+    void Close(void);
+
+    bool IsOpen(void) const { return base!=NULL; }
+
+    const lem::uint8_t* Data(void) const { return base; }
+    lem::uint64_t Size(void) const { return size; }
+
+    template < class T >
+    const T* At( lem::uint64_t offset ) const
+    { return reinterpret_cast<const T*>(base+offset); }
+  };
+ }
+
+#endif
@@ -0,0 +1,350 @@
+#ifndef LEM_MEM_ARENA__H
+#define LEM_MEM_ARENA__H
+#pragma once
+
+// CD->16.10.2026
+// LC->16.10.2026
+
+ #include <stdlib.h>
+ #include <new>
+ #include <vector>
+ #include <lem/noncopyable.h>
+ #include <lem/runtime_checks.h>
+
+ namespace lem
+ {
+  // ***************************************************************************
+  //       . 
+  //        Reset(),   
+  //    .    
+  //  New (   Own),    
+  // Reset(). ,    ,    
+  // Delete:   ,      
+  //        .  
+  //     ,     .
+  //    -    .
+  // ***************************************************************************
+  class MemArena : lem::NonCopyable
+  {
+   private:
+    enum { ALIGN=16, CHUNK_SIZE=65536, N_FREE_LIST=64 };
+
+    struct Chunk
+    {
+     char *ptr;
+     size_t size;
+    };
+
+    struct Destructor
+    {
+     void *obj;
+     void (*fun)( void *obj );
+    };
+
+    //   ,   New:   .
+    struct ObjHeader
+    {
+     size_t i_destructor;
+    };
+
+    struct FreeBlock
+    {
+     FreeBlock *next;
+    };
+
+    std::vector<Chunk> chunks;
+    std::vector<Destructor> destructors;
+    std::vector<size_t> free_destructors; //    destructors
+    FreeBlock* free_list[N_FREE_LIST]; //    (/ALIGN-1)
+    int cur_chunk;  //  , -1    
+    size_t cur_pos; //      
+
+    int n_alloc;        //      Reset()
+    int n_reused;       //       
+    int n_released;     //  ,   Free/Delete
+    size_t n_bytes;     //         Reset()
+    int n_sys_alloc;    //      
+
+    template < class T >
+    static void Destroy( void *obj ) { static_cast<T*>(obj)->~T(); }
+
+    static size_t Round( size_t size ) { return (size+ALIGN-1) & ~size_t(ALIGN-1); }
+
+    void NextChunk( size_t size )
+    {
+     //      .
+     while( cur_chunk+1 < int(chunks.size()) )
+      {
+       ++cur_chunk;
+       cur_pos = 0;
+       if( chunks[cur_chunk].size>=size )
+        return;
+      }
+
+     Chunk c;
+     c.size = size>CHUNK_SIZE ? size : CHUNK_SIZE;
+     c.ptr = (char*)malloc(c.size);
+     if( c.ptr==NULL )
+      throw std::bad_alloc();
+
+     n_sys_alloc++;
+     chunks.push_back(c);
+     cur_chunk = int(chunks.size())-1;
+     cur_pos = 0;
+     return;
+    }
+
+    size_t AddDestructor( void *obj, void (*fun)( void *obj ) )
+    {
+     Destructor d;
+     d.obj = obj;
+     d.fun = fun;
+
+     if( !free_destructors.empty() )
+      {
+       const size_t i = free_destructors.back();
+       free_destructors.pop_back();
+       destructors[i] = d;
+       return i;
+      }
+
+     destructors.push_back(d);
+     return destructors.size()-1;
+    }
+
+    template < class T >
+    ObjHeader* AllocateObj(void)
+    {
+     return (ObjHeader*)Allocate( Round(sizeof(ObjHeader)) + sizeof(T) );
+    }
+
+    template < class T >
+    T* Register( ObjHeader *h, T *obj )
+    {
+     h->i_destructor = AddDestructor( obj, &MemArena::Destroy<T> );
+     return obj;
+    }
+
+    template < class T >
+    static T* ObjPtr( ObjHeader *h ) { return (T*)( (char*)h + Round(sizeof(ObjHeader)) ); }
+
+   public:
+    MemArena(void) : cur_chunk(-1), cur_pos(0), n_alloc(0), n_reused(0), n_released(0), n_bytes(0), n_sys_alloc(0)
+    {
+     for( int i=0; i<N_FREE_LIST; ++i )
+      free_list[i] = NULL;
+    }
+
+    ~MemArena(void)
+    {
+     Reset();
+
+     for( size_t i=0; i<chunks.size(); ++i )
+      free( chunks[i].ptr );
+
+     return;
+    }
+
+    void* Allocate( size_t size )
+    {
+     size = Round(size);
+     n_alloc++;
+
+     const size_t k = size/ALIGN-1;
+     if( k<N_FREE_LIST && free_list[k]!=NULL )
+      {
+       FreeBlock *b = free_list[k];
+       free_list[k] = b->next;
+       n_reused++;
+       return b;
+      }
+
+     if( cur_chunk==-1 || cur_pos+size>chunks[cur_chunk].size )
+      NextChunk(size);
+
+     void *p = chunks[cur_chunk].ptr + cur_pos;
+     cur_pos += size;
+     n_bytes += size;
+     return p;
+    }
+
+    //  ,   Allocate(size),  
+    // .   N_FREE_LIST*ALIGN    Reset().
+    void Free( void *p, size_t size )
+    {
+     if( p==NULL )
+      return;
+
+     n_released++;
+
+     const size_t k = Round(size)/ALIGN-1;
+     if( k<N_FREE_LIST )
+      {
+       FreeBlock *b = (FreeBlock*)p;
+       b->next = free_list[k];
+       free_list[k] = b;
+      }
+
+     return;
+    }
+
+    //    ,   new
+    //   .     Reset().
+    template < class T >
+    T* Own( T *obj )
+    {
+     AddDestructor( obj, &MemArena::Destroy<T> );
+     return obj;
+    }
+
+    template < class T >
+    T* New(void)
+    {
+     ObjHeader *h = AllocateObj<T>();
+     return Register( h, new( ObjPtr<T>(h) ) T() );
+    }
+
+    template < class T, class A >
+    T* New( const A & a )
+    {
+     ObjHeader *h = AllocateObj<T>();
+     return Register( h, new( ObjPtr<T>(h) ) T(a) );
+    }
+
+    //   ,   New. , 
+    //   Reset() (,  ,  
+    //   ),   .
+    template < class T >
+    void Delete( T *obj )
+    {
+     if( obj==NULL )
+      return;
+
+     ObjHeader *h = (ObjHeader*)( (char*)obj - Round(sizeof(ObjHeader)) );
+
+     //        : 
+     //     New  ,     .
+     LEM_CHECKIT_Z( h->i_destructor<destructors.size() );
+     Destructor &d = destructors[h->i_destructor];
+     if( d.fun==NULL || d.obj!=obj )
+      return;
+
+     d.fun = NULL;
+     free_destructors.push_back( h->i_destructor );
+
+     obj->~T();
+     Free( h, Round(sizeof(ObjHeader)) + sizeof(T) );
+     return;
+    }
+
+    //    .     .
+    //      ,  Delete 
+    //        .
+    void Reset(void)
+    {
+     for( size_t i=destructors.size(); i>0; --i )
+      if( destructors[i-1].fun!=NULL )
+       {
+        const Destructor d = destructors[i-1];
+        destructors[i-1].fun = NULL;
+        d.fun( d.obj );
+       }
+
+     destructors.clear();
+     free_destructors.clear();
+     for( int i=0; i<N_FREE_LIST; ++i )
+      free_list[i] = NULL;
+
+     cur_chunk = chunks.empty() ? -1 : 0;
+     cur_pos = 0;
+     n_alloc = 0;
+     n_reused = 0;
+     n_released = 0;
+     n_bytes = 0;
+     return;
+    }
+
+    int CountAllocations(void) const { return n_alloc; }
+    int CountReusedAllocations(void) const { return n_reused; }
+    int CountReleased(void) const { return n_released; }
+    size_t CountBytes(void) const { return n_bytes; }
+    int CountSystemAllocations(void) const { return n_sys_alloc; }
+  };
+
+
+  // ***************************************************************************
+  //     (, , POD-) 
+  //  .      .  
+  //      operator new.
+  // ***************************************************************************
+  template < class T >
+  class MemArenaVector : lem::NonCopyable
+  {
+   private:
+    MemArena *arena;
+    T *items;
+    int n, capacity;
+
+    T* AllocItems( int count )
+    {
+     if( arena!=NULL )
+      return (T*)arena->Allocate( sizeof(T)*count );
+
+     return (T*)::operator new( sizeof(T)*count );
+    }
+
+    void FreeItems( T *p, int count )
+    {
+     if( p==NULL )
+      return;
+
+     if( arena!=NULL )
+      arena->Free( p, sizeof(T)*count );
+     else
+      ::operator delete(p);
+
+     return;
+    }
+
+    void Grow(void)
+    {
+     const int new_capacity = capacity==0 ? 8 : capacity*2;
+     T *p = AllocItems(new_capacity);
+     if( p==NULL )
+      throw std::bad_alloc();
+
+     for( int i=0; i<n; ++i )
+      new( p+i ) T( items[i] );
+
+     FreeItems( items, capacity );
+     items = p;
+     capacity = new_capacity;
+     return;
+    }
+
+   public:
+    typedef int size_type;
+
+    MemArenaVector( MemArena *_arena ) : arena(_arena), items(NULL), n(0), capacity(0) {}
+    ~MemArenaVector(void) { FreeItems( items, capacity ); }
+
+    void push_back( const T &x )
+    {
+     if( n==capacity )
+      Grow();
+
+     new( items+n ) T(x);
+     n++;
+     return;
+    }
+
+    void clear(void) { n=0; }
+    int size(void) const { return n; }
+    bool empty(void) const { return n==0; }
+
+    T& operator[]( int i ) { return items[i]; }
+    const T& operator[]( int i ) const { return items[i]; }
+  };
+ }
+
+#endif
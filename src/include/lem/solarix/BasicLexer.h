@@ -3,6 +3,7 @@
 
 #include <lem/containers.h>
 #include <lem/ptr_container.h>
+#include <lem/mem_arena.h>
 #include <lem/solarix/TextRecognitionParameters.h>
 
 namespace Solarix {
@@ -32,6 +33,10 @@ class BasicLexer
   TrTrace * trace;
   TextRecognitionParameters params; //  
 
+  //         .
+  //  ,     positions   new(arena).
+  lem::MemArena * arena;
+
   int path_count; //      -     
   void AddBranching( int new_branching );
   bool IsTooManyTokens( int new_branching ) const;
@@ -48,11 +53,6 @@ class BasicLexer
   typedef std::map<const LexerTextPos*,LexerTextPos*> CACHED_ENDS;
   CACHED_ENDS end_tokens;
 
-  //     ,    .
-  //    .
-  bool use_recognition_cache; //    
-  std::map< lem::UCString, const Word_Form* > recognitions;
-
   Word_Form *wf_end; //      .
 
   void SortTokensByScoreDesc( lem::MCollect<const LexerTextPos*> & tokens ) const;
@@ -61,7 +61,7 @@ class BasicLexer
   const LexerTextPos * GetBeyondRigthToken( const LexerTextPos * previous );
 
  public:
-  BasicLexer( Solarix::Dictionary * _dict, const TextRecognitionParameters & _params, TrTrace * _trace );
+  BasicLexer( Solarix::Dictionary * _dict, const TextRecognitionParameters & _params, TrTrace * _trace, lem::MemArena * _arena=NULL );
 
   virtual ~BasicLexer();
 
@@ -90,6 +90,8 @@ class BasicLexer
 
   TrTrace* GetTrace() { return trace; }
 
+  lem::MemArena* GetArena() const { return arena; }
+
   void FilterRecognitions( const LexerTextPos * token, const std::set<int> & selected_recognitions, bool remove_incorrect_alts );
   void ReplaceTokenWordform( LexerTextPos * token, Word_Form * new_wordform );
 };
@@ -0,0 +1,80 @@
+#if !defined SOL_CHAR_TRIE__H
+ #define SOL_CHAR_TRIE__H
+
+// CD->16.10.2026
+// LC->16.10.2026
+
+ #include <vector>
+ #include <lem/integer.h>
+ #include <lem/noncopyable.h>
+ #include <lem/containers.h>
+ #include <lem/ucstring.h>
+
+ namespace Solarix
+ {
+  struct CharNode;
+  class SG_Entry;
+
+  // ***************************************************************************
+  //        (double-array trie),
+  //      CharNode.    -  
+  //    (  256,   LA_ScriptTable)  
+  //  base/check,    std::map.   
+  //  ,      ,  
+  //   ().      
+  //  :       .
+  // ***************************************************************************
+  class CharTrie : lem::NonCopyable
+  {
+   private:
+    enum { PAGE_BITS=8, PAGE_SIZE=256 };
+
+    std::vector<int> pages;  //    codes  -1
+    std::vector<int> codes;  //   , 0 -    
+
+    std::vector<int> base;
+    std::vector<int> check;  //    -1   
+    std::vector<const CharNode*> node; //    
+
+    int Code( wchar_t c ) const
+    {
+     const lem::uint32_t u = (lem::uint32_t)c;
+     const lem::uint32_t ipage = u>>PAGE_BITS;
+     if( ipage>=pages.size() || pages[ipage]==-1 )
+      return 0;
+
+     return codes[ pages[ipage]+(u & (PAGE_SIZE-1)) ];
+    }
+
+    void AddCode( wchar_t c, int code );
+
+   public:
+    CharTrie( const CharNode &root );
+
+    enum { Root=0 };
+
+    //     -1,     .
+    int Probe( int state, wchar_t c ) const
+    {
+     const int code = Code(c);
+     if( code==0 )
+      return -1;
+
+     const lem::uint32_t t = (lem::uint32_t)(base[state]+code);
+     return t<check.size() && check[t]==state ? CastSizeToInt(t) : -1;
+    }
+
+    //       .
+    bool IsFinal( int state ) const;
+    const lem::MCollect<const Solarix::SG_Entry*>& GetEntries( int state ) const;
+
+    //  CharNode::match  CharNode::match_len.
+    bool Match( const lem::UCString &str ) const;
+    int MatchLen( const wchar_t *str ) const;
+
+    int CountStates(void) const;
+    int CountCells(void) const { return CastSizeToInt(check.size()); }
+  };
+ }
+
+#endif
@@ -21,6 +21,30 @@
     virtual void Store( lem::uint32_t c, int pos, const std::set<int> &ies )=0;
     virtual void Get( lem::uint32_t c, int pos, std::set<int> &ies )=0;
     virtual void GetIntersected( lem::uint32_t c, int pos, const std::set<int> &ies0, std::set<int> &ies )=0;
+
+    //        . ,
+    //     std::set,   .
+    virtual void GetSorted( lem::uint32_t c, int pos, lem::MCollect<int> &ies )
+    {
+     std::set<int> s;
+     Get( c, pos, s );
+     ies.clear();
+     ies.reserve( s.size() );
+     for( std::set<int>::const_iterator it=s.begin(); it!=s.end(); ++it )
+      ies.push_back(*it);
+    }
+
+    virtual void IntersectSorted( lem::uint32_t c, int pos, const lem::MCollect<int> &ies0, lem::MCollect<int> &ies )
+    {
+     std::set<int> s0, s;
+     for( lem::Container::size_type i=0; i<ies0.size(); ++i )
+      s0.insert( s0.end(), ies0[i] );
+     GetIntersected( c, pos, s0, s );
+     ies.clear();
+     for( std::set<int>::const_iterator it=s.begin(); it!=s.end(); ++it )
+      ies.push_back(*it);
+    }
+
     virtual Charpos2EntryEnumerator* Enumerate(void)=0;
   };
  }
@@ -0,0 +1,86 @@
+#if !defined Charpos2EntryStorage_Postings__H
+ #define Charpos2EntryStorage_Postings__H
+
+// CD->16.10.2026
+// LC->16.10.2026
+
+ #include <map>
+ #include <vector>
+ #include <lem/path.h>
+ #include <lem/mapped_file.h>
+ #include <lem/solarix/Charpos2EntryStorage.h>
+
+ namespace Solarix
+ {
+  // ***************************************************************************
+  //   "+ -> "   
+  // .        BLOCK_SIZE:
+  //       ,  -  
+  //    varint-.    
+  //         
+  //    .     (  -
+  //  ),     ,   
+  //      .  -   
+  // CommitTx.
+  // ***************************************************************************
+  class Charpos2EntryStorage_Postings : public Charpos2EntryStorage
+  {
+   public:
+    enum { BLOCK_SIZE=128 };
+
+    struct ListInfo
+    {
+     lem::uint32_t charpos;
+     lem::uint32_t n_ies;
+     lem::uint32_t n_blocks;
+     lem::uint32_t offset; //      
+    };
+
+    struct SkipEntry
+    {
+     lem::int32_t first;   //   
+     lem::uint32_t offset; //       
+    };
+
+   private:
+    lem::Path filename;
+    lem::MappedFile mapped;
+    std::vector<lem::uint8_t> image; //  ,    
+
+    const lem::uint8_t *data;
+    lem::uint64_t data_size;
+    const ListInfo *lists;
+    int n_lists;
+
+    bool in_tx;
+    std::map< lem::uint32_t, std::vector<int> > pending; //     
+
+    void Open(void);
+    void Write(void);
+
+    const ListInfo* Find( lem::uint32_t charpos ) const;
+    void ThrowTruncated( const ListInfo &list ) const;
+    int DecodeBlock( const ListInfo &list, int iblock, int *ies ) const;
+    void Decode( const ListInfo &list, std::vector<int> &ies ) const;
+
+   public:
+    Charpos2EntryStorage_Postings( const lem::Path &_filename );
+    virtual ~Charpos2EntryStorage_Postings(void);
+
+    virtual void BeginTx(void);
+    virtual void CommitTx(void);
+    virtual void ClearCharpos( lem::uint32_t c, int pos );
+    virtual void Store( lem::uint32_t c, int pos, const std::set<int> &ies );
+    virtual void Get( lem::uint32_t c, int pos, std::set<int> &ies );
+    virtual void GetIntersected( lem::uint32_t c, int pos, const std::set<int> &ies0, std::set<int> &ies );
+    virtual void GetSorted( lem::uint32_t c, int pos, lem::MCollect<int> &ies );
+    virtual void IntersectSorted( lem::uint32_t c, int pos, const lem::MCollect<int> &ies0, lem::MCollect<int> &ies );
+    virtual Charpos2EntryEnumerator* Enumerate(void);
+
+    int CountLists(void) const { return n_lists; }
+    lem::uint64_t GetImageSize(void) const { return data_size; }
+    bool IsMapped(void) const { return mapped.IsOpen(); }
+  };
+ }
+
+#endif
@@ -13,6 +13,8 @@
     lem::UFString sqlite_connection_string;
     struct sqlite3* hdb;
 
+    void SelectSorted( lem::uint32_t charpos, lem::MCollect<int> &ies );
+
    public:
     Charpos2EntryStorage_SQLITE( const lem::UFString &connection_string );
     virtual ~Charpos2EntryStorage_SQLITE(void);
@@ -23,6 +25,8 @@
     virtual void Store( lem::uint32_t c, int pos, const std::set<int> &ies );
     virtual void Get( lem::uint32_t c, int pos, std::set<int> &ies );
     virtual void GetIntersected( lem::uint32_t c, int pos, const std::set<int> &ies0, std::set<int> &ies );
+    virtual void GetSorted( lem::uint32_t c, int pos, lem::MCollect<int> &ies );
+    virtual void IntersectSorted( lem::uint32_t c, int pos, const lem::MCollect<int> &ies0, lem::MCollect<int> &ies );
     virtual Charpos2EntryEnumerator* Enumerate(void);
   };
  }
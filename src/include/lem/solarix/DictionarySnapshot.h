@@ -0,0 +1,115 @@
+#if !defined(DICTIONARY_SNAPSHOT__H)
+ #define DICTIONARY_SNAPSHOT__H
+
+// CD->16.10.2026
+// LC->16.10.2026
+
+ #include <vector>
+ #include <lem/integer.h>
+ #include <lem/noncopyable.h>
+ #include <lem/path.h>
+ #include <lem/streams.h>
+ #include <lem/smart_pointers.h>
+ #include <lem/mapped_file.h>
+
+ namespace Solarix
+ {
+  // ***************************************************************************
+  //   -  ,       
+  //   (  ,  , ).
+  //    ,       
+  //  ,       .  
+  //     ,      
+  //     .
+  //
+  //   ( Lexemes)       -
+  //     .     
+  //    ,     
+  // LoadBin    .
+  //
+  //    :
+  //  -  -   ,     ;
+  //  - N-   -   SQLite  MySQL,   
+  //        ,       
+  //        ;
+  //  -  -     LEME_FASTER    
+  //       ,         ;
+  //  -  (CRFSuite) -        .
+  //
+  //         ,  
+  //  .     , 
+  //    .    ,   
+  //          .
+  // ***************************************************************************
+  class DictionarySnapshot : lem::NonCopyable
+  {
+   public:
+    enum { Morphology=1, Affixes=2, Seeker=3, Lexemes=4 };
+
+   private:
+    struct Section
+    {
+     lem::uint32_t id;
+     lem::uint32_t reserved;
+     lem::uint64_t offset, size;
+     lem::uint64_t source_size, source_mtime; //  ,    
+    };
+
+    lem::Path path;
+    lem::MappedFile mapped;
+    std::vector<Section> sections;
+
+    const Section* Find( int id ) const;
+
+   public:
+    DictionarySnapshot(void) {}
+
+    //  ,        ,
+    //   false.
+    bool Open( const lem::Path &filename );
+    void Close(void);
+    bool IsOpen(void) const { return mapped.IsOpen(); }
+
+    const lem::Path& GetPath(void) const { return path; }
+
+    //    ,   source     .
+    bool HasSection( int id, const lem::Path &source ) const;
+
+    lem::uint64_t GetSectionOffset( int id ) const;
+    lem::uint64_t GetSectionSize( int id ) const;
+    const void* GetSectionData( int id ) const;
+
+    //      ,  .
+    lem::Stream* OpenSection( int id ) const;
+
+
+    //  :      , 
+    //      .     
+    //      Finish    .
+    //  ,       ,
+    //    inode      
+    //  ;        SIGBUS.
+    class Writer : lem::NonCopyable
+    {
+     private:
+      lem::Path path, image_path, tmp_path;
+      lem::Ptr<lem::BinaryWriter> bin;
+      lem::Ptr<lem::BinaryWriter> section_bin;
+      std::vector<Section> sections;
+
+     public:
+      Writer( const lem::Path &filename );
+      ~Writer(void);
+
+      // source -  ,      
+      // .
+      lem::Stream& BeginSection( int id, const lem::Path &source );
+      void EndSection(void);
+
+      //   ,     .
+      lem::uint64_t Finish(void);
+    };
+  };
+ }
+
+#endif
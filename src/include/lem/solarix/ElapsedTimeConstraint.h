@@ -6,7 +6,6 @@
 #if defined LEM_WINDOWS
 #include <windows.h>
 #elif defined LEM_LINUX
-#include <signal.h>
 #include <time.h>
 #else
 #include <lem/process.h>
@@ -14,6 +13,10 @@
 
 namespace Solarix
 {
+ #if defined LEM_LINUX
+ class ElapsedTimeService;
+ #endif
+
  class ElapsedTimeConstraint : lem::NonCopyable
  {
   private:
@@ -21,13 +24,9 @@ namespace Solarix
    HANDLE hTimerQueue, hTimer;
    static VOID CALLBACK TimerCallback( PVOID lpParameter, BOOLEAN TimerOrWaitFired );
    #elif defined LEM_LINUX
-   bool timer_is_armed;
-   static volatile int time_seq;
-   timer_t timerid;
-   struct sigevent sev;
-   struct itimerspec its;
-   struct sigaction sa;
-   static void timer_routine( int sig, siginfo_t * si, void * uc );
+   friend class ElapsedTimeService;
+   bool timer_is_armed;
+   struct timespec deadline; //    CLOCK_MONOTONIC
    #else
    lem::Process::Thread * thread;
    static void ThreadFunction( void * data );
@@ -2,6 +2,7 @@
  #define SOL_KNOWLEDGE_BASE__H
 
  #include <map>
+ #include <string>
  #include <lem/RWULock.h>
  #include <lem/noncopyable.h>
  #include <lem/ptr_container.h>
@@ -184,6 +185,31 @@
     int id;
     lem::PtrCollect< KB_Fact > facts;
 
+    // ,         .
+    struct RegexBucket
+    {
+     const KB_Argument *arg;
+     lem::MCollect<int> ifacts;
+    };
+
+    //      .     
+    //  :   ,  ,    
+    //  rest,       (, ,
+    // ,  ...).     .
+    struct ArgIndex
+    {
+     std::map< int /*id_entry*/, lem::MCollect<int> > by_entry;
+     std::map< lem::UCString, lem::MCollect<int> > by_word;
+     std::map< std::wstring, int > regex_key;
+     lem::PtrCollect<RegexBucket> regex;
+     int n_regex_facts;
+     lem::MCollect<int> rest;
+
+     ArgIndex(void) : n_regex_facts(0) {}
+    };
+
+    lem::PtrCollect<ArgIndex> arg_index; // ,    BuildIndex
+
    public:
     KB_CachedFacts( int _id );
     
@@ -192,6 +218,10 @@
 
     void AddFact( KB_Fact * x );
 
+    //         ,
+    //  Match    .
+    void BuildIndex(void);
+
     KB_CheckingResult Match( Solarix::Dictionary *dict, const KB_Facts &facts, const lem::MCollect<const Solarix::Word_Form*> & args ) const;
   };
   #endif
@@ -1,9 +1,11 @@
 #if !defined LA_RECOGNITION_RULES__H
  #define LA_RECOGNITION_RULES__H
 
+ #include <map>
  #include <lem/ptr_container.h>
  #include <lem/solarix/WordCoord.h>
  #include <lem/solarix/LA_RecognitionRule.h>
+ #include <lem/solarix/LA_RegexSet.h>
  #include <lem/solarix/LA_ProjectInfo.h>
  #include <lem/solarix/ProjScore.h>
 
@@ -24,18 +26,41 @@
    lem::MCollect<const LA_RecognitionRule*> rx_rules; // ,     
                                                       //   
 
+   //    rx_rules,    :  
+   //    ,   - . 
+   //    -    rx_rules. ,  
+   //   ,   rx_fallback    .
+   LA_RegexSet rx_icase, rx_case;
+   lem::MCollect<int> rx_fallback;
+   bool use_rx_set; // false -     ,  
+
    typedef std::multimap<LA_RecognitionRule::HashType,const LA_RecognitionRule*> RULES;
    RULES prefix_rules, affix_rules, syllab_prefix_rules, syllab_affix_rules;
 
+   // ,    .    ,
+   //         .
+   typedef std::multimap<lem::UCString,const LA_RecognitionRule*> WORD_RULES;
+   WORD_RULES word_rules;
+
    void AddResult(
                   const Solarix::Word_Coord &wc,
                   lem::Real1 val,
-                  Solarix::LA_ProjectInfo *inf,
+                  const Solarix::CP_Array &coords,
                   lem::MCollect<Solarix::Word_Coord> &found_list,
                   lem::MCollect<ProjScore> &val_list,
                   lem::PtrCollect<Solarix::LA_ProjectInfo> &inf_list
                  ) const;
 
+   void AddRuleResult(
+                      const LA_RecognitionRule *r,
+                      const lem::UCString & word,
+                      lem::Real1 word_rel,
+                      lem::MCollect<Solarix::Word_Coord> &found_list,
+                      lem::MCollect<ProjScore> &val_list,
+                      lem::PtrCollect<Solarix::LA_ProjectInfo> &inf_list,
+                      LA_RecognitionTrace *trace
+                     ) const;
+
 
    LA_RecognitionRules( int _id_language, LexiconStorage *_storage );
    ~LA_RecognitionRules(void);
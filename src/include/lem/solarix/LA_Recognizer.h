@@ -31,6 +31,8 @@
 
     lem::MCollect<int> id_langs;
     lem::MCollect<LA_RecognitionRules*> rules;
+
+    bool use_rx_set;
     
     void DeleteRules(void);
 
@@ -46,6 +48,9 @@
 
     void Connect( LexiconStorage *Storage );
 
+    //      -     .
+    void SetRegexAutomaton( bool f );
+
     bool Apply(
                const lem::UCString & normalized_word,
                const lem::UCString & original_word,
@@ -0,0 +1,71 @@
+#if !defined LA_REGEX_SET__H
+ #define LA_REGEX_SET__H
+
+ #include <lem/noncopyable.h>
+ #include <lem/containers.h>
+
+ namespace Solarix
+ {
+  // ***************************************************************************
+  //   ,    
+  //  ( ).       
+  // ,     ( boost::regex_match).
+  //   ,    
+  // : , '.',  [...], \d \w \s   ,
+  //  (...)  (?:...),  |,  * + ? {m,n},  ^  $
+  //   .    Add  false,  
+  //      -.   
+  //     boost::regex_traits<wchar_t>, 
+  //   boost::wregex     -ASCII .
+  // ***************************************************************************
+  class LA_RegexSet : lem::NonCopyable
+  {
+   private:
+    enum { StChar, StAny, StClass, StSplit, StMatch };
+
+    struct State
+    {
+     int type;
+     wchar_t c;
+     int out, out1; // ;  StClass  out1 -  ,  StMatch -  
+    };
+
+    struct CharClass
+    {
+     bool negated;
+     int flags;
+     lem::MCollect< std::pair<wchar_t,wchar_t> > ranges;
+
+     CharClass() : negated(false), flags(0) {}
+     bool Contains( wchar_t c, wchar_t fc ) const;
+    };
+
+    struct Node;
+    class Parser;
+
+    bool icase;
+    lem::MCollect<State> states;
+    lem::MCollect<CharClass> classes;
+    lem::MCollect<int> starts; //    
+
+    int NewState( int type, wchar_t c, int out, int out1 );
+    int Compile( const Node *node, int next );
+    void AddState( int s, int gen, int *list, int &n, int *mark ) const;
+    bool Step( int s, wchar_t c, wchar_t fc ) const;
+
+   public:
+    LA_RegexSet( bool _icase );
+
+    //        id.  false, 
+    //     ;     .
+    bool Add( const wchar_t *pattern, int id );
+
+    bool Empty() const { return starts.empty(); }
+    int CountStates() const { return CastSizeToInt(states.size()); }
+
+    //   matched   ,   .
+    void Match( const wchar_t *word, lem::MCollect<int> &matched ) const;
+  };
+ }
+
+#endif
@@ -0,0 +1,61 @@
+#if !defined LA_SCRIPT_TABLE__H
+ #define LA_SCRIPT_TABLE__H
+
+// CD->16.10.2026
+// LC->16.10.2026
+
+ #include <vector>
+ #include <lem/noncopyable.h>
+ #include <lem/containers.h>
+
+ namespace Solarix
+ {
+  class Dictionary;
+
+  // ***************************************************************************
+  //  "  ->  "    
+  //    (LexicalAutomat::GuessLanguage).    
+  //  :   2      
+  // (   abc_form),    -  
+  //  .    ,    
+  // GraphGram::FindSymbol   .      256,
+  //     ;    
+  //  .     .
+  // ***************************************************************************
+  class LA_ScriptTable : lem::NonCopyable
+  {
+   public:
+    struct LangPoints
+    {
+     int ilang;  //   GetLanguages()
+     int points;
+    };
+
+   private:
+    enum { PAGE_BITS=8, PAGE_SIZE=256 };
+
+    lem::MCollect<int> lang_id; // ,    
+    int fixed_language;         //       UNKNOWN
+
+    std::vector<int> pages;     //    cells  -1
+    std::vector<int> cells;     //    -   , 0 - 
+    std::vector<int> set_begin; //    points
+    std::vector<LangPoints> points;
+
+   public:
+    LA_ScriptTable( Dictionary &dict );
+
+    const lem::MCollect<int>& GetLanguages(void) const { return lang_id; }
+    int GetFixedLanguage(void) const { return fixed_language; }
+
+    //    : [begin,end),   -  
+    //      .
+    void Find( lem::uint32_t code, const LangPoints* &begin, const LangPoints* &end ) const;
+
+    //       lang_scores (GetLanguages().size()
+    // ). ,    .
+    void Score( const wchar_t *str, int len, int *lang_scores ) const;
+  };
+ }
+
+#endif
@@ -4,6 +4,7 @@
  #include <lem/sqlite.h>
  #include <lem/fstring.h>
  #include <lem/solarix/LS_ResultSet.h>
+ #include <lem/solarix/StatementCache.h>
 
  namespace Solarix
  {
@@ -12,8 +13,13 @@
    private:
     sqlite3_stmt *stmt;
 
+    //     ,       .
+    StatementCache<sqlite3_stmt*> *cache;
+    const char *sql; //    -    
+
    public:
     LS_ResultSet_SQLITE( sqlite3_stmt *h );
+    LS_ResultSet_SQLITE( sqlite3_stmt *h, StatementCache<sqlite3_stmt*> *_cache, const char *_sql );
     virtual ~LS_ResultSet_SQLITE(void);
     virtual bool Fetch(void);
     virtual int GetInt( int FieldIndex );
@@ -10,6 +10,7 @@
  #include <lem/streams.h>
  #include <lem/containers.h>
  #include <lem/process.h>
+ #include <lem/mapped_file.h>
  #include <lem/solarix/LemmatizatorStorage.h>
  #include <lem/solarix/LEMM_NGrams.h>
 
@@ -87,6 +88,15 @@
 
     void LoadModel();
 
+    //  LEME_FASTER     ,   
+    //           .
+    lem::MappedFile mapped;
+    int FindMapped( const lem::UCString &res, int igroup, lem::MCollect<lem::UCString> *lemmas, lem::UCString *first_lemma ) const;
+    lem::UCString GetMappedLemma( int idx ) const;
+
+    void LemmatizeBySuffix( const lem::UCString &res, lem::UCString &lemma ) const;
+    void LemmatizeWords( const lem::MCollect<lem::UCString> & words, lem::MCollect<lem::UCString> &lemmas );
+
 
    public:
     Lemmatizator(void);
@@ -1,7 +1,10 @@
 #if !defined LexemDictionary__H
  #define LexemDictionary__H
 
- #include <lem/solarix/SolidRef.h>
+ #include <lem/noncopyable.h>
+ #include <lem/process.h>
+ #include <lem/solarix/lexem.h>
+ #include <lem/solarix/LexemePool.h>
 
  namespace Solarix
  {
@@ -9,17 +12,97 @@
   class LexicalAutomat;
   class LD_Seeker;
 
- class LexemDictionary : public SolidRef<Lexem>
+ // ****************************************************************************
+ //   .     LexemePool, 
+ //  -  ,      .
+ //
+ //        const Lexem*, 
+ //   Lexem,   ,    
+ //  Reserve :     i   items+i, 
+ //   reattach   .    
+ //   BLOCK_SIZE    ,   , 
+ //   ,    .   
+ //        , 
+ //      .
+ // ****************************************************************************
+ class LexemDictionary : lem::NonCopyable
  {
+  private:
+   enum { BLOCK_SHIFT=5, BLOCK_SIZE=1<<BLOCK_SHIFT };
+   enum { POOL_IMAGE=-1 }; //     -    
+
+   LexemePool pool;
+   const void *pool_image;
+   lem::uint64_t pool_image_size;
+   bool save_pool_image;
+
+   int capacity;
+   Lexem *items;         //   capacity 
+   lem::uint8_t *built;  //    -       
+
+   const Lexem *old_first_item; //     
+
+   #if defined SOL_LOADTXT
+   int next_pool_build; //     -  
+   #endif
+
+   Lexem null_item; //   ,   
+                    //        .
+
+   #if defined LEM_THREADS
+   mutable lem::Process::CriticalSection cs_items;
+   #endif
+
+   void Allocate( int n );
+   void DestroyItems(void);
+   void BuildBlock( int iblock ) const;
+   const Lexem* Materialize( int id ) const;
+
   public:
    LexemDictionary( int Reserve=0 );
    ~LexemDictionary(void);
 
+   #if defined SOL_LOADTXT
+   //        .
+   const Lexem* Add( const Lexem &x );
+   #endif
+
+   const Lexem* Find( const Lexem &x ) const;
+
+   //    UNKNOWN.  Lexem    .
+   int FindId( const lem::UCString &x ) const;
+
+   //    ,  ,  UNKNOWN.
+   int GetId( const Lexem *ptr ) const;
+
+   //      Lexem -   .
+   lem::UCString GetString( int id ) const { return pool.Get(id); }
+
+   lem::Container::size_type size(void) const { return pool.size(); }
+   const Lexem& operator[]( int id ) const { return *Materialize(id); }
+
+   const Lexem* reattach( const Lexem *Old_Ptr ) const;
+
+   //   Lexem      
+   // : ,     .
+   int CountMaterialized(void) const;
+   lem::uint64_t GetMemoryUsage(void) const;
+
+   //       ,  
+   //       . 
+   // SetSavePoolImage(true) SaveBin      , 
+   //     SavePoolImage.    ,
+   //  LoadBin      SetPoolImage.
+   void SetSavePoolImage( bool f ) { save_pool_image=f; }
+   void SavePoolImage( lem::Stream &bin ) const { pool.SaveImage(bin); }
+   void SetPoolImage( const void *data, lem::uint64_t size ) { pool_image=data; pool_image_size=size; }
+   bool IsPoolImageAttached(void) const { return pool.IsImageAttached(); }
+
    #if defined SOL_SAVEBIN
    void SaveBin( lem::Stream &bin ) const;
    #endif
 
-   #if defined SOL_LOADBIN 
+   #if defined SOL_LOADBIN
    void LoadBin( lem::Stream &bin );
    #endif
 
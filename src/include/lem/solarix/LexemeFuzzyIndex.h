@@ -0,0 +1,58 @@
+#if !defined LexemeFuzzyIndex__H
+ #define LexemeFuzzyIndex__H
+
+// CD->16.10.2026
+// LC->16.10.2026
+
+ #include <lem/noncopyable.h>
+ #include <lem/containers.h>
+ #include <lem/ucstring.h>
+
+ namespace Solarix
+ {
+  class LexemDictionary;
+
+  // ***************************************************************************
+  // BK-      .  - 
+  //    ,   lem::Fuzzy::levinshtein_distance.
+  //    ,        
+  //  ,        .
+  //     ,     .
+  // ***************************************************************************
+  class LexemeFuzzyIndex : lem::NonCopyable
+  {
+   private:
+    struct Node
+    {
+     lem::int32_t ilexem; //    
+     lem::int32_t first_child;
+     lem::int32_t next_sibling;
+     lem::int32_t dist; //     
+    };
+
+    lem::MCollect<Node> nodes;
+    int n_lexem; //       
+
+   public:
+    LexemeFuzzyIndex(void) : n_lexem(0) {}
+
+    static int Distance( const lem::UCString &a, const lem::UCString &b );
+
+    void Build( const LexemDictionary &lexems );
+    void Clear(void);
+
+    int CountLexems(void) const { return n_lexem; }
+    int CountNodes(void) const { return CastSizeToInt(nodes.size()); }
+
+    //  found   ,   Distance(word,)<=max_dist,
+    //   .
+    void Find(
+              const LexemDictionary &lexems,
+              const lem::UCString &word,
+              int max_dist,
+              lem::MCollect<int> &found
+             ) const;
+  };
+ }
+
+#endif
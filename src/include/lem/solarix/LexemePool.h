@@ -0,0 +1,101 @@
+#if !defined LexemePool__H
+ #define LexemePool__H
+
+// CD->16.10.2026
+// LC->16.10.2026
+
+ #include <vector>
+ #include <map>
+ #include <lem/integer.h>
+ #include <lem/noncopyable.h>
+ #include <lem/ucstring.h>
+ #include <lem/streams.h>
+
+ namespace Solarix
+ {
+  // ***************************************************************************
+  //     :     UTF-8, 
+  //     -  . 
+  //        - (
+  // hash-and-displace):    ,   -
+  //  ,    . , 
+  //  Build,   Build    .
+  //       ,    .
+  // ***************************************************************************
+  class LexemePool : lem::NonCopyable
+  {
+   private:
+    std::vector<lem::uint8_t> text;    //   UTF-8 
+    std::vector<lem::uint32_t> offset; //     text,   
+
+    std::vector<lem::uint32_t> disp;   //  : (d0<<24) | d1
+    std::vector<lem::int32_t> slot2id; // -1   
+    lem::uint32_t n_slots;
+
+    // ,    -:   -> .
+    std::multimap<lem::uint32_t,lem::int32_t> tail;
+
+    //       .     
+    // ,    ,  AttachImage, -  
+    // ,         .
+    const lem::uint8_t *text_ptr;
+    const lem::uint32_t *offset_ptr, *disp_ptr;
+    const lem::int32_t *slot2id_ptr;
+    lem::uint32_t n_offset, n_disp, n_slot2id;
+    const void *image;
+
+    struct KeyHash
+    {
+     lem::uint32_t h1, h2;
+     lem::uint32_t bucket, f1, f2;
+    };
+
+    void Sync(void);
+    void Detach(void);
+
+    KeyHash Hash( const wchar_t *s, int len ) const;
+    bool Equal( int id, const wchar_t *s, int len ) const;
+    void IndexTail( int id_from );
+
+   public:
+    LexemePool(void);
+
+    void Clear(void);
+    void Reserve( int n_lexem, int n_bytes );
+    void Shrink(void); //      
+
+    //      ,   . Append
+    //    -   ,  
+    //  Build.
+    int Add( const lem::UCString &lexem );
+    int Append( const lem::UCString &lexem );
+
+    //  -   .  false,  
+    //      -     
+    //  .
+    bool Build(void);
+    bool IsReady(void) const { return n_slot2id!=0; }
+    int CountUnhashed(void) const { return CastSizeToInt(tail.size()); }
+
+    //    -1.
+    int Find( const lem::UCString &lexem ) const;
+
+    int size(void) const { return n_offset==0 ? 0 : int(n_offset)-1; }
+    lem::UCString Get( int id ) const;
+
+    //       .  
+    //   ,    GetImageSize.
+    lem::uint64_t GetMemoryUsage(void) const;
+
+    //   -      ,   
+    //     -.    
+    //   4   ,     . AttachImage
+    //  false,       .
+    void SaveImage( lem::Stream &bin ) const;
+    bool AttachImage( const void *data, lem::uint64_t size );
+    bool IsImageAttached(void) const { return image!=NULL; }
+    lem::uint64_t GetImageSize(void) const;
+  };
+ }
+
+#endif
@@ -2,6 +2,7 @@
  #define LexerTextPos__H
 
 #include <lem/containers.h>
+#include <lem/mem_arena.h>
 
 namespace Solarix {
 
@@ -35,6 +36,13 @@ class LexerTextPos
   lem::int16_t creat_flags; // .    -   
 
  public:
+  //         ( arena!=NULL),
+  //      ,    delete.
+  static void* operator new( size_t size ) { return ::operator new(size); }
+  static void operator delete( void *p ) { ::operator delete(p); }
+  static void* operator new( size_t size, lem::MemArena *arena ) { return arena==NULL ? ::operator new(size) : arena->Allocate(size); }
+  static void operator delete( void *p, lem::MemArena *arena ) { if( arena==NULL ) ::operator delete(p); }
+
   LexerTextPos(
                const LexerTextPos * _previous,
                const Word_Form * _wordform,
@@ -4,6 +4,7 @@
  #include <lem/sqlite.h>
  #include <lem/path.h>
  #include <lem/solarix/LexiconStorage.h>
+ #include <lem/solarix/StatementCache.h>
 
  namespace Solarix
  {
@@ -18,6 +19,9 @@
     lem::UFString sqlite_connection_string;
     struct sqlite3* hdb; //   
 
+    StatementCache<sqlite3_stmt*> stmt_cache; //    
+    static void FinalizeStatement( sqlite3_stmt *stmt );
+
     void Connect();
     void Disconnect();
     LexiconStorage_SQLITE();
@@ -40,6 +44,20 @@
     int SelectInt( const lem::FString &Select );
     int SelectInt( const lem::UFString &Select );
 
+    //    '?'    .
+    // sql     -    .
+    sqlite3_stmt* PrepareCached( const char *sql );
+    LS_ResultSet* ListPrepared( const char *sql, sqlite3_stmt *stmt );
+    static void BindText( sqlite3_stmt *stmt, int iparam, const lem::UFString &value );
+
+    LS_ResultSet* ListByQuery( const char *sql, int p1 );
+    LS_ResultSet* ListByQuery( const char *sql, int p1, int p2 );
+    LS_ResultSet* ListByQuery( const char *sql, const lem::UFString &p1 );
+    LS_ResultSet* ListByQuery( const char *sql, const lem::UFString &p1, int p2 );
+    int SelectInt( const char *sql, int p1 );
+    int SelectInt( const char *sql, int p1, int p2 );
+    int SelectInt( const char *sql, const lem::UFString &p1 );
+
     void CreateTables_MetaEntries();
     void CreateTables_AuxFormTypes();
     void CreateTables_AuxForms();
@@ -69,7 +87,7 @@
     void StoreCoordStates( int id_coord, const Solarix::GramCoord &coord );
     void StoreLanguageInternals( const SG_Language &lang );
 
-    TreeScorerPoint* LoadTreeScorerPoint( const lem::UFString & sql );
+    TreeScorerPoint* LoadTreeScorerPoint( LS_ResultSet * rs );
     void LoadTreeScorerPredicates( TreeScorerPoint * p );
     TreeScorerPredicate* LoadTreeScorerPredicate( int id );
 
@@ -78,6 +96,11 @@
 
     virtual ~LexiconStorage_SQLITE();
 
+    //  :        .
+    void EnableStatementCache( bool f ) { stmt_cache.SetEnabled(f); }
+    int CountStatementCacheHits() const { return stmt_cache.CountHits(); }
+    int CountStatementCacheMisses() const { return stmt_cache.CountMisses(); }
+
     virtual void CreateSchema();
     virtual void CopyDatabase( const lem::Path & lexicon_db_path );
 
@@ -1,9 +1,13 @@
 #if !defined MorphologyModels__H
 #define MorphologyModels__H
 
+#include <map>
+#include <string>
 #include <lem/noncopyable.h>
 #include <lem/path.h>
 #include <lem/ucstring.h>
+#include <lem/ufstring.h>
+#include <lem/process.h>
 #include <lem/containers.h>
 #include <lem/ptr_container.h>
 #include <lem/RWULock.h>
@@ -115,6 +119,61 @@ namespace Solarix
   ModelTokenFeatures();
  };
 
+ // **************************************************************************
+ //  CRF-   .     
+ //       ,    
+ // id        attrs->to_id.
+ // **************************************************************************
+ class ModelFeatureIndex : lem::NonCopyable
+ {
+  public:
+   enum { FormTag, Suffix, Aa, Pos, ContextFormTag, SuffixPair, SuffixTriple };
+
+   //         pos[...]  PullFeatures1.
+   enum { POS_N, POS_A, POS_V, POS_IMV, POS_I, POS_Y, POS_VY, POS_PRN, POS_PRN2, POS_C, POS_D, POS_P, POS_PX, POS_PP, POS_MU, POS_COUNT };
+
+  private:
+   struct Key
+   {
+    lem::int32_t family, offsets, v1, v2, v3;
+
+    Key( int _family, int _offsets, int _v1, int _v2, int _v3 )
+     : family(_family), offsets(_offsets), v1(_v1), v2(_v2), v3(_v3) {}
+
+    bool operator<( const Key & x ) const
+    {
+     if( family!=x.family ) return family<x.family;
+     if( offsets!=x.offsets ) return offsets<x.offsets;
+     if( v1!=x.v1 ) return v1<x.v1;
+     if( v2!=x.v2 ) return v2<x.v2;
+     return v3<x.v3;
+    }
+   };
+
+   std::map<Key,int> key2id;
+   std::map< std::pair<int,lem::UFString>, int > sem2id; // sem[offset]=tag
+   int n_unparsed; //  ,       
+
+   static int GetPosIndex( const char * name );
+
+  public:
+   ModelFeatureIndex();
+
+   static int PackOffsets( int o1, int o2 ) { return (o1+16)*64 + (o2+16); }
+   static int PackOffsets( int o1, int o2, int o3 ) { return PackOffsets(o1,o2)*64 + (o3+16); }
+   static int GetPosValue( const std::string & prob ) { return prob.length()==1 && prob[0]>='0' && prob[0]<='9' ? prob[0]-'0' : -1; }
+
+   void Clear();
+   void Add( const char * attr, int id );
+
+   int Find( int family, int offsets, int v1=0, int v2=0, int v3=0 ) const;
+   int FindSemantic( int offset, const wchar_t * tag ) const;
+
+   int Count() const { return CastSizeToInt(key2id.size()+sem2id.size()); }
+   int CountUnparsed() const { return n_unparsed; }
+ };
+
+
  class BasicLexer;
  class ElapsedTimeConstraint;
  class SequenceLabelerModel;
@@ -163,6 +222,11 @@ namespace Solarix
    void PullFeatures2( lem::MCollect<lem::CString> & b, const lem::PtrCollect<ModelTokenFeatures> & token_features, int ifocus, int offset1, int offset2 ) const;
    void PullFeatures3( lem::MCollect<lem::CString> & b, const lem::PtrCollect<ModelTokenFeatures> & token_features, int ifocus, int offset1, int offset2, int offset3 ) const;
 
+   //   ,     id  ,    .
+   void PullFeatureIds1( lem::MCollect<int> & b, const ModelFeatureIndex & index, const lem::PtrCollect<ModelTokenFeatures> & token_features, int ifocus, int offset, bool rich_set, bool emit_Aa_feature ) const;
+   void PullFeatureIds2( lem::MCollect<int> & b, const ModelFeatureIndex & index, const lem::PtrCollect<ModelTokenFeatures> & token_features, int ifocus, int offset1, int offset2 ) const;
+   void PullFeatureIds3( lem::MCollect<int> & b, const ModelFeatureIndex & index, const lem::PtrCollect<ModelTokenFeatures> & token_features, int ifocus, int offset1, int offset2, int offset3 ) const;
+
   public:
    BasicModel();
    virtual ~BasicModel();
@@ -181,9 +245,28 @@ namespace Solarix
    #if defined SOL_CRF_MODEL
    crfsuite_model_t *model;
    crfsuite_dictionary_t *attrs, *labels;
-   crfsuite_tagger_t *tagger;
+
+   //    ,      
+   //   .  -   ,    .
+   struct TaggerSlot
+   {
+    crfsuite_model_t *model;
+    crfsuite_tagger_t *tagger;
+   };
+
+   lem::MCollect<TaggerSlot> free_taggers;
+   lem::MCollect<TaggerSlot> all_taggers;
+   #if defined LEM_THREADS
+   lem::Process::CriticalSection cs_taggers;
+   #endif
+
+   bool CreateTagger( TaggerSlot & slot );
+   TaggerSlot AcquireTagger();
+   void ReleaseTagger( const TaggerSlot & slot );
    #endif
 
+   ModelFeatureIndex feature_index;
+
    bool EMIT_PAIRWISE_FEATURE;
    bool EMIT_TRIPLE_FEATURE;
    bool EMIT_AA_FEATURE;
@@ -210,6 +293,8 @@ namespace Solarix
    ~SequenceLabelerModel();
 
    void Apply( BasicLexer & lexer, Dictionary & dict, const ElapsedTimeConstraint & constraints, bool remove_incorrect_alts );
+
+   int CountTaggers();
  };
 
 
@@ -0,0 +1,58 @@
+#if !defined(NGRAMS_COLLECTION_DRIVER__H) && !defined(SOL_NO_NGRAMS)
+ #define NGRAMS_COLLECTION_DRIVER__H
+
+// CD->16.10.2026
+// LC->16.10.2026
+
+ #include <vector>
+ #include <lem/noncopyable.h>
+ #include <lem/containers.h>
+ #include <lem/ucstring.h>
+ #include <lem/process.h>
+
+ namespace Solarix
+ {
+  class RawNGramsCollector;
+
+  // ***************************************************************************
+  //      N-.    
+  //   Process,   .      
+  //     ,    Process,   
+  // ,       CountSentence. 
+  // N-       ,   id 
+  // .      
+  //  ,   CountSentence   .
+  // ***************************************************************************
+  class NGramsCollectionDriver : lem::NonCopyable
+  {
+   private:
+    lem::MCollect<RawNGramsCollector*> collectors;
+    int n_thread;
+    int batch_size; //      
+
+    lem::MCollect<lem::UCString> sentence; //  
+    std::vector< lem::MCollect<lem::UCString> > batch;
+
+    std::wstring error; //     
+    #if defined LEM_THREADS
+    lem::Process::CriticalSection cs_error;
+    #endif
+
+    void CountBatch(void);
+    void CountPart( int ithread );
+
+   public:
+    NGramsCollectionDriver( int _n_thread, int _batch_size=4096 );
+
+    void Add( RawNGramsCollector *collector );
+    int CountThreads(void) const { return n_thread; }
+
+    //   .
+    void Process( const lem::UCString &word );
+
+    //    -  EndDocument .
+    void Flush(void);
+  };
+ }
+
+#endif
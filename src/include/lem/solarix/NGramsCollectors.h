@@ -13,6 +13,7 @@
  #include <lem/mallocator.h>
  #include <lem/solarix/LemmatizatorStorage.h>
  #include <lem/solarix/ngrams_dbms.h>
+ #include <lem/solarix/NGramsShardedCounter.h>
  
  namespace Solarix
  {
@@ -112,6 +113,7 @@
 
 
  class RawNGramsCollector;
+ class NGramsCollectionDriver;
  class NGramFilter : lem::NonCopyable
  {
   protected:
@@ -334,7 +336,18 @@
    lem::Ptr<NGRAM5_DOCCACHE_ALLOCATOR> ngram5_doccache_allocator;
    lem::Ptr<NGRAM5_DOCCACHE> ngram5_doccache;
 
+   // ---   N-,    ---
+   int n_shards; // 0 -   
+   int shards_capacity;
+   lem::Ptr<NGramsShardedCounter> sharded1, sharded2, sharded3, sharded4, sharded5;
 
+   #if defined LEM_THREADS
+   lem::Process::CriticalSection cs_words; //    CountSentence
+   #endif
+
+   void CreateShardedCounters(void);
+   void FlushShardedCounters( bool echo );
+   void CountSegment( const lem::MCollect<int> &ies );
 
 
 
@@ -365,6 +378,11 @@
    void Store3Gram( int ie31, int ie32, int ie33, int freq );
    void Store4Gram( int ie41, int ie42, int ie43, int ie44, int freq );
    void Store5Gram( int ie51, int ie52, int ie53, int ie54, int ie55, int freq );
+   void Cache1Gram( int ie11, int freq );
+   void Cache2Gram( int ie21, int ie22, int freq );
+   void Cache3Gram( int ie31, int ie32, int ie33, int freq );
+   void Cache4Gram( int ie41, int ie42, int ie43, int ie44, int freq );
+   void Cache5Gram( int ie51, int ie52, int ie53, int ie54, int ie55, int freq );
    void CreateIndeces( bool echo );
    void CreateIndeces1( bool echo );
    void CreateIndeces2( bool echo );
@@ -374,6 +392,7 @@
 
    virtual void ProcessSentence( const lem::MCollect<UCString> &sent );
    virtual void ProcessSingleWord( const UCString &l );
+   bool IsNGramBreak( const UCString &l ) const;
 
 
   public:
@@ -389,8 +408,11 @@
 
    virtual void SetDocCacheCapacity( int n );
    virtual void SetNGramsCacheCapacity( int n );
+   virtual void SetShardedCounters( int n_shard, int capacity );
+   int CountShards(void) const { return n_shards; }
 
    virtual void Process( const UCString &l );
+   virtual void CountSentence( const lem::MCollect<UCString> &sent );
    virtual void Report(void);
    virtual void EraseFreq1(void);
    virtual void Merge( const lem::Path &dbfile, bool echo );
@@ -408,6 +430,10 @@
 
    const UCString& IE_2_Word( int ie ) const;
 
+   //   ,  Process   ,
+   // n_words -      .
+   bool IsSentenceEnd( const UCString &l, int n_words ) const;
+
    int RegisterWord( const lem::UCString &word );
    void SetFilter( NGramFilter *filter );
  };
@@ -467,6 +493,7 @@
    virtual void EndDocument( bool echo );
    virtual void Merge( const lem::Path &dbfile, bool echo  );
    virtual void EndAll( bool echo );
+   virtual void CountSentence( const lem::MCollect<UCString> &sent );
  };
 
 
@@ -488,6 +515,9 @@
    lem::Path outdir;
    lem::zbool erase_freq1;
    lem::zbool clean_database;
+   int n_thread; //    BuildKnowledgeBase
+   int n_shard; //    ,   Prepare
+   int shard_capacity;
 
   public:
    NGramsCollectors( lem::Ptr<Solarix::Dictionary> _dict, lem::Ptr<LemmatizatorStorage> _lemm );
@@ -513,10 +543,26 @@
    virtual void SetDocCacheCapacity( int n );
    virtual void SetNGramsCacheCapacity( int n );
    virtual void SetDBCache( int cache_size );
+   //        ,
+   //      Prepare.
+   void SetShardedCounters( int _n_shard, int capacity );
+
+   //    N-  BuildKnowledgeBase.  n>1, 
+   //      ,    
+   //  ,      .
+   void SetThreads( int n );
+
+   //  ,      (0 -   
+   //    ).
+   int CountShards(void) const;
+
+   //       .
+   void AddTo( NGramsCollectionDriver &driver );
 
    void PrintNgrams( const FString &format, lem::Ptr<OFormatter> to );
 
    void Process( const UCString &l );
+   void CountSentence( const lem::MCollect<UCString> &sent );
 
    void StoreNGram( const UFString &a, const UFString &b, int freq );
    void StoreNGram( const UFString &a, const UFString &b, const UFString &c, int freq );
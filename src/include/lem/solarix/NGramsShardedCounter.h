@@ -0,0 +1,104 @@
+#if !defined(NGRAMS_SHARDED_COUNTER__H) && !defined(SOL_NO_NGRAMS)
+ #define NGRAMS_SHARDED_COUNTER__H
+
+// CD->16.10.2026
+// LC->16.10.2026
+
+ #include <vector>
+ #include <lem/integer.h>
+ #include <lem/noncopyable.h>
+ #include <lem/path.h>
+ #include <lem/fstring.h>
+ #include <lem/streams.h>
+ #include <lem/smart_pointers.h>
+ #include <lem/process.h>
+
+ namespace Solarix
+ {
+  // ***************************************************************************
+  //  N-        
+  //       N-.    
+  //   ,        ,  
+  //     N- . 
+  //       N-,   
+  //     -     .
+  //         
+  // :  N-   ,     
+  //   id .
+  // ***************************************************************************
+  class NGramsShardedCounter : lem::NonCopyable
+  {
+   public:
+    enum { MAX_ORDER=5 };
+
+    struct Record
+    {
+     lem::int32_t ie[MAX_ORDER]; // id ,   order 
+     lem::int32_t freq;
+    };
+
+   private:
+    struct Shard
+    {
+     #if defined LEM_THREADS
+     lem::Process::CriticalSection cs;
+     #endif
+     std::vector<Record> buffer;
+    };
+
+    //    -      .
+    struct MergeSource
+    {
+     lem::Ptr<lem::BinaryReader> file;
+     lem::int64_t n_left; //      
+     std::vector<Record> buf;
+     std::size_t pos;
+
+     MergeSource(void) : n_left(0), pos(0) {}
+    };
+
+    int order;
+    int max_records; //    
+    lem::Path outdir;
+    lem::FString name; //    
+
+    std::vector<Shard*> shards;
+
+    #if defined LEM_THREADS
+    lem::Process::CriticalSection cs_runs;
+    #endif
+    std::vector<lem::Path> runs;
+    lem::int64_t n_spilled;
+
+    std::vector<MergeSource*> sources;
+    std::vector<int> heap; //  ,    
+
+    lem::uint32_t Hash( const int *ie ) const;
+    bool Less( const Record &a, const Record &b ) const;
+    bool Equal( const Record &a, const Record &b ) const;
+
+    void Compact( std::vector<Record> &buffer ) const;
+    void Spill( std::vector<Record> &buffer );
+
+    bool Refill( MergeSource &src );
+    const Record& Current( int isrc ) const;
+    void SiftDown( int i );
+    void ClearMerge(void);
+
+   public:
+    NGramsShardedCounter( int _order, int n_shard, int capacity, const lem::Path &_outdir, const lem::FString &_name );
+    ~NGramsShardedCounter(void);
+
+    int GetOrder(void) const { return order; }
+
+    //  N-, .
+    void Add( const int *ie, int freq );
+
+    //  .  BeginMerge  Fetch  N-
+    //  ,   N-  .
+    void BeginMerge( bool echo );
+    bool Fetch( Record &r );
+  };
+ }
+
+#endif
@@ -0,0 +1,99 @@
+#if !defined(NGRAMS_SUCCINCT_STORE__H) && !defined(SOL_NO_NGRAMS)
+ #define NGRAMS_SUCCINCT_STORE__H
+
+// CD->16.10.2026
+// LC->16.10.2026
+
+ #include <vector>
+ #include <utility>
+ #include <lem/integer.h>
+ #include <lem/noncopyable.h>
+ #include <lem/path.h>
+ #include <lem/mapped_file.h>
+
+ namespace Solarix
+ {
+  // ***************************************************************************
+  //    N-  ,   .
+  // N-   id     :  
+  //    Elias-Fano  ,  j-   id 
+  //      (j-1)-,   
+  // ,     .  
+  //      .   
+  //   :      2^q_bits, 
+  //  .    ,    .
+  // ***************************************************************************
+  class NGramsSuccinctStore : lem::NonCopyable
+  {
+   public:
+    enum { MAX_ORDER=5 };
+
+    struct Entry
+    {
+     lem::int32_t ie[MAX_ORDER];
+     lem::int32_t id;
+     lem::int32_t w;
+    };
+
+   private:
+    //  Elias-Fano   .
+    struct EliasFano
+    {
+     lem::uint64_t n, l;
+     lem::uint64_t n_high_bits;
+     const lem::uint64_t *high, *low, *samples;
+
+     EliasFano(void) : n(0), l(0), n_high_bits(0), high(NULL), low(NULL), samples(NULL) {}
+
+     lem::uint64_t Select1( lem::uint64_t i ) const;
+     lem::uint64_t Get( lem::uint64_t i ) const;
+     lem::uint64_t LowerBound( lem::uint64_t x, lem::uint64_t lo, lem::uint64_t hi ) const;
+
+     const lem::uint64_t* Attach( const lem::uint64_t *p, const lem::uint64_t *end );
+     static void Build( const std::vector<lem::uint64_t> &values, std::vector<lem::uint64_t> &out );
+    };
+
+    lem::MappedFile mapped;
+
+    int order;
+    lem::int64_t n;
+    lem::int32_t max_freq;
+    lem::uint64_t vocab; //  id  + 1
+
+    EliasFano columns[MAX_ORDER];
+
+    int id_bits, q_bits;
+    const lem::uint64_t *ids, *codes;
+    const lem::int32_t *codebook;
+
+    static lem::uint64_t GetBits( const lem::uint64_t *data, lem::uint64_t pos, int width );
+    static void PutBits( std::vector<lem::uint64_t> &data, lem::uint64_t pos, int width, lem::uint64_t value );
+
+   public:
+    NGramsSuccinctStore(void);
+
+    bool Open( const lem::Path &filename );
+    void Close(void);
+    bool IsOpen(void) const { return mapped.IsOpen(); }
+
+    int GetOrder(void) const { return order; }
+    lem::int64_t size(void) const { return n; }
+    bool empty(void) const { return n==0; }
+    lem::int32_t GetMaxFreq(void) const { return max_freq; }
+    lem::uint64_t GetFileSize(void) const { return mapped.Size(); }
+
+    //  N-,   (id, )  (-1,-1).
+    std::pair<int,int> Find( const int *ie ) const;
+
+    // i- N-    id .
+    void Get( lem::int64_t i, int *ie, int &id, int &w ) const;
+
+    //   .    .
+    static void Write( const lem::Path &filename, int order, std::vector<Entry> &entries, int q_bits );
+
+    //     N- ( Ngrams::Cache2..Cache5).
+    static lem::int64_t ConvertBlockFile( const lem::Path &src, const lem::Path &dst, int order, int q_bits );
+  };
+ }
+
+#endif
@@ -0,0 +1,74 @@
+#if !defined ParadigmaAutomaton__H
+ #define ParadigmaAutomaton__H
+
+// CD->16.10.2026
+// LC->16.10.2026
+
+ #include <vector>
+ #include <lem/noncopyable.h>
+ #include <lem/containers.h>
+ #include <lem/ucstring.h>
+
+ namespace Solarix
+ {
+  class ParadigmaMatcher;
+
+  // ***************************************************************************
+  //    "(.+)", "(.*)[]", "(.+)(|)"  ..,
+  //        .
+  //      ,    
+  //  .      (
+  //  )     
+  //   ,   CharTrie. ,  
+  //   " +     ",   ,
+  //    GetFallback -   .
+  // ***************************************************************************
+  class ParadigmaAutomaton : lem::NonCopyable
+  {
+   private:
+    enum { PAGE_BITS=8, PAGE_SIZE=256 };
+
+    struct Rule
+    {
+     int imatcher;   //     
+     int min_prefix; //       
+     int max_prefix; // -1 -  
+    };
+
+    std::vector<Rule> rules;
+    lem::MCollect<int> fallback;
+
+    std::vector<int> pages; //    codes  -1
+    std::vector<int> codes; //  , 0 -     
+    int n_classes;
+
+    std::vector<int> next;        // n_states*n_classes , -1 - 
+    std::vector<int> final_begin; // ,     
+    std::vector<int> final_rules;
+
+    int Class( wchar_t c ) const
+    {
+     const lem::uint32_t u = (lem::uint32_t)c;
+     const lem::uint32_t ipage = u>>PAGE_BITS;
+     if( ipage>=pages.size() || pages[ipage]==-1 )
+      return 0;
+
+     return codes[ pages[ipage]+(u & (PAGE_SIZE-1)) ];
+    }
+
+    void SetClass( wchar_t c, int cls );
+
+   public:
+    ParadigmaAutomaton( const lem::MCollect<ParadigmaMatcher*> &matchers );
+
+    //     ,    GetFallback.
+    void Match( const lem::UCString &word, lem::MCollect<int> &hits ) const;
+
+    const lem::MCollect<int>& GetFallback(void) const { return fallback; }
+
+    int CountStates(void) const { return CastSizeToInt(final_begin.size())-1; }
+    int CountClasses(void) const { return n_classes; }
+  };
+ }
+
+#endif
@@ -7,6 +7,7 @@
  {
   class LexiconStorage;
   class ParadigmaMatcher;
+  class ParadigmaAutomaton;
 
   class ParadigmaFinder
   {
@@ -25,6 +26,8 @@
     typedef std::map< int /*id_class*/, lem::MCollect< std::pair<int,const ParadigmaMatcher*> >* > CLASS2DECL;
     CLASS2DECL class2decl;
 
+    ParadigmaAutomaton *automaton;
+
     void LoadFromDB(void);
 
    public:
@@ -32,6 +35,7 @@
     ~ParadigmaFinder(void);
 
     void Find( int PartOfSpeech, const lem::UCString &entry_name, lem::MCollect<int> &ids );
+    void FindLinear( int PartOfSpeech, const lem::UCString &entry_name, lem::MCollect<int> &ids );
     void Add( const ParadigmaMatcher &matcher, int PartOfSpeech, int id );
   };
  }
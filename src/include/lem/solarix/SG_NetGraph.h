@@ -0,0 +1,87 @@
+#if !defined SG_NetGraph__H
+ #define SG_NetGraph__H
+
+// CD->16.10.2026
+// LC->16.10.2026
+
+ #include <vector>
+ #include <lem/noncopyable.h>
+ #include <lem/containers.h>
+
+ namespace Solarix
+ {
+  class ThesaurusStorage;
+  class TagSets;
+
+  // ***************************************************************************
+  //        ,  
+  //   (CSR):    ,  
+  //    .     id_entry1, 
+  // -  id_entry2;       id ,   
+  //   ,      ListWordLinks/ListWordLinks2.
+  //
+  //     :    sg_link_tag
+  //   TagSets,        id 
+  //  (0 -  ),      .
+  //
+  //     ,      
+  //  .     .
+  // ***************************************************************************
+  class SG_NetGraph : lem::NonCopyable
+  {
+   public:
+    struct Edge
+    {
+     int id_link;
+     int ekey;      //     
+     int link_type;
+     int id_tags;   // id    TagSets, 0   
+    };
+
+   private:
+    struct Adjacency
+    {
+     std::vector<int> keys;    //    
+     std::vector<int> offsets; // keys.size()+1   edges
+     std::vector<Edge> edges;
+
+     void Find( int ekey, const Edge* &begin, const Edge* &end ) const;
+    };
+
+    struct LinkRow
+    {
+     int id, ekey1, ekey2, link_type, id_tags;
+    };
+
+    Adjacency outgoing, incoming;
+
+    SG_NetGraph(void) {}
+
+    void Build( std::vector<LinkRow> &rows );
+    void ListRows( std::vector<LinkRow> &rows ) const;
+
+   public:
+    SG_NetGraph( ThesaurusStorage &db, TagSets &tag_sets );
+
+    //       id_link.  id_tags  
+    //  ,     -1.
+    SG_NetGraph* WithLink( int id_link, int ekey1, int ekey2, int link_type, int id_tags ) const;
+    SG_NetGraph* WithoutLink( int id_link ) const;
+    SG_NetGraph* WithLinkTags( int id_link, int id_tags ) const;
+
+    //    ekey1 (begin==end,   ).
+    void GetOutgoing( int ekey1, const Edge* &begin, const Edge* &end ) const
+    { outgoing.Find( ekey1, begin, end ); }
+
+    // ,    ekey2.
+    void GetIncoming( int ekey2, const Edge* &begin, const Edge* &end ) const
+    { incoming.Find( ekey2, begin, end ); }
+
+    int CountLinks(void) const { return CastSizeToInt(outgoing.edges.size()); }
+
+    //        (  -  ).
+    static bool IsAllowedType( int link_type, const lem::MCollect<int> &types );
+  };
+ }
+
+#endif
@@ -0,0 +1,132 @@
+#if !defined StatementCache__H
+ #define StatementCache__H
+
+// CD->16.10.2026
+// LC->16.10.2026
+
+ #include <map>
+ #include <string>
+ #include <lem/noncopyable.h>
+ #include <lem/containers.h>
+ #include <lem/process.h>
+
+ namespace Solarix
+ {
+  // ***************************************************************************
+  //   SQL-  .  -  
+  //   '?',  -    .
+  //         (Take)  
+  //    (Put),       
+  //     ,    .
+  //  HANDLE       .
+  // ***************************************************************************
+  template < class HANDLE >
+  class StatementCache : lem::NonCopyable
+  {
+   public:
+    typedef void (*Finalizer)( HANDLE h );
+
+    //        .
+    enum { MAX_FREE_PER_SQL=8 };
+
+   private:
+    typedef std::map< std::string, lem::MCollect<HANDLE> > FREE_LIST;
+    FREE_LIST free_list;
+
+    Finalizer finalizer;
+    bool enabled;
+    int n_hit, n_miss;
+
+    #if defined LEM_THREADS
+    lem::Process::CriticalSection cs;
+    #endif
+
+   public:
+    StatementCache( Finalizer _finalizer ) : finalizer(_finalizer), enabled(true), n_hit(0), n_miss(0) {}
+
+    ~StatementCache(void) { Clear(); }
+
+    //      sql  NULL,    .
+    HANDLE Take( const char *sql )
+    {
+     #if defined LEM_THREADS
+     lem::Process::CritSecLocker guard(&cs);
+     #endif
+
+     if( enabled )
+      {
+       typename FREE_LIST::iterator it = free_list.find(sql);
+       if( it!=free_list.end() && !it->second.empty() )
+        {
+         HANDLE h = it->second.back();
+         it->second.pop_back();
+         n_hit++;
+         return h;
+        }
+      }
+
+     n_miss++;
+     return HANDLE();
+    }
+
+    //       .
+    void Put( const char *sql, HANDLE h )
+    {
+     {
+      #if defined LEM_THREADS
+      lem::Process::CritSecLocker guard(&cs);
+      #endif
+
+      if( enabled )
+       {
+        lem::MCollect<HANDLE> &l = free_list[sql];
+        if( CastSizeToInt(l.size())<MAX_FREE_PER_SQL )
+         {
+          l.push_back(h);
+          return;
+         }
+       }
+     }
+
+     finalizer(h);
+     return;
+    }
+
+    //    .     .
+    void Clear(void)
+    {
+     #if defined LEM_THREADS
+     lem::Process::CritSecLocker guard(&cs);
+     #endif
+
+     for( typename FREE_LIST::iterator it=free_list.begin(); it!=free_list.end(); ++it )
+      for( lem::Container::size_type i=0; i<it->second.size(); ++i )
+       finalizer( it->second[i] );
+
+     free_list.clear();
+     return;
+    }
+
+    //       -    .
+    void SetEnabled( bool f )
+    {
+     {
+      #if defined LEM_THREADS
+      lem::Process::CritSecLocker guard(&cs);
+      #endif
+      enabled = f;
+     }
+
+     if( !f )
+      Clear();
+
+     return;
+    }
+
+    bool IsEnabled(void) const { return enabled; }
+    int CountHits(void) const { return n_hit; }
+    int CountMisses(void) const { return n_miss; }
+  };
+ }
+
+#endif
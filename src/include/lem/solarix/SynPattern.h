@@ -2,6 +2,7 @@
 #define LA_SYNPATTERN__H
 #pragma once
 
+ #include <map>
  #include <lem/noncopyable.h>
  #include <lem/ptr_container.h>
  #include <boost/regex.hpp>
@@ -796,6 +797,12 @@
     bool IsNamedTreeCall() const { return id_tree!=UNKNOWN; }
     void AddRootNodeExport( Dictionary & dict );
 
+    // ,        Equal:  
+    // ,    ,     
+    //  (id , id       ).
+    enum { DispatchAny, DispatchLexeme, DispatchEntry, DispatchClass };
+    int GetDispatchKey( int & key, lem::UCString & lower_lexeme ) const;
+
     #if defined SOL_LOADTXT && defined SOL_COMPILER
     bool operator<( const SynPatternPoint &x ) const;
     #endif
@@ -1043,6 +1050,26 @@
     lem::PtrCollect<SynPatternPoint> point;
     lem::PtrCollect<SynPatternTreeNode> leaf;
 
+    //       :    ,
+    //    SynPatternPoint::Equal  ,  
+    //     .
+    typedef std::map< int, lem::MCollect<int> > DISPATCH_INT;
+    typedef std::map< lem::UCString, lem::MCollect<int> > DISPATCH_STR;
+    bool dispatch_ready;
+    lem::MCollect<int> dispatch_any;
+    DISPATCH_INT dispatch_entry, dispatch_class;
+    DISPATCH_STR dispatch_lexeme;
+
+    void BuildDispatchIndex(void);
+
+    #if defined SOL_CAA && !defined SOL_NO_AA
+    void GetDispatchCandidates(
+                               SynGram &sg,
+                               const LexerTextPos * current_token,
+                               lem::MCollect<int> & candidates
+                              ) const;
+    #endif
+
     #if defined SOL_CAA && !defined SOL_NO_AA
     void Limit(
                BasicLexer & lexer,
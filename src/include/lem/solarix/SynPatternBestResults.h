@@ -0,0 +1,122 @@
+#if !defined SynPatternBestResults__H
+ #define SynPatternBestResults__H
+
+ #include <lem/noncopyable.h>
+ #include <lem/mem_arena.h>
+ #include <lem/solarix/SynPatternResult.h>
+
+ namespace Solarix
+ {
+  class LexerTextPos;
+
+  //   .      
+  // ,   ,       
+  // .   (Clear    
+  // )  ,      
+  // ,      
+  // ,    .
+  struct BestResults : lem::NonCopyable
+  {
+   lem::MemArena * arena;
+
+   lem::MemArenaVector<EXPORTED_COORDS*> best_exported_coords;
+   lem::MemArenaVector<MATCHING_ALTS*> best_matching_alts;
+   lem::MemArenaVector<EXPORTED_NODES*> best_exported_nodes;
+   lem::MemArenaVector<LINKAGE_GROUPS*> best_linkage_groups;
+   lem::MemArenaVector<LINKAGE_EDGES*> best_linkage_edges;
+   lem::MemArenaVector<BackTrace*> best_backtrace;
+   lem::MemArenaVector<int> matching_len;
+   lem::MemArenaVector<NGramScore> ngram_freqs;
+   lem::MemArenaVector<const LexerTextPos*> start_token;
+   lem::MemArenaVector<const LexerTextPos*> final_token;
+
+   #if defined SOL_DEBUGGING
+   lem::MemArenaVector<SYNPATTERN_DEBUG_TRACE*> best_debug_trace;
+   #endif
+
+   BestResults( lem::MemArena * _arena ) : arena(_arena),
+    best_exported_coords(_arena), best_matching_alts(_arena), best_exported_nodes(_arena),
+    best_linkage_groups(_arena), best_linkage_edges(_arena), best_backtrace(_arena),
+    matching_len(_arena), ngram_freqs(_arena), start_token(_arena), final_token(_arena)
+    #if defined SOL_DEBUGGING
+    , best_debug_trace(_arena)
+    #endif
+   {}
+
+   ~BestResults(void) { Clear(); }
+
+   static BestResults* Create( lem::MemArena * arena )
+   {
+    if( arena==NULL )
+     return new BestResults(NULL);
+
+    return arena->New<BestResults>(arena);
+   }
+
+   static void Destroy( BestResults * x )
+   {
+    if( x==NULL )
+     return;
+
+    if( x->arena==NULL )
+     delete x;
+    else
+     x->arena->Delete(x);
+
+    return;
+   }
+
+   template < class T >
+   T* New(void)
+   {
+    if( arena==NULL )
+     return new T();
+
+    return arena->New<T>();
+   }
+
+   template < class T >
+   T* Copy( const T & src )
+   {
+    if( arena==NULL )
+     return new T(src);
+
+    return arena->New<T>(src);
+   }
+
+   template < class T >
+   void Delete( lem::MemArenaVector<T*> & list )
+   {
+    for( int i=0; i<list.size(); ++i )
+     if( arena==NULL )
+      delete list[i];
+     else
+      arena->Delete( list[i] );
+
+    list.clear();
+    return;
+   }
+
+   void Clear(void)
+   {
+    Delete(best_exported_coords);
+    Delete(best_matching_alts);
+    Delete(best_backtrace);
+    matching_len.clear();
+    Delete(best_exported_nodes);
+    Delete(best_linkage_groups);
+    Delete(best_linkage_edges);
+    ngram_freqs.clear();
+    start_token.clear();
+    final_token.clear();
+
+    #if defined SOL_DEBUGGING
+    Delete(best_debug_trace);
+    #endif
+
+    return;
+   }
+  };
+ }
+
+#endif
@@ -0,0 +1,80 @@
+#if !defined TextAnalysisProfile__H
+ #define TextAnalysisProfile__H
+
+// CD->16.10.2026
+// LC->16.10.2026
+
+ #include <lem/integer.h>
+ #include <lem/date_time.h>
+
+ namespace Solarix
+ {
+  // ***************************************************************************
+  //   TextAnalysisSession::Analyze -    
+  //    .   ,  
+  //   (,    operator new), 
+  //         ,   
+  //   .     Clear().
+  //    TextAnalysisSession::SetProfile,  
+  //    .
+  // ***************************************************************************
+  class TextAnalysisProfile
+  {
+   public:
+    // Fallback -   ,   
+    // UseTopDownThenSparse    .
+    enum { Tokenize, Model, Parse, Fallback, Build, STAGE_COUNT };
+
+    typedef lem::int64_t (*AllocationCounter)(void);
+
+    lem::int64_t usec[STAGE_COUNT];
+    lem::int64_t n_alloc[STAGE_COUNT];
+
+   private:
+    AllocationCounter count_allocations;
+    lem::ElapsedTime timer;
+    lem::int64_t alloc0;
+
+    lem::int64_t CountAllocations(void) const
+    { return count_allocations==NULL ? 0 : count_allocations(); }
+
+   public:
+    TextAnalysisProfile( AllocationCounter _count_allocations=NULL )
+     : count_allocations(_count_allocations) { Clear(); }
+
+    void Clear(void)
+    {
+     for( int i=0; i<STAGE_COUNT; ++i )
+      {
+       usec[i] = 0;
+       n_alloc[i] = 0;
+      }
+
+     alloc0 = 0;
+     return;
+    }
+
+    void Begin(void)
+    {
+     alloc0 = CountAllocations();
+     timer.start();
+     return;
+    }
+
+    void End( int stage )
+    {
+     timer.stop();
+     usec[stage] += timer.elapsed().total_microseconds();
+     n_alloc[stage] += CountAllocations()-alloc0;
+     return;
+    }
+
+    static const char* GetStageName( int stage )
+    {
+     static const char* names[STAGE_COUNT] = { "tokenize", "model", "parse", "fallback", "build" };
+     return names[stage];
+    }
+  };
+ }
+
+#endif
@@ -16,6 +16,7 @@ class TreeMatchingExperience;
 class TrWideContext;
 class SynPatternTreeNodeMatchingResults;
 class ElapsedTimeConstraint;
+class TextAnalysisProfile;
 
 //          .
 class TextAnalysisSession : lem::NonCopyable
@@ -27,6 +28,13 @@ class TextAnalysisSession : lem::NonCopyable
   BasicLexer * lexer;
   Res_Pack * pack;
 
+  int n_point_checked, n_point_skipped; //  SynPatternPoint::Equal  ,  
+
+  TextAnalysisProfile * profile; //   NULL -      
+
+  void BeginStage();
+  void EndStage( int stage );
+
   virtual void Analyze( bool ApplyPatterns, bool DoSyntaxLinks, const ElapsedTimeConstraint &constraints );
 
   SynPatternTreeNodeMatchingResults* TopDownParsing(
@@ -52,6 +60,13 @@ class TextAnalysisSession : lem::NonCopyable
   //       -    .
   const Res_Pack& GetPack() const { return *pack; }
   Res_Pack* PickPack() { Res_Pack *p=pack; pack=NULL; return p; }
+
+  //       .
+  int CountCheckedPatternPoints() const { return n_point_checked; }
+  int CountSkippedPatternPoints() const { return n_point_skipped; }
+
+  //    , NULL  .
+  void SetProfile( TextAnalysisProfile * p ) { profile=p; }
 };
 
 }
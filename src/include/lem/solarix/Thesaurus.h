@@ -1,8 +1,10 @@
 #if !defined Thesaurus__H
  #define Thesaurus__H
 
+ #include <boost/shared_ptr.hpp>
  #include <lem/smart_pointers.h>
  #include <lem/ptr_container.h>
+ #include <lem/process.h>
  #include <lem/tuple.h>
  #include <lem/solarix/SG_ComplexLink.h>
  #include <lem/solarix/SG_NetLink.h>
@@ -23,6 +25,7 @@
   class PhraseNoteEnumerator;
   struct Dictionary_Config;
   class SG_TagFilter;
+  class SG_NetGraph;
   class SQL_Production;
   struct ExactWordEntryLocator;
 
@@ -42,6 +45,17 @@
    private:
     lem::zint internal_offset_buffer;
 
+    //    ,   .    
+    //  cs_graph    ,     
+    //    . cs_graph_edit   .
+    boost::shared_ptr<const SG_NetGraph> graph;
+    #if defined LEM_THREADS
+    lem::Process::CriticalSection cs_graph, cs_graph_edit;
+    #endif
+
+    boost::shared_ptr<const SG_NetGraph> GetGraph(void);
+    void PublishGraph( const SG_NetGraph *g );
+
     #if defined SOL_COMPILER && defined SOL_LOADTXT 
      //       - 
      //     .
@@ -74,6 +88,13 @@
     void SetStorage( ThesaurusStorage *_db, bool _do_delete );
     ThesaurusStorage& GetStorage(void) { return *db; }
 
+    //       -   Find_Linked_Entries
+    //     .     SG_Net
+    //    .
+    void LoadGraph(void);
+    void DropGraph(void);
+    bool IsGraphLoaded(void);
+
     ThesaurusTagDefs& GetTagDefs(void) { return *tag_defs; }
 
     #if defined SOL_REPORT
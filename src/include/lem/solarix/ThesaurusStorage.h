@@ -34,6 +34,8 @@
     virtual void ReplaceEntryKey( int old_ekey, int new_ekey )=0;
     virtual int CountWordLinks( int optional_link_type )=0;
     virtual LS_ResultSet* ListWordLinks(void)=0;
+    virtual LS_ResultSet* ListAllWordLinks(void)=0;
+    virtual LS_ResultSet* ListAllWordLinkTags(void)=0;
     virtual LS_ResultSet* ListWordLinks( int ekey1 )=0;
     virtual LS_ResultSet* ListWordLinks( int ekey1, int link_type )=0;
     virtual LS_ResultSet* ListWordLinks( int ekey1, const lem::MCollect<int> & link_types )=0;
@@ -52,6 +52,8 @@
 
     virtual int CountWordLinks( int optional_link_type );
     virtual LS_ResultSet* ListWordLinks(void);
+    virtual LS_ResultSet* ListAllWordLinks(void);
+    virtual LS_ResultSet* ListAllWordLinkTags(void);
     virtual LS_ResultSet* ListWordLinks( int ekey1 );
     virtual LS_ResultSet* ListWordLinks( int ekey1, int link_type );
     virtual LS_ResultSet* ListWordLinks( int ekey1, const lem::MCollect<int> & link_types );
@@ -0,0 +1,119 @@
+#if !defined TR_BYTECODE__H
+ #define TR_BYTECODE__H
+
+// CD->16.10.2026
+// LC->16.10.2026
+
+ #include <lem/noncopyable.h>
+ #include <lem/containers.h>
+ #include <lem/ucstring.h>
+ #include <lem/smart_pointers.h>
+
+ namespace Solarix
+ {
+  class PM_Automat;
+  class ElapsedTimeConstraint;
+  class TrValue;
+  class TrType;
+  class TrFunCall;
+  class TrFunction;
+  class TrFunContext;
+  class TrFun_User;
+
+  #if defined SOL_CAA && !defined SOL_NO_AA
+  struct TrBytecodeOp
+  {
+   int code;
+   int a, b;
+  };
+
+  // ***************************************************************************
+  //   ,     
+  //  -.      
+  // ,   ,      
+  // ;  int  bool     TrValue.
+  // ,      (  ,
+  // ,  ),    TrFunCall 
+  // -,     .    
+  // ,   -    , 
+  //       .
+  // ***************************************************************************
+  class TrBytecode : lem::NonCopyable
+  {
+   public:
+    enum {
+          End,
+          PushInt, PushBool, PushConst, PushVoid, // a -    
+          Load, LoadOuter,                        // a -    
+          Assign,
+          Declare, DeclareType,                   // a - , b -  
+          Pop,
+          Jump, JumpIfFalse, JumpIfTrue,          // a -  
+          Eq, Neq, Gt, Ge, Lt, Not,
+          Plus, Minus, Mul, Div, Mod,
+          ForInit, ForTest, ForNext,              // a -  , b -  
+          Return,                                 // a - , b=1  return    
+          Call,                                   // a -  , b -  
+          Tree                                    // a -   , b -  
+         };
+
+   private:
+    friend class TrBytecodeCompiler;
+    friend class TrBytecodeContext;
+
+    lem::MCollect<TrBytecodeOp> ops;
+    lem::MCollect<lem::UCString> arg_name;
+    int n_slots, ret_slot, n_loops, max_stack;
+
+    lem::MCollect<const TrValue*> consts;
+    lem::MCollect<const TrType*> types;
+    lem::MCollect<lem::UCString> outer_name;
+    lem::MCollect<const TrFun_User*> call_site;
+    lem::MCollect<const TrFunCall*> tree_call;
+
+    //         -:
+    // vis_begin[i]..vis_begin[i+1]  vis_name/vis_slot,   .
+    lem::MCollect<int> vis_begin;
+    lem::MCollect<lem::UCString> vis_name;
+    lem::MCollect<int> vis_slot;
+
+    TrBytecode(void);
+
+    void Execute(
+                 const ElapsedTimeConstraint & constraints,
+                 PM_Automat &pm,
+                 TrFunContext &outer,
+                 TrValue **slots,
+                 bool &returned
+                ) const;
+
+    lem::Ptr<TrValue> Run(
+                          const ElapsedTimeConstraint & constraints,
+                          PM_Automat &pm,
+                          TrFunContext &outer,
+                          TrValue **slots,
+                          const TrFun_User &site
+                         ) const;
+
+   public:
+    //  NULL,       -.
+    static TrBytecode* Compile( const TrFunction &fun );
+
+    //   -    :   
+    //     ,    .
+    bool Accepts( const TrFun_User &site ) const;
+
+    //   TrFun_User::Run  .
+    lem::Ptr<TrValue> Invoke(
+                             const ElapsedTimeConstraint & constraints,
+                             PM_Automat &pm,
+                             TrFunContext &ctx,
+                             const TrFun_User &site
+                            ) const;
+
+    int CountOps(void) const { return CastSizeToInt(ops.size()); }
+  };
+  #endif
+ }
+
+#endif
@@ -65,8 +65,10 @@
     typedef std::map< const LexerTextPos*, TreeMatchingExperienceItem* > FRAGMENT2ITEM;
     FRAGMENT2ITEM fragment2item;
 
+    int n_point_checked, n_point_skipped; //     SynPatternTreeNode
+
    public:
-    TreeMatchingExperience(void) {}
+    TreeMatchingExperience(void) : n_point_checked(0), n_point_skipped(0) {}
     ~TreeMatchingExperience(void);
 
     const TreeMatchingExperienceItem* Find( int id_tree, const LexerTextPos * token ) const
@@ -89,6 +91,10 @@
     bool FindKBCheckerMatching( int id_facts, const lem::MCollect< const Solarix::Word_Form * > & arg_values, KB_CheckingResult * res ) const;
     void AddKBCheckerMatching( int id_facts, const lem::MCollect< const Solarix::Word_Form * > & arg_values, const KB_CheckingResult & res );
 
+    void CountPointChecks( int checked, int skipped ) { n_point_checked+=checked; n_point_skipped+=skipped; }
+    int CountCheckedPoints(void) const { return n_point_checked; }
+    int CountSkippedPoints(void) const { return n_point_skipped; }
+
     int FindAccelerator( const LexerTextPos * token, int id_accel ) const;
     void StoreAccelerator( const LexerTextPos * token, int id_accel, bool result );
 
@@ -73,6 +73,12 @@
     virtual WordFormEnumerator* ListWordForms_Fuzzy( const lem::UCString &word, float min_val )=0;
     virtual WordFormEnumerator* ListWordForms_Globbing( const lem::UFString &mask )=0;
 
+    //       ,   
+    //  word     max_dist  ( ).  - 
+    // ( , )    ListEntries().  
+    // ,   false       .
+    virtual bool FindFuzzyForms( const lem::UCString &word, int max_dist, lem::MCollect<Word_Coord> &forms ) { return false; }
+
     virtual int CountLexemes(void)=0;
     virtual LexemeEnumerator* ListLexemes(void)=0;
 
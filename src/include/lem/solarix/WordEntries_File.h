@@ -4,10 +4,12 @@
  #include <lem/solarix/WordEntries.h>
  #include <lem/solarix/SG_EntryGroup.h>
  #include <lem/solarix/LexemDictionary.h>
+ #include <lem/solarix/LexemeFuzzyIndex.h>
  #include <lem/solarix/BaseRef.h>
  #include <lem/solarix/coord_pair.h>
  #include <lem/bit_array32.h>
  #include <lem/process.h>
+ #include <lem/mapped_file.h>
 
 
  namespace Solarix
@@ -31,7 +33,12 @@
     lem::MCollect<WordEntries_LookUpItem> lexem_slot;
     lem::MCollect<int> entry_index;
 
+    //   sorted_lexem_index:     -> 
+    //  lexem_slot.  ,   .
+    lem::MCollect<lem::int32_t> lexem_to_slot;
+
     void InitLexems( const LexemDictionary & lexems );
+    void BuildSlotIndex(void);
     int Findlexem( const LexemDictionary & lexems, const lem::UCString & lexem ) const;
     void Clear();
     void SaveBin( lem::Stream & bin ) const;
@@ -48,6 +55,17 @@
 
     //     .
     WordEntries_LookUp lookup_table;
+    int lookup_entries_count; //    lookup_table
+
+    // BK-    ,    .
+    #if defined LEM_THREADS
+    lem::Process::CriticalSection cs_fuzzy;
+    #endif
+    LexemeFuzzyIndex fuzzy_index;
+    bool use_fuzzy_index;
+    bool PrepareFuzzyIndex(void);
+    bool FindFuzzyLexemes( const lem::UCString &word, int max_dist, lem::MCollect<int> &ilexems );
+    void ListLexemeForms( int ilexem, lem::MCollect< std::pair<int,int> > &index_form );
 
     void ClearGroups(void);
 
@@ -57,7 +75,10 @@
 
     int max_ml_len;                    // Max. number of lexem in a wordform.
 
-    std::map< int/*entry_key*/, int/*entry_index*/ > key_to_index;
+    //    : key_to_index[entry_key] -    UNKNOWN.
+    //    ,     .
+    lem::MCollect<int> key_to_index;
+    void IndexEntryKey( int key, int index );
 
     //      .
     lem::IntCollect ML_entry_key_list;
@@ -82,10 +103,14 @@
     lem::Process::CriticalSection cs;
     #endif
     bool lazy_load;
+    bool use_entry_mapping;
     lem::MCollect<lem::Stream::pos_type> entry_pos;
     lem::Path entries_path;
+    lem::uint64_t entries_offset; //      entries_path
     lem::Ptr<lem::BinaryReader> entries_bin;
+    lem::MappedFile entries_map; //  ,    -   
     void LoadEntry( int index );
+    bool PublishEntry( int index, SG_Entry *e );
    
     friend class WordEntryEnumerator_File;
     friend class WordEntryEnumerator_File_ByGroup;
@@ -142,6 +167,10 @@
     virtual WordFormEnumerator* ListWordForms( const lem::MCollect<lem::UCString> &forms );
     virtual WordFormEnumerator* ListWordForms_Fuzzy( const lem::UCString &word, float min_val );
     virtual WordFormEnumerator* ListWordForms_Globbing( const lem::UFString &mask );
+    virtual bool FindFuzzyForms( const lem::UCString &word, int max_dist, lem::MCollect<Word_Coord> &forms );
+
+    //     ,      .
+    void SetFuzzyIndex( bool f ) { use_fuzzy_index=f; }
 
     virtual int CountLexemes(void);
     virtual LexemeEnumerator* ListLexemes(void);
@@ -186,7 +215,21 @@
 
     virtual const lem::IntCollect& GetUEntries(void);
 
-    void SetLazyLoad( const lem::Path & morphology_path );
+    void SetLazyLoad( const lem::Path & morphology_path, lem::uint64_t offset=0 );
+    bool IsLazyLoad(void) const { return lazy_load; }
+
+    //     , . LexemDictionary::SetSavePoolImage.
+    void SetSaveLexemePoolImage( bool f ) { ml_ref.SetSavePoolImage(f); }
+    void SaveLexemePoolImage( lem::Stream &bin ) const { ml_ref.SavePoolImage(bin); }
+    void SetLexemePoolImage( const void *data, lem::uint64_t size ) { ml_ref.SetPoolImage(data,size); }
+    bool IsLexemePoolImageAttached(void) const { return ml_ref.IsPoolImageAttached(); }
+
+    //         , 
+    //       BinaryReader  .
+    void SetEntryMapping( bool f );
+
+    //   ,      .
+    void ListEntryKeys( lem::MCollect<int> &keys ) const;
 
     virtual int GetUnknownEntryKey(void);
   };
@@ -0,0 +1,108 @@
+#if !defined WordRecognitionCache__H
+ #define WordRecognitionCache__H
+
+// CD->16.10.2026
+// LC->16.10.2026
+
+ #include <map>
+ #include <deque>
+ #include <lem/noncopyable.h>
+ #include <lem/process.h>
+ #include <lem/ucstring.h>
+
+ namespace Solarix
+ {
+  class Word_Form;
+
+  // ***************************************************************************
+  //         
+  // .   Dictionary,     
+  //      .      
+  // ,       . 
+  // ,       .
+  // ***************************************************************************
+  class WordRecognitionCache : lem::NonCopyable
+  {
+   public:
+    struct Key
+    {
+     lem::UCString word;
+     int id_language;
+     int case_flags; //     TF_CaseFilter,  UNKNOWN
+     int word_parts;
+     int flags; //   ,   
+
+     Key(void) : id_language(-1), case_flags(-1), word_parts(0), flags(0) {}
+
+     bool operator<( const Key &x ) const
+     {
+      if( id_language!=x.id_language ) return id_language<x.id_language;
+      if( case_flags!=x.case_flags ) return case_flags<x.case_flags;
+      if( word_parts!=x.word_parts ) return word_parts<x.word_parts;
+      if( flags!=x.flags ) return flags<x.flags;
+      return word<x.word;
+     }
+    };
+
+   private:
+    enum { N_SHARD=16 };
+
+    typedef std::map<Key,Word_Form*> ITEMS;
+
+    struct Shard
+    {
+     #if defined LEM_THREADS
+     lem::Process::CriticalSection cs;
+     #endif
+
+     ITEMS items;
+     std::deque<ITEMS::iterator> order; //    
+     int hits, misses;
+
+     Shard(void) : hits(0), misses(0) {}
+    };
+
+    Shard shards[N_SHARD];
+    volatile int max_size; // .     , 0 -  
+
+    #if defined LEM_THREADS
+    lem::Process::CriticalSection cs_generation;
+    #endif
+    int generation; //     
+
+    Shard& GetShard( const Key &key );
+    void Evict( Shard &shard, int shard_limit );
+
+   public:
+    WordRecognitionCache( int _max_size=200000 );
+    ~WordRecognitionCache(void);
+
+    bool IsEnabled(void) const { return max_size>0; }
+
+    //      , 
+    //   ,  NULL     .
+    Word_Form* Find( const Key &key );
+
+    //         
+    //  Store,    ,     .
+    int GetGeneration(void);
+
+    //    .
+    void Store( const Key &key, const Word_Form &wordform, int _generation );
+
+    void Clear(void);
+
+    //     ,   
+    //   .
+    void Invalidate(void);
+
+    void SetMaxSize( int n );
+
+    int GetMaxSize(void) const { return max_size; }
+    int Count(void);
+    int CountHits(void);
+    int CountMisses(void);
+  };
+ }
+
+#endif
@@ -1,6 +1,7 @@
 #if !defined WrittenTextAnalysisSession__H
 #define WrittenTextAnalysisSession__H
 
+#include <lem/mem_arena.h>
 #include <lem/solarix/TextAnalysisSession.h>
 
 namespace Solarix {
@@ -12,10 +13,17 @@ class WrittenTextAnalysisSession : public TextAnalysisSession
  private:
   lem::UFString processed_str;
 
+  //         
+  //  .     .
+  lem::MemArena arena;
+
+  void NewLexer( const lem::UFString & str );
+
   void AnalyzeIt( const lem::UFString & str, bool ApplyPatterns, bool DoSyntacticLinks, const ElapsedTimeConstraint & constraints );
 
  public:
   WrittenTextAnalysisSession( Solarix::Dictionary * _dict, TrTrace * _trace );
+  virtual ~WrittenTextAnalysisSession();
   
   void MorphologicalAnalysis( const lem::UFString & str );
   void SyntacticAnalysis( const lem::UFString & str );
@@ -25,6 +33,9 @@ class WrittenTextAnalysisSession : public TextAnalysisSession
   void SyntacticAnalysis( BasicLexer & lexer, const ElapsedTimeConstraint & constraints );
 
   const lem::UFString & GetString() const { return processed_str; }
+
+  //        .
+  const lem::MemArena & GetArena() const { return arena; }
 };
 
 }
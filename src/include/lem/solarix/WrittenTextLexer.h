@@ -66,7 +66,8 @@ class WrittenTextLexer : public BasicLexer
                    const lem::UFString & _text,
                    const TextRecognitionParameters & _params,
                    Solarix::Dictionary * _dict,
-                   TrTrace * _trace
+                   TrTrace * _trace,
+                   lem::MemArena * _arena=NULL
                   );
 
  
@@ -92,6 +92,8 @@
   class StorageConnections;
   class LemmatizatorStorage;
   class DebugSymbols;
+  class WordRecognitionCache;
+  class DictionarySnapshot;
   
   //        ,
   //     ,  .
@@ -147,6 +149,7 @@
     lem::Path dictionary_xml;  
     lem::Path xml_base_path; // ,    XML  
     lem::Path morphology_path; //   diction.bin
+    lem::Path affix_path, seeker_path; //  ,      
 
     int compilation_tracing; //     
 
@@ -178,6 +181,11 @@
     lem::Ptr<Solarix::Affix_Table> affix_table;
 
     lem::Ptr<Solarix::LD_Seeker> seeker;
+
+    //   :       ,
+    //       .
+    lem::Ptr<DictionarySnapshot> snapshot;
+
     #if defined SOL_CAA
     lem::Ptr<Solarix::SG_Stemmer> stemmer;
     #endif
@@ -208,6 +216,8 @@
 
     DebugSymbols * debug_symbols; //   
 
+    WordRecognitionCache * recognition_cache; //       
+
     Automaton* auto_list[SOL_N_AUTOMATA]; //    .
     GraphGram *gg;
     SynGram *sg;
@@ -321,8 +331,10 @@
     void LoadMorphology( const lem::Path &morphology_path, const Load_Options &opt );
 
     void LoadAffixTable( const lem::Path &affix_path );
+    void LoadAffixTable( lem::Stream &bin );
 
     void LoadSeeker( const lem::Path &seeker_path );
+    void LoadSeeker( lem::Stream &bin );
 
     void LoadStemmer( const lem::Path &stemmer_path );
 
@@ -338,8 +350,12 @@
 
     void CreateEmptySeeker(void);
 
+    //      ( <snapshot>  dictionary.xml).
+    bool UsesSnapshot(void) const { return !snapshot.IsNull(); }
+
     #if defined SOL_SAVEBIN
     void SaveBin( lem::Stream &dst_stream ) const; 
+    lem::uint64_t SaveSnapshot( const lem::Path &filename );
     #endif
 
     #if defined SOL_REPORT
@@ -466,6 +482,8 @@
 
    DebugSymbols& GetDebugSymbols(void) { return *debug_symbols; }
 
+   WordRecognitionCache& GetRecognitionCache(void) { return *recognition_cache; }
+
    #if defined SOL_CAA
    TextTokenizationRules * GetTokenizationRules( const lem::MCollect<int> & id_language );
    #endif
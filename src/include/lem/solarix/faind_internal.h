@@ -124,6 +124,7 @@ namespace Solarix
  class Dictionary;
  class LD_Seeker;
  class SentenceBroker;
+ class SyntaxAnalysisPool;
 
  class XmlText
  {
@@ -170,6 +171,10 @@ namespace Solarix
 
     int DefaultLanguage; // Default language index
 
+    //      (sol_SyntaxAnalysisBatch),
+    //    .
+    SyntaxAnalysisPool *batch_pool;
+
     #if defined LEM_THREADS
     lem::Process::CriticalSection cs_error;
     #endif
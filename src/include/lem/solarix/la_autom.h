@@ -86,6 +86,7 @@
  struct TextRecognitionParameters;
  class TreeScorers;
  class MorphologyModels;
+ class LA_ScriptTable;
 
  class LexicalAutomat : public PM_Automat
  {
@@ -246,6 +247,16 @@
 
    Real1 GetMinProjectionRel(void);
 
+   #if defined SOL_CAA
+    #if defined LEM_THREADS
+    mutable lem::Process::RWU_Lock cs_script_table;
+    #endif
+    mutable LA_ScriptTable * volatile script_table; //    
+    bool use_script_table;
+
+    const LA_ScriptTable& GetScriptTable(void) const;
+   #endif
+
    #if defined SOL_LOADTXT && defined SOL_COMPILER
    lem::PtrCollect<SynPattern> patterns; //  ( )  
 
@@ -398,6 +409,10 @@
 
    virtual void SetDictPtr( Dictionary *d );
    void SetStorage( LexiconStorage *stg, bool _do_delete );
+
+   #if defined SOL_LOADBIN && defined SOL_CAA
+   virtual void DictionaryLoaded(void);
+   #endif
    LexiconStorage& GetStorage(void) { return *storage; }
 
    bool IsCorrectWord( const UCString& word ) const;
@@ -542,6 +557,10 @@
    int GuessLanguage( const lem::UFString &str ) const;
    int GuessLanguage( const Sentence & phrase );
    int GuessLanguage( const Variator &phrase ) const;
+
+   // false - GuessLanguage     GraphGram::FindSymbol,
+   //   (   ).
+   void SetScriptTable( bool f ) { use_script_table=f; }
    void GetAllProjections(
                           const lem::UCString &word,
                           bool allow_dynforms,
@@ -562,6 +581,7 @@
    LA_SynPatternTrees& GetSynPatternTrees(void) { return *pattern_trees; }
    WordEntrySet & GetWordEntrySet(void) { return *wordentry_set; }
    LA_PhoneticMatcher & GetPhoneticMatcher(void) { return *phonetic_matcher; }
+   LA_Recognizer & GetRecognizer(void) { return *recognizer; }
    KnowledgeBase & GetKnowledgeBase() { return * knowledges; }
 
    virtual void BeforeSyntaxRecompilation(void);
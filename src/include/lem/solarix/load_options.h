@@ -12,6 +12,7 @@
   struct Load_Options : lem::NonCopyable
   {
    lem::zbool load_semnet;     // Do load thesaurus
+   lem::zbool semnet_in_memory; // Snapshot thesaurus links into memory for fast traversal (SG_NetGraph)
    lem::zbool affix_table;
    lem::zbool seeker;          // Do load the fast word lookup table (necessary for search engine)
    lem::zbool stemmer;         // Do load stemmer
@@ -19,6 +20,7 @@
    lem::zbool lexicon;         //         (true)        (false)
    lem::zbool lemmatizer;      // 
    lem::zbool force_lemmatizer_fastest_mode; //      
+   lem::zbool snapshot;        //      ( snapshot  dictionary.xml),   
 
    Load_Options(void);
   };
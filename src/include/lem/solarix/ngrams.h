@@ -12,7 +12,9 @@
  #include <lem/path.h>
  #include <lem/containers.h>
  #include <lem/ptr_container.h>
+ #include <lem/mapped_file.h>
  #include <lem/solarix/ngrams_dbms.h>
+ #include <lem/solarix/NGramsSuccinctStore.h>
 
  namespace Solarix
  {
@@ -137,6 +139,8 @@
      lem::uint32_t *marks_n;
      int n_marks;
      Cached2Gram *search_buffer;
+     lem::MappedFile mapped; //  N-,   
+     lem::Ptr<NGramsSuccinctStore> succinct; //    
 
      Cache2(void):n(0),max_freq(0),marks_filepos(NULL),marks_n(NULL),n_marks(0),search_buffer(NULL) {}
      ~Cache2(void);
@@ -146,6 +150,7 @@
      bool empty(void) const { return n==0; }
 
      lem::int64_t LoadBin( const lem::Path &p );
+     lem::int64_t LoadSuccinct( const lem::Path &p );
 
      void ForEach( Ngrams *n, const lem::FString &db_suffix, const lem::FString &segment_name, Ngrams::raw *r, NGramHandler *handler );
     };
@@ -160,6 +165,8 @@
      lem::uint32_t *marks_n;
      int n_marks;
      Cached3Gram *search_buffer;
+     lem::MappedFile mapped; //  N-,   
+     lem::Ptr<NGramsSuccinctStore> succinct; //    
 
      Cache3(void):n(0),max_freq(0),marks_filepos(NULL),marks_n(NULL),n_marks(0),search_buffer(NULL) {}
      ~Cache3(void);
@@ -169,6 +176,7 @@
      bool empty(void) const { return n==0; }
 
      lem::int64_t LoadBin( const lem::Path &p );
+     lem::int64_t LoadSuccinct( const lem::Path &p );
      void ForEach( Ngrams *n, const lem::FString &db_suffix, const lem::FString &segment_name, Ngrams::raw *r, NGramHandler *handler );
     };
 
@@ -183,6 +191,8 @@
      lem::uint32_t *marks_n;
      int n_marks;
      Cached4Gram *search_buffer;
+     lem::MappedFile mapped; //  N-,   
+     lem::Ptr<NGramsSuccinctStore> succinct; //    
 
      Cache4(void):n(0),max_freq(0),marks_filepos(NULL),marks_n(NULL),n_marks(0),search_buffer(NULL) {}
      ~Cache4(void);
@@ -192,6 +202,7 @@
      bool empty(void) const { return n==0; }
 
      lem::int64_t LoadBin( const lem::Path &p );
+     lem::int64_t LoadSuccinct( const lem::Path &p );
      void ForEach( Ngrams *n, const lem::FString &db_suffix, const lem::FString &segment_name, Ngrams::raw *r, NGramHandler *handler );
     };
 
@@ -206,6 +217,8 @@
      lem::uint32_t *marks_n;
      int n_marks;
      Cached5Gram *search_buffer;
+     lem::MappedFile mapped; //  N-,   
+     lem::Ptr<NGramsSuccinctStore> succinct; //    
 
      Cache5(void):n(0),max_freq(0),marks_filepos(NULL),marks_n(NULL),n_marks(0),search_buffer(NULL) {}
      ~Cache5(void);
@@ -215,6 +228,7 @@
      bool empty(void) const { return n==0; }
 
      lem::int64_t LoadBin( const lem::Path &p );
+     lem::int64_t LoadSuccinct( const lem::Path &p );
      void ForEach( Ngrams *n, const lem::FString &db_suffix, const lem::FString &segment_name, Ngrams::raw *r, NGramHandler *handler );
     };
 
@@ -406,6 +420,10 @@
 
     lem::int64_t PreloadCachesFromFiles(void);
 
+    #if defined SOL_CAA
+    lem::int64_t BuildSuccinctStores( Ngrams::raw &pdb, const lem::Path &dest_folder, int q_bits, bool echo );
+    #endif
+
     lem::zbool available;
 
    public:
@@ -669,6 +687,9 @@
     //   N  
     void ForEachRaw( NGramHandler *handler, int order, bool lemmatized, int sorting );
 
+    //   N-    (.ef )
+    lem::int64_t BuildSuccinctStores( const lem::Path &dest_folder, int q_bits, bool echo );
+
     //        N-.
     int GetRawOrder(void) const;
     int GetLiteralOrder(void) const;
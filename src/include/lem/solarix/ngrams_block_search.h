@@ -0,0 +1,55 @@
+#ifndef SOLARIX_NGRAMS_BLOCK_SEARCH__H
+#define SOLARIX_NGRAMS_BLOCK_SEARCH__H
+#pragma once
+
+// CD->16.10.2026
+// LC->16.10.2026
+
+ #include <utility>
+ #include <lem/integer.h>
+
+ namespace Solarix
+ {
+  //  N-   ,   .   ,
+  //          
+  //      .
+  template < class REC, class KEY >
+  inline std::pair<int/*id*/,int/*w*/> ngram_find_in_block( const REC *block, lem::uint32_t n, const KEY &ngram )
+  {
+   if( n==0 )
+    return std::make_pair( -1, -1 );
+
+   if( n<=10 )
+    {
+     for( lem::uint32_t i=0; i<n; ++i )
+      if( block[i].ngram==ngram )
+       return std::make_pair( block[i].id, block[i].w );
+    }
+   else
+    {
+     int i_left=0, i_right=n-1;
+     while( (i_right-i_left)>1 )
+      {
+       int i_mid = (i_right+i_left)/2;
+
+       if( block[i_mid].ngram==ngram )
+        return std::make_pair( block[i_mid].id, block[i_mid].w );
+
+       if( block[i_mid].ngram<ngram )
+        i_right = i_mid;
+       else
+        i_left = i_mid;
+      }
+
+     if( block[i_left].ngram==ngram )
+      return std::make_pair( block[i_left].id, block[i_left].w );
+
+     if( block[i_right].ngram==ngram )
+      return std::make_pair( block[i_right].id, block[i_right].w );
+    }
+
+   return std::make_pair( -1, -1 );
+  }
+ }
+
+#endif
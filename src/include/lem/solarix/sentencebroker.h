@@ -13,6 +13,7 @@
  #include <lem/noncopyable.h>
  #include <lem/ptr_container.h>
  #include <lem/solarix/prefix_tree.h>
+ #include <lem/solarix/CharTrie.h>
  #include <lem/solarix/sg_autom.h>
  #include <lem/solarix/LD_Seeker.h>
 
@@ -108,7 +109,7 @@
   class SegmentingSentenceTokenizer : public SentenceTokenizer
   {
    private:
-    lem::Ptr<Solarix::CharNode> lookup;
+    const Solarix::CharTrie *lookup;
     lem::Ptr<Solarix::LD_Seeker> seeker;
     lem::UFString delimiters;
  
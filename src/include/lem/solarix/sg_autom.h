@@ -240,6 +240,7 @@
  class SG_EntryForm;
  class LanguageUsage;
  struct CharNode;
+ class CharTrie;
  class SG_Entry;
  class SG_DeclensionAutomat;
  struct ExactWordEntryLocator;
@@ -282,6 +283,7 @@
     lem::Process::RWU_Lock cs_prefix_tree;
     #endif    
    Solarix::CharNode* prefix_tree; 
+   Solarix::CharTrie* prefix_trie; 
    #endif
 
    #if defined SOL_LOADTXT && defined SOL_COMPILER
@@ -509,6 +511,7 @@
 
    #if defined SOL_CAA
    const CharNode& GetPrefixTree(void);
+   const CharTrie& GetPrefixTrie(void);
    CharNode* GetPrefixTreeForAllLanguages(void);
    CharNode* GetPrefixTree( const std::set<int>& allowed_langs );
    #endif
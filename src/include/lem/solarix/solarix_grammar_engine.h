@@ -746,6 +746,67 @@ typedef HGREN_RESPACK (SX_STDCALL * sol_SyntaxAnalysis8_Fun)(
                                                              int Language
                                                             );
 
+// **************************************************************************
+// Batch syntax analysis. The sentences are spread over ThreadCount worker
+// threads which share the loaded dictionary (ThreadCount<=0 - use all cores).
+// The worker threads belong to the engine handle and are reused by later
+// calls; concurrent batches on one engine run one after another. Demo
+// builds analyze the batch sequentially.
+// Results[i] receives the result for Sentences[i] or NULL if the analysis
+// of this sentence failed; each pack must be freed by sol_DeleteResPack.
+// Returns the number of successfully analyzed sentences, -1 on error.
+// **************************************************************************
+FAIND_API(int) sol_SyntaxAnalysisBatch(
+                                       HGREN hEngine,
+                                       const wchar_t **Sentences,
+                                       int nSentence,
+                                       int MorphologicalFlags,
+                                       int SyntacticFlags,
+                                       int Constraints,
+                                       int Language,
+                                       int ThreadCount,
+                                       HGREN_RESPACK *Results
+                                      );
+
+FAIND_API(int) sol_SyntaxAnalysisBatch8(
+                                        HGREN hEngine,
+                                        const char **SentencesUtf8,
+                                        int nSentence,
+                                        int MorphologicalFlags,
+                                        int SyntacticFlags,
+                                        int Constraints,
+                                        int Language,
+                                        int ThreadCount,
+                                        HGREN_RESPACK *Results
+                                       );
+
+// Fetches up to MaxSentences sentences from the broker and analyzes them
+// in parallel. Results[0..N-1] get the packs in the order of fetching.
+// Returns N, 0 if the broker is exhausted, -1 on error.
+FAIND_API(int) sol_SyntaxAnalysisBrokerBatch(
+                                             HGREN hEngine,
+                                             HGREN_SBROKER hBroker,
+                                             int MaxSentences,
+                                             int MorphologicalFlags,
+                                             int SyntacticFlags,
+                                             int Constraints,
+                                             int Language,
+                                             int ThreadCount,
+                                             HGREN_RESPACK *Results
+                                            );
+
+typedef int (SX_STDCALL * sol_SyntaxAnalysisBatch8_Fun)(
+                                                        HGREN hEngine,
+                                                        const char **SentencesUtf8,
+                                                        int nSentence,
+                                                        int MorphologicalFlags,
+                                                        int SyntacticFlags,
+                                                        int Constraints,
+                                                        int Language,
+                                                        int ThreadCount,
+                                                        HGREN_RESPACK *Results
+                                                       );
+
 // http://www.solarix.ru/api/ru/sol_DeleteResPack.shtml
 //       
 FAIND_API(void) sol_DeleteResPack( HGREN_RESPACK hPack );
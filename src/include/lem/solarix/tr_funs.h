@@ -12,6 +12,8 @@
   class TrFun_Var : public TrFunCall
   {
    private:
+    friend class TrBytecodeCompiler;
+
     lem::UCString var_name; 
 
    public:
@@ -52,6 +54,8 @@
   class TrFun_Declare : public TrFunCall
   {
    private:
+    friend class TrBytecodeCompiler;
+
     TrType var_type;
     lem::MCollect<lem::UCString> var_name; 
     lem::CloneCollect<TrFunCall> var_value;
@@ -145,6 +149,8 @@
   class TrFun_Assign : public TrFunCall
   {
    private:
+    friend class TrBytecodeCompiler;
+
     lem::UCString var_name;
     lem::ClonePtr<TrFunCall> expr; 
 
@@ -183,6 +189,8 @@
   class TrFun_Group : public TrFunCall
   {
    private:
+    friend class TrBytecodeCompiler;
+
     lem::CloneCollect<TrFunCall> items;
 
    public:
@@ -278,6 +286,8 @@
   class TrFun_Return : public TrFunCall
   {
    private:
+    friend class TrBytecodeCompiler;
+
     lem::Ptr<TrFunCall> expr; 
 
    public:
@@ -317,6 +327,8 @@
   class TrFun_If : public TrFunCall
   {
    private:
+    friend class TrBytecodeCompiler;
+
     lem::ClonePtr<TrFunCall> cond, f_then, f_else;
 
    public:
@@ -362,6 +374,8 @@
   class TrFun_While : public TrFunCall
   {
    private:
+    friend class TrBytecodeCompiler;
+
     lem::Ptr<TrFunCall> cond, body; 
 
    public:
@@ -409,6 +423,8 @@
   class TrFun_For : public TrFunCall
   {
    private:
+    friend class TrBytecodeCompiler;
+
     UCString varname;
     lem::Ptr<TrFunCall> i0, i1, step, body; 
 
@@ -458,6 +474,7 @@
   {
    private:
     friend class TrFunctions;
+    friend class TrBytecodeCompiler;
 
     lem::UCString name;
     lem::CloneCollect<TrFunCall> args;
@@ -409,6 +409,7 @@
   class ElapsedTimeConstraint;
 
   class TrFunctions;
+  class TrBytecode;
   class TrFunCall
   {
    protected:
@@ -479,6 +480,10 @@
 
     lem::Ptr<TrFunCall> body;
 
+    #if defined SOL_CAA && !defined SOL_NO_AA
+    lem::Ptr<TrBytecode> bytecode; // ,   -,  NULL
+    #endif
+
    public:
     TrFunction(void):ret_type(TrVoidType()) {}
     virtual ~TrFunction(void) {}
@@ -608,6 +613,14 @@
                            TrTrace *trace_log
                           );
     #endif
+
+    #if defined SOL_CAA && !defined SOL_NO_AA
+    //     -   . 
+    //         (, ).
+    void CompileBytecode(void);
+    void DropBytecode(void);
+    int CountBytecodeFuns(void) const;
+    #endif
   };
 
 
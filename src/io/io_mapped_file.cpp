@@ -0,0 +1,185 @@
+// -----------------------------------------------------------------------------
+// File IO_MAPPED_FILE.CPP
+//
+// (c) by Koziev Elijah     all rights reserved
+//
+// SOLARIX Intellectronix Project http://www.solarix.ru
+//                                http://sourceforge.net/projects/solarix
+//
+// You must not eliminate, delete or supress these copyright strings
+// from the file!
+//
+// Content:
+//  MappedFile -        ,
+//      .
+// -----------------------------------------------------------------------------
+//
+// CD->16.10.2026
+// LC->16.10.2026
+// --------------
+
+#include <lem/config.h>
+
+#if defined LEM_UNIX
+ #include <sys/types.h>
+ #include <sys/stat.h>
+ #include <sys/mman.h>
+ #include <fcntl.h>
+ #include <unistd.h>
+#endif
+
+#include <lem/conversions.h>
+#include <lem/mapped_file.h>
+
+using namespace lem;
+
+
+MappedFile::MappedFile(void)
+{
+ #if defined LEM_WINDOWS
+ hFile = hFileMap = NULL;
+ #else
+ fd = -1;
+ #endif
+
+ base = NULL;
+ size = 0;
+ return;
+}
+
+
+MappedFile::MappedFile( const lem::Path &filename )
+{
+ #if defined LEM_WINDOWS
+ hFile = hFileMap = NULL;
+ #else
+ fd = -1;
+ #endif
+
+ base = NULL;
+ size = 0;
+ Open(filename);
+ return;
+}
+
+
+MappedFile::~MappedFile(void)
+{
+ Close();
+ return;
+}
+
+
+bool MappedFile::Open( const lem::Path &filename )
+{
+ Close();
+
+ #if defined LEM_WINDOWS
+
+ hFile = CreateFileW(
+                     filename.GetUnicode().c_str(),
+                     GENERIC_READ,
+                     FILE_SHARE_READ,
+                     NULL,
+                     OPEN_EXISTING,
+                     0,
+                     NULL
+                    );
+
+ if( hFile==INVALID_HANDLE_VALUE )
+  {
+   hFile = NULL;
+   return false;
+  }
+
+ LARGE_INTEGER fsize;
+ if( GetFileSizeEx( hFile, &fsize )==0 || fsize.QuadPart==0 )
+  {
+   Close();
+   return false;
+  }
+
+ hFileMap = CreateFileMapping( hFile, NULL, PAGE_READONLY, 0, 0, NULL );
+ if( hFileMap==NULL )
+  {
+   Close();
+   return false;
+  }
+
+ base = (const lem::uint8_t*)MapViewOfFile( hFileMap, FILE_MAP_READ, 0, 0, 0 );
+ if( base==NULL )
+  {
+   Close();
+   return false;
+  }
+
+ size = fsize.QuadPart;
+ return true;
+
+ #elif defined LEM_UNIX
+
+ if( filename.IsAscii() )
+  fd = ::open( filename.GetAscii().c_str(), O_RDONLY );
+ else
+  fd = ::open( lem::to_utf8(filename.GetUnicode()).c_str(), O_RDONLY );
+
+ if( fd==-1 )
+  return false;
+
+ struct stat st;
+ if( fstat( fd, &st )!=0 || st.st_size==0 )
+  {
+   Close();
+   return false;
+  }
+
+ void *p = mmap( NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0 );
+ if( p==MAP_FAILED )
+  {
+   Close();
+   return false;
+  }
+
+ base = (const lem::uint8_t*)p;
+ size = st.st_size;
+ return true;
+
+ #else
+
+ return false;
+
+ #endif
+}
+
+
+void MappedFile::Close(void)
+{
+ #if defined LEM_WINDOWS
+
+ if( base!=NULL )
+  UnmapViewOfFile(base);
+
+ if( hFileMap!=NULL )
+  CloseHandle(hFileMap);
+
+ if( hFile!=NULL )
+  CloseHandle(hFile);
+
+ hFile = hFileMap = NULL;
+
+ #elif defined LEM_UNIX
+
+ if( base!=NULL )
+  munmap( (void*)base, size );
+
+ if( fd!=-1 )
+  ::close(fd);
+
+ fd = -1;
+
+ #endif
+
+ base = NULL;
+ size = 0;
+ return;
+}
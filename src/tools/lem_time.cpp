@@ -715,29 +715,35 @@ const boost::posix_time::ptime lem::to_ptime( const FILETIME &ft )
 
 
 
+// lem::get_time()     ,    .
+static boost::posix_time::ptime get_precise_time(void)
+{
+ return boost::posix_time::microsec_clock::universal_time();
+}
+
 ElapsedTime::ElapsedTime(void)
 {
- t1 = t0 = lem::get_time();
+ t1 = t0 = get_precise_time();
  stopped=false;
  return;
 }
 
 void ElapsedTime::start(void)
 {
- t1 = t0 = lem::get_time();
+ t1 = t0 = get_precise_time();
  stopped=false;
  return;
 }
 
 void ElapsedTime::stop(void)
 {
- t1 = lem::get_time();
+ t1 = get_precise_time();
  stopped=true;
 }
 
 boost::posix_time::ptime ElapsedTime::GetStopTime() const
 {
- return stopped ? t1 : lem::get_time(); 
+ return stopped ? t1 : get_precise_time(); 
 }
 
 